@@ -115,6 +115,14 @@ typedef struct svn_memcache_t svn_memcache_t;
  */
 typedef struct svn_membuffer_t svn_membuffer_t;
 
+/**
+ * An opaque structure representing a persistent, memory-mapped cache file
+ * that may be shared between processes.
+ *
+ * @since New in 1.11.
+ */
+typedef struct svn_cache__disk_t svn_cache__disk_t;
+
 /**
  * Opaque type for an in-memory cache.
  */
@@ -179,6 +187,34 @@ typedef struct svn_cache__info_t
    * highest array index.
    */
   apr_uint64_t histogram[32];
+
+  /** Number of cache segments that contributed to this info.
+   * 0 if the cache is not segmented.
+   */
+  apr_uint64_t segments;
+
+  /** Number of lookups that were served without taking any lock.
+   */
+  apr_uint64_t optimistic_reads;
+
+  /** Number of lock-free lookups that collided with a concurrent write
+   * and had to be repeated with the lock held.
+   */
+  apr_uint64_t optimistic_retries;
+
+  /** Number of times a thread had to wait for a segment lock.
+   * May be 0 if that information is not available.
+   */
+  apr_uint64_t lock_waits;
+
+  /** Total time in microseconds spent waiting for segment locks.
+   */
+  apr_uint64_t lock_wait_time;
+
+  /** Largest value of @a lock_waits for any individual segment.
+   * Much larger than @a lock_waits / @a segments indicates hot spots.
+   */
+  apr_uint64_t max_segment_lock_waits;
 } svn_cache__info_t;
 
 /**
@@ -310,6 +346,62 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
                                   svn_boolean_t allow_blocking_writes,
                                   apr_pool_t *result_pool);
 
+/**
+ * Like svn_cache__membuffer_cache_create() but place the whole cache,
+ * i.e. its data buffers, directories and bookkeeping, into an anonymous
+ * shared memory region.  Every process that gets forked from the current
+ * one after this call will see and update the same cache contents.
+ * Processes that have been started in any other way will not.
+ *
+ * Access to the segments is serialized across processes and threads by
+ * a small set of global mutexes; the cache is always thread-safe.  Forked
+ * processes must call svn_cache__membuffer_child_init() before using the
+ * cache.  If a process dies while modifying a segment, the next user of
+ * that segment will find it in an inconsistent state and clear it.
+ * Because cache key prefix indexes are process-local, cache instances on
+ * top of the result will always store their full keys.
+ *
+ * Return #SVN_ERR_UNSUPPORTED_FEATURE if the platform does not support
+ * shared memory.  Allocations, the shared memory region and the locks will
+ * be created in @a result_pool and get released together with it.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_cache__membuffer_cache_create_shared(svn_membuffer_t **cache,
+                                         apr_size_t total_size,
+                                         apr_size_t directory_size,
+                                         apr_size_t segment_count,
+                                         svn_boolean_t allow_blocking_writes,
+                                         apr_pool_t *result_pool);
+
+/**
+ * Re-initialize the locks of the shared membuffer @a cache for use in the
+ * current process, which has been forked after the cache was created.
+ * Some lock mechanisms require this.  Use @a pool for allocations; it
+ * should live as long as the current process.
+ *
+ * This is a no-op if @a cache is process-local or @c NULL.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_cache__membuffer_child_init(svn_membuffer_t *cache,
+                                apr_pool_t *pool);
+
+/**
+ * Return the global mutexes used by the shared membuffer @a cache as an
+ * array of <tt>apr_global_mutex_t *</tt>, allocated in @a result_pool.
+ * Servers that switch to a different user after creating the cache may
+ * need to adjust their permissions.  The array will be empty if @a cache
+ * is process-local or @c NULL.
+ *
+ * @since New in 1.11.
+ */
+apr_array_header_t *
+svn_cache__membuffer_get_mutexes(svn_membuffer_t *cache,
+                                 apr_pool_t *result_pool);
+
 /**
  * @defgroup Standard priority classes for #svn_cache__create_membuffer_cache.
  * @{
@@ -378,6 +470,57 @@ svn_cache__create_membuffer_cache(svn_cache__t **cache_p,
                                   apr_pool_t *result_pool,
                                   apr_pool_t *scratch_pool);
 
+/**
+ * Set @a *disk to the disk cache stored in the file at @a path.  All
+ * callers within the same process will receive the same instance for the
+ * same file and all processes opening the same file will share its
+ * contents.  If the file does not exist, does not have @a size bytes or
+ * has not been initialized properly, it will be created and reset.  The
+ * same happens if it has been written by a different Subversion version
+ * or a build with a different pointer size, because the serialized items
+ * would not be compatible.  The contents survive process restarts but are
+ * never synced to disk.
+ *
+ * Use @a scratch_pool for temporary allocations.  The disk cache itself
+ * lives until the end of the process.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_cache__get_disk_cache(svn_cache__disk_t **disk,
+                          const char *path,
+                          apr_uint64_t size,
+                          apr_pool_t *scratch_pool);
+
+/**
+ * Creates a new cache in @a *cache_p that uses @a l1 as its first level
+ * and @a disk as a persistent second level.  Lookups that miss @a l1 fall
+ * back to @a disk and hits will be promoted to @a l1.  All items written
+ * to the cache get stored in both levels, except for items with string
+ * keys longer than 1kB, which are only stored in @a l1.
+ *
+ * @a serialize_func, @a deserialize_func and @a klen must be the same as
+ * used for @a l1, with the same conventions for NULL as in
+ * svn_cache__create_membuffer_cache().  Because many caches may share the
+ * same @a disk, @a prefix should be specified to differentiate this cache
+ * from other caches.  It should not depend on the process instance, or
+ * else the data won't be found after a restart.
+ *
+ * @a *cache_p will be allocated in @a result_pool.  These caches do not
+ * support svn_cache__iter.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_cache__create_disk_backed(svn_cache__t **cache_p,
+                              svn_cache__t *l1,
+                              svn_cache__disk_t *disk,
+                              svn_cache__serialize_func_t serialize_func,
+                              svn_cache__deserialize_func_t deserialize_func,
+                              apr_ssize_t klen,
+                              const char *prefix,
+                              apr_pool_t *result_pool);
+
 /**
  * Creates a null-cache instance in @a *cache_p, allocated from
  * @a result_pool.  The given @c id is the only data stored in it and can
@@ -554,6 +697,47 @@ svn_cache__format_info(const svn_cache__info_t *info,
 struct svn_membuffer_t *
 svn_cache__get_global_membuffer_cache(void);
 
+/**
+ * Request @a segment_count segments for the process-global membuffer
+ * cache.  See svn_cache__membuffer_cache_create() for how that number
+ * will be adjusted.  0 selects a default based on the cache size.
+ *
+ * More segments reduce lock contention between threads.  Use the lock
+ * statistics returned by svn_cache__membuffer_get_global_info() to tune
+ * this value.
+ *
+ * Like svn_cache_config_set(), this is not thread-safe and has no effect
+ * once the global cache has been created.
+ *
+ * @since New in 1.11.
+ */
+void
+svn_cache__set_global_membuffer_segment_count(apr_size_t segment_count);
+
+/**
+ * Allocate the process-global membuffer cache in shared memory using
+ * svn_cache__membuffer_cache_create_shared() and the current cache
+ * configuration.  Pre-forking servers should call this before forking
+ * their workers, so that all of them use the same cache.  The workers
+ * must then call svn_cache__membuffer_child_init() on the result of
+ * svn_cache__get_global_membuffer_cache().
+ *
+ * The cache will live in @a pool.  Once @a pool gets cleared, the next
+ * call to this function will create a new shared cache.  All users of
+ * the old one must be gone by then.
+ *
+ * If the shared cache can't be created, return the error and leave the
+ * global cache alone.  It will then be created as a process-local cache
+ * on first use, as usual.
+ *
+ * Like svn_cache_config_set(), this is not thread-safe.  Call it before
+ * using the global cache for the first time.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_cache__create_global_membuffer_shared(apr_pool_t *pool);
+
 /**
  * Return total access and size stats over all membuffer caches as they
  * share the underlying data buffer.  The result will be allocated in POOL.
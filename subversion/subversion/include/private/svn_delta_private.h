@@ -108,6 +108,16 @@ svn_txdelta__read_raw_window_len(apr_size_t *window_len,
                                  svn_stream_t *stream,
                                  apr_pool_t *pool);
 
+/* Allow (ENABLED is TRUE, the default) or forbid the SSE2 code paths
+ * used by the xdelta algorithm when computing text deltas, including those
+ * enabled by svn_cstring__set_simd_enabled.  This is a no-op on builds
+ * without SSE2 support.
+ *
+ * For testing only.  This is not thread-safe.
+ */
+void
+svn_txdelta__set_simd_enabled(svn_boolean_t enabled);
+
 /* Return a debug editor that wraps @a wrapped_editor.
  *
  * The debug editor simply prints an indication of what callbacks are being
@@ -95,6 +95,24 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * Indicate whether the target CPU supports SSE2 such that the intrinsics
+ * from emmintrin.h may be used unconditionally.  This is true for all
+ * x86-64 and most modern x86 builds.  Define SVN_DISABLE_SSE2 to force
+ * the portable code paths.
+ *
+ * @since New in 1.11.
+ */
+#ifndef SVN_HAVE_SSE2
+#if    !defined(SVN_DISABLE_SSE2) \
+    && (   defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+        || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define SVN_HAVE_SSE2 1
+#else
+#  define SVN_HAVE_SSE2 0
+#endif
+#endif
+
 /**
  * APR keeps a few interesting defines hidden away in its private
  * headers apr_arch_file_io.h, so we redefined them here.
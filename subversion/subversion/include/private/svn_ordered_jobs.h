@@ -0,0 +1,147 @@
+/**
+ * @copyright
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ * @endcopyright
+ *
+ * @file svn_ordered_jobs.h
+ * @brief Process a range of items on worker threads, in order
+ */
+
+#ifndef SVN_ORDERED_JOBS_H
+#define SVN_ORDERED_JOBS_H
+
+#include <apr.h>
+#include <apr_pools.h>
+
+#include "svn_types.h"
+#include "svn_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if APR_HAS_THREADS
+
+/**
+ * Infrastructure for processing a range of items, e.g. revisions or
+ * shards, concurrently while consuming the results strictly in order.
+ *
+ * A fixed number of worker threads claim the items in ascending order
+ * and store the outcome of each in a result slot.  The calling thread
+ * takes the results one by one, in item order, and releases each slot
+ * when done with it.  Workers never get more than a given number of
+ * items ahead of the calling thread, which bounds the amount of buffered
+ * results.
+ *
+ * Every worker has a private, thread-safe root pool and a baton of its
+ * own, e.g. a separate FS instance.  The worker functions get a cancel
+ * function that fails once the jobs are being stopped.
+ */
+
+/** Opaque state of a set of ordered jobs.
+ */
+typedef struct svn_ordered_jobs__t svn_ordered_jobs__t;
+
+/** Set up a worker thread.  Set @a *worker_baton to the data to pass to
+ * every call of the #svn_ordered_jobs__run_func_t for this worker,
+ * allocated in @a worker_pool.  @a baton is the one given to
+ * svn_ordered_jobs__start().
+ *
+ * This is called on the thread calling svn_ordered_jobs__start(), before
+ * any worker starts.  Use @a scratch_pool for temporary allocations.
+ */
+typedef svn_error_t *
+(*svn_ordered_jobs__init_func_t)(void **worker_baton,
+                                 void *baton,
+                                 apr_pool_t *worker_pool,
+                                 apr_pool_t *scratch_pool);
+
+/** Process @a item on a worker thread.  Set @a *result to the outcome,
+ * allocated in @a result_pool, which is a thread-safe root pool that the
+ * worker owns until this function returns.  @a baton is the one given to
+ * svn_ordered_jobs__start(), @a worker_baton the one set up for this
+ * thread.
+ *
+ * Check @a cancel_func with @a cancel_baton regularly.  Use
+ * @a scratch_pool for temporary allocations.
+ */
+typedef svn_error_t *
+(*svn_ordered_jobs__run_func_t)(void **result,
+                                void *baton,
+                                void *worker_baton,
+                                apr_int64_t item,
+                                svn_cancel_func_t cancel_func,
+                                void *cancel_baton,
+                                apr_pool_t *result_pool,
+                                apr_pool_t *scratch_pool);
+
+/** Start up to @a threads worker threads calling @a run_func with
+ * @a baton for the items @a first_item up to but not including
+ * @a end_item, and return their state in @a *jobs_p.  Call @a init_func,
+ * if not NULL, once for each worker before starting it.  Workers will not
+ * start on an item that is @a window or more items ahead of the next one
+ * to be taken by svn_ordered_jobs__next().
+ *
+ * The workers get stopped by svn_ordered_jobs__stop() or, at the latest,
+ * when @a result_pool gets cleaned up.  Use @a scratch_pool for temporary
+ * allocations.
+ */
+svn_error_t *
+svn_ordered_jobs__start(svn_ordered_jobs__t **jobs_p,
+                        apr_int64_t first_item,
+                        apr_int64_t end_item,
+                        int threads,
+                        int window,
+                        svn_ordered_jobs__init_func_t init_func,
+                        svn_ordered_jobs__run_func_t run_func,
+                        void *baton,
+                        apr_pool_t *result_pool,
+                        apr_pool_t *scratch_pool);
+
+/** Wait for the next item in @a jobs to be processed and set @a *result
+ * to its outcome.  Return the error returned by the run function for it.
+ *
+ * @a *result remains valid until svn_ordered_jobs__release() gets called,
+ * which must happen before the next call to this function.
+ */
+svn_error_t *
+svn_ordered_jobs__next(void **result,
+                       svn_ordered_jobs__t *jobs);
+
+/** Free the result of the item last returned by svn_ordered_jobs__next()
+ * for @a jobs and let the workers move on.
+ */
+void
+svn_ordered_jobs__release(svn_ordered_jobs__t *jobs);
+
+/** Tell all workers of @a jobs to stop as soon as possible, wait for them
+ * to finish and release all resources held by them and by results not
+ * taken yet.  Further calls are no-ops.
+ */
+void
+svn_ordered_jobs__stop(svn_ordered_jobs__t *jobs);
+
+#endif /* APR_HAS_THREADS */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SVN_ORDERED_JOBS_H */
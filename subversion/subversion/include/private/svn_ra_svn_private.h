@@ -169,6 +169,22 @@ svn_ra_svn__write_string(svn_ra_svn_conn_t *conn,
                          apr_pool_t *pool,
                          const svn_string_t *str);
 
+/** Write @a length bytes starting at @a offset in @a file over the net,
+ * as a sequence of strings.  If the connection writes directly to a
+ * socket, transfer the data with sendfile() and don't copy it through
+ * our buffers.
+ *
+ * Other writes will be buffered until the next read or flush.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_ra_svn__write_file_strings(svn_ra_svn_conn_t *conn,
+                               apr_pool_t *pool,
+                               apr_file_t *file,
+                               apr_off_t offset,
+                               svn_filesize_t length);
+
 /** Write a cstring over the net.
  *
  * Writes will be buffered until the next read or flush.
@@ -353,6 +369,21 @@ svn_ra_svn__read_cmd_response(svn_ra_svn_conn_t *conn,
                               apr_pool_t *pool,
                               const char *fmt, ...);
 
+/** Enable windowed edit pipelining on @a conn if @a enable is set and
+ * disable it otherwise.  Enable it only if both sides announced the
+ * #SVN_RA_SVN_CAP_EDIT_WINDOW capability and only for the duration of
+ * an edit driven by the client.
+ *
+ * While enabled, the editor returned by svn_ra_svn_get_editor() sends
+ * commands without waiting for the receiver but never has more than a
+ * fixed amount of data unacknowledged.  It picks up acknowledgements and
+ * errors reported by the receiver along the way.  On the receiving side,
+ * svn_ra_svn_drive_editor2() sends those acknowledgements.
+ */
+void
+svn_ra_svn__enable_edit_window(svn_ra_svn_conn_t *conn,
+                               svn_boolean_t enable);
+
 /** Check the receive buffer and socket of @a conn whether there is some
  * unprocessed incoming data without waiting for new data to come in.
  * If data is found, set @a *has_command to TRUE.  If the connection does
@@ -365,6 +396,18 @@ svn_ra_svn__has_command(svn_boolean_t *has_command,
                         svn_ra_svn_conn_t *conn,
                         apr_pool_t *pool);
 
+/** Set @a *terminated to TRUE if the other side of @a conn has closed the
+ * connection and to FALSE otherwise, without waiting for new data to come
+ * in.  Unlike svn_ra_svn__has_command(), this neither flushes the write
+ * buffer nor resets the I/O counters of the current command, so it may be
+ * called in the middle of one.  Any data received gets buffered for later
+ * reading.  @a pool is used for temporary allocations.
+ */
+svn_error_t *
+svn_ra_svn__check_terminated(svn_boolean_t *terminated,
+                             svn_ra_svn_conn_t *conn,
+                             apr_pool_t *pool);
+
 /** Accept a single command from @a conn and handle them according
  * to @a cmd_hash.  Command handlers will be passed @a conn, @a pool,
  * the parameters of the command, and @a baton.  @a *terminate will be
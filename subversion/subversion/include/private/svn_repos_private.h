@@ -349,6 +349,24 @@ svn_repos__dump_node_record(svn_stream_t *dump_stream,
                             svn_boolean_t content_length_always,
                             apr_pool_t *scratch_pool);
 
+/* (Re-)build the changed-paths log index of REPOS from scratch, creating
+ * it if it does not exist yet.  Once the index exists, commits made
+ * through svn_repos_fs_commit_txn() will keep it up-to-date and
+ * svn_repos_get_logs5() will use it to quickly find the revisions that
+ * touched a given path.
+ *
+ * Set *INDEXED_REV to the youngest revision covered by the new index.
+ *
+ * CANCEL_FUNC and CANCEL_BATON will be used to check for cancellation.
+ * Use SCRATCH_POOL for temporaries.
+ */
+svn_error_t *
+svn_repos__log_index_build(svn_revnum_t *indexed_rev,
+                           svn_repos_t *repos,
+                           svn_cancel_func_t cancel_func,
+                           void *cancel_baton,
+                           apr_pool_t *scratch_pool);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
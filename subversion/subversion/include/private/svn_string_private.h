@@ -272,6 +272,15 @@ svn_cstring__reverse_match_length(const char *a,
                                   const char *b,
                                   apr_size_t max_len);
 
+/* Allow (ENABLED is TRUE, the default) or forbid the SSE2 code paths in
+ * svn_cstring__match_length and svn_cstring__reverse_match_length.
+ * This is a no-op on builds without SSE2 support.
+ *
+ * For testing only.  This is not thread-safe.
+ */
+void
+svn_cstring__set_simd_enabled(svn_boolean_t enabled);
+
 /** @} */
 
 /** Prefix trees.
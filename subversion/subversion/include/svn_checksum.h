@@ -58,7 +58,13 @@ typedef enum svn_checksum_kind_t
   /** The checksum is (or should be set to) a modified FNV-1a 32 bit,
    * in big endian byte order.
    * @since New in 1.9. */
-  svn_checksum_fnv1a_32x4
+  svn_checksum_fnv1a_32x4,
+
+  /** The checksum is (or should be set to) a modified FNV-1a 64 bit,
+   * in big endian byte order.  This is a fast, non-cryptographic
+   * checksum suitable for detecting accidental data corruption.
+   * @since New in 1.11. */
+  svn_checksum_fnv1a_64x4
 } svn_checksum_kind_t;
 
 /**
@@ -2894,6 +2894,12 @@ svn_client_log(const apr_array_header_t *targets,
  * If @a include_merged_revisions is TRUE, also return data based upon
  * revisions which have been merged to @a path_or_url.
  *
+ * If the server supports #SVN_RA_CAPABILITY_FILE_BLAME, @a start is not
+ * younger than @a end and @a include_merged_revisions is FALSE, let the
+ * server calculate the blame, unless the #SVN_CONFIG_OPTION_SERVER_BLAME
+ * option in @a ctx->config is set to "no".  No
+ * #svn_wc_notify_blame_revision notifications are sent in that case.
+ *
  * Use @a pool for any temporary allocation.
  *
  * @since New in 1.7.
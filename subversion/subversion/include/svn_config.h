@@ -161,6 +161,8 @@ typedef struct svn_config_t svn_config_t;
 #define SVN_CONFIG_OPTION_MEMORY_CACHE_SIZE         "memory-cache-size"
 /** @since New in 1.9. */
 #define SVN_CONFIG_OPTION_DIFF_IGNORE_CONTENT_TYPE  "diff-ignore-content-type"
+/** @since New in 1.11. */
+#define SVN_CONFIG_OPTION_SERVER_BLAME              "server-blame"
 #define SVN_CONFIG_SECTION_TUNNELS              "tunnels"
 #define SVN_CONFIG_SECTION_AUTO_PROPS           "auto-props"
 /** @since New in 1.8. */
@@ -171,6 +173,12 @@ typedef struct svn_config_t svn_config_t;
 #define SVN_CONFIG_OPTION_SQLITE_EXCLUSIVE_CLIENTS  "exclusive-locking-clients"
 /** @since New in 1.9. */
 #define SVN_CONFIG_OPTION_SQLITE_BUSY_TIMEOUT       "busy-timeout"
+/** @since New in 1.11. */
+#define SVN_CONFIG_OPTION_STATUS_THREADS            "status-threads"
+/** @since New in 1.11. */
+#define SVN_CONFIG_OPTION_STATUS_JOURNAL            "status-journal"
+/** @since New in 1.11. */
+#define SVN_CONFIG_OPTION_INSTALL_THREADS           "install-threads"
 /** @} */
 
 /** @name Repository conf directory configuration files strings
@@ -191,6 +199,8 @@ typedef struct svn_config_t svn_config_t;
 #define SVN_CONFIG_OPTION_FORCE_USERNAME_CASE       "force-username-case"
 /** @since New in 1.8. */
 #define SVN_CONFIG_OPTION_HOOKS_ENV                 "hooks-env"
+/** @since New in 1.11. */
+#define SVN_CONFIG_OPTION_FILE_BLAME                "file-blame"
 /** @since New in 1.5. */
 #define SVN_CONFIG_SECTION_SASL                 "sasl"
 /** @since New in 1.5. */
@@ -422,6 +422,25 @@ extern "C" {
 #define SVN_DAV_NS_DAV_SVN_PUT_RESULT_CHECKSUM\
             SVN_DAV_PROP_NS_DAV "svn/put-result-checksum"
 
+/** Presence of this in a DAV header in an OPTIONS response indicates
+ * that the transmitter (in this case, the server) knows how to handle
+ * 'fetch-files' reports, which deliver the contents of many files in
+ * a single response.
+ *
+ * @since New in 1.11.
+ */
+#define SVN_DAV_NS_DAV_SVN_FETCH_FILES\
+            SVN_DAV_PROP_NS_DAV "svn/fetch-files"
+
+/** Presence of this in a DAV header in an OPTIONS response indicates
+ * that the transmitter (in this case, the server) knows how to handle
+ * 'file-blame' reports, which calculate blame information on the server.
+ *
+ * @since New in 1.11.
+ */
+#define SVN_DAV_NS_DAV_SVN_FILE_BLAME\
+            SVN_DAV_PROP_NS_DAV "svn/file-blame"
+
 /** @} */
 
 /** @} */
@@ -1440,6 +1440,34 @@ svn_compat_wrap_file_rev_handler(svn_file_rev_handler_t *handler2,
                                  void *handler_baton,
                                  apr_pool_t *pool);
 
+/**
+ * The callback invoked by server-side blame implementations, such as
+ * svn_ra_get_file_blame() and svn_repos_get_file_blame(), for each range
+ * of consecutive lines of a file that were last changed in the same
+ * revision.
+ *
+ * The range covers the @a line_count lines starting at the zero-based
+ * line @a line_start.  Ranges are reported in file order and together
+ * they cover the whole file.
+ *
+ * @a revision is the revision that last changed these lines, or
+ * #SVN_INVALID_REVNUM if the lines are older than the blamed revision
+ * range.  The first range reported for each valid @a revision carries
+ * the revision properties of @a revision in @a rev_props; for all other
+ * ranges, @a rev_props is @c NULL.
+ *
+ * @a pool may be used for temporary allocations.
+ *
+ * @since New in 1.11.
+ */
+typedef svn_error_t *(*svn_file_blame_receiver_t)(
+  void *baton,
+  apr_int64_t line_start,
+  apr_int64_t line_count,
+  svn_revnum_t revision,
+  apr_hash_t *rev_props,
+  apr_pool_t *pool);
+
 /** @} end group: delta_support */
 
 
@@ -455,6 +455,29 @@ typedef enum svn_diff_file_ignore_space_t
   svn_diff_file_ignore_space_all
 } svn_diff_file_ignore_space_t;
 
+/** The algorithm used to find the differences between files.
+ *
+ * @since New in 1.11.
+ */
+typedef enum svn_diff_file_algorithm_t
+{
+  /** The O(NP) algorithm by Wu, Manber and Myers.  This is the fastest
+   * algorithm for files with few differences. */
+  svn_diff_file_algorithm_myers,
+
+  /** Myers' divide-and-conquer algorithm, which finds the same minimal
+   * differences as @c svn_diff_file_algorithm_myers but only needs
+   * memory linear in the size of the files. */
+  svn_diff_file_algorithm_myers_linear,
+
+  /** Histogram diff, which matches up lines that are rare in both files
+   * first.  It is much faster on files with many differences and tends
+   * to produce more readable diffs, which may not be minimal.  Regions
+   * without rare lines are handled by
+   * @c svn_diff_file_algorithm_myers_linear. */
+  svn_diff_file_algorithm_histogram
+} svn_diff_file_algorithm_t;
+
 /** Options to control the behaviour of the file diff routines.
  *
  * @since New in 1.4.
@@ -487,6 +510,12 @@ typedef struct svn_diff_file_options_t
    *
    * @since New in 1.9 */
   int context_size;
+
+  /** The algorithm used to compare the files.  The default is
+   * @c svn_diff_file_algorithm_myers.
+   *
+   * @since New in 1.11 */
+  svn_diff_file_algorithm_t algorithm;
 } svn_diff_file_options_t;
 
 /** Allocate a @c svn_diff_file_options_t structure in @a pool, initializing
@@ -510,6 +539,8 @@ svn_diff_file_options_create(apr_pool_t *pool);
  * - --ignore-eol-style
  * - --show-c-function, -p @since New in 1.5.
  * - --context, -U ARG @since New in 1.9.
+ * - --diff-algorithm ARG, where ARG is one of "myers", "myers-linear"
+ *   and "histogram" @since New in 1.11.
  * - --unified, -u (for compatibility, does nothing).
  */
 svn_error_t *
@@ -166,6 +166,25 @@ typedef struct svn_fs_t svn_fs_t;
  */
 #define SVN_FS_CONFIG_FSFS_LOG_ADDRESSING       "fsfs-log-addressing"
 
+/** String with a decimal representation of the maximum number of worker
+ * threads that FSFS may use for long-running maintenance operations.
+ * Values less than 2 (the default) disable concurrent processing.
+ *
+ * Values greater than #SVN_FS_CONFIG_FSFS_JOBS_MAX are rejected.
+ *
+ * This option is currently honored by svn_fs_pack2() and svn_fs_verify()
+ * and will be ignored if APR has been built without thread support.
+ *
+ * @since New in 1.11.
+ */
+#define SVN_FS_CONFIG_FSFS_JOBS                 "fsfs-jobs"
+
+/** The largest value accepted for #SVN_FS_CONFIG_FSFS_JOBS.
+ *
+ * @since New in 1.11.
+ */
+#define SVN_FS_CONFIG_FSFS_JOBS_MAX             256
+
 /* Note to maintainers: if you add further SVN_FS_CONFIG_FSFS_CACHE_* knobs,
    update fs_fs.c:verify_as_revision_before_current_plus_plus(). */
 
@@ -2540,6 +2559,30 @@ svn_fs_try_process_file_contents(svn_boolean_t *success,
                                  void* baton,
                                  apr_pool_t *pool);
 
+/** Find the contents of the file @a path in @a root in the repository's
+ * storage files.  If they are stored verbatim, i.e. neither deltified nor
+ * compressed, as a contiguous range of bytes, set @a *file to an open,
+ * read-only handle of the file containing them, @a *offset to their start
+ * within that file and @a *length to their size.  Otherwise, set @a *file
+ * to @c NULL.  Allocate @a *file in @a result_pool and use @a scratch_pool
+ * for temporary allocations.
+ *
+ * This function is intended to support zero-copy transfers of file
+ * contents, e.g. via sendfile().  It may not be implemented by all
+ * backends.  The contents are not verified against their checksum.  The
+ * caller must not modify @a *file.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_fs_file_contents_location(apr_file_t **file,
+                              apr_off_t *offset,
+                              svn_filesize_t *length,
+                              svn_fs_root_t *root,
+                              const char *path,
+                              apr_pool_t *result_pool,
+                              apr_pool_t *scratch_pool);
+
 /** Create a new file named @a path in @a root.  The file's initial contents
  * are the empty string, and it has no properties.  @a root must be the
  * root of a transaction, not a revision.
@@ -3301,11 +3344,33 @@ typedef svn_error_t *(*svn_fs_pack_notify_t)(void *baton,
                                              apr_pool_t *pool);
 
 /**
- * Possibly update the filesystem located in the directory @a path
- * to use disk space more efficiently.
+ * Possibly update the filesystem located in the directory @a db_path
+ * to use disk space more efficiently.  Use the backend-specific
+ * configuration @a fs_config when opening the filesystem.  @a NULL is
+ * valid for all backends.  Use @a scratch_pool for temporary allocations.
+ *
+ * Backends may process multiple shards concurrently if @a fs_config
+ * asks for it, e.g. through #SVN_FS_CONFIG_FSFS_JOBS.  @a notify_func
+ * will still be called from the calling thread only and in shard order.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_fs_pack2(const char *db_path,
+             apr_hash_t *fs_config,
+             svn_fs_pack_notify_t notify_func,
+             void *notify_baton,
+             svn_cancel_func_t cancel_func,
+             void *cancel_baton,
+             apr_pool_t *scratch_pool);
+
+/**
+ * Similar to svn_fs_pack2(), but with @a fs_config always being @c NULL.
  *
  * @since New in 1.6.
+ * @deprecated Provided for backward compatibility with the 1.10 API.
  */
+SVN_DEPRECATED
 svn_error_t *
 svn_fs_pack(const char *db_path,
             svn_fs_pack_notify_t notify_func,
@@ -3341,6 +3406,10 @@ svn_fs_pack(const char *db_path,
  * The optional @a cancel_func callback will be invoked as usual to allow
  * the user to preempt this potentially lengthy operation.
  *
+ * Backends may check multiple sections of the revision range concurrently
+ * if @a fs_config allows for it (see #SVN_FS_CONFIG_FSFS_JOBS).  Both
+ * callbacks will still only be invoked from the calling thread.
+ *
  * @note You probably don't want to use this directly.  Take a look at
  * svn_repos_verify_fs2() instead, which does non-backend-specific
  * verifications as well.
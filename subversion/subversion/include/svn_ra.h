@@ -1872,6 +1872,45 @@ svn_ra_get_file_revs2(svn_ra_session_t *session,
                       void *handler_baton,
                       apr_pool_t *pool);
 
+/**
+ * Calculate on the server which revision last changed each line of the
+ * file @a path, as seen in revision @a end, and invoke @a receiver with
+ * @a receiver_baton for each range of lines that were last changed in
+ * the same revision.  @a session is an open RA session.
+ *
+ * Only changes made in @a start or later are attributed to a revision;
+ * lines that already existed before @a start are reported with
+ * #SVN_INVALID_REVNUM.  @a start must not be greater than @a end.
+ * Merged revisions are not taken into account.
+ *
+ * @a diff_options is an array of <tt>const char *</tt> options for
+ * comparing the revisions of the file, as accepted by
+ * svn_diff_file_options_parse().  It may be @c NULL.
+ *
+ * The result is what svn_ra_get_file_revs2() and a line diff between
+ * each pair of subsequent revisions would give, but the contents of the
+ * revisions don't have to be transmitted.
+ *
+ * Use @a scratch_pool for temporary allocations.
+ *
+ * If the server doesn't implement it, an #SVN_ERR_UNSUPPORTED_FEATURE
+ * error is returned; check #SVN_RA_CAPABILITY_FILE_BLAME first to
+ * avoid it.  Local repositories always support it, but don't advertise
+ * the capability: there, calculating the blame in the repository layer
+ * saves nothing over calculating it in the client.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_ra_get_file_blame(svn_ra_session_t *session,
+                      const char *path,
+                      svn_revnum_t start,
+                      svn_revnum_t end,
+                      const apr_array_header_t *diff_options,
+                      svn_file_blame_receiver_t receiver,
+                      void *receiver_baton,
+                      apr_pool_t *scratch_pool);
+
 /**
  * Similar to svn_ra_get_file_revs2(), but with @a include_merged_revisions
  * set to FALSE.
@@ -2239,6 +2278,14 @@ svn_ra_has_capability(svn_ra_session_t *session,
  */
 #define SVN_RA_CAPABILITY_LIST "list"
 
+/**
+ * The capability of a server to calculate blame information itself,
+ * see svn_ra_get_file_blame().
+ *
+ * @since New in 1.11.
+ */
+#define SVN_RA_CAPABILITY_FILE_BLAME "file-blame"
+
 
 /*       *** PLEASE READ THIS IF YOU ADD A NEW CAPABILITY ***
  *
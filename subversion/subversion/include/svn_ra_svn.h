@@ -71,6 +71,11 @@ extern "C" {
 #define SVN_RA_SVN_CAP_GET_FILE_REVS_REVERSE "file-revs-reverse"
 /* maps to SVN_RA_CAPABILITY_LIST */
 #define SVN_RA_SVN_CAP_LIST "list"
+/* maps to SVN_RA_CAPABILITY_FILE_BLAME */
+#define SVN_RA_SVN_CAP_FILE_BLAME "file-blame"
+/** Editor commands sent by the client may be acknowledged in chunks,
+ * see svn_ra_svn__enable_edit_window().  @since New in 1.11. */
+#define SVN_RA_SVN_CAP_EDIT_WINDOW "edit-window"
 
 
 /** ra_svn passes @c svn_dirent_t fields over the wire as a list of
@@ -730,6 +730,10 @@ svn_repos_hotcopy(const char *src_path,
  * Possibly update the repository, @a repos, to use a more efficient
  * filesystem representation.  Use @a pool for allocations.
  *
+ * @note As of 1.11, the filesystem configuration that @a repos has been
+ * opened with will be used for packing as well.  That allows e.g. for
+ * setting #SVN_FS_CONFIG_FSFS_JOBS.
+ *
  * @since New in 1.7.
  */
 svn_error_t *
@@ -1054,6 +1058,13 @@ svn_repos_hooks_setenv(svn_repos_t *repos,
  * any FSFS data structures (and, hence, caches).  So, it is basically
  * safe for networked editors only.
  *
+ * If @a prefetch_jobs is larger than 1, up to that many worker threads,
+ * each with its own filesystem instance, will compute the text deltas
+ * for upcoming files while @a editor is being driven.  The editor drive
+ * itself still happens in the calling thread and in the usual order.
+ * This requires the process-wide caches to be thread-safe (see
+ * #svn_cache_config_t) and is silently disabled otherwise.
+ *
  * All allocation for the context and collected state will occur in
  * @a pool.
  *
@@ -1086,8 +1097,35 @@ svn_repos_hooks_setenv(svn_repos_t *repos,
  * than or equal to the depth of the working copy, then the editor
  * operations will affect only paths at or above @a depth.
  *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_repos_begin_report4(void **report_baton,
+                        svn_revnum_t revnum,
+                        svn_repos_t *repos,
+                        const char *fs_base,
+                        const char *target,
+                        const char *tgt_path,
+                        svn_boolean_t text_deltas,
+                        svn_depth_t depth,
+                        svn_boolean_t ignore_ancestry,
+                        svn_boolean_t send_copyfrom_args,
+                        const svn_delta_editor_t *editor,
+                        void *edit_baton,
+                        svn_repos_authz_func_t authz_read_func,
+                        void *authz_read_baton,
+                        apr_size_t zero_copy_limit,
+                        int prefetch_jobs,
+                        apr_pool_t *pool);
+
+/**
+ * The same as svn_repos_begin_report4(), but with @a prefetch_jobs
+ * always passed as 1.
+ *
  * @since New in 1.8.
+ * @deprecated Provided for backward compatibility with the 1.10 API.
  */
+SVN_DEPRECATED
 svn_error_t *
 svn_repos_begin_report3(void **report_baton,
                         svn_revnum_t revnum,
@@ -1164,7 +1202,7 @@ svn_repos_begin_report(void **report_baton,
 
 
 /**
- * Given a @a report_baton constructed by svn_repos_begin_report3(),
+ * Given a @a report_baton constructed by svn_repos_begin_report4(),
  * record the presence of @a path, at @a revision with depth @a depth,
  * in the current tree.
  *
@@ -1235,7 +1273,7 @@ svn_repos_set_path(void *report_baton,
                    apr_pool_t *pool);
 
 /**
- * Given a @a report_baton constructed by svn_repos_begin_report3(),
+ * Given a @a report_baton constructed by svn_repos_begin_report4(),
  * record the presence of @a path in the current tree, containing the contents
  * of @a link_path at @a revision with depth @a depth.
  *
@@ -1301,7 +1339,7 @@ svn_repos_link_path(void *report_baton,
                     svn_boolean_t start_empty,
                     apr_pool_t *pool);
 
-/** Given a @a report_baton constructed by svn_repos_begin_report3(),
+/** Given a @a report_baton constructed by svn_repos_begin_report4(),
  * record the non-existence of @a path in the current tree.
  *
  * @a path may not be underneath a path on which svn_repos_set_path3()
@@ -1317,7 +1355,7 @@ svn_repos_delete_path(void *report_baton,
                       const char *path,
                       apr_pool_t *pool);
 
-/** Given a @a report_baton constructed by svn_repos_begin_report3(),
+/** Given a @a report_baton constructed by svn_repos_begin_report4(),
  * finish the report and drive the editor as specified when the report
  * baton was constructed.
  *
@@ -1334,7 +1372,7 @@ svn_repos_finish_report(void *report_baton,
                         apr_pool_t *pool);
 
 
-/** Given a @a report_baton constructed by svn_repos_begin_report3(),
+/** Given a @a report_baton constructed by svn_repos_begin_report4(),
  * abort the report.  This function can be called anytime before
  * svn_repos_finish_report() is called.
  *
@@ -2457,6 +2495,46 @@ svn_repos_get_file_revs(svn_repos_t *repos,
                         void *handler_baton,
                         apr_pool_t *pool);
 
+/**
+ * Calculate which revision last changed each line of the file @a path
+ * in @a repos, as seen in revision @a end, and report the result as
+ * ranges of lines to @a receiver with @a receiver_baton.
+ *
+ * Only changes made in @a start or later are attributed to a revision;
+ * lines that already existed before @a start are reported with
+ * #SVN_INVALID_REVNUM.  @a start must not be greater than @a end.
+ *
+ * The history of @a path is retrieved as with svn_repos_get_file_revs2(),
+ * without merged revisions, and @a authz_read_func and @a
+ * authz_read_baton are used in the same way.  Consecutive revisions of
+ * the file are compared with svn_diff_file_diff_2(), using the options
+ * in @a diff_options, an array of <tt>const char *</tt> as accepted by
+ * svn_diff_file_options_parse().  @a diff_options may be @c NULL.
+ *
+ * This is the same calculation that svn_client_blame5() performs on the
+ * client, but only the resulting line ranges have to be transmitted.
+ *
+ * If @a cancel_func is not @c NULL, call it with @a cancel_baton to check
+ * whether the operation has been cancelled.
+ *
+ * Use @a scratch_pool for temporary allocations.
+ *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_repos_get_file_blame(svn_repos_t *repos,
+                         const char *path,
+                         svn_revnum_t start,
+                         svn_revnum_t end,
+                         const apr_array_header_t *diff_options,
+                         svn_repos_authz_func_t authz_read_func,
+                         void *authz_read_baton,
+                         svn_file_blame_receiver_t receiver,
+                         void *receiver_baton,
+                         svn_cancel_func_t cancel_func,
+                         void *cancel_baton,
+                         apr_pool_t *scratch_pool);
+
 
 /* ---------------------------------------------------------------*/
 
@@ -3131,10 +3209,10 @@ enum svn_repos_load_uuid
   svn_repos_load_uuid_force
 };
 
-/** Callback type for use with svn_repos_verify_fs3().  @a revision
+/** Callback type for use with svn_repos_verify_fs4().  @a revision
  * and @a verify_err are the details of a single verification failure
- * that occurred during the svn_repos_verify_fs3() call.  @a baton is
- * the same baton given to svn_repos_verify_fs3().  @a scratch_pool is
+ * that occurred during the svn_repos_verify_fs4() call.  @a baton is
+ * the same baton given to svn_repos_verify_fs4().  @a scratch_pool is
  * provided for the convenience of the implementor, who should not
  * expect it to live longer than a single callback call.
  *
@@ -3144,7 +3222,7 @@ enum svn_repos_load_uuid
  * should also call svn_error_dup() for @a verify_err.  Implementors of this
  * callback are forbidden to call svn_error_clear() for @a verify_err.
  *
- * @see svn_repos_verify_fs3
+ * @see svn_repos_verify_fs4
  *
  * @since New in 1.9.
  */
@@ -3213,6 +3291,14 @@ typedef svn_error_t *(*svn_repos_verify_callback_t)(void *baton,
  *            called has reached its end and is about to return?
  *        ### Not sent, currently, if a FS structure error is found.
  *
+ * If @a jobs is larger than 1, verify up to @a jobs revisions at the
+ * same time, each in a separate thread using its own filesystem instance.
+ * Backend-specific checks will run concurrently as well where supported,
+ * unless the filesystem config of @a repos already sets a different
+ * value for #SVN_FS_CONFIG_FSFS_JOBS.  @a notify_func and
+ * @a verify_callback will still only be called from the calling thread
+ * and in revision order.  @a jobs is ignored if APR has no thread support.
+ *
  * If @a cancel_func is not @c NULL, call it periodically with @a
  * cancel_baton as argument to see if the caller wishes to cancel the
  * verification.
@@ -3221,8 +3307,30 @@ typedef svn_error_t *(*svn_repos_verify_callback_t)(void *baton,
  *
  * @see svn_repos_verify_callback_t
  *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_repos_verify_fs4(svn_repos_t *repos,
+                     svn_revnum_t start_rev,
+                     svn_revnum_t end_rev,
+                     svn_boolean_t check_normalization,
+                     svn_boolean_t metadata_only,
+                     int jobs,
+                     svn_repos_notify_func_t notify_func,
+                     void *notify_baton,
+                     svn_repos_verify_callback_t verify_callback,
+                     void *verify_baton,
+                     svn_cancel_func_t cancel,
+                     void *cancel_baton,
+                     apr_pool_t *scratch_pool);
+
+/**
+ * Like svn_repos_verify_fs4(), but with @a jobs set to 1.
+ *
  * @since New in 1.9.
+ * @deprecated Provided for backward compatibility with the 1.10 API.
  */
+SVN_DEPRECATED
 svn_error_t *
 svn_repos_verify_fs3(svn_repos_t *repos,
                      svn_revnum_t start_rev,
@@ -3280,7 +3388,7 @@ svn_repos_verify_fs(svn_repos_t *repos,
  * Dump the contents of the filesystem within already-open @a repos into
  * writable @a dumpstream.  If @a dumpstream is
  * @c NULL, this is effectively a primitive verify.  It is not complete,
- * however; see instead svn_repos_verify_fs3().
+ * however; see instead svn_repos_verify_fs4().
  *
  * Begin at revision @a start_rev, and dump every revision up through
  * @a end_rev.  If @a start_rev is #SVN_INVALID_REVNUM, start at revision
@@ -3331,14 +3439,48 @@ svn_repos_verify_fs(svn_repos_t *repos,
  * If @a filter_func is not @c NULL, it is called for each node being
  * dumped, allowing the caller to exclude it from dump.
  *
+ * If @a jobs is larger than 1, the node records of up to @a jobs
+ * revisions are produced at the same time, each in a separate thread
+ * using its own filesystem instance, and buffered until they can be
+ * written to @a stream.  The output is identical to that of a dump with
+ * @a jobs set to 1.  @a notify_func, @a cancel_func and @a stream will
+ * still only be used from the calling thread and in revision order, but
+ * @a filter_func may be called concurrently from several threads.
+ * @a jobs is ignored if APR has no thread support.
+ *
  * If @a cancel_func is not @c NULL, it is called periodically with
  * @a cancel_baton as argument to see if the client wishes to cancel
  * the dump.
  *
  * Use @a scratch_pool for temporary allocation.
  *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_repos_dump_fs5(svn_repos_t *repos,
+                   svn_stream_t *stream,
+                   svn_revnum_t start_rev,
+                   svn_revnum_t end_rev,
+                   svn_boolean_t incremental,
+                   svn_boolean_t use_deltas,
+                   svn_boolean_t include_revprops,
+                   svn_boolean_t include_changes,
+                   int jobs,
+                   svn_repos_notify_func_t notify_func,
+                   void *notify_baton,
+                   svn_repos_dump_filter_func_t filter_func,
+                   void *filter_baton,
+                   svn_cancel_func_t cancel_func,
+                   void *cancel_baton,
+                   apr_pool_t *scratch_pool);
+
+/**
+ * Like svn_repos_dump_fs5(), but with @a jobs set to 1.
+ *
  * @since New in 1.10.
+ * @deprecated Provided for backward compatibility with the 1.10 API.
  */
+SVN_DEPRECATED
 svn_error_t *
 svn_repos_dump_fs4(svn_repos_t *repos,
                    svn_stream_t *stream,
@@ -3469,6 +3611,13 @@ svn_repos_dump_fs(svn_repos_t *repos,
  * @note The details or the performed normalizations are deliberately
  * left unspecified and may change in the future.
  *
+ * If @a jobs is larger than 1, read and parse @a dumpstream in a separate
+ * thread while the previous revisions are being committed, buffering up
+ * to @a jobs parsed revisions.  @a dumpstream will only be read from that
+ * thread.  All other callbacks will still only be called from the calling
+ * thread and in the same order as with @a jobs set to 1.  @a jobs is
+ * ignored if APR has no thread support.
+ *
  * If non-NULL, use @a notify_func and @a notify_baton to send notification
  * of events to the caller.
  *
@@ -3476,8 +3625,34 @@ svn_repos_dump_fs(svn_repos_t *repos,
  * @a cancel_baton as argument to see if the client wishes to cancel
  * the load.
  *
+ * @since New in 1.11.
+ */
+svn_error_t *
+svn_repos_load_fs7(svn_repos_t *repos,
+                   svn_stream_t *dumpstream,
+                   svn_revnum_t start_rev,
+                   svn_revnum_t end_rev,
+                   enum svn_repos_load_uuid uuid_action,
+                   const char *parent_dir,
+                   svn_boolean_t use_pre_commit_hook,
+                   svn_boolean_t use_post_commit_hook,
+                   svn_boolean_t validate_props,
+                   svn_boolean_t ignore_dates,
+                   svn_boolean_t normalize_props,
+                   int jobs,
+                   svn_repos_notify_func_t notify_func,
+                   void *notify_baton,
+                   svn_cancel_func_t cancel_func,
+                   void *cancel_baton,
+                   apr_pool_t *pool);
+
+/**
+ * Similar to svn_repos_load_fs7(), but with @a jobs set to 1.
+ *
  * @since New in 1.10.
+ * @deprecated Provided for backward compatibility with the 1.10 API.
  */
+SVN_DEPRECATED
 svn_error_t *
 svn_repos_load_fs6(svn_repos_t *repos,
                    svn_stream_t *dumpstream,
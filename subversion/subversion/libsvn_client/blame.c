@@ -58,16 +58,40 @@ struct blame
   const struct rev *rev;    /* the responsible revision */
   apr_off_t start;          /* the starting diff-token (line) */
   struct blame *next;       /* the next chunk */
+
+  /* Members used while the chunk is part of blame_chain->root. */
+  apr_off_t length;         /* number of tokens covered by this chunk */
+  apr_off_t size;           /* sum of LENGTH over this subtree */
+  apr_uint32_t priority;    /* heap priority within the treap */
+  struct blame *left;       /* subtree of the preceding chunks */
+  struct blame *right;      /* subtree of the following chunks */
 };
 
-/* A chain of blame chunks */
+/* A chain of blame chunks.
+
+   While the diffs between the file revisions are applied, the chunks are
+   kept in ROOT, a treap ordered by position in which each chunk only
+   records its LENGTH.  The start of a chunk is implied by the lengths of
+   the chunks before it, so finding the chunk of a token and shifting
+   everything behind an insertion or deletion both take O(log n) instead
+   of a walk over the whole chain.  The last chunk is unbounded and
+   covers everything up to the end of the file.
+
+   blame_chain_flatten() turns ROOT into the linked list BLAME with
+   explicit START offsets, which is what the reporting code walks. */
 struct blame_chain
 {
   struct blame *blame;      /* linked list of blame chunks */
+  struct blame *root;       /* treap of blame chunks, see above */
   struct blame *avail;      /* linked list of free blame chunks */
+  apr_uint32_t seed;        /* state of the treap priority generator */
   struct apr_pool_t *pool;  /* Allocate members from this pool. */
 };
 
+/* The LENGTH of the last chunk in blame_chain->root.  It is large enough
+   to cover any file, while sums of it and real lengths cannot overflow. */
+#define BLAME_UNBOUNDED ((apr_off_t)1 << (sizeof(apr_off_t) * 8 - 2))
+
 /* The baton use for the diff output routine. */
 struct diff_baton {
   struct blame_chain *chain;
@@ -123,6 +147,18 @@ struct delta_baton {
 
 
 
+/* Initialize CHAIN to an empty chain allocating from POOL. */
+static void
+blame_chain_init(struct blame_chain *chain,
+                 apr_pool_t *pool)
+{
+  chain->blame = NULL;
+  chain->root = NULL;
+  chain->avail = NULL;
+  chain->seed = 2463534242U;
+  chain->pool = pool;
+}
+
 /* Return a blame chunk associated with REV for a change starting
    at token START, and allocated in CHAIN->mainpool. */
 static struct blame *
@@ -131,6 +167,8 @@ blame_create(struct blame_chain *chain,
              apr_off_t start)
 {
   struct blame *blame;
+  apr_uint32_t x;
+
   if (chain->avail)
     {
       blame = chain->avail;
@@ -141,6 +179,20 @@ blame_create(struct blame_chain *chain,
   blame->rev = rev;
   blame->start = start;
   blame->next = NULL;
+
+  /* Treap priorities only need to be well spread, so a xorshift
+     generator is good enough. */
+  x = chain->seed;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  chain->seed = x;
+
+  blame->length = 0;
+  blame->size = 0;
+  blame->priority = x;
+  blame->left = NULL;
+  blame->right = NULL;
   return blame;
 }
 
@@ -153,30 +205,137 @@ blame_destroy(struct blame_chain *chain,
   chain->avail = blame;
 }
 
-/* Return the blame chunk that contains token OFF, starting the search at
-   BLAME. */
+/* Destroy all blame chunks in the subtree TREE. */
+static void
+blame_destroy_tree(struct blame_chain *chain,
+                   struct blame *tree)
+{
+  while (tree)
+    {
+      struct blame *right = tree->right;
+
+      blame_destroy_tree(chain, tree->left);
+      blame_destroy(chain, tree);
+      tree = right;
+    }
+}
+
+/* Return the number of tokens covered by the subtree TREE. */
+static APR_INLINE apr_off_t
+blame_size(const struct blame *tree)
+{
+  return tree ? tree->size : 0;
+}
+
+/* Recalculate the size of TREE after its children changed. */
+static APR_INLINE void
+blame_update(struct blame *tree)
+{
+  tree->size = tree->length + blame_size(tree->left)
+                            + blame_size(tree->right);
+}
+
+/* Return the concatenation of the subtrees LEFT and RIGHT, the chunks
+   of LEFT preceding those of RIGHT. */
 static struct blame *
-blame_find(struct blame *blame, apr_off_t off)
+blame_join(struct blame *left,
+           struct blame *right)
+{
+  if (!left)
+    return right;
+  if (!right)
+    return left;
+
+  if (left->priority > right->priority)
+    {
+      left->right = blame_join(left->right, right);
+      blame_update(left);
+      return left;
+    }
+  else
+    {
+      right->left = blame_join(left, right->left);
+      blame_update(right);
+      return right;
+    }
+}
+
+/* Split the subtree TREE in front of token OFF, relative to the start of
+   TREE, setting *LEFT to the chunks before OFF and *RIGHT to the chunks
+   from OFF onwards.  A chunk that contains OFF is cut in two, allocating
+   the new chunk in CHAIN. */
+static void
+blame_split(struct blame **left,
+            struct blame **right,
+            struct blame_chain *chain,
+            struct blame *tree,
+            apr_off_t off)
 {
-  struct blame *prev = NULL;
-  while (blame)
+  apr_off_t left_size;
+
+  if (!tree)
     {
-      if (blame->start > off) break;
-      prev = blame;
-      blame = blame->next;
+      *left = *right = NULL;
+      return;
     }
-  return prev;
+
+  left_size = blame_size(tree->left);
+  if (off <= left_size)
+    {
+      blame_split(left, &tree->left, chain, tree->left, off);
+      blame_update(tree);
+      *right = tree;
+    }
+  else if (off >= left_size + tree->length)
+    {
+      blame_split(&tree->right, right, chain, tree->right,
+                  off - left_size - tree->length);
+      blame_update(tree);
+      *left = tree;
+    }
+  else
+    {
+      struct blame *tail = blame_create(chain, tree->rev, 0);
+
+      tail->length = left_size + tree->length - off;
+      tail->size = tail->length;
+      tree->length = off - left_size;
+
+      *right = blame_join(tail, tree->right);
+      tree->right = NULL;
+      blame_update(tree);
+      *left = tree;
+    }
+}
+
+/* Return the first chunk of the non-empty subtree TREE. */
+static struct blame *
+blame_first(struct blame *tree)
+{
+  while (tree->left)
+    tree = tree->left;
+  return tree;
+}
+
+/* Return the last chunk of the non-empty subtree TREE. */
+static struct blame *
+blame_last(struct blame *tree)
+{
+  while (tree->right)
+    tree = tree->right;
+  return tree;
 }
 
-/* Shift the start-point of BLAME and all subsequence blame-chunks
-   by ADJUST tokens */
+/* Add LENGTH tokens to the last chunk of the subtree TREE. */
 static void
-blame_adjust(struct blame *blame, apr_off_t adjust)
+blame_grow_last(struct blame *tree,
+                apr_off_t length)
 {
-  while (blame)
+  for (; tree; tree = tree->right)
     {
-      blame->start += adjust;
-      blame = blame->next;
+      tree->size += length;
+      if (!tree->right)
+        tree->length += length;
     }
 }
 
@@ -187,37 +346,24 @@ blame_delete_range(struct blame_chain *chain,
                    apr_off_t start,
                    apr_off_t length)
 {
-  struct blame *first = blame_find(chain->blame, start);
-  struct blame *last = blame_find(chain->blame, start + length);
-  struct blame *tail = last->next;
+  struct blame *head, *middle, *tail;
 
-  if (first != last)
-    {
-      struct blame *walk = first->next;
-      while (walk != last)
-        {
-          struct blame *next = walk->next;
-          blame_destroy(chain, walk);
-          walk = next;
-        }
-      first->next = last;
-      last->start = start;
-      if (first->start == start)
-        {
-          *first = *last;
-          blame_destroy(chain, last);
-          last = first;
-        }
-    }
+  blame_split(&head, &tail, chain, chain->root, start);
+  blame_split(&middle, &tail, chain, tail, length);
+  blame_destroy_tree(chain, middle);
 
-  if (tail && tail->start == last->start + length)
+  /* A deletion inside a single chunk leaves two pieces of it behind;
+     glue them together again instead of fragmenting the chain. */
+  if (head && tail && blame_last(head)->rev == blame_first(tail)->rev)
     {
-      *last = *tail;
-      blame_destroy(chain, tail);
-      tail = last->next;
+      apr_off_t moved = blame_first(tail)->length;
+
+      blame_split(&middle, &tail, chain, tail, moved);
+      blame_destroy_tree(chain, middle);
+      blame_grow_last(head, moved);
     }
 
-  blame_adjust(tail, -length);
+  chain->root = blame_join(head, tail);
 
   return SVN_NO_ERROR;
 }
@@ -230,29 +376,49 @@ blame_insert_range(struct blame_chain *chain,
                    apr_off_t start,
                    apr_off_t length)
 {
-  struct blame *head = chain->blame;
-  struct blame *point = blame_find(head, start);
-  struct blame *insert;
+  struct blame *head, *tail;
+  struct blame *insert = blame_create(chain, rev, start);
 
-  if (point->start == start)
-    {
-      insert = blame_create(chain, point->rev, point->start + length);
-      point->rev = rev;
-      insert->next = point->next;
-      point->next = insert;
-    }
-  else
+  insert->length = length;
+  insert->size = length;
+
+  blame_split(&head, &tail, chain, chain->root, start);
+  chain->root = blame_join(blame_join(head, insert), tail);
+
+  return SVN_NO_ERROR;
+}
+
+/* Append the chunks of the subtree TREE, which starts at token *OFFSET,
+   to the linked list at *LINK, setting their START and advancing *OFFSET
+   past them.  Return the location of the final NEXT pointer. */
+static struct blame **
+blame_flatten(struct blame **link,
+              struct blame *tree,
+              apr_off_t *offset)
+{
+  while (tree)
     {
-      struct blame *middle;
-      middle = blame_create(chain, rev, start);
-      insert = blame_create(chain, point->rev, start + length);
-      middle->next = insert;
-      insert->next = point->next;
-      point->next = middle;
+      link = blame_flatten(link, tree->left, offset);
+
+      tree->start = *offset;
+      *offset += tree->length;
+      *link = tree;
+      link = &tree->next;
+
+      tree = tree->right;
     }
-  blame_adjust(insert->next, length);
 
-  return SVN_NO_ERROR;
+  return link;
+}
+
+/* Set CHAIN->blame to the linked list of the chunks in CHAIN->root.
+   CHAIN->root must not be changed afterwards. */
+static void
+blame_chain_flatten(struct blame_chain *chain)
+{
+  apr_off_t offset = 0;
+
+  *blame_flatten(&chain->blame, chain->root, &offset) = NULL;
 }
 
 /* Callback for diff between subsequent revisions */
@@ -297,8 +463,10 @@ add_file_blame(const char *last_file,
 {
   if (!last_file)
     {
-      SVN_ERR_ASSERT(chain->blame == NULL);
-      chain->blame = blame_create(chain, rev, 0);
+      SVN_ERR_ASSERT(chain->root == NULL);
+      chain->root = blame_create(chain, rev, 0);
+      chain->root->length = BLAME_UNBOUNDED;
+      chain->root->size = BLAME_UNBOUNDED;
     }
   else
     {
@@ -655,6 +823,126 @@ normalize_blames(struct blame_chain *chain,
     }
 }
 
+/* The baton used while receiving blame calculated by the server. */
+struct server_blame_baton {
+  struct blame_chain *chain;
+  /* The struct rev * of every revision seen, keyed by svn_revnum_t. */
+  apr_hash_t *revs;
+  /* The rev of lines that are older than the start revision. */
+  struct rev *unblamed;
+  svn_cancel_func_t cancel_func;
+  void *cancel_baton;
+  apr_pool_t *mainpool;
+};
+
+/* Append the lines LINE_START to LINE_START + LINE_COUNT, attributed to
+   REVISION, to the chain in (struct server_blame_baton) BATON.
+
+   Implements svn_file_blame_receiver_t. */
+static svn_error_t *
+server_blame_receiver(void *baton,
+                      apr_int64_t line_start,
+                      apr_int64_t line_count,
+                      svn_revnum_t revision,
+                      apr_hash_t *rev_props,
+                      apr_pool_t *pool)
+{
+  struct server_blame_baton *sbb = baton;
+  struct rev *rev;
+
+  if (sbb->cancel_func)
+    SVN_ERR(sbb->cancel_func(sbb->cancel_baton));
+
+  if (line_start != blame_size(sbb->chain->root))
+    return svn_error_createf(SVN_ERR_INCORRECT_PARAMS, NULL,
+                             _("Server sent blame information for line "
+                               "%s instead of line %s"),
+                             apr_psprintf(pool, "%" APR_INT64_T_FMT,
+                                          line_start),
+                             apr_off_t_toa(pool,
+                                           blame_size(sbb->chain->root)));
+
+  if (!SVN_IS_VALID_REVNUM(revision))
+    rev = sbb->unblamed;
+  else
+    {
+      rev = apr_hash_get(sbb->revs, &revision, sizeof(revision));
+      if (!rev)
+        {
+          /* The properties are sent with the first lines of REVISION. */
+          rev = apr_pcalloc(sbb->mainpool, sizeof(*rev));
+          rev->revision = revision;
+          rev->rev_props = rev_props
+                             ? svn_prop_hash_dup(rev_props, sbb->mainpool)
+                             : apr_hash_make(sbb->mainpool);
+          apr_hash_set(sbb->revs, &rev->revision, sizeof(rev->revision),
+                       rev);
+        }
+    }
+
+  return svn_error_trace(blame_insert_range(sbb->chain, rev, line_start,
+                                            line_count));
+}
+
+/* Let the server of RA_SESSION calculate the blame of FRB->target from
+   FRB->start_rev to FRB->end_rev, add it to FRB->chain and fetch the
+   contents of the file in FRB->end_rev to FRB->last_filename.  Use POOL
+   for all allocations. */
+static svn_error_t *
+get_server_blame(struct file_rev_baton *frb,
+                 svn_ra_session_t *ra_session,
+                 apr_pool_t *pool)
+{
+  struct server_blame_baton sbb;
+  apr_array_header_t *args = apr_array_make(pool, 2, sizeof(const char *));
+  svn_stream_t *stream;
+
+  if (frb->diff_options)
+    {
+      if (frb->diff_options->ignore_space
+            == svn_diff_file_ignore_space_change)
+        APR_ARRAY_PUSH(args, const char *) = "-b";
+      else if (frb->diff_options->ignore_space
+                 == svn_diff_file_ignore_space_all)
+        APR_ARRAY_PUSH(args, const char *) = "-w";
+      if (frb->diff_options->ignore_eol_style)
+        APR_ARRAY_PUSH(args, const char *) = "--ignore-eol-style";
+      if (frb->diff_options->algorithm
+            == svn_diff_file_algorithm_myers_linear)
+        APR_ARRAY_PUSH(args, const char *) = "--diff-algorithm=myers-linear";
+      else if (frb->diff_options->algorithm
+                 == svn_diff_file_algorithm_histogram)
+        APR_ARRAY_PUSH(args, const char *) = "--diff-algorithm=histogram";
+    }
+
+  sbb.chain = frb->chain;
+  sbb.revs = apr_hash_make(pool);
+  sbb.unblamed = apr_pcalloc(pool, sizeof(*sbb.unblamed));
+  sbb.unblamed->revision = SVN_INVALID_REVNUM;
+  sbb.cancel_func = frb->ctx->cancel_func;
+  sbb.cancel_baton = frb->ctx->cancel_baton;
+  sbb.mainpool = pool;
+
+  SVN_ERR(svn_ra_get_file_blame(ra_session, "", frb->start_rev, frb->end_rev,
+                                args, server_blame_receiver, &sbb, pool));
+
+  /* Like the chain built from the file revisions, let the last chunk
+     cover everything up to the end of the file. */
+  if (frb->chain->root)
+    blame_grow_last(frb->chain->root, BLAME_UNBOUNDED);
+  else
+    SVN_ERR(blame_insert_range(frb->chain, sbb.unblamed, 0,
+                               BLAME_UNBOUNDED));
+
+  SVN_ERR(svn_stream_open_unique(&stream, &frb->last_filename, NULL,
+                                 svn_io_file_del_on_pool_cleanup,
+                                 pool, pool));
+  SVN_ERR(svn_ra_get_file(ra_session, "", frb->end_rev, stream, NULL, NULL,
+                          pool));
+
+  return svn_error_trace(svn_stream_close(stream));
+}
+
 svn_error_t *
 svn_client_blame5(const char *target,
                   const svn_opt_revision_t *peg_revision,
@@ -676,6 +964,7 @@ svn_client_blame5(const char *target,
   svn_stream_t *last_stream;
   svn_stream_t *stream;
   const char *target_abspath_or_url;
+  svn_boolean_t server_blame = FALSE;
 
   if (start->kind == svn_opt_revision_unspecified
       || end->kind == svn_opt_revision_unspecified)
@@ -777,15 +1066,11 @@ svn_client_blame5(const char *target,
   frb.last_rev = NULL;
   frb.last_original_filename = NULL;
   frb.chain = apr_palloc(pool, sizeof(*frb.chain));
-  frb.chain->blame = NULL;
-  frb.chain->avail = NULL;
-  frb.chain->pool = pool;
+  blame_chain_init(frb.chain, pool);
   if (include_merged_revisions)
     {
       frb.merged_chain = apr_palloc(pool, sizeof(*frb.merged_chain));
-      frb.merged_chain->blame = NULL;
-      frb.merged_chain->avail = NULL;
-      frb.merged_chain->pool = pool;
+      blame_chain_init(frb.merged_chain, pool);
     }
   frb.backwards = (frb.start_rev > frb.end_rev);
   frb.last_revnum = SVN_INVALID_REVNUM;
@@ -806,16 +1091,41 @@ svn_client_blame5(const char *target,
       frb.prevfilepool = svn_pool_create(pool);
     }
 
-  /* Collect all blame information.
-     We need to ensure that we get one revision before the start_rev,
-     if available so that we can know what was actually changed in the start
-     revision. */
-  SVN_ERR(svn_ra_get_file_revs2(ra_session, "",
-                                frb.backwards ? start_revnum
-                                              : MAX(0, start_revnum-1),
-                                end_revnum,
-                                include_merged_revisions,
-                                file_rev_handler, &frb, pool));
+  /* Servers that can calculate the blame themselves save us from
+     transferring and diffing every revision of the file.  They don't
+     track merged revisions and only blame forwards, though. */
+  if (!include_merged_revisions && !frb.backwards)
+    {
+      svn_config_t *cfg = ctx->config
+                          ? svn_hash_gets(ctx->config,
+                                          SVN_CONFIG_CATEGORY_CONFIG)
+                          : NULL;
+
+      SVN_ERR(svn_config_get_bool(cfg, &server_blame,
+                                  SVN_CONFIG_SECTION_MISCELLANY,
+                                  SVN_CONFIG_OPTION_SERVER_BLAME, TRUE));
+      if (server_blame)
+        SVN_ERR(svn_ra_has_capability(ra_session, &server_blame,
+                                      SVN_RA_CAPABILITY_FILE_BLAME, pool));
+    }
+
+  if (server_blame)
+    {
+      SVN_ERR(get_server_blame(&frb, ra_session, pool));
+    }
+  else
+    {
+      /* Collect all blame information.
+         We need to ensure that we get one revision before the start_rev,
+         if available so that we can know what was actually changed in the
+         start revision. */
+      SVN_ERR(svn_ra_get_file_revs2(ra_session, "",
+                                    frb.backwards ? start_revnum
+                                                  : MAX(0, start_revnum-1),
+                                    end_revnum,
+                                    include_merged_revisions,
+                                    file_rev_handler, &frb, pool));
+    }
 
   if (end->kind == svn_opt_revision_working)
     {
@@ -891,6 +1201,11 @@ svn_client_blame5(const char *target,
   stream = svn_subst_stream_translated(last_stream,
                                        "\n", TRUE, NULL, FALSE, pool);
 
+  /* Turn the collected blame into linked lists of chunks. */
+  blame_chain_flatten(frb.chain);
+  if (include_merged_revisions)
+    blame_chain_flatten(frb.merged_chain);
+
   /* Perform optional merged chain normalization. */
   if (include_merged_revisions)
     {
@@ -29,8 +29,14 @@
 
 #include "svn_hash.h"
 #include "svn_delta.h"
+#include "private/svn_delta_private.h"
+#include "private/svn_dep_compat.h"
 #include "private/svn_string_private.h"
 #include "delta.h"
+
+#if SVN_HAVE_SSE2
+#include <emmintrin.h>
+#endif
 
 /* This is pseudo-adler32. It is adler32 without the prime modulus.
    The idea is borrowed from monotone, and is a translation of the C++
@@ -76,6 +82,53 @@ adler32_replace(apr_uint32_t adler32, const char c_out, const char c_in)
   return adler32 + adler32 * 0x10000;
 }
 
+#if SVN_HAVE_SSE2
+
+/* Whether init_adler32 may use the SSE2 code.  Only the test suite ever
+   clears this, see svn_txdelta__set_simd_enabled. */
+static svn_boolean_t use_sse2 = TRUE;
+
+/* SSE2 implementation of init_adler32. */
+static APR_INLINE apr_uint32_t
+init_adler32_sse2(const char *data)
+{
+  /* S1 is the plain sum of all bytes while S2 adds the I-th byte
+     MATCH_BLOCKSIZE - I times.  So, we can calculate both sums
+     independently for 16 bytes at a time.  Products and partial sums
+     are small enough to not overflow 16 resp. 32 bits. */
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i sixteen = _mm_set1_epi16(16);
+  __m128i weights_lo = _mm_setr_epi16(64, 63, 62, 61, 60, 59, 58, 57);
+  __m128i weights_hi = _mm_setr_epi16(56, 55, 54, 53, 52, 51, 50, 49);
+  __m128i s1 = zero;
+  __m128i s2 = zero;
+  int i;
+
+  for (i = 0; i < MATCH_BLOCKSIZE; i += 16)
+    {
+      __m128i input = _mm_loadu_si128((const __m128i *)(data + i));
+
+      s1 = _mm_add_epi64(s1, _mm_sad_epu8(input, zero));
+      s2 = _mm_add_epi32(s2, _mm_madd_epi16(_mm_unpacklo_epi8(input, zero),
+                                            weights_lo));
+      s2 = _mm_add_epi32(s2, _mm_madd_epi16(_mm_unpackhi_epi8(input, zero),
+                                            weights_hi));
+
+      weights_lo = _mm_sub_epi16(weights_lo, sixteen);
+      weights_hi = _mm_sub_epi16(weights_hi, sixteen);
+    }
+
+  /* Horizontal sums. */
+  s1 = _mm_add_epi64(s1, _mm_shuffle_epi32(s1, _MM_SHUFFLE(1, 0, 3, 2)));
+  s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(1, 0, 3, 2)));
+  s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return (apr_uint32_t)_mm_cvtsi128_si32(s2) * 0x10000
+       + (apr_uint32_t)_mm_cvtsi128_si32(s1);
+}
+
+#endif
+
 /* Calculate an pseudo-adler32 checksum for MATCH_BLOCKSIZE bytes starting
    at DATA.  Return the checksum value.  */
 
@@ -88,6 +141,11 @@ init_adler32(const char *data)
   apr_uint32_t s1 = 0;
   apr_uint32_t s2 = 0;
 
+#if SVN_HAVE_SSE2
+  if (use_sse2)
+    return init_adler32_sse2(data);
+#endif
+
   for (; input < last; input += 8)
     {
       s1 += input[0]; s2 += s1;
@@ -278,7 +336,7 @@ find_match(const struct blocks *blocks,
            apr_size_t pending_insert_start)
 {
   apr_size_t apos, bpos = *bposp;
-  apr_size_t delta, max_delta;
+  apr_size_t delta, max_delta, back;
 
   apos = find_block(blocks, rolling, b + bpos);
 
@@ -296,12 +354,13 @@ find_match(const struct blocks *blocks,
 
   /* See if we can extend backwards (max MATCH_BLOCKSIZE-1 steps because A's
      content has been sampled only every MATCH_BLOCKSIZE positions).  */
-  while (apos > 0 && bpos > pending_insert_start && a[apos-1] == b[bpos-1])
-    {
-      --apos;
-      --bpos;
-      ++delta;
-    }
+  max_delta = bpos - pending_insert_start < apos
+            ? bpos - pending_insert_start
+            : apos;
+  back = svn_cstring__reverse_match_length(a + apos, b + bpos, max_delta);
+  apos -= back;
+  bpos -= back;
+  delta += back;
 
   *aposp = apos;
   *bposp = bpos;
@@ -494,3 +553,12 @@ svn_txdelta__xdelta(svn_txdelta__ops_baton_t *build_baton,
                 data + source_len, target_len,
                 pool);
 }
+
+void
+svn_txdelta__set_simd_enabled(svn_boolean_t enabled)
+{
+#if SVN_HAVE_SSE2
+  use_sse2 = enabled;
+#endif
+  svn_cstring__set_simd_enabled(enabled);
+}
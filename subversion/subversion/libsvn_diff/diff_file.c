@@ -1182,6 +1182,9 @@ static const svn_diff_fns2_t svn_diff__file_vtable =
 /* Id for the --ignore-eol-style option, which doesn't have a short name. */
 #define SVN_DIFF__OPT_IGNORE_EOL_STYLE 256
 
+/* Id for the --diff-algorithm option, which doesn't have a short name. */
+#define SVN_DIFF__OPT_DIFF_ALGORITHM 257
+
 /* Options supported by svn_diff_file_options_parse(). */
 static const apr_getopt_option_t diff_options[] =
 {
@@ -1193,6 +1196,7 @@ static const apr_getopt_option_t diff_options[] =
    * ### we don't have optional argument support. */
   { "unified", 'u', 0, NULL },
   { "context", 'U', 1, NULL },
+  { "diff-algorithm", SVN_DIFF__OPT_DIFF_ALGORITHM, 1, NULL },
   { NULL, 0, 0, NULL }
 };
 
@@ -1298,6 +1302,18 @@ svn_diff_file_options_parse(svn_diff_file_options_t *options,
         case 'U':
           SVN_ERR(svn_cstring_atoi(&options->context_size, opt_arg));
           break;
+        case SVN_DIFF__OPT_DIFF_ALGORITHM:
+          if (strcmp(opt_arg, "myers") == 0)
+            options->algorithm = svn_diff_file_algorithm_myers;
+          else if (strcmp(opt_arg, "myers-linear") == 0)
+            options->algorithm = svn_diff_file_algorithm_myers_linear;
+          else if (strcmp(opt_arg, "histogram") == 0)
+            options->algorithm = svn_diff_file_algorithm_histogram;
+          else
+            return svn_error_createf(SVN_ERR_INVALID_DIFF_OPTION, NULL,
+                                     _("Unknown diff algorithm '%s'"),
+                                     opt_arg);
+          break;
         default:
           break;
         }
@@ -1326,7 +1342,8 @@ svn_diff_file_diff_2(svn_diff_t **diff,
   baton.files[1].path = modified;
   baton.pool = svn_pool_create(pool);
 
-  SVN_ERR(svn_diff_diff_2(diff, &baton, &svn_diff__file_vtable, pool));
+  SVN_ERR(svn_diff__diff_2(diff, &baton, &svn_diff__file_vtable,
+                           options->algorithm, pool));
 
   svn_pool_destroy(baton.pool);
   return SVN_NO_ERROR;
@@ -1348,7 +1365,8 @@ svn_diff_file_diff3_2(svn_diff_t **diff,
   baton.files[2].path = latest;
   baton.pool = svn_pool_create(pool);
 
-  SVN_ERR(svn_diff_diff3_2(diff, &baton, &svn_diff__file_vtable, pool));
+  SVN_ERR(svn_diff__diff3_2(diff, &baton, &svn_diff__file_vtable,
+                            options->algorithm, pool));
 
   svn_pool_destroy(baton.pool);
   return SVN_NO_ERROR;
@@ -1372,7 +1390,8 @@ svn_diff_file_diff4_2(svn_diff_t **diff,
   baton.files[3].path = ancestor;
   baton.pool = svn_pool_create(pool);
 
-  SVN_ERR(svn_diff_diff4_2(diff, &baton, &svn_diff__file_vtable, pool));
+  SVN_ERR(svn_diff__diff4_2(diff, &baton, &svn_diff__file_vtable,
+                            options->algorithm, pool));
 
   svn_pool_destroy(baton.pool);
   return SVN_NO_ERROR;
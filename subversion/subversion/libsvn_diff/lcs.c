@@ -25,6 +25,9 @@
 #include <apr.h>
 #include <apr_pools.h>
 #include <apr_general.h>
+#include <apr_tables.h>
+
+#include "svn_pools.h"
 
 #include "diff.h"
 
@@ -228,6 +231,465 @@ prepend_lcs(svn_diff__lcs_t *lcs, apr_off_t lines,
 }
 
 
+/*
+ * The alternatives to the O(NP) algorithm work on arrays of tokens and
+ * split the problem into ever smaller pairs of ranges.  Each step finds
+ * a run of matching tokens in the ranges, whose surroundings become the
+ * next ranges to split.
+ *
+ * The linear space variant of Myers' algorithm, described in section 4b
+ * of "An O(ND) Difference Algorithm and Its Variations", splits at the
+ * middle snake of a minimal edit script.  It only needs two arrays of
+ * furthest reaching points, which are shared by all steps, so the memory
+ * use is linear in the size of the sources.
+ *
+ * Histogram diff splits at the longest run of matching tokens that are
+ * least frequent in the first range, which is what makes it fast for
+ * sources with many differences.  Ranges in which all common tokens are
+ * too frequent are split by the linear space Myers algorithm instead.
+ */
+
+/* Tokens that occur more often than this in a range are not used to split
+   it in histogram diff. */
+#define HISTOGRAM_MAX_CHAIN 64
+
+/* An item on the work stack of the range splitting algorithms: either a
+ * pair of ranges [START[0], END[0]) and [START[1], END[1]) to compare, or
+ * (if IS_MATCH) END[0] - START[0] matching tokens at START.
+ */
+typedef struct lcs_range_t
+{
+  apr_off_t start[2];
+  apr_off_t end[2];
+  svn_boolean_t is_match;
+} lcs_range_t;
+
+/* The state of the range splitting algorithms. */
+typedef struct lcs_split_baton_t
+{
+  svn_diff_file_algorithm_t algorithm;
+
+  /* The positions of both sources that have tokens in common with the
+     other source, and their token indices. */
+  svn_diff__position_t **position[2];
+  svn_diff__token_index_t *token[2];
+
+  /* Work stack of lcs_range_t, processed such that matches are found in
+     the order of the sources. */
+  apr_array_header_t *stack;
+
+  /* The furthest reaching points of the forward and backward searches
+     for the middle snake, indexed by diagonal. */
+  apr_off_t *forward;
+  apr_off_t *backward;
+
+  /* For histogram diff: the number of occurrences of each token in the
+     first range, the first position of each token in it and the next
+     position with the same token for each position. */
+  apr_off_t *count;
+  apr_off_t *first;
+  apr_off_t *next_same;
+
+  /* The resulting chain of matches and its last element. */
+  svn_diff__lcs_t *lcs;
+  svn_diff__lcs_t *last_lcs;
+
+  apr_pool_t *pool;
+} lcs_split_baton_t;
+
+/* Append LENGTH matching tokens starting at START0 and START1 to the
+ * chain in SB.  Since tokens that only occur in one source are left out
+ * of the arrays, a run of matches may have to be split in several
+ * elements of the chain.
+ */
+static void
+add_match(lcs_split_baton_t *sb,
+          apr_off_t start0,
+          apr_off_t start1,
+          apr_off_t length)
+{
+  svn_diff__lcs_t *lcs = sb->last_lcs;
+  apr_off_t i;
+
+  for (i = 0; i < length; i++)
+    {
+      svn_diff__position_t *position0 = sb->position[0][start0 + i];
+      svn_diff__position_t *position1 = sb->position[1][start1 + i];
+
+      /* Extend the previous element if this match continues it. */
+      if (lcs
+          && position0->offset == lcs->position[0]->offset + lcs->length
+          && position1->offset == lcs->position[1]->offset + lcs->length)
+        {
+          lcs->length++;
+          continue;
+        }
+
+      lcs = apr_palloc(sb->pool, sizeof(*lcs));
+      lcs->position[0] = position0;
+      lcs->position[1] = position1;
+      lcs->length = 1;
+      lcs->refcount = 1;
+      lcs->next = NULL;
+
+      if (sb->last_lcs)
+        sb->last_lcs->next = lcs;
+      else
+        sb->lcs = lcs;
+      sb->last_lcs = lcs;
+    }
+}
+
+/* Push the pair of ranges or match described by the arguments onto the
+   work stack of SB. */
+static void
+push_range(lcs_split_baton_t *sb,
+           apr_off_t start0, apr_off_t end0,
+           apr_off_t start1, apr_off_t end1,
+           svn_boolean_t is_match)
+{
+  lcs_range_t *range = apr_array_push(sb->stack);
+
+  range->start[0] = start0;
+  range->end[0] = end0;
+  range->start[1] = start1;
+  range->end[1] = end1;
+  range->is_match = is_match;
+}
+
+/* Find the middle snake of a minimal edit script between the N tokens A
+ * and the M tokens B, which must not be empty, using the arrays FORWARD
+ * and BACKWARD of SB.  Set *X0, *Y0 to the start and *X1, *Y1 to the
+ * end of the snake, relative to A and B.
+ */
+static void
+find_middle_snake(apr_off_t *x0, apr_off_t *y0,
+                  apr_off_t *x1, apr_off_t *y1,
+                  const svn_diff__token_index_t *a, apr_off_t n,
+                  const svn_diff__token_index_t *b, apr_off_t m,
+                  lcs_split_baton_t *sb)
+{
+  apr_off_t *forward = sb->forward;
+  apr_off_t *backward = sb->backward;
+  apr_off_t delta = n - m;
+  svn_boolean_t odd = (delta & 1) != 0;
+  apr_off_t d, k, x, y, start_x;
+
+  /* The diagonal K is the difference X - Y of the points on it.  For the
+     backward search, X and Y count from the end of the sources, so its
+     diagonal K is the forward diagonal DELTA - K. */
+  forward[1] = 0;
+  backward[1] = 0;
+
+  for (d = 0; ; d++)
+    {
+      for (k = -d; k <= d; k += 2)
+        {
+          if (k == -d || (k != d && forward[k - 1] < forward[k + 1]))
+            x = forward[k + 1];
+          else
+            x = forward[k - 1] + 1;
+          y = x - k;
+          start_x = x;
+
+          while (x < n && y < m && a[x] == b[y])
+            {
+              x++;
+              y++;
+            }
+          forward[k] = x;
+
+          if (odd && delta - k >= -(d - 1) && delta - k <= d - 1
+              && x + backward[delta - k] >= n)
+            {
+              *x0 = start_x;
+              *y0 = start_x - k;
+              *x1 = x;
+              *y1 = y;
+              return;
+            }
+        }
+
+      for (k = -d; k <= d; k += 2)
+        {
+          if (k == -d || (k != d && backward[k - 1] < backward[k + 1]))
+            x = backward[k + 1];
+          else
+            x = backward[k - 1] + 1;
+          y = x - k;
+          start_x = x;
+
+          while (x < n && y < m && a[n - 1 - x] == b[m - 1 - y])
+            {
+              x++;
+              y++;
+            }
+          backward[k] = x;
+
+          if (!odd && delta - k >= -d && delta - k <= d
+              && x + forward[delta - k] >= n)
+            {
+              *x0 = n - x;
+              *y0 = m - y;
+              *x1 = n - start_x;
+              *y1 = m - (start_x - k);
+              return;
+            }
+        }
+    }
+}
+
+/* Look for the longest run of matching tokens in the ranges of RANGE
+ * whose least frequent token is as infrequent as possible in the first
+ * range, using the histogram arrays of SB.  If there is one, set
+ * *X0, *Y0, *LENGTH to its start and length and *FOUND to TRUE.  Set
+ * *ANY_COMMON to whether the ranges have any tokens in common at all.
+ */
+static void
+find_histogram_split(svn_boolean_t *found,
+                     svn_boolean_t *any_common,
+                     apr_off_t *x0, apr_off_t *y0, apr_off_t *length,
+                     const lcs_range_t *range,
+                     lcs_split_baton_t *sb)
+{
+  const svn_diff__token_index_t *a = sb->token[0];
+  const svn_diff__token_index_t *b = sb->token[1];
+  apr_off_t best_count = HISTOGRAM_MAX_CHAIN;
+  apr_off_t i, j, next_j;
+
+  *found = FALSE;
+  *any_common = FALSE;
+  *length = 0;
+
+  /* Index the first range, so that each chain of positions with the
+     same token is in ascending order. */
+  for (i = range->end[0] - 1; i >= range->start[0]; i--)
+    {
+      sb->next_same[i] = sb->count[a[i]] ? sb->first[a[i]] : -1;
+      sb->first[a[i]] = i;
+      sb->count[a[i]]++;
+    }
+
+  for (j = range->start[1]; j < range->end[1]; j = next_j)
+    {
+      apr_off_t count = sb->count[b[j]];
+
+      next_j = j + 1;
+      if (count == 0)
+        continue;
+
+      *any_common = TRUE;
+      if (count > best_count)
+        continue;
+
+      for (i = sb->first[b[j]]; i != -1; i = sb->next_same[i])
+        {
+          apr_off_t start0 = i, start1 = j;
+          apr_off_t end0 = i + 1, end1 = j + 1;
+          apr_off_t region_count = count;
+          apr_off_t k;
+
+          while (start0 > range->start[0] && start1 > range->start[1]
+                 && a[start0 - 1] == b[start1 - 1])
+            {
+              start0--;
+              start1--;
+            }
+          while (end0 < range->end[0] && end1 < range->end[1]
+                 && a[end0] == b[end1])
+            {
+              end0++;
+              end1++;
+            }
+
+          /* Don't look at the tokens of this run again. */
+          if (end1 > next_j)
+            next_j = end1;
+
+          for (k = start0; k < end0; k++)
+            if (sb->count[a[k]] < region_count)
+              region_count = sb->count[a[k]];
+
+          if (region_count < best_count
+              || (region_count == best_count && end0 - start0 > *length))
+            {
+              *found = TRUE;
+              *x0 = start0;
+              *y0 = start1;
+              *length = end0 - start0;
+              best_count = region_count;
+            }
+        }
+    }
+
+  for (i = range->start[0]; i < range->end[0]; i++)
+    sb->count[a[i]] = 0;
+}
+
+/* Find the matching tokens of the ranges in RANGE, adding them to SB
+   and pushing the ranges that remain to be compared to its stack. */
+static void
+split_range(lcs_range_t range,
+            lcs_split_baton_t *sb)
+{
+  const svn_diff__token_index_t *a = sb->token[0];
+  const svn_diff__token_index_t *b = sb->token[1];
+  apr_off_t start0 = range.start[0];
+  apr_off_t start1 = range.start[1];
+  apr_off_t end0 = range.end[0];
+  apr_off_t end1 = range.end[1];
+  apr_off_t x0, y0, x1, y1;
+
+  /* Common tokens at the start can be added right away, since everything
+     before RANGE has already been handled. */
+  while (range.start[0] < range.end[0] && range.start[1] < range.end[1]
+         && a[range.start[0]] == b[range.start[1]])
+    {
+      range.start[0]++;
+      range.start[1]++;
+    }
+  add_match(sb, start0, start1, range.start[0] - start0);
+
+  /* Common tokens at the end have to wait for the rest of RANGE. */
+  while (range.start[0] < range.end[0] && range.start[1] < range.end[1]
+         && a[range.end[0] - 1] == b[range.end[1] - 1])
+    {
+      range.end[0]--;
+      range.end[1]--;
+    }
+  if (end0 > range.end[0])
+    push_range(sb, range.end[0], end0, range.end[1], end1, TRUE);
+
+  /* Everything left is either inserted or deleted. */
+  if (range.start[0] == range.end[0] || range.start[1] == range.end[1])
+    return;
+
+  if (sb->algorithm == svn_diff_file_algorithm_histogram)
+    {
+      svn_boolean_t found, any_common;
+      apr_off_t length;
+
+      find_histogram_split(&found, &any_common, &x0, &y0, &length,
+                           &range, sb);
+      if (found)
+        {
+          push_range(sb, x0 + length, range.end[0], y0 + length,
+                     range.end[1], FALSE);
+          push_range(sb, x0, x0 + length, y0, y0 + length, TRUE);
+          push_range(sb, range.start[0], x0, range.start[1], y0, FALSE);
+          return;
+        }
+
+      /* Without any common tokens, nothing matches. */
+      if (!any_common)
+        return;
+    }
+
+  find_middle_snake(&x0, &y0, &x1, &y1,
+                    a + range.start[0], range.end[0] - range.start[0],
+                    b + range.start[1], range.end[1] - range.start[1],
+                    sb);
+  x0 += range.start[0];
+  y0 += range.start[1];
+  x1 += range.start[0];
+  y1 += range.start[1];
+
+  push_range(sb, x1, range.end[0], y1, range.end[1], FALSE);
+  if (x1 > x0)
+    push_range(sb, x0, x1, y0, y1, TRUE);
+  push_range(sb, range.start[0], x0, range.start[1], y0, FALSE);
+}
+
+/* Return the chain of matching tokens between the non-empty position
+ * rings POSITION_LIST1 and POSITION_LIST2, which have NUM_TOKENS different
+ * tokens occurring as often as TOKEN_COUNTS_LIST1 and TOKEN_COUNTS_LIST2
+ * say, found by ALGORITHM.  The chain is in the order of the sources and
+ * is not terminated by an EOF element.  Allocate it in POOL.
+ */
+static svn_diff__lcs_t *
+lcs_by_splitting(svn_diff__position_t *position_list1,
+                 svn_diff__position_t *position_list2,
+                 svn_diff__token_index_t *token_counts_list1,
+                 svn_diff__token_index_t *token_counts_list2,
+                 svn_diff__token_index_t num_tokens,
+                 svn_diff_file_algorithm_t algorithm,
+                 apr_pool_t *pool)
+{
+  lcs_split_baton_t sb;
+  svn_diff__position_t *position_list[2];
+  svn_diff__token_index_t *token_counts[2];
+  apr_off_t length[2];
+  apr_off_t max_d;
+  apr_pool_t *scratch_pool = svn_pool_create(pool);
+  int i;
+
+  position_list[0] = position_list1;
+  position_list[1] = position_list2;
+  token_counts[0] = token_counts_list1;
+  token_counts[1] = token_counts_list2;
+
+  /* Tokens that don't occur in the other source can never match, so
+     leave them out, just like the O(NP) algorithm skips over them. */
+  for (i = 0; i < 2; i++)
+    {
+      svn_diff__position_t *position = position_list[i]->next;
+      apr_off_t size = position_list[i]->offset - position->offset + 1;
+      apr_off_t j;
+
+      sb.position[i] = apr_palloc(scratch_pool,
+                                  size * sizeof(*sb.position[i]));
+      sb.token[i] = apr_palloc(scratch_pool, size * sizeof(*sb.token[i]));
+      length[i] = 0;
+      for (j = 0; j < size; j++)
+        {
+          if (token_counts[1 - i][position->token_index] > 0)
+            {
+              sb.position[i][length[i]] = position;
+              sb.token[i][length[i]] = position->token_index;
+              length[i]++;
+            }
+          position = position->next;
+        }
+    }
+
+  sb.algorithm = algorithm;
+  sb.stack = apr_array_make(scratch_pool, 64, sizeof(lcs_range_t));
+  max_d = (length[0] + length[1] + 1) / 2;
+  sb.forward = apr_palloc(scratch_pool,
+                          (2 * max_d + 3) * sizeof(*sb.forward));
+  sb.forward += max_d + 1;
+  sb.backward = apr_palloc(scratch_pool,
+                           (2 * max_d + 3) * sizeof(*sb.backward));
+  sb.backward += max_d + 1;
+  if (algorithm == svn_diff_file_algorithm_histogram)
+    {
+      sb.count = apr_pcalloc(scratch_pool, num_tokens * sizeof(*sb.count));
+      sb.first = apr_palloc(scratch_pool, num_tokens * sizeof(*sb.first));
+      sb.next_same = apr_palloc(scratch_pool,
+                                length[0] * sizeof(*sb.next_same));
+    }
+  sb.lcs = NULL;
+  sb.last_lcs = NULL;
+  sb.pool = pool;
+
+  push_range(&sb, 0, length[0], 0, length[1], FALSE);
+  while (sb.stack->nelts)
+    {
+      lcs_range_t range = *(lcs_range_t *)apr_array_pop(sb.stack);
+
+      if (range.is_match)
+        add_match(&sb, range.start[0], range.start[1],
+                  range.end[0] - range.start[0]);
+      else
+        split_range(range, &sb);
+    }
+
+  svn_pool_destroy(scratch_pool);
+
+  return sb.lcs;
+}
+
+
 svn_diff__lcs_t *
 svn_diff__lcs(svn_diff__position_t *position_list1, /* pointer to tail (ring) */
               svn_diff__position_t *position_list2, /* pointer to tail (ring) */
@@ -236,6 +698,7 @@ svn_diff__lcs(svn_diff__position_t *position_list1, /* pointer to tail (ring) */
               svn_diff__token_index_t num_tokens,
               apr_off_t prefix_lines,
               apr_off_t suffix_lines,
+              svn_diff_file_algorithm_t algorithm,
               apr_pool_t *pool)
 {
   apr_off_t length[2];
@@ -279,6 +742,32 @@ svn_diff__lcs(svn_diff__position_t *position_list1, /* pointer to tail (ring) */
       return lcs;
     }
 
+  if (algorithm != svn_diff_file_algorithm_myers)
+    {
+      svn_diff__lcs_t *eof_lcs = lcs;
+      svn_diff__lcs_t **lcs_ref;
+
+      lcs = lcs_by_splitting(position_list1, position_list2,
+                             token_counts_list1, token_counts_list2,
+                             num_tokens, algorithm, pool);
+
+      for (lcs_ref = &lcs; *lcs_ref; lcs_ref = &(*lcs_ref)->next)
+        ;
+
+      if (suffix_lines)
+        *lcs_ref = prepend_lcs(eof_lcs, suffix_lines,
+                               eof_lcs->position[0]->offset - suffix_lines,
+                               eof_lcs->position[1]->offset - suffix_lines,
+                               pool);
+      else
+        *lcs_ref = eof_lcs;
+
+      if (prefix_lines)
+        lcs = prepend_lcs(lcs, prefix_lines, 1, 1, pool);
+
+      return lcs;
+    }
+
   unique_count[1] = unique_count[0] = 0;
   for (token_index = 0; token_index < num_tokens; token_index++)
     {
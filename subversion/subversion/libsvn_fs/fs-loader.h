@@ -427,6 +427,16 @@ typedef struct root_vtable_t
                                 svn_fs_mergeinfo_receiver_t receiver,
                                 void *baton,
                                 apr_pool_t *scratch_pool);
+
+  /* Optional.  If NULL, svn_fs_file_contents_location() reports the
+     contents as not being available. */
+  svn_error_t *(*file_contents_location)(apr_file_t **file,
+                                         apr_off_t *offset,
+                                         svn_filesize_t *length,
+                                         svn_fs_root_t *root,
+                                         const char *path,
+                                         apr_pool_t *result_pool,
+                                         apr_pool_t *scratch_pool);
 } root_vtable_t;
 
 
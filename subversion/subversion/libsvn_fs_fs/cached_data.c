@@ -744,6 +744,10 @@ typedef struct rep_state_t
   int ver;          /* If a delta, what svndiff version?
                        -1 for unknown delta version. */
   int chunk_index;  /* number of the window to read */
+                    /* If not NULL, the SIZE bytes of raw rep data
+                       starting at START, read ahead of time.  Windows
+                       will then be taken from here instead of SFILE. */
+  svn_stringbuf_t *prefetched;
 } rep_state_t;
 
 /* Simple wrapper around svn_io_file_get_offset to simplify callers. */
@@ -1541,6 +1545,366 @@ rep_read_get_baton(struct rep_read_baton **rb_p,
   return SVN_NO_ERROR;
 }
 
+/* Delta chain prefetching.
+ *
+ * Once build_rep_list() has found all members of a delta chain, we know
+ * exactly which parts of which rev / pack files we will need.  Reading
+ * them one window at a time, alternating between chain members, results
+ * in many small, dependent reads.  On cold caches and high-latency
+ * storage, that is where most of the time goes.
+ *
+ * Therefore, prefetch_rep_list() reads the raw data of all uncached chain
+ * members concurrently into memory using up to PREFETCH_THREADS worker
+ * threads.  Each worker uses its own file handle and touches nothing but
+ * its own buffers.  The windows will then be parsed, combined and cached
+ * from these buffers as usual.
+ *
+ * Prefetching is purely an optimization.  Any failure will simply leave
+ * the respective rep_state_t to read from its file as before.
+ */
+
+/* Don't prefetch representations larger than this.  They contain more
+ * than enough windows to keep the disk busy on their own. */
+#define PREFETCH_MAX_REP_SIZE (16 * SVN_DELTA_WINDOW_SIZE)
+
+/* Don't prefetch more than this many bytes per delta chain. */
+#define PREFETCH_MAX_TOTAL_SIZE (256 * SVN_DELTA_WINDOW_SIZE)
+
+/* Baton type for prefetch_stream_read. */
+typedef struct prefetch_stream_baton_t
+{
+  /* The prefetched data. */
+  const svn_stringbuf_t *data;
+
+  /* Current read position within DATA. */
+  apr_size_t pos;
+} prefetch_stream_baton_t;
+
+/* Implement svn_read_fn_t, reading from a prefetch_stream_baton_t. */
+static svn_error_t *
+prefetch_stream_read(void *baton,
+                     char *buffer,
+                     apr_size_t *len)
+{
+  prefetch_stream_baton_t *b = baton;
+  apr_size_t remaining = b->data->len - b->pos;
+  if (*len > remaining)
+    *len = remaining;
+
+  memcpy(buffer, b->data->data + b->pos, *len);
+  b->pos += *len;
+
+  return SVN_NO_ERROR;
+}
+
+/* Like read_delta_window but take the data from RS->PREFETCHED. */
+static svn_error_t *
+read_prefetched_window(svn_txdelta_window_t **nwin,
+                       int this_chunk,
+                       rep_state_t *rs,
+                       apr_pool_t *result_pool,
+                       apr_pool_t *scratch_pool)
+{
+  prefetch_stream_baton_t baton;
+  svn_stream_t *stream;
+  apr_pool_t *iterpool;
+
+  /* Same as auto_read_diff_version. */
+  if (rs->ver == -1)
+    {
+      const char *buf = rs->prefetched->data;
+      if (   rs->prefetched->len < 4
+          || !((buf[0] == 'S') && (buf[1] == 'V') && (buf[2] == 'N')))
+        return svn_error_create
+          (SVN_ERR_FS_CORRUPT, NULL,
+           _("Malformed svndiff data in representation"));
+      rs->ver = buf[3];
+
+      rs->chunk_index = 0;
+      rs->current = 4;
+    }
+
+  baton.data = rs->prefetched;
+  baton.pos = (apr_size_t)rs->current;
+  stream = svn_stream_create(&baton, scratch_pool);
+  svn_stream_set_read2(stream, NULL, prefetch_stream_read);
+
+  /* Skip windows to reach the current chunk if we aren't there yet. */
+  iterpool = svn_pool_create(scratch_pool);
+  while (rs->chunk_index < this_chunk)
+    {
+      svn_txdelta_window_t *skipped;
+
+      svn_pool_clear(iterpool);
+      SVN_ERR(svn_txdelta_read_svndiff_window(&skipped, stream, rs->ver,
+                                              iterpool));
+      rs->chunk_index++;
+      rs->current = baton.pos;
+      if (rs->current >= rs->size)
+        return svn_error_create(SVN_ERR_FS_CORRUPT, NULL,
+                                _("Reading one svndiff window read "
+                                  "beyond the end of the "
+                                  "representation"));
+    }
+  svn_pool_destroy(iterpool);
+
+  /* Actually read the next window. */
+  SVN_ERR(svn_txdelta_read_svndiff_window(nwin, stream, rs->ver,
+                                          result_pool));
+  rs->current = baton.pos;
+  if (rs->current > rs->size)
+    return svn_error_create(SVN_ERR_FS_CORRUPT, NULL,
+                            _("Reading one svndiff window read beyond "
+                              "the end of the representation"));
+
+  return svn_error_trace(set_cached_window(*nwin, rs, scratch_pool));
+}
+
+#if APR_HAS_THREADS
+
+/* A single rep to prefetch. */
+typedef struct prefetch_item_t
+{
+  /* The rep to read ahead for. */
+  rep_state_t *rs;
+
+  /* Rev / pack file containing it. */
+  const char *path;
+
+  /* Buffer of RS->SIZE bytes to fill. */
+  svn_stringbuf_t *buffer;
+
+  /* Outcome of the read. */
+  svn_error_t *result;
+} prefetch_item_t;
+
+/* State of a prefetch worker thread. */
+typedef struct prefetch_job_t
+{
+  /* Thread-safe root pool containing this struct.  Private to the worker
+     until it has been joined. */
+  apr_pool_t *pool;
+
+  /* The thread running the reads. */
+  apr_thread_t *thread;
+
+  /* All prefetch_item_t * of this run.  This worker handles the elements
+     FIRST, FIRST + STRIDE, FIRST + 2 * STRIDE etc. */
+  apr_array_header_t *items;
+  int first;
+  int stride;
+} prefetch_job_t;
+
+/* Read ITEM->BUFFER->LEN bytes from ITEM->PATH, starting at ITEM->RS's
+ * start offset.  Use SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+prefetch_item(prefetch_item_t *item,
+              apr_pool_t *scratch_pool)
+{
+  apr_file_t *file;
+  apr_off_t offset = item->rs->start;
+
+  SVN_ERR(svn_io_file_open(&file, item->path, APR_READ, APR_OS_DEFAULT,
+                           scratch_pool));
+  SVN_ERR(svn_io_file_seek(file, APR_SET, &offset, scratch_pool));
+  SVN_ERR(svn_io_file_read_full2(file, item->buffer->data,
+                                 item->buffer->len, NULL, NULL,
+                                 scratch_pool));
+
+  return svn_error_trace(svn_io_file_close(file, scratch_pool));
+}
+
+/* Thread function running the prefetch_job_t given by DATA. */
+static void * APR_THREAD_FUNC
+prefetch_job_run(apr_thread_t *tid,
+                 void *data)
+{
+  prefetch_job_t *job = data;
+  apr_pool_t *iterpool = svn_pool_create(job->pool);
+  int i;
+
+  for (i = job->first; i < job->items->nelts; i += job->stride)
+    {
+      prefetch_item_t *item = APR_ARRAY_IDX(job->items, i, prefetch_item_t *);
+
+      svn_pool_clear(iterpool);
+      item->result = prefetch_item(item, iterpool);
+    }
+
+  svn_pool_destroy(iterpool);
+  apr_thread_exit(tid, APR_SUCCESS);
+
+  return NULL;
+}
+
+/* Return TRUE if the first window of RS needs to be read from disk,
+ * i.e. if prefetching RS would be useful. */
+static svn_boolean_t
+needs_prefetch(rep_state_t *rs,
+               apr_pool_t *scratch_pool)
+{
+  window_cache_key_t key = { 0 };
+  svn_boolean_t is_cached = FALSE;
+  svn_error_t *err;
+
+  /* Fresh, committed reps of limited size only. */
+  if (   rs->prefetched
+      || !SVN_IS_VALID_REVNUM(rs->revision)
+      || rs->chunk_index != 0
+      || rs->size > PREFETCH_MAX_REP_SIZE)
+    return FALSE;
+
+  /* Delta windows might be in cache already. */
+  get_window_key(&key, rs);
+  if (rs->window_cache)
+    {
+      err = svn_cache__has_key(&is_cached, rs->window_cache, &key,
+                               scratch_pool);
+      svn_error_clear(err);
+    }
+  if (!is_cached && rs->raw_window_cache)
+    {
+      err = svn_cache__has_key(&is_cached, rs->raw_window_cache, &key,
+                               scratch_pool);
+      svn_error_clear(err);
+    }
+
+  return !is_cached;
+}
+
+/* Read the raw data of all members of the delta chain RS_LIST as well as
+ * of the plain base rep SRC_STATE (may be NULL) concurrently into memory,
+ * unless we don't need them or they are already in cache.  Use up to
+ * MAX_THREADS threads.  Allocate the buffers in RESULT_POOL and use
+ * SCRATCH_POOL for temporary allocations.
+ */
+static svn_error_t *
+prefetch_rep_list(apr_array_header_t *rs_list,
+                  rep_state_t *src_state,
+                  int max_threads,
+                  apr_pool_t *result_pool,
+                  apr_pool_t *scratch_pool)
+{
+  apr_array_header_t *candidates
+    = apr_array_make(scratch_pool, rs_list->nelts + 1, sizeof(rep_state_t *));
+  apr_array_header_t *items
+    = apr_array_make(scratch_pool, rs_list->nelts + 1,
+                     sizeof(prefetch_item_t *));
+  prefetch_job_t **jobs;
+  apr_off_t total_size = 0;
+  int stride;
+  int thread_count;
+  int i;
+
+  /* Prefetching a single rep gains nothing over the sequential read. */
+  if (max_threads < 2 || rs_list->nelts + (src_state ? 1 : 0) < 2)
+    return SVN_NO_ERROR;
+
+  for (i = 0; i < rs_list->nelts; ++i)
+    APR_ARRAY_PUSH(candidates, rep_state_t *)
+      = APR_ARRAY_IDX(rs_list, i, rep_state_t *);
+  if (src_state && src_state->current == 0)
+    APR_ARRAY_PUSH(candidates, rep_state_t *) = src_state;
+
+  /* Determine what to read and from where.  This may need to consult the
+   * indexes and must therefore happen in this thread. */
+  for (i = 0; i < candidates->nelts; ++i)
+    {
+      rep_state_t *rs = APR_ARRAY_IDX(candidates, i, rep_state_t *);
+      prefetch_item_t *item;
+      const char *path;
+      svn_error_t *err;
+
+      if (   !needs_prefetch(rs, scratch_pool)
+          || total_size + rs->size > PREFETCH_MAX_TOTAL_SIZE)
+        continue;
+
+      err = auto_open_shared_file(rs->sfile);
+      if (!err)
+        err = auto_set_start_offset(rs, scratch_pool);
+      if (!err)
+        err = svn_io_file_name_get(&path, rs->sfile->rfile->file,
+                                   scratch_pool);
+      if (err)
+        {
+          /* Just read it the normal way later. */
+          svn_error_clear(err);
+          continue;
+        }
+
+      item = apr_pcalloc(scratch_pool, sizeof(*item));
+      item->rs = rs;
+      item->path = path;
+      item->buffer = svn_stringbuf_create_ensure((apr_size_t)rs->size,
+                                                 result_pool);
+      item->buffer->len = (apr_size_t)rs->size;
+      item->buffer->data[item->buffer->len] = '\0';
+      APR_ARRAY_PUSH(items, prefetch_item_t *) = item;
+
+      total_size += rs->size;
+    }
+
+  if (items->nelts < 2)
+    return SVN_NO_ERROR;
+
+  /* Read everything concurrently. */
+  stride = MIN(max_threads, items->nelts);
+  jobs = apr_pcalloc(scratch_pool, stride * sizeof(*jobs));
+  for (thread_count = 0; thread_count < stride; ++thread_count)
+    {
+      apr_pool_t *pool = svn_pool_create(NULL);
+      prefetch_job_t *job = apr_pcalloc(pool, sizeof(*job));
+      apr_status_t status;
+
+      job->pool = pool;
+      job->items = items;
+      job->first = thread_count;
+      job->stride = stride;
+
+      status = apr_thread_create(&job->thread, NULL, prefetch_job_run, job,
+                                 pool);
+      if (status)
+        {
+          svn_pool_destroy(pool);
+          break;
+        }
+
+      jobs[thread_count] = job;
+    }
+
+  /* If we could not start all threads, read their share in this one. */
+  for (i = 0; i < items->nelts; ++i)
+    if (i % stride >= thread_count)
+      {
+        prefetch_item_t *item = APR_ARRAY_IDX(items, i, prefetch_item_t *);
+        item->result = prefetch_item(item, scratch_pool);
+      }
+
+  for (i = 0; i < thread_count; ++i)
+    {
+      apr_status_t retval;
+      apr_status_t status = apr_thread_join(&retval, jobs[i]->thread);
+      svn_pool_destroy(jobs[i]->pool);
+
+      if (status)
+        return svn_error_wrap_apr(status, _("Can't join prefetch thread"));
+    }
+
+  /* Hand the data to the successfully prefetched reps. */
+  for (i = 0; i < items->nelts; ++i)
+    {
+      prefetch_item_t *item = APR_ARRAY_IDX(items, i, prefetch_item_t *);
+      if (item->result)
+        svn_error_clear(item->result);
+      else
+        item->rs->prefetched = item->buffer;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+#endif /* APR_HAS_THREADS */
+
 /* Skip forwards to THIS_CHUNK in REP_STATE and then read the next delta
    window into *NWIN.  Note that RS->CHUNK_INDEX will be THIS_CHUNK rather
    than THIS_CHUNK + 1 when this function returns. */
@@ -1565,6 +1929,12 @@ read_delta_window(svn_txdelta_window_t **nwin, int this_chunk,
   if (is_cached)
     return SVN_NO_ERROR;
 
+  /* The data may have been read ahead of time by prefetch_rep_list(). */
+  if (rs->prefetched)
+    return svn_error_trace(read_prefetched_window(nwin, this_chunk, rs,
+                                                  result_pool,
+                                                  scratch_pool));
+
   /* someone has to actually read the data from file.  Open it */
   SVN_ERR(auto_open_shared_file(rs->sfile));
 
@@ -1641,6 +2011,21 @@ read_plain_window(svn_stringbuf_t **nwin, rep_state_t *rs,
 {
   apr_off_t offset;
 
+  /* Use data that has been read ahead of time, if available. */
+  if (rs->prefetched)
+    {
+      if (rs->current + (apr_off_t)size > (apr_off_t)rs->prefetched->len)
+        return svn_error_create(SVN_ERR_FS_CORRUPT, NULL,
+                                _("Reading one plain window read beyond "
+                                  "the end of the representation"));
+
+      *nwin = svn_stringbuf_ncreate(rs->prefetched->data + rs->current,
+                                    size, result_pool);
+      rs->current += (apr_off_t)size;
+
+      return SVN_NO_ERROR;
+    }
+
   /* RS->FILE may be shared between RS instances -> make sure we point
    * to the right data. */
   SVN_ERR(auto_open_shared_file(rs->sfile));
@@ -2134,6 +2519,17 @@ rep_read_contents(void *baton,
                              &rb->src_state, rb->fs, &rb->rep,
                              rb->filehandle_pool));
 
+#if APR_HAS_THREADS
+      /* On cold caches, read all chain members concurrently. */
+      if (!rb->base_window)
+        {
+          fs_fs_data_t *ffd = rb->fs->fsap_data;
+          SVN_ERR(prefetch_rep_list(rb->rs_list, rb->src_state,
+                                    ffd->prefetch_threads,
+                                    rb->filehandle_pool, rb->pool));
+        }
+#endif
+
       /* In case we did read from the fulltext cache before, make the
        * window stream catch up.  Also, initialize the fulltext buffer
        * if we want to cache the fulltext at the end. */
@@ -2418,6 +2814,45 @@ svn_fs_fs__try_process_file_contents(svn_boolean_t *success,
   return SVN_NO_ERROR;
 }
 
+svn_error_t *
+svn_fs_fs__get_contents_location(apr_file_t **file,
+                                 apr_off_t *offset,
+                                 svn_filesize_t *length,
+                                 svn_fs_t *fs,
+                                 node_revision_t *noderev,
+                                 apr_pool_t *result_pool,
+                                 apr_pool_t *scratch_pool)
+{
+  representation_t *rep = noderev->data_rep;
+  svn_fs_fs__revision_file_t *rev_file;
+  svn_fs_fs__rep_header_t *rep_header;
+
+  *file = NULL;
+
+  /* Empty files and reps in transactions don't qualify.  Neither do
+     reps that are obviously not PLAIN. */
+  if (   !rep
+      || svn_fs_fs__id_txn_used(&rep->txn_id)
+      || rep->size == 0
+      || (rep->expanded_size && rep->expanded_size != rep->size))
+    return SVN_NO_ERROR;
+
+  /* The rev file must outlive this call. */
+  SVN_ERR(open_and_seek_revision(&rev_file, fs, rep->revision,
+                                 rep->item_index, result_pool));
+  SVN_ERR(svn_fs_fs__read_rep_header(&rep_header, rev_file->stream,
+                                     scratch_pool, scratch_pool));
+  if (rep_header->type != svn_fs_fs__rep_plain)
+    return svn_error_trace(svn_fs_fs__close_revision_file(rev_file));
+
+  /* The contents follow the header immediately. */
+  SVN_ERR(svn_io_file_get_offset(offset, rev_file->file, scratch_pool));
+  *length = rep->size;
+  *file = rev_file->file;
+
+  return SVN_NO_ERROR;
+}
+
 
 /* Baton used when reading delta windows. */
 struct delta_read_baton
@@ -346,17 +346,55 @@ create_cache(svn_cache__t **cache_p,
   return SVN_NO_ERROR;
 }
 
+/* If DISK is not NULL, replace *CACHE_P with a cache that uses the
+ * current *CACHE_P as first level and DISK as persistent second level.
+ * SERIALIZER, DESERIALIZER, KLEN, PREFIX, FS and NO_HANDLER must be the
+ * same as were passed to create_cache() for *CACHE_P.
+ *
+ * The combined cache is allocated in RESULT_POOL.
+ */
+static svn_error_t *
+add_disk_cache(svn_cache__t **cache_p,
+               svn_cache__disk_t *disk,
+               svn_cache__serialize_func_t serializer,
+               svn_cache__deserialize_func_t deserializer,
+               apr_ssize_t klen,
+               const char *prefix,
+               svn_fs_t *fs,
+               svn_boolean_t no_handler,
+               apr_pool_t *result_pool)
+{
+  if (disk == NULL || *cache_p == NULL)
+    return SVN_NO_ERROR;
+
+  /* Report errors only once, at the outer level. */
+  SVN_ERR(svn_cache__set_error_handler(*cache_p, NULL, NULL, result_pool));
+  SVN_ERR(svn_cache__create_disk_backed(cache_p, *cache_p, disk,
+                                        serializer, deserializer, klen,
+                                        prefix, result_pool));
+  SVN_ERR(init_callbacks(*cache_p, fs,
+                         no_handler ? NULL : warn_and_fail_on_cache_errors,
+                         result_pool));
+
+  return SVN_NO_ERROR;
+}
+
 svn_error_t *
 svn_fs_fs__initialize_caches(svn_fs_t *fs,
                              apr_pool_t *pool)
 {
   fs_fs_data_t *ffd = fs->fsap_data;
+  /* The instance ID distinguishes repositories that have been replaced
+     at the same path with the same UUID.  That matters to the disk cache,
+     which outlives the processes that filled it. */
   const char *prefix = apr_pstrcat(pool,
                                    "fsfs:", fs->uuid,
+                                   ":", ffd->instance_id,
                                    "/", normalize_key_part(fs->path, pool),
                                    ":",
                                    SVN_VA_NULL);
   svn_membuffer_t *membuffer;
+  svn_cache__disk_t *disk = NULL;
   svn_boolean_t no_handler = ffd->fail_stop;
   svn_boolean_t cache_txdeltas;
   svn_boolean_t cache_fulltexts;
@@ -377,6 +415,25 @@ svn_fs_fs__initialize_caches(svn_fs_t *fs,
 
   membuffer = svn_cache__get_global_membuffer_cache();
 
+  /* The persistent cache is only useful for keys that remain valid across
+   * process restarts.  Unless we are told to fail on cache errors, run
+   * without it if the file cannot be used - e.g. due to missing write
+   * access. */
+  if (ffd->disk_cache_size > 0 && membuffer && !has_namespace)
+    {
+      svn_error_t *err = svn_cache__get_disk_cache(&disk,
+                                                   ffd->disk_cache_path,
+                                                   ffd->disk_cache_size,
+                                                   pool);
+      if (err && !ffd->fail_stop)
+        {
+          svn_error_clear(err);
+          disk = NULL;
+        }
+      else
+        SVN_ERR(err);
+    }
+
   /* General rules for assigning cache priorities:
    *
    * - Data that can be reconstructed from other elements has low prio
@@ -547,6 +604,15 @@ svn_fs_fs__initialize_caches(svn_fs_t *fs,
                            no_handler,
                            fs->pool, pool));
 
+      /* memcached is persistent already. */
+      if (!ffd->memcache)
+        SVN_ERR(add_disk_cache(&(ffd->fulltext_cache), disk,
+                               NULL, NULL,
+                               sizeof(pair_cache_key_t),
+                               apr_pstrcat(pool, prefix, "TEXT",
+                                           SVN_VA_NULL),
+                               fs, no_handler, fs->pool));
+
       SVN_ERR(create_cache(&(ffd->mergeinfo_cache),
                            NULL,
                            membuffer,
@@ -639,6 +705,13 @@ svn_fs_fs__initialize_caches(svn_fs_t *fs,
                            fs,
                            no_handler,
                            fs->pool, pool));
+      SVN_ERR(add_disk_cache(&(ffd->txdelta_window_cache), disk,
+                             svn_fs_fs__serialize_txdelta_window,
+                             svn_fs_fs__deserialize_txdelta_window,
+                             sizeof(window_cache_key_t),
+                             apr_pstrcat(pool, prefix, "TXDELTA_WINDOW",
+                                         SVN_VA_NULL),
+                             fs, no_handler, fs->pool));
 
       SVN_ERR(create_cache(&(ffd->combined_window_cache),
                            NULL,
@@ -654,6 +727,12 @@ svn_fs_fs__initialize_caches(svn_fs_t *fs,
                            fs,
                            no_handler,
                            fs->pool, pool));
+      SVN_ERR(add_disk_cache(&(ffd->combined_window_cache), disk,
+                             NULL, NULL,
+                             sizeof(window_cache_key_t),
+                             apr_pstrcat(pool, prefix, "COMBINED_WINDOW",
+                                         SVN_VA_NULL),
+                             fs, no_handler, fs->pool));
     }
   else
     {
@@ -46,6 +46,7 @@
 #include "util.h"
 #include "verify.h"
 #include "svn_private_config.h"
+#include "private/svn_batch_fsync.h"
 #include "private/svn_fs_util.h"
 
 #include "../libsvn_fs/fs-loader.h"
@@ -365,6 +366,37 @@ fs_open(svn_fs_t *fs,
   return SVN_NO_ERROR;
 }
 
+svn_error_t *
+svn_fs_fs__open_clone(svn_fs_t **clone_p,
+                      svn_fs_t *fs,
+                      apr_pool_t *result_pool,
+                      apr_pool_t *scratch_pool)
+{
+  fs_fs_data_t *ffd = fs->fsap_data;
+  fs_fs_data_t *clone_ffd;
+  svn_fs_t *clone = apr_pcalloc(result_pool, sizeof(*clone));
+
+  clone->pool = result_pool;
+  clone->warning = fs->warning;
+  clone->warning_baton = fs->warning_baton;
+  clone->config = fs->config;
+
+  SVN_ERR(initialize_fs_struct(clone));
+  SVN_ERR(svn_fs_fs__open(clone, fs->path, scratch_pool));
+  SVN_ERR(svn_fs_fs__initialize_caches(clone, scratch_pool));
+
+  /* The shared data is keyed by UUID and instance ID, both of which are
+     the same for FS and CLONE.  So, fs_serialized_init() would simply
+     give us the instance that FS already uses. */
+  clone_ffd = clone->fsap_data;
+  clone_ffd->shared = ffd->shared;
+  clone_ffd->svn_fs_open_ = ffd->svn_fs_open_;
+
+  *clone_p = clone;
+
+  return SVN_NO_ERROR;
+}
+
 
 
 /* This implements the fs_library_vtable_t.open_for_recovery() API. */
@@ -625,6 +657,8 @@ svn_fs_fs__init(const svn_version_t *loader_version,
                              loader_version->major);
   SVN_ERR(svn_ver_check_list2(fs_version(), checklist, svn_ver_equal));
 
+  SVN_ERR(svn_batch_fsync__init(common_pool));
+
   *vtable = &library_vtable;
   return SVN_NO_ERROR;
 }
@@ -78,6 +78,8 @@ extern "C" {
                                                     to-log index */
 /* If you change this, look at tests/svn_test_fs.c(maybe_install_fsfs_conf) */
 #define PATH_CONFIG           "fsfs.conf"        /* Configuration */
+#define PATH_DISK_CACHE       "disk-cache"       /* Default location of the
+                                                    persistent cache file */
 
 /* Names of special files and file extensions for transactions */
 #define PATH_CHANGES       "changes"       /* Records changes made so far */
@@ -100,6 +102,8 @@ extern "C" {
 /* Names of sections and options in fsfs.conf. */
 #define CONFIG_SECTION_CACHES            "caches"
 #define CONFIG_OPTION_FAIL_STOP          "fail-stop"
+#define CONFIG_OPTION_DISK_CACHE_SIZE    "disk-cache-size"
+#define CONFIG_OPTION_DISK_CACHE_PATH    "disk-cache-path"
 #define CONFIG_SECTION_REP_SHARING       "rep-sharing"
 #define CONFIG_OPTION_ENABLE_REP_SHARING "enable-rep-sharing"
 #define CONFIG_SECTION_DELTIFICATION     "deltification"
@@ -107,6 +111,7 @@ extern "C" {
 #define CONFIG_OPTION_ENABLE_PROPS_DELTIFICATION "enable-props-deltification"
 #define CONFIG_OPTION_MAX_DELTIFICATION_WALK     "max-deltification-walk"
 #define CONFIG_OPTION_MAX_LINEAR_DELTIFICATION   "max-linear-deltification"
+#define CONFIG_OPTION_PLAIN_FULLTEXT_SIZE        "plain-fulltext-size"
 #define CONFIG_OPTION_COMPRESSION_LEVEL  "compression-level"
 #define CONFIG_SECTION_PACKED_REVPROPS   "packed-revprops"
 #define CONFIG_OPTION_REVPROP_PACK_SIZE  "revprop-pack-size"
@@ -115,6 +120,7 @@ extern "C" {
 #define CONFIG_OPTION_BLOCK_SIZE         "block-size"
 #define CONFIG_OPTION_L2P_PAGE_SIZE      "l2p-page-size"
 #define CONFIG_OPTION_P2L_PAGE_SIZE      "p2l-page-size"
+#define CONFIG_OPTION_PREFETCH_THREADS   "prefetch-threads"
 #define CONFIG_SECTION_DEBUG             "debug"
 #define CONFIG_OPTION_PACK_AFTER_COMMIT  "pack-after-commit"
 #define CONFIG_OPTION_VERIFY_BEFORE_COMMIT "verify-before-commit"
@@ -215,6 +221,14 @@ extern "C" {
    At 100..300 bytes per entry, this limits the allocation to ~30kB. */
 #define SVN_FS_FS__CHANGES_BLOCK_SIZE 100
 
+/* Upper limit to the number of worker threads that we will accept in the
+   SVN_FS_CONFIG_FSFS_JOBS setting. */
+#define SVN_FS_FS__MAX_JOBS SVN_FS_CONFIG_FSFS_JOBS_MAX
+
+/* Upper limit, in kBytes, to the plain-fulltext-size setting.  Commits
+   keep up to that much of each new file in memory. */
+#define SVN_FS_FS__MAX_PLAIN_FULLTEXT_SIZE 0x10000
+
 /* Private FSFS-specific data shared between all svn_txn_t objects that
    relate to a particular transaction in a filesystem (as identified
    by transaction id and filesystem UUID).  Objects of this type are
@@ -347,6 +361,10 @@ typedef struct fs_fs_data_t
    * (not just the one bit that we need, atm). */
   svn_boolean_t use_block_read;
 
+  /* Maximum number of threads to use when reading the members of a
+   * delta chain ahead of time.  Values < 2 disable prefetching. */
+  int prefetch_threads;
+
   /* The revision that was youngest, last time we checked. */
   svn_revnum_t youngest_rev_cache;
 
@@ -360,6 +378,13 @@ typedef struct fs_fs_data_t
      e.g. memcached may be ignored as caching is an optional feature. */
   svn_boolean_t fail_stop;
 
+  /* Size of the persistent second-level cache file in bytes.
+     0 disables it. */
+  apr_int64_t disk_cache_size;
+
+  /* Absolute path of the persistent second-level cache file. */
+  const char *disk_cache_path;
+
   /* A cache of revision root IDs, mapping from (svn_revnum_t *) to
      (svn_fs_id_t *).  (Not threadsafe.) */
   svn_cache__t *rev_root_id_cache;
@@ -493,6 +518,10 @@ typedef struct fs_fs_data_t
    * deltification history after which skip deltas will be used. */
   apr_int64_t max_linear_deltification;
 
+  /* File contents that would be stored as self-delta are stored PLAIN
+   * instead if they are at least this many bytes long.  0 disables it. */
+  apr_int64_t plain_fulltext_size;
+
   /* Compression type to use with txdelta storage format in new revs. */
   compression_type_t delta_compression_type;
 
@@ -514,6 +543,10 @@ typedef struct fs_fs_data_t
   /* Ensure that all filesystem changes are written to disk. */
   svn_boolean_t flush_to_disk;
 
+  /* Maximum number of worker threads to use for operations that support
+     concurrent processing, e.g. pack.  1 disables concurrency. */
+  int max_jobs;
+
   /* Pointer to svn_fs_open. */
   svn_error_t *(*svn_fs_open_)(svn_fs_t **, const char *, apr_hash_t *,
                                apr_pool_t *, apr_pool_t *);
@@ -788,6 +788,18 @@ read_config(fs_fs_data_t *ffd,
       ffd->max_linear_deltification = SVN_FS_FS_MAX_LINEAR_DELTIFICATION;
     }
 
+  /* PLAIN representations are understood by all formats. */
+  SVN_ERR(svn_config_get_int64(config, &ffd->plain_fulltext_size,
+                               CONFIG_SECTION_DELTIFICATION,
+                               CONFIG_OPTION_PLAIN_FULLTEXT_SIZE, 0));
+  if (   ffd->plain_fulltext_size < 0
+      || ffd->plain_fulltext_size > SVN_FS_FS__MAX_PLAIN_FULLTEXT_SIZE)
+    return svn_error_createf(SVN_ERR_BAD_CONFIG_VALUE, NULL,
+                             _("'%s' must be between 0 and %d"),
+                             CONFIG_OPTION_PLAIN_FULLTEXT_SIZE,
+                             SVN_FS_FS__MAX_PLAIN_FULLTEXT_SIZE);
+  ffd->plain_fulltext_size *= 0x400;
+
   /* Initialize revprop packing settings in ffd. */
   if (ffd->format >= SVN_FS_FS__MIN_PACKED_REVPROP_FORMAT)
     {
@@ -848,6 +860,22 @@ read_config(fs_fs_data_t *ffd,
       ffd->p2l_page_size = 0x100000;  /* Matches above default in bytes. */
     }
 
+  /* Delta chain prefetching works with all formats. */
+  {
+    apr_int64_t prefetch_threads;
+    SVN_ERR(svn_config_get_int64(config, &prefetch_threads,
+                                 CONFIG_SECTION_IO,
+                                 CONFIG_OPTION_PREFETCH_THREADS,
+                                 4));
+    if (prefetch_threads < 0 || prefetch_threads > SVN_FS_FS__MAX_JOBS)
+      return svn_error_createf(SVN_ERR_BAD_CONFIG_VALUE, NULL,
+                               _("'%s' must be between 0 and %d"),
+                               CONFIG_OPTION_PREFETCH_THREADS,
+                               SVN_FS_FS__MAX_JOBS);
+
+    ffd->prefetch_threads = (int)prefetch_threads;
+  }
+
   if (ffd->format >= SVN_FS_FS__MIN_PACKED_FORMAT)
     {
       SVN_ERR(svn_config_get_bool(config, &ffd->pack_after_commit,
@@ -945,6 +973,24 @@ read_config(fs_fs_data_t *ffd,
                               CONFIG_SECTION_CACHES, CONFIG_OPTION_FAIL_STOP,
                               FALSE));
 
+  /* Persistent second-level cache.  The size is given in MB. */
+  SVN_ERR(svn_config_get_int64(config, &ffd->disk_cache_size,
+                               CONFIG_SECTION_CACHES,
+                               CONFIG_OPTION_DISK_CACHE_SIZE, 0));
+  if (ffd->disk_cache_size < 0)
+    return svn_error_createf(SVN_ERR_BAD_CONFIG_VALUE, NULL,
+                             _("'%s' must not be negative"),
+                             CONFIG_OPTION_DISK_CACHE_SIZE);
+  ffd->disk_cache_size *= 0x100000;
+
+  svn_config_get(config, &ffd->disk_cache_path, CONFIG_SECTION_CACHES,
+                 CONFIG_OPTION_DISK_CACHE_PATH, PATH_DISK_CACHE);
+  ffd->disk_cache_path = svn_dirent_join(fs_path,
+                                         svn_dirent_internal_style(
+                                           ffd->disk_cache_path,
+                                           scratch_pool),
+                                         result_pool);
+
   return SVN_NO_ERROR;
 }
 
@@ -977,6 +1023,17 @@ write_config(svn_fs_t *fs,
 "### configured (and ignoring it with file:// access).  To make"             NL
 "### Subversion never ignore cache errors, uncomment this line."             NL
 "# " CONFIG_OPTION_FAIL_STOP " = true"                                       NL
+"###"                                                                        NL
+"### Reconstructed file contents and text deltas may also be kept in a"      NL
+"### memory-mapped file that survives server restarts and is shared by all"  NL
+"### processes on this machine accessing this repository.  Set the size of"  NL
+"### this file in MB to enable it.  It is disabled (0) by default."          NL
+"# " CONFIG_OPTION_DISK_CACHE_SIZE " = 0"                                    NL
+"### The location of the cache file.  Relative paths are relative to the"    NL
+"### 'db' directory of the repository.  All processes accessing the"         NL
+"### repository need write access to this file, or else they will run"       NL
+"### without it.  Don't place it on network storage."                        NL
+"# " CONFIG_OPTION_DISK_CACHE_PATH " = " PATH_DISK_CACHE                     NL
 ""                                                                           NL
 "[" CONFIG_SECTION_REP_SHARING "]"                                           NL
 "### To conserve space, the filesystem can optionally avoid storing"         NL
@@ -1055,6 +1112,18 @@ write_config(svn_fs_t *fs,
 "### For 1.8, the default value is 16; earlier versions use 1."              NL
 "# " CONFIG_OPTION_MAX_LINEAR_DELTIFICATION " = 16"                          NL
 "###"                                                                        NL
+"### File contents that have no suitable deltification base are normally"    NL
+"### stored as a delta against the empty text, i.e. compressed.  Files of"   NL
+"### at least the size (in kBytes) given here will be stored as plain"       NL
+"### fulltext instead.  This costs disk space for compressible files but"    NL
+"### allows svnserve to send them directly from the revision files.  It is"  NL
+"### mainly useful for repositories dominated by large, already compressed"  NL
+"### binaries.  All Subversion versions can read such repositories."         NL
+"### Commits keep up to that much of each new file in memory, so values"     NL
+"### above 65536 (64 MB) are rejected."                                      NL
+"### A value of 0 (the default) disables this feature."                      NL
+"# " CONFIG_OPTION_PLAIN_FULLTEXT_SIZE " = 0"                                NL
+"###"                                                                        NL
 "### After deltification, we compress the data to minimize on-disk size."    NL
 "### This setting controls the compression algorithm, which will be used in" NL
 "### future revisions.  It can be used to either disable compression or to"  NL
@@ -1147,6 +1216,14 @@ write_config(svn_fs_t *fs,
 "### Must be a power of 2."                                                  NL
 "### p2l-page-size is given in kBytes and with a default of 1024 kBytes."    NL
 "# " CONFIG_OPTION_P2L_PAGE_SIZE " = 1024"                                   NL
+"###"                                                                        NL
+"### When reading a file that has been stored as a chain of deltas, and"     NL
+"### the parts of that chain are not in cache, they get read from disk"      NL
+"### concurrently by up to this many threads.  This reduces latency on"      NL
+"### network storage and on RAIDs.  Values below 2 disable prefetching."     NL
+"### This parameter applies to all repository formats."                     NL
+"### prefetch-threads is 4 by default."                                      NL
+"# " CONFIG_OPTION_PREFETCH_THREADS " = 4"                                   NL
 ""                                                                           NL
 "[" CONFIG_SECTION_DEBUG "]"                                                 NL
 "###"                                                                        NL
@@ -1174,6 +1251,22 @@ read_global_config(svn_fs_t *fs)
                                            SVN_FS_CONFIG_NO_FLUSH_TO_DISK,
                                            FALSE);
 
+  ffd->max_jobs = 1;
+#if APR_HAS_THREADS
+  if (fs->config)
+    {
+      const char *jobs_str = svn_hash_gets(fs->config,
+                                           SVN_FS_CONFIG_FSFS_JOBS);
+      if (jobs_str)
+        {
+          apr_int64_t val;
+          SVN_ERR(svn_cstring_strtoi64(&val, jobs_str, 0,
+                                       SVN_FS_FS__MAX_JOBS, 10));
+          ffd->max_jobs = MAX(1, (int)val);
+        }
+    }
+#endif
+
   /* Ignore the user-specified larger block size if we don't use block-read.
      Defaulting to 4k gives us the same access granularity in format 7 as in
      older formats. */
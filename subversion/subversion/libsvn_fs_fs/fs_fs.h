@@ -48,6 +48,18 @@ svn_error_t *svn_fs_fs__initialize_shared_data(svn_fs_t *fs,
                                                apr_pool_t *pool,
                                                apr_pool_t *common_pool);
 
+/* Set *CLONE_P to a new, fully opened filesystem object for the same
+   repository as the open filesystem FS, using the same configuration.
+   The clone has its own FS-local state and caches but shares the global
+   synchronization objects with FS.  It may therefore be used in another
+   thread than FS, provided that RESULT_POOL is thread-safe.
+
+   Allocate *CLONE_P in RESULT_POOL and use SCRATCH_POOL for temporaries. */
+svn_error_t *svn_fs_fs__open_clone(svn_fs_t **clone_p,
+                                   svn_fs_t *fs,
+                                   apr_pool_t *result_pool,
+                                   apr_pool_t *scratch_pool);
+
 /* Upgrade the fsfs filesystem FS.  Indicate progress via the optional
  * NOTIFY_FUNC callback using NOTIFY_BATON.  The optional CANCEL_FUNC
  * will periodically be called with CANCEL_BATON to allow for preemption.
@@ -25,6 +25,8 @@
 #include "svn_pools.h"
 #include "svn_dirent_uri.h"
 #include "svn_sorts.h"
+#include "private/svn_batch_fsync.h"
+#include "private/svn_ordered_jobs.h"
 #include "private/svn_temp_serializer.h"
 #include "private/svn_sorts_private.h"
 #include "private/svn_subr_private.h"
@@ -234,8 +236,8 @@ typedef struct pack_context_t
    * the next range of revisions is being processed */
   apr_pool_t *info_pool;
 
-  /* ensure that all filesystem changes are written to disk. */
-  svn_boolean_t flush_to_disk;
+  /* schedule all files to be written to disk here. */
+  svn_batch_fsync__t *batch;
 } pack_context_t;
 
 /* Create and initialize a new pack context for packing shard SHARD_REV in
@@ -243,7 +245,8 @@ typedef struct pack_context_t
  * and return the structure in *CONTEXT.
  *
  * Limit the number of items being copied per iteration to MAX_ITEMS.
- * Set FLUSH_TO_DISK, CANCEL_FUNC and CANCEL_BATON as well.
+ * Set BATCH, CANCEL_FUNC and CANCEL_BATON as well.  The pack file will be
+ * owned by BATCH.
  */
 static svn_error_t *
 initialize_pack_context(pack_context_t *context,
@@ -252,7 +255,7 @@ initialize_pack_context(pack_context_t *context,
                         const char *shard_dir,
                         svn_revnum_t shard_rev,
                         int max_items,
-                        svn_boolean_t flush_to_disk,
+                        svn_batch_fsync__t *batch,
                         svn_cancel_func_t cancel_func,
                         void *cancel_baton,
                         apr_pool_t *pool)
@@ -281,16 +284,15 @@ initialize_pack_context(pack_context_t *context,
   context->info_pool = svn_pool_create(pool);
   context->paths = svn_prefix_tree__create(context->info_pool);
 
-  context->flush_to_disk = flush_to_disk;
+  context->batch = batch;
 
   /* Create the new directory and pack file. */
   context->shard_dir = shard_dir;
   context->pack_file_dir = pack_file_dir;
   context->pack_file_path
     = svn_dirent_join(pack_file_dir, PATH_PACKED, pool);
-  SVN_ERR(svn_io_file_open(&context->pack_file, context->pack_file_path,
-                           APR_WRITE | APR_BUFFERED | APR_BINARY | APR_EXCL
-                             | APR_CREATE, APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_batch_fsync__open_file(&context->pack_file, batch,
+                                     context->pack_file_path, pool));
 
   /* Proto index files */
   SVN_ERR(svn_fs_fs__l2p_proto_index_open(
@@ -382,7 +384,8 @@ reset_pack_context(pack_context_t *context,
 }
 
 /* Call this after the last revision range.  It will finalize all index files
- * for CONTEXT and close any open files.  Use POOL for temporary allocations.
+ * for CONTEXT and close any open files except for the pack file, which is
+ * owned by CONTEXT->BATCH.  Use POOL for temporary allocations.
  */
 static svn_error_t *
 close_pack_context(pack_context_t *context,
@@ -412,11 +415,6 @@ close_pack_context(pack_context_t *context,
   SVN_ERR(svn_io_remove_file2(proto_l2p_index_path, FALSE, pool));
   SVN_ERR(svn_io_remove_file2(proto_p2l_index_path, FALSE, pool));
 
-  /* Ensure that packed file is written to disk.*/
-  if (context->flush_to_disk)
-    SVN_ERR(svn_io_file_flush_to_disk(context->pack_file, pool));
-  SVN_ERR(svn_io_file_close(context->pack_file, pool));
-
   return SVN_NO_ERROR;
 }
 
@@ -1538,9 +1536,9 @@ append_revision(pack_context_t *context,
  *
  * Pack the revision shard starting at SHARD_REV in filesystem FS from
  * SHARD_DIR into the PACK_FILE_DIR, using POOL for allocations.  Limit
- * the extra memory consumption to MAX_MEM bytes.  If FLUSH_TO_DISK is
- * non-zero, do not return until the data has actually been written on
- * the disk.  CANCEL_FUNC and CANCEL_BATON are what you think they are.
+ * the extra memory consumption to MAX_MEM bytes.  Schedule all new files
+ * for fsync in BATCH.  CANCEL_FUNC and CANCEL_BATON are what you think
+ * they are.
  */
 static svn_error_t *
 pack_log_addressed(svn_fs_t *fs,
@@ -1548,7 +1546,7 @@ pack_log_addressed(svn_fs_t *fs,
                    const char *shard_dir,
                    svn_revnum_t shard_rev,
                    apr_size_t max_mem,
-                   svn_boolean_t flush_to_disk,
+                   svn_batch_fsync__t *batch,
                    svn_cancel_func_t cancel_func,
                    void *cancel_baton,
                    apr_pool_t *pool)
@@ -1581,7 +1579,7 @@ pack_log_addressed(svn_fs_t *fs,
 
   /* set up a pack context */
   SVN_ERR(initialize_pack_context(&context, fs, pack_file_dir, shard_dir,
-                                  shard_rev, max_items, flush_to_disk,
+                                  shard_rev, max_items, batch,
                                   cancel_func, cancel_baton, pool));
 
   /* phase 1: determine the size of the revisions to pack */
@@ -1706,8 +1704,7 @@ svn_fs_fs__get_packed_offset(apr_off_t *rev_offset,
  *
  * Pack the revision shard starting at SHARD_REV containing exactly
  * MAX_FILES_PER_DIR revisions from SHARD_PATH into the PACK_FILE_DIR,
- * using POOL for allocations.  If FLUSH_TO_DISK is non-zero, do not
- * return until the data has actually been written on the disk.
+ * using POOL for allocations.  Schedule all new files for fsync in BATCH.
  * CANCEL_FUNC and CANCEL_BATON are what you think they are.
  */
 static svn_error_t *
@@ -1715,7 +1712,7 @@ pack_phys_addressed(const char *pack_file_dir,
                     const char *shard_path,
                     svn_revnum_t start_rev,
                     int max_files_per_dir,
-                    svn_boolean_t flush_to_disk,
+                    svn_batch_fsync__t *batch,
                     svn_cancel_func_t cancel_func,
                     void *cancel_baton,
                     apr_pool_t *pool)
@@ -1731,17 +1728,13 @@ pack_phys_addressed(const char *pack_file_dir,
   pack_file_path = svn_dirent_join(pack_file_dir, PATH_PACKED, pool);
   manifest_file_path = svn_dirent_join(pack_file_dir, PATH_MANIFEST, pool);
 
-  /* Create the new directory and pack file.
-   * Use unbuffered apr_file_t since we're going to write using 16kb
-   * chunks. */
-  SVN_ERR(svn_io_file_open(&pack_file, pack_file_path,
-                           APR_WRITE | APR_CREATE | APR_EXCL,
-                           APR_OS_DEFAULT, pool));
+  /* Create the new pack file.  BATCH owns it and will close it. */
+  SVN_ERR(svn_batch_fsync__open_file(&pack_file, batch,
+                                     pack_file_path, pool));
 
   /* Create the manifest file. */
-  SVN_ERR(svn_io_file_open(&manifest_file, manifest_file_path,
-                           APR_WRITE | APR_BUFFERED | APR_CREATE | APR_EXCL,
-                           APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_batch_fsync__open_file(&manifest_file, batch,
+                                     manifest_file_path, pool));
   manifest_stream = svn_stream_from_aprfile2(manifest_file, TRUE, pool);
 
   end_rev = start_rev + max_files_per_dir - 1;
@@ -1782,19 +1775,9 @@ pack_phys_addressed(const char *pack_file_dir,
   /* Close stream over APR file. */
   SVN_ERR(svn_stream_close(manifest_stream));
 
-  /* Ensure that pack file is written to disk. */
-  if (flush_to_disk)
-    SVN_ERR(svn_io_file_flush_to_disk(manifest_file, pool));
-  SVN_ERR(svn_io_file_close(manifest_file, pool));
-
   /* disallow write access to the manifest file */
   SVN_ERR(svn_io_set_file_read_only(manifest_file_path, FALSE, iterpool));
 
-  /* Ensure that pack file is written to disk. */
-  if (flush_to_disk)
-    SVN_ERR(svn_io_file_flush_to_disk(pack_file, pool));
-  SVN_ERR(svn_io_file_close(pack_file, pool));
-
   svn_pool_destroy(iterpool);
 
   return SVN_NO_ERROR;
@@ -1826,27 +1809,35 @@ pack_rev_shard(svn_fs_t *fs,
 {
   const char *pack_file_path;
   svn_revnum_t shard_rev = (svn_revnum_t) (shard * max_files_per_dir);
+  svn_batch_fsync__t *batch;
 
   /* Some useful paths. */
   pack_file_path = svn_dirent_join(pack_file_dir, PATH_PACKED, pool);
 
+  /* Collect the new files and folders and flush them all at once. */
+  SVN_ERR(svn_batch_fsync__create(&batch, flush_to_disk, pool));
+
   /* Remove any existing pack file for this shard, since it is incomplete. */
   SVN_ERR(svn_io_remove_dir2(pack_file_dir, TRUE, cancel_func, cancel_baton,
                              pool));
 
   /* Create the new directory and pack file. */
   SVN_ERR(svn_io_dir_make(pack_file_dir, APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_batch_fsync__new_path(batch, pack_file_dir, pool));
 
   /* Index information files */
   if (svn_fs_fs__use_log_addressing(fs))
     SVN_ERR(pack_log_addressed(fs, pack_file_dir, shard_path,
-                               shard_rev, max_mem, flush_to_disk,
+                               shard_rev, max_mem, batch,
                                cancel_func, cancel_baton, pool));
   else
     SVN_ERR(pack_phys_addressed(pack_file_dir, shard_path, shard_rev,
-                                max_files_per_dir, flush_to_disk,
+                                max_files_per_dir, batch,
                                 cancel_func, cancel_baton, pool));
 
+  /* Ensure that the pack file, manifest and directory are on disk. */
+  SVN_ERR(svn_batch_fsync__run(batch, pool));
+
   SVN_ERR(svn_io_copy_perms(shard_path, pack_file_dir, pool));
   SVN_ERR(svn_io_set_file_read_only(pack_file_path, FALSE, pool));
 
@@ -1957,6 +1948,58 @@ synced_pack_shard(void *baton,
   return SVN_NO_ERROR;
 }
 
+/* Return the path of the pack directory for SHARD in REVS_DIR.
+ * Allocate the result in RESULT_POOL. */
+static const char *
+rev_pack_file_dir(const char *revs_dir,
+                  apr_int64_t shard,
+                  apr_pool_t *result_pool)
+{
+  return svn_dirent_join(revs_dir,
+                         apr_psprintf(result_pool,
+                                      "%" APR_INT64_T_FMT PATH_EXT_PACKED_SHARD,
+                                      shard),
+                         result_pool);
+}
+
+/* Return the path of the non-packed SHARD in REVS_DIR.
+ * Allocate the result in RESULT_POOL. */
+static const char *
+rev_shard_path(const char *revs_dir,
+               apr_int64_t shard,
+               apr_pool_t *result_pool)
+{
+  return svn_dirent_join(revs_dir,
+                         apr_psprintf(result_pool, "%" APR_INT64_T_FMT, shard),
+                         result_pool);
+}
+
+/* Switch over to the packed data for the shard described by BATON, whose
+ * rev pack file has already been written, and notify the caller.
+ */
+static svn_error_t *
+publish_shard(struct pack_baton *baton,
+              apr_pool_t *pool)
+{
+  fs_fs_data_t *ffd = baton->fs->fsap_data;
+
+  /* For newer repo formats, we only acquired the pack lock so far.
+     Before modifying the repo state by switching over to the packed
+     data, we need to acquire the global (write) lock. */
+  if (ffd->format >= SVN_FS_FS__MIN_PACK_LOCK_FORMAT)
+    SVN_ERR(svn_fs_fs__with_write_lock(baton->fs, synced_pack_shard, baton,
+                                       pool));
+  else
+    SVN_ERR(synced_pack_shard(baton, pool));
+
+  /* Notify caller we're starting to pack this shard. */
+  if (baton->notify_func)
+    SVN_ERR(baton->notify_func(baton->notify_baton, baton->shard,
+                               svn_fs_pack_notify_end, pool));
+
+  return SVN_NO_ERROR;
+}
+
 /* Pack the shard described by BATON.
  *
  * If for some reason we detect a partial packing already performed,
@@ -1967,48 +2010,167 @@ pack_shard(struct pack_baton *baton,
            apr_pool_t *pool)
 {
   fs_fs_data_t *ffd = baton->fs->fsap_data;
-  const char *rev_pack_file_dir;
 
   /* Notify caller we're starting to pack this shard. */
   if (baton->notify_func)
     SVN_ERR(baton->notify_func(baton->notify_baton, baton->shard,
                                svn_fs_pack_notify_start, pool));
 
-  /* Some useful paths. */
-  rev_pack_file_dir = svn_dirent_join(baton->revs_dir,
-                  apr_psprintf(pool,
-                               "%" APR_INT64_T_FMT PATH_EXT_PACKED_SHARD,
-                               baton->shard),
-                  pool);
-  baton->rev_shard_path = svn_dirent_join(baton->revs_dir,
-                                          apr_psprintf(pool,
-                                                       "%" APR_INT64_T_FMT,
-                                                       baton->shard),
-                                          pool);
-
   /* pack the revision content */
-  SVN_ERR(pack_rev_shard(baton->fs, rev_pack_file_dir, baton->rev_shard_path,
+  baton->rev_shard_path = rev_shard_path(baton->revs_dir, baton->shard, pool);
+  SVN_ERR(pack_rev_shard(baton->fs,
+                         rev_pack_file_dir(baton->revs_dir, baton->shard,
+                                           pool),
+                         baton->rev_shard_path,
                          baton->shard, ffd->max_files_per_dir,
                          baton->max_mem, ffd->flush_to_disk,
                          baton->cancel_func, baton->cancel_baton, pool));
 
-  /* For newer repo formats, we only acquired the pack lock so far.
-     Before modifying the repo state by switching over to the packed
-     data, we need to acquire the global (write) lock. */
-  if (ffd->format >= SVN_FS_FS__MIN_PACK_LOCK_FORMAT)
-    SVN_ERR(svn_fs_fs__with_write_lock(baton->fs, synced_pack_shard, baton,
-                                       pool));
-  else
-    SVN_ERR(synced_pack_shard(baton, pool));
+  return svn_error_trace(publish_shard(baton, pool));
+}
 
-  /* Notify caller we're starting to pack this shard. */
-  if (baton->notify_func)
-    SVN_ERR(baton->notify_func(baton->notify_baton, baton->shard,
-                               svn_fs_pack_notify_end, pool));
+#if APR_HAS_THREADS
+
+/* Concurrent packing.
+ *
+ * Writing the pack file for a shard only reads the shard's revision files
+ * and creates a new, private pack directory.  Hence, we may do that for
+ * multiple shards at once.  Switching over to the packed data, however,
+ * must still happen in strict shard order and under the write lock.
+ *
+ * So, up to MAX_JOBS worker threads, each with its own FS instance and
+ * pack memory budget, write the pack files of the shards in ascending
+ * order, never getting more than MAX_JOBS shards ahead.  The main thread
+ * waits for the oldest shard to be written and then publishes it just
+ * like the sequential code would.  All notifications are being sent from
+ * the main thread.
+ */
+
+/* Parameters to pack_rev_shard() common to all shards of one pack run. */
+typedef struct pack_jobs_t
+{
+  /* The main FS.  Workers use it to open their own instance only. */
+  svn_fs_t *fs;
+
+  const char *revs_dir;
+  int max_files_per_dir;
+  apr_size_t max_mem;
+  svn_boolean_t flush_to_disk;
+} pack_jobs_t;
+
+/* Implement svn_ordered_jobs__init_func_t by opening a separate instance
+   of the FS in the pack_jobs_t given by BATON. */
+static svn_error_t *
+pack_job_init(void **worker_baton,
+              void *baton,
+              apr_pool_t *worker_pool,
+              apr_pool_t *scratch_pool)
+{
+  pack_jobs_t *jobs = baton;
+  svn_fs_t *fs;
+
+  SVN_ERR(svn_fs_fs__open_clone(&fs, jobs->fs, worker_pool, scratch_pool));
+  *worker_baton = fs;
 
   return SVN_NO_ERROR;
 }
 
+/* Implement svn_ordered_jobs__run_func_t by writing the pack file for
+   SHARD as described by the pack_jobs_t BATON, using the FS instance
+   WORKER_BATON. */
+static svn_error_t *
+pack_job_run(void **result,
+             void *baton,
+             void *worker_baton,
+             apr_int64_t shard,
+             svn_cancel_func_t cancel_func,
+             void *cancel_baton,
+             apr_pool_t *result_pool,
+             apr_pool_t *scratch_pool)
+{
+  pack_jobs_t *jobs = baton;
+
+  *result = NULL;
+  return svn_error_trace(pack_rev_shard(worker_baton,
+                                        rev_pack_file_dir(jobs->revs_dir,
+                                                          shard,
+                                                          scratch_pool),
+                                        rev_shard_path(jobs->revs_dir, shard,
+                                                       scratch_pool),
+                                        shard, jobs->max_files_per_dir,
+                                        jobs->max_mem, jobs->flush_to_disk,
+                                        cancel_func, cancel_baton,
+                                        scratch_pool));
+}
+
+/* Pack the shards FIRST_SHARD up to but not including END_SHARD as
+ * described by BATON, using up to MAX_JOBS worker threads.  Use POOL for
+ * temporary allocations.
+ */
+static svn_error_t *
+pack_shards_concurrently(struct pack_baton *baton,
+                         apr_int64_t first_shard,
+                         apr_int64_t end_shard,
+                         int max_jobs,
+                         apr_pool_t *pool)
+{
+  fs_fs_data_t *ffd = baton->fs->fsap_data;
+  pack_jobs_t *shared = apr_pcalloc(pool, sizeof(*shared));
+  svn_ordered_jobs__t *jobs;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_error_t *err = SVN_NO_ERROR;
+
+  shared->fs = baton->fs;
+  shared->revs_dir = baton->revs_dir;
+  shared->max_files_per_dir = ffd->max_files_per_dir;
+  shared->max_mem = baton->max_mem;
+  shared->flush_to_disk = ffd->flush_to_disk;
+
+  SVN_ERR(svn_ordered_jobs__start(&jobs, first_shard, end_shard,
+                                  max_jobs, max_jobs,
+                                  pack_job_init, pack_job_run, shared,
+                                  pool, iterpool));
+
+  for (baton->shard = first_shard;
+       baton->shard < end_shard && !err;
+       baton->shard++)
+    {
+      void *result;
+
+      svn_pool_clear(iterpool);
+
+      if (baton->cancel_func)
+        err = baton->cancel_func(baton->cancel_baton);
+
+      /* Notify caller we're starting to pack this shard. */
+      if (!err && baton->notify_func)
+        err = baton->notify_func(baton->notify_baton, baton->shard,
+                                 svn_fs_pack_notify_start, iterpool);
+
+      /* Wait for the pack file to get written and switch over to it. */
+      if (!err)
+        {
+          err = svn_ordered_jobs__next(&result, jobs);
+          svn_ordered_jobs__release(jobs);
+        }
+
+      if (!err)
+        {
+          baton->rev_shard_path = rev_shard_path(baton->revs_dir,
+                                                 baton->shard, iterpool);
+          err = publish_shard(baton, iterpool);
+        }
+    }
+
+  /* Don't leave any threads behind, not even in case of an error. */
+  svn_ordered_jobs__stop(jobs);
+  svn_pool_destroy(iterpool);
+
+  return svn_error_trace(err);
+}
+
+#endif
+
 /* Read the youngest rev and the first non-packed rev info for FS from disk.
    Set *FULLY_PACKED when there is no completed unpacked shard.
    Use SCRATCH_POOL for temporary allocations.
@@ -2080,6 +2242,15 @@ pack_body(void *baton,
     pb->revsprops_dir = svn_dirent_join(pb->fs->path, PATH_REVPROPS_DIR,
                                         pool);
 
+#if APR_HAS_THREADS
+  /* Write multiple pack files at once, if we have been asked to. */
+  if (ffd->max_jobs > 1
+      && completed_shards - ffd->min_unpacked_rev / ffd->max_files_per_dir > 1)
+    return svn_error_trace(pack_shards_concurrently(pb,
+                               ffd->min_unpacked_rev / ffd->max_files_per_dir,
+                               completed_shards, ffd->max_jobs, pool));
+#endif
+
   iterpool = svn_pool_create(pool);
   for (pb->shard = ffd->min_unpacked_rev / ffd->max_files_per_dir;
        pb->shard < completed_shards;
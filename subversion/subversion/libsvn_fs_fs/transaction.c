@@ -43,6 +43,7 @@
 #include "lock.h"
 #include "rep-cache.h"
 
+#include "private/svn_batch_fsync.h"
 #include "private/svn_fs_util.h"
 #include "private/svn_fspath.h"
 #include "private/svn_sorts_private.h"
@@ -1917,6 +1918,11 @@ struct rep_write_baton
      deltified, then eventually written to rep_stream. */
   svn_stream_t *delta_stream;
 
+  /* If not NULL, we have not written the rep header yet and still need
+     to decide between PLAIN and self-delta storage.  The contents
+     received so far are collected here. */
+  svn_stringbuf_t *plain_buffer;
+
   /* Where is this representation header stored. */
   apr_off_t rep_offset;
 
@@ -1948,6 +1954,86 @@ struct rep_write_baton
   apr_pool_t *result_pool;
 };
 
+static void
+txdelta_to_svndiff(svn_txdelta_window_handler_t *handler,
+                   void **handler_baton,
+                   svn_stream_t *output,
+                   svn_fs_t *fs,
+                   apr_pool_t *pool)
+{
+  fs_fs_data_t *ffd = fs->fsap_data;
+  int svndiff_version;
+
+  if (ffd->delta_compression_type == compression_type_lz4)
+    {
+      SVN_ERR_ASSERT_NO_RETURN(ffd->format >= SVN_FS_FS__MIN_SVNDIFF2_FORMAT);
+      svndiff_version = 2;
+    }
+  else if (ffd->delta_compression_type == compression_type_zlib)
+    {
+      SVN_ERR_ASSERT_NO_RETURN(ffd->format >= SVN_FS_FS__MIN_SVNDIFF1_FORMAT);
+      svndiff_version = 1;
+    }
+  else
+    {
+      svndiff_version = 0;
+    }
+
+  svn_txdelta_to_svndiff3(handler, handler_baton, output, svndiff_version,
+                          ffd->delta_compression_level, pool);
+}
+
+/* Write the rep HEADER for the representation being written by B and
+   remember where the actual data begins.  Unless HEADER describes a
+   PLAIN rep, prepare B->DELTA_STREAM to deltify against SOURCE. */
+static svn_error_t *
+start_rep_data(struct rep_write_baton *b,
+               svn_fs_fs__rep_header_t *header,
+               svn_stream_t *source)
+{
+  svn_txdelta_window_handler_t wh;
+  void *whb;
+
+  SVN_ERR(svn_fs_fs__write_rep_header(header, b->rep_stream,
+                                      b->scratch_pool));
+
+  /* Now determine the offset of the actual svndiff data. */
+  SVN_ERR(svn_io_file_get_offset(&b->delta_start, b->file,
+                                 b->scratch_pool));
+
+  if (header->type != svn_fs_fs__rep_plain)
+    {
+      /* Prepare to write the svndiff data. */
+      txdelta_to_svndiff(&wh, &whb, b->rep_stream, b->fs, b->result_pool);
+
+      b->delta_stream = svn_txdelta_target_push(wh, whb, source,
+                                                b->scratch_pool);
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Write the contents collected in B->PLAIN_BUFFER as a PLAIN rep if
+   PLAIN is set and as a self-delta otherwise.  Further data will be
+   written in the same way. */
+static svn_error_t *
+flush_plain_buffer(struct rep_write_baton *b,
+                   svn_boolean_t plain)
+{
+  svn_fs_fs__rep_header_t header = { 0 };
+  svn_stringbuf_t *buffer = b->plain_buffer;
+  apr_size_t len = buffer->len;
+
+  b->plain_buffer = NULL;
+  header.type = plain ? svn_fs_fs__rep_plain : svn_fs_fs__rep_self_delta;
+  SVN_ERR(start_rep_data(b, &header, svn_stream_empty(b->scratch_pool)));
+
+  if (b->delta_stream)
+    return svn_stream_write(b->delta_stream, buffer->data, &len);
+  else
+    return svn_stream_write(b->rep_stream, buffer->data, &len);
+}
+
 /* Handler for the write method of the representation writable stream.
    BATON is a rep_write_baton, DATA is the data to write, and *LEN is
    the length of this data. */
@@ -1958,10 +2044,22 @@ rep_write_contents(void *baton,
 {
   struct rep_write_baton *b = baton;
 
-  SVN_ERR(svn_checksum_update(b->md5_checksum_ctx, data, *len));
-  SVN_ERR(svn_checksum_update(b->sha1_checksum_ctx, data, *len));
+  SVN_ERR(svn_checksum__update_pair(b->md5_checksum_ctx,
+                                    b->sha1_checksum_ctx, data, *len));
   b->rep_size += *len;
 
+  /* Large fulltexts get stored as PLAIN. */
+  if (b->plain_buffer)
+    {
+      fs_fs_data_t *ffd = b->fs->fsap_data;
+
+      svn_stringbuf_appendbytes(b->plain_buffer, data, *len);
+      if ((apr_int64_t)b->plain_buffer->len < ffd->plain_fulltext_size)
+        return SVN_NO_ERROR;
+
+      return svn_error_trace(flush_plain_buffer(b, TRUE));
+    }
+
   /* If we are writing a delta, use that stream. */
   if (b->delta_stream)
     return svn_stream_write(b->delta_stream, data, len);
@@ -2159,35 +2257,6 @@ rep_write_cleanup(void *data)
   return APR_SUCCESS;
 }
 
-static void
-txdelta_to_svndiff(svn_txdelta_window_handler_t *handler,
-                   void **handler_baton,
-                   svn_stream_t *output,
-                   svn_fs_t *fs,
-                   apr_pool_t *pool)
-{
-  fs_fs_data_t *ffd = fs->fsap_data;
-  int svndiff_version;
-
-  if (ffd->delta_compression_type == compression_type_lz4)
-    {
-      SVN_ERR_ASSERT_NO_RETURN(ffd->format >= SVN_FS_FS__MIN_SVNDIFF2_FORMAT);
-      svndiff_version = 2;
-    }
-  else if (ffd->delta_compression_type == compression_type_zlib)
-    {
-      SVN_ERR_ASSERT_NO_RETURN(ffd->format >= SVN_FS_FS__MIN_SVNDIFF1_FORMAT);
-      svndiff_version = 1;
-    }
-  else
-    {
-      svndiff_version = 0;
-    }
-
-  svn_txdelta_to_svndiff3(handler, handler_baton, output, svndiff_version,
-                          ffd->delta_compression_level, pool);
-}
-
 /* Get a rep_write_baton and store it in *WB_P for the representation
    indicated by NODEREV in filesystem FS.  Perform allocations in
    POOL.  Only appropriate for file contents, not for props or
@@ -2198,12 +2267,11 @@ rep_write_get_baton(struct rep_write_baton **wb_p,
                     node_revision_t *noderev,
                     apr_pool_t *pool)
 {
+  fs_fs_data_t *ffd = fs->fsap_data;
   struct rep_write_baton *b;
   apr_file_t *file;
   representation_t *base_rep;
   svn_stream_t *source;
-  svn_txdelta_window_handler_t wh;
-  void *whb;
   svn_fs_fs__rep_header_t header = { 0 };
 
   b = apr_pcalloc(pool, sizeof(*b));
@@ -2230,8 +2298,23 @@ rep_write_get_baton(struct rep_write_baton **wb_p,
 
   SVN_ERR(svn_io_file_get_offset(&b->rep_offset, file, b->scratch_pool));
 
+  /* Cleanup in case something goes wrong. */
+  apr_pool_cleanup_register(b->scratch_pool, b, rep_write_cleanup,
+                            apr_pool_cleanup_null);
+
   /* Get the base for this delta. */
   SVN_ERR(choose_delta_base(&base_rep, fs, noderev, FALSE, b->scratch_pool));
+
+  /* Without a base, we may store the contents as PLAIN.  We can only
+     tell once we know how large they are.  Defer writing the header. */
+  if (!base_rep && ffd->plain_fulltext_size > 0)
+    {
+      b->plain_buffer = svn_stringbuf_create_empty(b->scratch_pool);
+      *wb_p = b;
+
+      return SVN_NO_ERROR;
+    }
+
   SVN_ERR(svn_fs_fs__get_contents(&source, fs, base_rep, TRUE,
                                   b->scratch_pool));
 
@@ -2247,22 +2330,7 @@ rep_write_get_baton(struct rep_write_baton **wb_p,
     {
       header.type = svn_fs_fs__rep_self_delta;
     }
-  SVN_ERR(svn_fs_fs__write_rep_header(&header, b->rep_stream,
-                                      b->scratch_pool));
-
-  /* Now determine the offset of the actual svndiff data. */
-  SVN_ERR(svn_io_file_get_offset(&b->delta_start, file,
-                                 b->scratch_pool));
-
-  /* Cleanup in case something goes wrong. */
-  apr_pool_cleanup_register(b->scratch_pool, b, rep_write_cleanup,
-                            apr_pool_cleanup_null);
-
-  /* Prepare to write the svndiff data. */
-  txdelta_to_svndiff(&wh, &whb, b->rep_stream, fs, pool);
-
-  b->delta_stream = svn_txdelta_target_push(wh, whb, source,
-                                            b->scratch_pool);
+  SVN_ERR(start_rep_data(b, &header, source));
 
   *wb_p = b;
 
@@ -2520,6 +2588,10 @@ rep_write_contents_close(void *baton)
 
   rep = apr_pcalloc(b->result_pool, sizeof(*rep));
 
+  /* Small fulltexts still get deltified. */
+  if (b->plain_buffer)
+    SVN_ERR(flush_plain_buffer(b, FALSE));
+
   /* Close our delta stream so the last bits of svndiff are written
      out. */
   if (b->delta_stream)
@@ -2729,9 +2801,8 @@ write_container_handler(void *baton,
 {
   struct write_container_baton *whb = baton;
 
-  SVN_ERR(svn_checksum_update(whb->md5_ctx, data, *len));
-  if (whb->sha1_ctx)
-    SVN_ERR(svn_checksum_update(whb->sha1_ctx, data, *len));
+  SVN_ERR(svn_checksum__update_pair(whb->md5_ctx, whb->sha1_ctx,
+                                    data, *len));
 
   SVN_ERR(svn_stream_write(whb->stream, data, len));
   whb->size += *len;
@@ -3593,13 +3664,14 @@ verify_locks(svn_fs_t *fs,
 }
 
 /* Writes final revision properties to file PATH applying permissions
-   from file PERMS_REFERENCE. This involves setting svn:date and
-   removing any temporary properties associated with the commit flags. */
+   from file PERMS_REFERENCE and schedule the necessary fsync calls in
+   BATCH. This involves setting svn:date and removing any temporary
+   properties associated with the commit flags. */
 static svn_error_t *
 write_final_revprop(const char *path,
                     const char *perms_reference,
                     svn_fs_txn_t *txn,
-                    svn_boolean_t flush_to_disk,
+                    svn_batch_fsync__t *batch,
                     apr_pool_t *pool)
 {
   apr_hash_t *txnprops;
@@ -3607,6 +3679,7 @@ write_final_revprop(const char *path,
   svn_string_t *client_date;
   apr_file_t *revprop_file;
   svn_stream_t *stream;
+  apr_off_t offset;
 
   SVN_ERR(svn_fs_fs__txn_proplist(&txnprops, txn, pool));
 
@@ -3629,19 +3702,20 @@ write_final_revprop(const char *path,
       svn_hash_sets(txnprops, SVN_PROP_REVISION_DATE, &date);
     }
 
-  /* Create new revprops file. Tell OS to truncate existing file,
-     since  file may already exists from failed transaction. */
-  SVN_ERR(svn_io_file_open(&revprop_file, path,
-                           APR_WRITE | APR_CREATE | APR_TRUNCATE
-                           | APR_BUFFERED, APR_OS_DEFAULT, pool));
+  /* Create new revprops file.  BATCH owns the file handle and will close
+     it.  A file left behind by a failed transaction has been made
+     read-only already, so remove it instead of opening it for writing.
+     Truncate the file after writing, nonetheless. */
+  SVN_ERR(svn_io_remove_file2(path, TRUE, pool));
+  SVN_ERR(svn_batch_fsync__open_file(&revprop_file, batch, path,
+                                     pool));
 
   stream = svn_stream_from_aprfile2(revprop_file, TRUE, pool);
   SVN_ERR(svn_hash_write2(txnprops, stream, SVN_HASH_TERMINATOR, pool));
   SVN_ERR(svn_stream_close(stream));
 
-  if (flush_to_disk)
-    SVN_ERR(svn_io_file_flush_to_disk(revprop_file, pool));
-  SVN_ERR(svn_io_file_close(revprop_file, pool));
+  SVN_ERR(svn_io_file_get_offset(&offset, revprop_file, pool));
+  SVN_ERR(svn_io_file_trunc(revprop_file, offset, pool));
 
   SVN_ERR(svn_io_copy_perms(perms_reference, path, pool));
 
@@ -3734,6 +3808,67 @@ struct commit_baton {
   apr_pool_t *reps_pool;
 };
 
+/* Create the shard directory NEW_DIR, if it does not exist yet, and copy
+   the permissions of PARENT_DIR to it.  Schedule the fsync of the new
+   directory entry in BATCH.  Use POOL for temporary allocations. */
+static svn_error_t *
+auto_create_shard(const char *new_dir,
+                  const char *parent_dir,
+                  svn_batch_fsync__t *batch,
+                  apr_pool_t *pool)
+{
+  svn_error_t *err = svn_io_dir_make(new_dir, APR_OS_DEFAULT, pool);
+  if (err && !APR_STATUS_IS_EEXIST(err->apr_err))
+    return svn_error_trace(err);
+  svn_error_clear(err);
+
+  SVN_ERR(svn_io_copy_perms(parent_dir, new_dir, pool));
+  SVN_ERR(svn_batch_fsync__new_path(batch, new_dir, pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Like svn_fs_fs__move_into_place but instead of flushing OLD_FILENAME's
+   contents and the new directory entry immediately, schedule both for
+   fsync in BATCH.  Use POOL for temporary allocations. */
+static svn_error_t *
+move_into_place(const char *old_filename,
+                const char *new_filename,
+                const char *perms_reference,
+                svn_batch_fsync__t *batch,
+                apr_pool_t *pool)
+{
+  svn_error_t *err;
+
+  /* Copying permissions is a no-op on WIN32. */
+  SVN_ERR(svn_io_copy_perms(perms_reference, old_filename, pool));
+
+  /* Move the file into place.  Only POSIX needs an extra fsync on the
+     directory for the new name, which BATCH takes care of.  Elsewhere,
+     let the platform use its own "fsyncing move". */
+#ifdef SVN_ON_POSIX
+  err = svn_io_file_rename2(old_filename, new_filename, FALSE, pool);
+#else
+  err = svn_io_file_rename2(old_filename, new_filename, TRUE, pool);
+#endif
+  if (err && APR_STATUS_IS_EXDEV(err->apr_err))
+    {
+      /* Can't rename across devices; fall back to copying. */
+      svn_error_clear(err);
+      SVN_ERR(svn_io_copy_file(old_filename, new_filename, TRUE, pool));
+    }
+  else if (err)
+    return svn_error_trace(err);
+
+  /* fsync() is per file, not per handle, so syncing a new handle to the
+     same file is as good as syncing the one we wrote it through.  The
+     file has just been made read-only, so don't ask for write access.
+     This schedules the new directory entry as well. */
+  SVN_ERR(svn_batch_fsync__add_file(batch, new_filename, pool));
+
+  return SVN_NO_ERROR;
+}
+
 /* The work-horse for svn_fs_fs__commit, called with the FS write lock.
    This implements the svn_fs_fs__with_write_lock() 'body' callback
    type.  BATON is a 'struct commit_baton *'. */
@@ -3755,6 +3890,7 @@ commit_body(void *baton, apr_pool_t *pool)
   apr_hash_t *changed_paths;
   apr_array_header_t *directory_ids = apr_array_make(pool, 4,
                                                      sizeof(pair_cache_key_t));
+  svn_batch_fsync__t *batch;
 
   /* Re-Read the current repository format.  All our repo upgrade and
      config evaluation strategies are such that existing information in
@@ -3799,6 +3935,10 @@ commit_body(void *baton, apr_pool_t *pool)
   /* We are going to be one better than this puny old revision. */
   new_rev = old_rev + 1;
 
+  /* Collect all files and folders that need to be flushed to disk before
+     we can bump 'current' and flush them concurrently. */
+  SVN_ERR(svn_batch_fsync__create(&batch, ffd->flush_to_disk, pool));
+
   /* Get a write handle on the proto revision file. */
   SVN_ERR(get_writable_proto_rev(&proto_file, &proto_file_lockcookie,
                                  cb->fs, txn_id, pool));
@@ -3837,8 +3977,7 @@ commit_body(void *baton, apr_pool_t *pool)
                                      NULL, pool));
     }
 
-  if (ffd->flush_to_disk)
-    SVN_ERR(svn_io_file_flush_to_disk(proto_file, pool));
+  /* The fsync for the rev file will be done through BATCH. */
   SVN_ERR(svn_io_file_close(proto_file, pool));
 
   /* We don't unlock the prototype revision file immediately to avoid a
@@ -3851,35 +3990,20 @@ commit_body(void *baton, apr_pool_t *pool)
   if (ffd->max_files_per_dir && new_rev % ffd->max_files_per_dir == 0)
     {
       /* Create the revs shard. */
-        {
-          const char *new_dir
-            = svn_fs_fs__path_rev_shard(cb->fs, new_rev, pool);
-          svn_error_t *err
-            = svn_io_dir_make(new_dir, APR_OS_DEFAULT, pool);
-          if (err && !APR_STATUS_IS_EEXIST(err->apr_err))
-            return svn_error_trace(err);
-          svn_error_clear(err);
-          SVN_ERR(svn_io_copy_perms(svn_dirent_join(cb->fs->path,
-                                                    PATH_REVS_DIR,
-                                                    pool),
-                                    new_dir, pool));
-        }
+      SVN_ERR(auto_create_shard(svn_fs_fs__path_rev_shard(cb->fs, new_rev,
+                                                          pool),
+                                svn_dirent_join(cb->fs->path, PATH_REVS_DIR,
+                                                pool),
+                                batch, pool));
 
       /* Create the revprops shard. */
       SVN_ERR_ASSERT(! svn_fs_fs__is_packed_revprop(cb->fs, new_rev));
-        {
-          const char *new_dir
-            = svn_fs_fs__path_revprops_shard(cb->fs, new_rev, pool);
-          svn_error_t *err
-            = svn_io_dir_make(new_dir, APR_OS_DEFAULT, pool);
-          if (err && !APR_STATUS_IS_EEXIST(err->apr_err))
-            return svn_error_trace(err);
-          svn_error_clear(err);
-          SVN_ERR(svn_io_copy_perms(svn_dirent_join(cb->fs->path,
-                                                    PATH_REVPROPS_DIR,
-                                                    pool),
-                                    new_dir, pool));
-        }
+      SVN_ERR(auto_create_shard(svn_fs_fs__path_revprops_shard(cb->fs,
+                                                               new_rev,
+                                                               pool),
+                                svn_dirent_join(cb->fs->path,
+                                                PATH_REVPROPS_DIR, pool),
+                                batch, pool));
     }
 
   /* Move the finished rev file into place.
@@ -3890,9 +4014,8 @@ commit_body(void *baton, apr_pool_t *pool)
   old_rev_filename = svn_fs_fs__path_rev_absolute(cb->fs, old_rev, pool);
   rev_filename = svn_fs_fs__path_rev(cb->fs, new_rev, pool);
   proto_filename = svn_fs_fs__path_txn_proto_rev(cb->fs, txn_id, pool);
-  SVN_ERR(svn_fs_fs__move_into_place(proto_filename, rev_filename,
-                                     old_rev_filename, ffd->flush_to_disk,
-                                     pool));
+  SVN_ERR(move_into_place(proto_filename, rev_filename, old_rev_filename,
+                          batch, pool));
 
   /* Now that we've moved the prototype revision file out of the way,
      we can unlock it (since further attempts to write to the file
@@ -3904,7 +4027,11 @@ commit_body(void *baton, apr_pool_t *pool)
   SVN_ERR_ASSERT(! svn_fs_fs__is_packed_revprop(cb->fs, new_rev));
   revprop_filename = svn_fs_fs__path_revprops(cb->fs, new_rev, pool);
   SVN_ERR(write_final_revprop(revprop_filename, old_rev_filename,
-                              cb->txn, ffd->flush_to_disk, pool));
+                              cb->txn, batch, pool));
+
+  /* Flush the rev file, the revprops file and any new directory entries
+     to disk.  This must be completed before we bump 'current'. */
+  SVN_ERR(svn_batch_fsync__run(batch, pool));
 
   /* Run paranoia checks. */
   if (ffd->verify_before_commit)
@@ -23,6 +23,7 @@
 #include "svn_sorts.h"
 #include "svn_checksum.h"
 #include "svn_time.h"
+#include "private/svn_ordered_jobs.h"
 #include "private/svn_subr_private.h"
 
 #include "verify.h"
@@ -884,6 +885,265 @@ verify_f7_metadata_consistency(svn_fs_t *fs,
   return SVN_NO_ERROR;
 }
 
+#if APR_HAS_THREADS
+
+/* Concurrent verification.
+ *
+ * All checks above only read from the repository and operate on revision
+ * ranges.  Hence, we may split the requested range into sections and let
+ * worker threads with their own FS instances verify them independently.
+ *
+ * Up to MAX_JOBS workers verify the sections while the main thread
+ * collects their results in section order.  It also sends all progress
+ * notifications, such that the caller sees them in revision order and
+ * never from more than one thread.
+ */
+
+/* Function type for the verification of revisions START to END in FS.
+ * The function signature is similar to svn_fs_fs__verify but without
+ * progress notification. */
+typedef svn_error_t *
+(*verify_range_func_t)(svn_fs_t *fs,
+                       svn_revnum_t start,
+                       svn_revnum_t end,
+                       svn_cancel_func_t cancel_func,
+                       void *cancel_baton,
+                       apr_pool_t *pool);
+
+/* A section of revisions to verify in one go. */
+typedef struct verify_range_t
+{
+  /* First and last revision to verify. */
+  svn_revnum_t start;
+  svn_revnum_t end;
+
+  /* Revision to send a progress notification for before the results
+     of this section get collected.  May be SVN_INVALID_REVNUM. */
+  svn_revnum_t notify_rev;
+} verify_range_t;
+
+/* Constant parameters of one concurrent verification run. */
+typedef struct verify_jobs_t
+{
+  /* The main FS.  Workers use it to open their own instance only. */
+  svn_fs_t *fs;
+
+  /* What to check and where (verify_range_t). */
+  verify_range_func_t func;
+  const apr_array_header_t *ranges;
+} verify_jobs_t;
+
+/* Implement svn_ordered_jobs__init_func_t by opening a separate instance
+   of the FS in the verify_jobs_t BATON. */
+static svn_error_t *
+verify_job_init(void **worker_baton,
+                void *baton,
+                apr_pool_t *worker_pool,
+                apr_pool_t *scratch_pool)
+{
+  verify_jobs_t *jobs = baton;
+  svn_fs_t *fs;
+
+  SVN_ERR(svn_fs_fs__open_clone(&fs, jobs->fs, worker_pool, scratch_pool));
+  *worker_baton = fs;
+
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_ordered_jobs__run_func_t by running the checks of the
+   verify_jobs_t BATON on the section with index ITEM, using the FS
+   instance WORKER_BATON. */
+static svn_error_t *
+verify_job_run(void **result,
+               void *baton,
+               void *worker_baton,
+               apr_int64_t item,
+               svn_cancel_func_t cancel_func,
+               void *cancel_baton,
+               apr_pool_t *result_pool,
+               apr_pool_t *scratch_pool)
+{
+  verify_jobs_t *jobs = baton;
+  const verify_range_t *range
+    = &APR_ARRAY_IDX(jobs->ranges, (int)item, verify_range_t);
+
+  *result = NULL;
+  return svn_error_trace(jobs->func(worker_baton, range->start, range->end,
+                                    cancel_func, cancel_baton,
+                                    scratch_pool));
+}
+
+/* Run FUNC on all verify_range_t elements of RANGES in FS, using up to
+ * MAX_JOBS worker threads.  Return the error of the first section, in
+ * array order, that failed.  Progress notification and cancellation
+ * are as for svn_fs_fs__verify.  Use POOL for temporary allocations.
+ */
+static svn_error_t *
+verify_ranges_concurrently(svn_fs_t *fs,
+                           verify_range_func_t func,
+                           const apr_array_header_t *ranges,
+                           int max_jobs,
+                           svn_fs_progress_notify_func_t notify_func,
+                           void *notify_baton,
+                           svn_cancel_func_t cancel_func,
+                           void *cancel_baton,
+                           apr_pool_t *pool)
+{
+  verify_jobs_t *shared = apr_pcalloc(pool, sizeof(*shared));
+  svn_ordered_jobs__t *jobs;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_error_t *err = SVN_NO_ERROR;
+  int i;
+
+  shared->fs = fs;
+  shared->func = func;
+  shared->ranges = ranges;
+
+  SVN_ERR(svn_ordered_jobs__start(&jobs, 0, ranges->nelts,
+                                  max_jobs, max_jobs,
+                                  verify_job_init, verify_job_run, shared,
+                                  pool, iterpool));
+
+  for (i = 0; i < ranges->nelts && !err; ++i)
+    {
+      const verify_range_t *range
+        = &APR_ARRAY_IDX(ranges, i, verify_range_t);
+      void *result;
+
+      svn_pool_clear(iterpool);
+
+      if (cancel_func)
+        err = cancel_func(cancel_baton);
+
+      if (!err && notify_func && SVN_IS_VALID_REVNUM(range->notify_rev))
+        notify_func(range->notify_rev, notify_baton, iterpool);
+
+      if (!err)
+        {
+          err = svn_ordered_jobs__next(&result, jobs);
+          svn_ordered_jobs__release(jobs);
+        }
+    }
+
+  /* Don't leave any threads behind, not even in case of an error. */
+  svn_ordered_jobs__stop(jobs);
+  svn_pool_destroy(iterpool);
+
+  return svn_error_trace(err);
+}
+
+/* Implement verify_range_func_t for verify_f7_metadata_consistency. */
+static svn_error_t *
+verify_f7_metadata_range(svn_fs_t *fs,
+                         svn_revnum_t start,
+                         svn_revnum_t end,
+                         svn_cancel_func_t cancel_func,
+                         void *cancel_baton,
+                         apr_pool_t *pool)
+{
+  return svn_error_trace(verify_f7_metadata_consistency(fs, start, end,
+                                                        NULL, NULL,
+                                                        cancel_func,
+                                                        cancel_baton,
+                                                        pool));
+}
+
+/* Implement verify_range_func_t for verify_rep_cache. */
+static svn_error_t *
+verify_rep_cache_range(svn_fs_t *fs,
+                       svn_revnum_t start,
+                       svn_revnum_t end,
+                       svn_cancel_func_t cancel_func,
+                       void *cancel_baton,
+                       apr_pool_t *pool)
+{
+  return svn_error_trace(verify_rep_cache(fs, start, end, NULL, NULL,
+                                          cancel_func, cancel_baton,
+                                          pool));
+}
+
+/* Concurrent implementation of svn_fs_fs__verify, using up to MAX_JOBS
+ * worker threads.  The values of START and END have already been
+ * auto-selected and verified.
+ *
+ * The f7 metadata checks get split at shard boundaries, the rep-cache
+ * check into MAX_JOBS sections of roughly equal size.
+ */
+static svn_error_t *
+verify_concurrently(svn_fs_t *fs,
+                    svn_revnum_t start,
+                    svn_revnum_t end,
+                    int max_jobs,
+                    svn_fs_progress_notify_func_t notify_func,
+                    void *notify_baton,
+                    svn_cancel_func_t cancel_func,
+                    void *cancel_baton,
+                    apr_pool_t *pool)
+{
+  fs_fs_data_t *ffd = fs->fsap_data;
+  apr_array_header_t *ranges
+    = apr_array_make(pool, 16, sizeof(verify_range_t));
+  verify_range_t *range;
+  svn_revnum_t revision;
+
+  if (svn_fs_fs__use_log_addressing(fs))
+    {
+      for (revision = start; revision <= end; revision = range->end + 1)
+        {
+          svn_revnum_t shard_start
+            = revision - revision % ffd->max_files_per_dir;
+
+          range = apr_array_push(ranges);
+          range->start = revision;
+          range->end = MIN(end, shard_start + ffd->max_files_per_dir - 1);
+          range->notify_rev = revision == shard_start
+                            ? revision
+                            : SVN_INVALID_REVNUM;
+        }
+
+      SVN_ERR(verify_ranges_concurrently(fs, verify_f7_metadata_range,
+                                         ranges, max_jobs,
+                                         notify_func, notify_baton,
+                                         cancel_func, cancel_baton, pool));
+    }
+
+  if (ffd->format >= SVN_FS_FS__MIN_REP_SHARING_FORMAT)
+    {
+      svn_boolean_t exists;
+      svn_revnum_t count = end - start + 1;
+      int i;
+
+      /* Only look at the rep-cache if there is one.  See verify_rep_cache
+         for why we don't simply let the workers find out. */
+      SVN_ERR(svn_fs_fs__exists_rep_cache(&exists, fs, pool));
+      if (!exists)
+        return SVN_NO_ERROR;
+
+      if (notify_func)
+        notify_func(SVN_INVALID_REVNUM, notify_baton, pool);
+
+      apr_array_clear(ranges);
+      for (i = 0; i < max_jobs && i < count; ++i)
+        {
+          range = apr_array_push(ranges);
+          range->start = start
+                       + (svn_revnum_t)((apr_int64_t)count * i / max_jobs);
+          range->end = start - 1
+                     + (svn_revnum_t)((apr_int64_t)count * (i + 1) / max_jobs);
+          range->notify_rev = range->start;
+        }
+
+      SVN_ERR(verify_ranges_concurrently(fs, verify_rep_cache_range,
+                                         ranges, max_jobs,
+                                         notify_func, notify_baton,
+                                         cancel_func, cancel_baton, pool));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+#endif
+
 svn_error_t *
 svn_fs_fs__verify(svn_fs_t *fs,
                   svn_revnum_t start,
@@ -907,6 +1167,14 @@ svn_fs_fs__verify(svn_fs_t *fs,
   SVN_ERR(svn_fs_fs__ensure_revision_exists(start, fs, pool));
   SVN_ERR(svn_fs_fs__ensure_revision_exists(end, fs, pool));
 
+#if APR_HAS_THREADS
+  if (ffd->max_jobs > 1)
+    return svn_error_trace(verify_concurrently(fs, start, end, ffd->max_jobs,
+                                               notify_func, notify_baton,
+                                               cancel_func, cancel_baton,
+                                               pool));
+#endif
+
   /* log/phys index consistency.  We need to check them first to make
      sure we can access the rev / pack files in format7. */
   if (svn_fs_fs__use_log_addressing(fs))
@@ -32,7 +32,6 @@
 #include "svn_delta.h"
 #include "svn_version.h"
 #include "svn_pools.h"
-#include "batch_fsync.h"
 #include "fs.h"
 #include "fs_x.h"
 #include "pack.h"
@@ -47,6 +46,7 @@
 #include "transaction.h"
 #include "util.h"
 #include "svn_private_config.h"
+#include "private/svn_batch_fsync.h"
 #include "private/svn_fs_util.h"
 
 #include "../libsvn_fs/fs-loader.h"
@@ -665,7 +665,7 @@ svn_fs_x__init(const svn_version_t *loader_version,
                              loader_version->major);
   SVN_ERR(svn_ver_check_list2(x_version(), checklist, svn_ver_equal));
 
-  SVN_ERR(svn_fs_x__batch_fsync_init(common_pool));
+  SVN_ERR(svn_batch_fsync__init(common_pool));
 
   *vtable = &library_vtable;
   return SVN_NO_ERROR;
@@ -1065,6 +1065,44 @@ svn_error_t *svn_ra_get_file_revs2(svn_ra_session_t *session,
   return svn_error_trace(err);
 }
 
+svn_error_t *
+svn_ra_get_file_blame(svn_ra_session_t *session,
+                      const char *path,
+                      svn_revnum_t start,
+                      svn_revnum_t end,
+                      const apr_array_header_t *diff_options,
+                      svn_file_blame_receiver_t receiver,
+                      void *receiver_baton,
+                      apr_pool_t *scratch_pool)
+{
+  svn_error_t *err;
+
+  SVN_ERR_ASSERT(svn_relpath_is_canonical(path));
+  SVN_ERR_ASSERT(SVN_IS_VALID_REVNUM(start) && SVN_IS_VALID_REVNUM(end)
+                 && start <= end);
+  if (!session->vtable->get_file_blame)
+    return svn_error_create(SVN_ERR_UNSUPPORTED_FEATURE, NULL, NULL);
+
+  /* Don't check SVN_RA_CAPABILITY_FILE_BLAME here: ra_local supports
+     this without advertising it.  The other RA layers check whether
+     the server can do it. */
+  err = session->vtable->get_file_blame(session, path, start, end,
+                                        diff_options, receiver,
+                                        receiver_baton, scratch_pool);
+  if (err && err->apr_err == SVN_ERR_RA_NOT_IMPLEMENTED)
+    {
+      const char *session_url;
+
+      svn_error_clear(err);
+      SVN_ERR(svn_ra_get_session_url(session, &session_url, scratch_pool));
+      return svn_error_createf(SVN_ERR_UNSUPPORTED_FEATURE, NULL,
+                               _("The '%s' feature is not supported by '%s'"),
+                               SVN_RA_CAPABILITY_FILE_BLAME, session_url);
+    }
+
+  return svn_error_trace(err);
+}
+
 svn_error_t *svn_ra_lock(svn_ra_session_t *session,
                          apr_hash_t *path_revs,
                          const char *comment,
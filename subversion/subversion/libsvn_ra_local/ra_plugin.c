@@ -346,7 +346,7 @@ make_reporter(svn_ra_session_t *session,
                                               result_pool));
 
   /* Build a reporter baton. */
-  SVN_ERR(svn_repos_begin_report3(&rbaton,
+  SVN_ERR(svn_repos_begin_report4(&rbaton,
                                   revision,
                                   sess->repos,
                                   sess->fs_path->data,
@@ -365,8 +365,10 @@ make_reporter(svn_ra_session_t *session,
                                         zero-copy code path limitation (do
                                         not access FSFS data structures
                                         and, hence, caches).  See notes
-                                        to svn_repos_begin_report3() for
+                                        to svn_repos_begin_report4() for
                                         additional details. */
+                                  1, /* The client's process caches may
+                                        not be thread-safe. */
                                   result_pool));
 
   /* Wrap the report baton given us by the repos layer with our own
@@ -731,6 +733,28 @@ svn_ra_local__get_file_revs(svn_ra_session_t *session,
                                   handler, handler_baton, pool);
 }
 
+static svn_error_t *
+svn_ra_local__get_file_blame(svn_ra_session_t *session,
+                             const char *path,
+                             svn_revnum_t start,
+                             svn_revnum_t end,
+                             const apr_array_header_t *diff_options,
+                             svn_file_blame_receiver_t receiver,
+                             void *receiver_baton,
+                             apr_pool_t *pool)
+{
+  svn_ra_local__session_baton_t *sess = session->priv;
+  const char *abs_path = svn_fspath__join(sess->fs_path->data, path, pool);
+
+  return svn_error_trace(svn_repos_get_file_blame(
+                           sess->repos, abs_path, start, end, diff_options,
+                           NULL, NULL, receiver, receiver_baton,
+                           sess->callbacks
+                             ? sess->callbacks->cancel_func
+                             : NULL,
+                           sess->callback_baton, pool));
+}
+
 static svn_error_t *
 svn_ra_local__get_dated_revision(svn_ra_session_t *session,
                                  svn_revnum_t *revision,
@@ -1914,6 +1938,7 @@ static const svn_ra__vtable_t ra_local_vtable =
   svn_ra_local__get_inherited_props,
   NULL /* set_svn_ra_open */,
   svn_ra_local__list ,
+  svn_ra_local__get_file_blame,
   svn_ra_local__register_editor_shim_callbacks,
   svn_ra_local__get_commit_ev2,
   NULL /* replay_range_ev2 */
@@ -397,3 +397,223 @@ svn_ra_serf__get_file_revs(svn_ra_session_t *ra_session,
 
   return SVN_NO_ERROR;
 }
+
+
+/*
+ * The server-side blame report.
+ */
+typedef enum file_blame_state_e {
+  FILE_BLAME_INITIAL = XML_STATE_INITIAL,
+  FILE_BLAME_REPORT,
+  BLAME_RANGE,
+  BLAME_REV_PROP
+} file_blame_state_e;
+
+
+typedef struct file_blame_context_t {
+  /* parameters set by our caller */
+  const char *path;
+  svn_revnum_t start;
+  svn_revnum_t end;
+  const apr_array_header_t *diff_options;
+
+  /* receiver and baton */
+  svn_file_blame_receiver_t receiver;
+  void *receiver_baton;
+
+  /* The revision properties sent with the current BLAME_RANGE, if any. */
+  apr_hash_t *rev_props;
+  apr_pool_t *state_pool;
+
+} file_blame_context_t;
+
+
+static const svn_ra_serf__xml_transition_t file_blame_ttable[] = {
+  { FILE_BLAME_INITIAL, S_, "file-blame-report", FILE_BLAME_REPORT,
+    FALSE, { NULL }, FALSE },
+
+  { FILE_BLAME_REPORT, S_, "range", BLAME_RANGE,
+    FALSE, { "start", "count", "?rev", NULL }, TRUE },
+
+  { BLAME_RANGE, S_, "rev-prop", BLAME_REV_PROP,
+    TRUE, { "name", "?encoding", NULL }, TRUE },
+
+  { 0 }
+};
+
+/* Conforms to svn_ra_serf__xml_opened_t  */
+static svn_error_t *
+file_blame_opened(svn_ra_serf__xml_estate_t *xes,
+                  void *baton,
+                  int entered_state,
+                  const svn_ra_serf__dav_props_t *tag,
+                  apr_pool_t *scratch_pool)
+{
+  file_blame_context_t *blame_ctx = baton;
+
+  if (entered_state == BLAME_RANGE)
+    {
+      blame_ctx->state_pool = svn_ra_serf__xml_state_pool(xes);
+      blame_ctx->rev_props = NULL;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Conforms to svn_ra_serf__xml_closed_t  */
+static svn_error_t *
+file_blame_closed(svn_ra_serf__xml_estate_t *xes,
+                  void *baton,
+                  int leaving_state,
+                  const svn_string_t *cdata,
+                  apr_hash_t *attrs,
+                  apr_pool_t *scratch_pool)
+{
+  file_blame_context_t *blame_ctx = baton;
+
+  if (leaving_state == BLAME_RANGE)
+    {
+      const char *rev_str = svn_hash_gets(attrs, "rev");
+      apr_int64_t line_start, line_count;
+      svn_revnum_t rev = SVN_INVALID_REVNUM;
+
+      SVN_ERR(svn_cstring_atoi64(&line_start,
+                                 svn_hash_gets(attrs, "start")));
+      SVN_ERR(svn_cstring_atoi64(&line_count,
+                                 svn_hash_gets(attrs, "count")));
+      if (rev_str)
+        SVN_ERR(svn_revnum_parse(&rev, rev_str, NULL));
+
+      SVN_ERR(blame_ctx->receiver(blame_ctx->receiver_baton,
+                                  line_start, line_count, rev,
+                                  blame_ctx->rev_props, scratch_pool));
+    }
+  else
+    {
+      const char *name;
+      const char *encoding = svn_hash_gets(attrs, "encoding");
+      const svn_string_t *value;
+
+      SVN_ERR_ASSERT(leaving_state == BLAME_REV_PROP);
+
+      name = apr_pstrdup(blame_ctx->state_pool,
+                         svn_hash_gets(attrs, "name"));
+      if (encoding && strcmp(encoding, "base64") == 0)
+        value = svn_base64_decode_string(cdata, blame_ctx->state_pool);
+      else
+        value = svn_string_dup(cdata, blame_ctx->state_pool);
+
+      if (!blame_ctx->rev_props)
+        blame_ctx->rev_props = apr_hash_make(blame_ctx->state_pool);
+      svn_hash_sets(blame_ctx->rev_props, name, value);
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_ra_serf__request_body_delegate_t */
+static svn_error_t *
+create_file_blame_body(serf_bucket_t **body_bkt,
+                       void *baton,
+                       serf_bucket_alloc_t *alloc,
+                       apr_pool_t *pool /* request pool */,
+                       apr_pool_t *scratch_pool)
+{
+  serf_bucket_t *buckets;
+  file_blame_context_t *blame_ctx = baton;
+  int i;
+
+  buckets = serf_bucket_aggregate_create(alloc);
+
+  svn_ra_serf__add_open_tag_buckets(buckets, alloc,
+                                    "S:file-blame-report",
+                                    "xmlns:S", SVN_XML_NAMESPACE,
+                                    SVN_VA_NULL);
+
+  svn_ra_serf__add_tag_buckets(buckets,
+                               "S:start-revision",
+                               apr_ltoa(pool, blame_ctx->start),
+                               alloc);
+
+  svn_ra_serf__add_tag_buckets(buckets,
+                               "S:end-revision",
+                               apr_ltoa(pool, blame_ctx->end),
+                               alloc);
+
+  svn_ra_serf__add_tag_buckets(buckets,
+                               "S:path", blame_ctx->path,
+                               alloc);
+
+  if (blame_ctx->diff_options)
+    for (i = 0; i < blame_ctx->diff_options->nelts; i++)
+      svn_ra_serf__add_tag_buckets(buckets,
+                                   "S:diff-option",
+                                   APR_ARRAY_IDX(blame_ctx->diff_options, i,
+                                                 const char *),
+                                   alloc);
+
+  svn_ra_serf__add_close_tag_buckets(buckets, alloc,
+                                     "S:file-blame-report");
+
+  *body_bkt = buckets;
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_ra_serf__get_file_blame(svn_ra_session_t *ra_session,
+                            const char *path,
+                            svn_revnum_t start,
+                            svn_revnum_t end,
+                            const apr_array_header_t *diff_options,
+                            svn_file_blame_receiver_t receiver,
+                            void *receiver_baton,
+                            apr_pool_t *scratch_pool)
+{
+  file_blame_context_t *blame_ctx;
+  svn_ra_serf__session_t *session = ra_session->priv;
+  svn_ra_serf__handler_t *handler;
+  svn_ra_serf__xml_context_t *xmlctx;
+  const char *req_url;
+  svn_boolean_t has_blame;
+
+  SVN_ERR(svn_ra_serf__has_capability(ra_session, &has_blame,
+                                      SVN_RA_CAPABILITY_FILE_BLAME,
+                                      scratch_pool));
+  if (!has_blame)
+    return svn_error_create(SVN_ERR_RA_NOT_IMPLEMENTED, NULL, NULL);
+
+  blame_ctx = apr_pcalloc(scratch_pool, sizeof(*blame_ctx));
+  blame_ctx->path = path;
+  blame_ctx->start = start;
+  blame_ctx->end = end;
+  blame_ctx->diff_options = diff_options;
+  blame_ctx->receiver = receiver;
+  blame_ctx->receiver_baton = receiver_baton;
+
+  SVN_ERR(svn_ra_serf__get_stable_url(&req_url, NULL /* latest_revnum */,
+                                      session,
+                                      NULL /* url */, end,
+                                      scratch_pool, scratch_pool));
+
+  xmlctx = svn_ra_serf__xml_context_create(file_blame_ttable,
+                                           file_blame_opened,
+                                           file_blame_closed,
+                                           NULL,
+                                           blame_ctx,
+                                           scratch_pool);
+  handler = svn_ra_serf__create_expat_handler(session, xmlctx, NULL,
+                                              scratch_pool);
+
+  handler->method = "REPORT";
+  handler->path = req_url;
+  handler->body_type = "text/xml";
+  handler->body_delegate = create_file_blame_body;
+  handler->body_delegate_baton = blame_ctx;
+
+  SVN_ERR(svn_ra_serf__context_run_one(handler, scratch_pool));
+
+  if (handler->sline.code != 200)
+    return svn_error_trace(svn_ra_serf__unexpected_status(handler));
+
+  return SVN_NO_ERROR;
+}
@@ -273,6 +273,10 @@ struct svn_ra_serf__session_t {
    * to a successful PUT request. */
   svn_boolean_t supports_put_result_checksum;
 
+  /* Indicates whether the server can deliver the contents of many files
+   * in a single fetch-files REPORT. */
+  svn_boolean_t supports_fetch_files;
+
   apr_interval_time_t conn_latency;
 };
 
@@ -1321,6 +1325,17 @@ svn_ra_serf__get_file_revs(svn_ra_session_t *session,
                            void *handler_baton,
                            apr_pool_t *pool);
 
+/* Implements svn_ra__vtable_t.get_file_blame(). */
+svn_error_t *
+svn_ra_serf__get_file_blame(svn_ra_session_t *session,
+                            const char *path,
+                            svn_revnum_t start,
+                            svn_revnum_t end,
+                            const apr_array_header_t *diff_options,
+                            svn_file_blame_receiver_t receiver,
+                            void *receiver_baton,
+                            apr_pool_t *scratch_pool);
+
 /* Implements svn_ra__vtable_t.get_dated_revision(). */
 svn_error_t *
 svn_ra_serf__get_dated_revision(svn_ra_session_t *session,
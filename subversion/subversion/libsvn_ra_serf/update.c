@@ -238,6 +238,27 @@ static const svn_ra_serf__xml_transition_t update_ttable[] = {
   { 0 }
 };
 
+/* States of the fetch-files REPORT response parsing. */
+typedef enum fetch_files_state_e {
+  FF_INITIAL = XML_STATE_INITIAL,
+  FF_REPORT,
+  FF_FILE,
+  FF_TXDELTA
+} fetch_files_state_e;
+
+static const svn_ra_serf__xml_transition_t fetch_files_ttable[] = {
+  { FF_INITIAL, S_, "fetch-files-report", FF_REPORT,
+    FALSE, { NULL }, FALSE },
+
+  { FF_REPORT, S_, "file", FF_FILE,
+    FALSE, { "path", NULL }, TRUE },
+
+  { FF_FILE, S_, "txdelta", FF_TXDELTA,
+    FALSE, { NULL }, TRUE },
+
+  { 0 }
+};
+
 /* While we process the REPORT response, we will queue up GET and PROPFIND
    requests. For a very large checkout, it is very easy to queue requests
    faster than they are resolved. Thus, we need to pause the XML processing
@@ -260,8 +281,14 @@ static const svn_ra_serf__xml_transition_t update_ttable[] = {
 
 #define PARSE_CHUNK_SIZE 8000 /* Copied from xml.c ### Needs tuning */
 
+/* Maximum number of files whose contents we request in a single
+   fetch-files REPORT.  Each file counts as an active fetch, so keep
+   this below REQUEST_COUNT_TO_RESUME or batches would never fill up. */
+#define FETCH_FILES_BATCH_SIZE 32
+
 /* Forward-declare our report context. */
 typedef struct report_context_t report_context_t;
+typedef struct fetch_files_ctx_t fetch_files_ctx_t;
 typedef struct body_create_baton_t body_create_baton_t;
 /*
  * This structure represents the information for a directory.
@@ -390,6 +417,41 @@ typedef struct fetch_ctx_t {
 
 } fetch_ctx_t;
 
+/*
+ * A file whose contents are requested via a fetch-files REPORT.
+ */
+typedef struct fetch_files_item_t {
+  file_baton_t *file;
+
+  /* Repository paths of the file and of its delta base (or NULL) and
+     the revision of the latter, allocated in the batch pool. */
+  const char *path;
+  const char *base_path;
+  const char *base_rev;
+} fetch_files_item_t;
+
+/*
+ * This structure represents a single fetch-files REPORT which retrieves
+ * the contents of a batch of files in one response.
+ */
+struct fetch_files_ctx_t {
+  apr_pool_t *pool;
+
+  report_context_t *report;
+
+  /* The handler representing this request. */
+  svn_ra_serf__handler_t *handler;
+
+  /* The requested files, in request (and response) order. */
+  apr_array_header_t *items;
+
+  /* Index of the next file we expect in the response. */
+  int next_item;
+
+  /* The file currently being received, if any. */
+  file_baton_t *cur_file;
+};
+
 /*
  * The master structure for a REPORT request and response.
  */
@@ -439,9 +501,20 @@ struct report_context_t {
   /* Buffer holding request body for the REPORT (can spill to disk). */
   svn_ra_serf__request_body_t *body;
 
-  /* number of pending GET requests */
+  /* number of files whose contents are being fetched, either with a
+     GET request or as part of a (possibly not yet sent) batch */
   unsigned int num_active_fetches;
 
+  /* number of pending fetch-files REPORT requests */
+  unsigned int num_active_fetch_batches;
+
+  /* Should we fetch file contents in batches rather than GETting each
+     file individually? */
+  svn_boolean_t fetch_files_mode;
+
+  /* The batch of files waiting to be requested, or NULL. */
+  fetch_files_ctx_t *fetch_batch;
+
   /* number of pending PROPFIND requests */
   unsigned int num_active_propfinds;
 
@@ -1205,6 +1278,339 @@ file_fetch_done(serf_request_t *request,
   return svn_error_trace(close_file(file, scratch_pool));
 }
 
+/** Routines called when we are fetching files in batches */
+
+/* Conforms to svn_ra_serf__xml_opened_t  */
+static svn_error_t *
+fetch_files_opened(svn_ra_serf__xml_estate_t *xes,
+                   void *baton,
+                   int entered_state,
+                   const svn_ra_serf__dav_props_t *tag,
+                   apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+
+  switch (entered_state)
+    {
+      case FF_FILE:
+        {
+          fetch_files_item_t *item;
+          apr_hash_t *attrs;
+          const char *path;
+
+          attrs = svn_ra_serf__xml_gather_since(xes, entered_state);
+          path = svn_hash_gets(attrs, "path");
+
+          if (batch->next_item >= batch->items->nelts)
+            return svn_error_create(SVN_ERR_RA_DAV_MALFORMED_DATA, NULL,
+                                    _("The fetch-files response contains "
+                                      "more files than requested"));
+
+          item = APR_ARRAY_IDX(batch->items, batch->next_item,
+                               fetch_files_item_t *);
+          if (!path || strcmp(path, item->path) != 0)
+            return svn_error_createf(SVN_ERR_RA_DAV_MALFORMED_DATA, NULL,
+                                     _("The fetch-files response contains "
+                                       "'%s' where '%s' was expected"),
+                                     path ? path : "", item->path);
+
+          batch->cur_file = item->file;
+          batch->next_item++;
+        }
+        break;
+
+      case FF_TXDELTA:
+        {
+          file_baton_t *file = batch->cur_file;
+          svn_stream_t *decoder;
+
+          /* The editor handler was obtained in fetch_for_file(). */
+          decoder = svn_txdelta_parse_svndiff(file->txdelta,
+                                              file->txdelta_baton,
+                                              TRUE /* error early close*/,
+                                              file->pool);
+
+          file->txdelta_stream = svn_base64_decode(decoder, file->pool);
+        }
+        break;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Conforms to svn_ra_serf__xml_closed_t  */
+static svn_error_t *
+fetch_files_closed(svn_ra_serf__xml_estate_t *xes,
+                   void *baton,
+                   int leaving_state,
+                   const svn_string_t *cdata,
+                   apr_hash_t *attrs,
+                   apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+
+  switch (leaving_state)
+    {
+      case FF_TXDELTA:
+        {
+          file_baton_t *file = batch->cur_file;
+
+          SVN_ERR(svn_stream_close(file->txdelta_stream));
+          file->txdelta_stream = NULL;
+          file->fetch_file = FALSE;
+        }
+        break;
+
+      case FF_FILE:
+        {
+          file_baton_t *file = batch->cur_file;
+
+          batch->cur_file = NULL;
+          batch->report->num_active_fetches--;
+
+          /* Every file element carries a txdelta, but be tolerant. */
+          if (file->fetch_file)
+            {
+              SVN_ERR(file->txdelta(NULL, file->txdelta_baton));
+              file->fetch_file = FALSE;
+            }
+
+          if (file->fetch_props)
+            break; /* Still processing PROPFIND request */
+
+          SVN_ERR(close_file(file, scratch_pool));
+        }
+        break;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Conforms to svn_ra_serf__xml_cdata_t  */
+static svn_error_t *
+fetch_files_cdata(svn_ra_serf__xml_estate_t *xes,
+                  void *baton,
+                  int current_state,
+                  const char *data,
+                  apr_size_t len,
+                  apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+
+  if (current_state == FF_TXDELTA && batch->cur_file
+      && batch->cur_file->txdelta_stream)
+    {
+      SVN_ERR(svn_stream_write(batch->cur_file->txdelta_stream, data, &len));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_ra_serf__request_body_delegate_t */
+static svn_error_t *
+create_fetch_files_body(serf_bucket_t **body_bkt,
+                        void *baton,
+                        serf_bucket_alloc_t *alloc,
+                        apr_pool_t *pool /* request pool */,
+                        apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+  serf_bucket_t *buckets;
+  int i;
+
+  buckets = serf_bucket_aggregate_create(alloc);
+
+  svn_ra_serf__add_open_tag_buckets(buckets, alloc,
+                                    "S:fetch-files-report",
+                                    "xmlns:S", SVN_XML_NAMESPACE,
+                                    SVN_VA_NULL);
+
+  svn_ra_serf__add_tag_buckets(buckets, "S:revision",
+                               apr_ltoa(pool, batch->report->target_rev),
+                               alloc);
+
+  for (i = 0; i < batch->items->nelts; i++)
+    {
+      fetch_files_item_t *item = APR_ARRAY_IDX(batch->items, i,
+                                               fetch_files_item_t *);
+
+      svn_ra_serf__add_open_tag_buckets(buckets, alloc, "S:file",
+                                        SVN_VA_NULL);
+      svn_ra_serf__add_tag_buckets(buckets, "S:path", item->path, alloc);
+      if (item->base_path)
+        {
+          svn_ra_serf__add_tag_buckets(buckets, "S:base-path",
+                                       item->base_path, alloc);
+          svn_ra_serf__add_tag_buckets(buckets, "S:base-revision",
+                                       item->base_rev, alloc);
+        }
+      svn_ra_serf__add_close_tag_buckets(buckets, alloc, "S:file");
+    }
+
+  svn_ra_serf__add_close_tag_buckets(buckets, alloc,
+                                     "S:fetch-files-report");
+
+  *body_bkt = buckets;
+  return SVN_NO_ERROR;
+}
+
+/* Serf callback to setup fetch-files request headers. */
+static svn_error_t *
+setup_fetch_files_headers(serf_bucket_t *headers,
+                          void *baton,
+                          apr_pool_t *pool /* request pool */,
+                          apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+
+  svn_ra_serf__setup_svndiff_accept_encoding(headers, batch->report->sess);
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_ra_serf__response_done_delegate_t */
+static svn_error_t *
+fetch_files_done(serf_request_t *request,
+                 void *baton,
+                 apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = baton;
+  svn_ra_serf__handler_t *handler = batch->handler;
+
+  if (handler->server_error)
+      return svn_error_trace(svn_ra_serf__server_error_create(handler,
+                                                              scratch_pool));
+
+  if (handler->sline.code != 200)
+    return svn_error_trace(svn_ra_serf__unexpected_status(handler));
+
+  if (batch->next_item != batch->items->nelts)
+    return svn_error_create(SVN_ERR_RA_DAV_MALFORMED_DATA, NULL,
+                            _("The fetch-files response did not include "
+                              "all requested files"));
+
+  batch->report->num_active_fetch_batches--;
+
+  /* All files have been closed or are waiting for their properties;
+     this is the last callback for this request. */
+  svn_pool_destroy(batch->pool);
+
+  return SVN_NO_ERROR;
+}
+
+/* Send the pending batch of file fetches in CTX, if any, as a single
+   fetch-files REPORT. */
+static svn_error_t *
+send_fetch_batch(report_context_t *ctx,
+                 apr_pool_t *scratch_pool)
+{
+  fetch_files_ctx_t *batch = ctx->fetch_batch;
+  svn_ra_serf__xml_context_t *xmlctx;
+  svn_ra_serf__handler_t *handler;
+  const char *report_target;
+
+  if (!batch)
+    return SVN_NO_ERROR;
+
+  ctx->fetch_batch = NULL;
+
+  /* Each batch carries the work of many GETs, so give each one its own
+     connection as far as we can. */
+  if (ctx->sess->num_conns < ctx->sess->max_connections)
+    SVN_ERR(open_connection_if_needed(ctx->sess,
+                                      (ctx->num_active_fetch_batches + 1)
+                                        * REQS_PER_CONN
+                                      + ctx->num_active_propfinds));
+
+  SVN_ERR(svn_ra_serf__report_resource(&report_target, ctx->sess,
+                                       batch->pool));
+
+  xmlctx = svn_ra_serf__xml_context_create(fetch_files_ttable,
+                                           fetch_files_opened,
+                                           fetch_files_closed,
+                                           fetch_files_cdata,
+                                           batch,
+                                           batch->pool);
+  handler = svn_ra_serf__create_expat_handler(ctx->sess, xmlctx, NULL,
+                                              batch->pool);
+
+  handler->method = "REPORT";
+  handler->path = report_target;
+  handler->body_delegate = create_fetch_files_body;
+  handler->body_delegate_baton = batch;
+  handler->body_type = "text/xml";
+  handler->custom_accept_encoding = TRUE;
+  handler->header_delegate = setup_fetch_files_headers;
+  handler->header_delegate_baton = batch;
+
+  handler->conn = get_best_connection(ctx); /* Explicit scheduling */
+
+  handler->done_delegate = fetch_files_done;
+  handler->done_delegate_baton = batch;
+
+  batch->handler = handler;
+
+  svn_ra_serf__request_create(handler);
+
+  ctx->num_active_fetch_batches++;
+
+  return SVN_NO_ERROR;
+}
+
+/* Add FILE, whose textdelta handler has already been obtained, to the
+   pending batch of file fetches in its report context, sending the
+   batch once it is full. */
+static svn_error_t *
+queue_file_fetch(file_baton_t *file,
+                 apr_pool_t *scratch_pool)
+{
+  report_context_t *ctx = file->parent_dir->ctx;
+  fetch_files_ctx_t *batch = ctx->fetch_batch;
+  fetch_files_item_t *item;
+
+  if (!batch)
+    {
+      apr_pool_t *batch_pool = svn_pool_create(ctx->pool);
+
+      batch = apr_pcalloc(batch_pool, sizeof(*batch));
+      batch->pool = batch_pool;
+      batch->report = ctx;
+      batch->items = apr_array_make(batch_pool, FETCH_FILES_BATCH_SIZE,
+                                    sizeof(fetch_files_item_t *));
+      ctx->fetch_batch = batch;
+    }
+
+  item = apr_pcalloc(batch->pool, sizeof(*item));
+  item->file = file;
+  item->path = apr_pstrcat(batch->pool, "/", file->repos_relpath,
+                           SVN_VA_NULL);
+
+  /* Same delta base as we would use for a GET request. */
+  if (SVN_IS_VALID_REVNUM(file->base_rev))
+    {
+      item->base_path = item->path;
+      item->base_rev = apr_ltoa(batch->pool, file->base_rev);
+    }
+  else if (file->copyfrom_path)
+    {
+      SVN_ERR_ASSERT(SVN_IS_VALID_REVNUM(file->copyfrom_rev));
+
+      item->base_path = apr_pstrdup(batch->pool, file->copyfrom_path);
+      item->base_rev = apr_ltoa(batch->pool, file->copyfrom_rev);
+    }
+
+  APR_ARRAY_PUSH(batch->items, fetch_files_item_t *) = item;
+
+  /* Queued files count just like GETs in flight, so that the report
+     parsing gets throttled the same way. */
+  ctx->num_active_fetches++;
+
+  if (batch->items->nelts >= FETCH_FILES_BATCH_SIZE)
+    SVN_ERR(send_fetch_batch(ctx, scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
 /* Initiates additional requests needed for a file when not in "send-all" mode.
  */
 static svn_error_t *
@@ -1266,7 +1672,14 @@ fetch_for_file(file_baton_t *file,
             }
         }
 
-      if (file->fetch_file)
+      if (file->fetch_file && ctx->fetch_files_mode)
+        {
+          /* Let's fetch the file along with others in one REPORT. */
+          SVN_ERR_ASSERT(file->repos_relpath);
+
+          SVN_ERR(queue_file_fetch(file, scratch_pool));
+        }
+      else if (file->fetch_file)
         {
           fetch_ctx_t *fetch_ctx;
 
@@ -1712,6 +2125,9 @@ update_closed(svn_ra_serf__xml_estate_t *xes,
     {
       case UPDATE_REPORT:
         ctx->done = TRUE;
+
+        /* Don't leave the last files waiting for a full batch. */
+        SVN_ERR(send_fetch_batch(ctx, scratch_pool));
         break;
       case TARGET_REVISION:
         {
@@ -2442,6 +2858,12 @@ process_editor_report(report_context_t *ctx,
       if (ud->spillbuf)
         SVN_ERR(process_pending(ud, iterpool));
 
+      /* Send partial batches of file fetches while there are idle
+         connections, instead of waiting for them to fill up. */
+      if (ctx->fetch_batch
+          && ctx->num_active_fetch_batches < (unsigned int)sess->num_conns)
+        SVN_ERR(send_fetch_batch(ctx, iterpool));
+
       /* Debugging purposes only! */
       for (i = 0; i < sess->num_conns; i++)
         {
@@ -2605,6 +3027,11 @@ make_update_reporter(svn_ra_session_t *ra_session,
   report->editor_baton = update_baton;
   report->done = FALSE;
 
+  /* Fetch file contents in batches if the server supports that.  We
+     need HTTPv2 to address the delta bases by repository path. */
+  report->fetch_files_mode = sess->supports_fetch_files
+                             && SVN_RA_SERF__HAVE_HTTPV2_SUPPORT(sess);
+
   *reporter = &ra_serf_reporter;
   *report_baton = report;
 
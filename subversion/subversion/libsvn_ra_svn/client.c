@@ -193,6 +193,15 @@ static svn_error_t *make_connection(const char *hostname, unsigned short port,
       /* It's not a fatal error if we cannot enable keep-alives. */
     }
 
+  /* We buffer our output ourselves and flush it when we are done
+   * writing for a while.  Nagle's algorithm would only hold back the
+   * tail of each flush for a full round trip. */
+  status = apr_socket_opt_set(*sock, APR_TCP_NODELAY, 1);
+  if (status)
+    {
+      /* Not fatal either. */
+    }
+
   return SVN_NO_ERROR;
 }
 
@@ -760,7 +769,7 @@ static svn_error_t *open_session(svn_ra_svn__session_baton_t **sess_p,
    * capability list, and the URL, and subsequently there is an auth
    * request. */
   /* Client-side capabilities list: */
-  SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "n(wwwwwww)cc(?c)",
+  SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "n(wwwwwwww)cc(?c)",
                                   (apr_uint64_t) 2,
                                   SVN_RA_SVN_CAP_EDIT_PIPELINE,
                                   SVN_RA_SVN_CAP_SVNDIFF1,
@@ -769,6 +778,7 @@ static svn_error_t *open_session(svn_ra_svn__session_baton_t **sess_p,
                                   SVN_RA_SVN_CAP_DEPTH,
                                   SVN_RA_SVN_CAP_MERGEINFO,
                                   SVN_RA_SVN_CAP_LOG_REVPROPS,
+                                  SVN_RA_SVN_CAP_EDIT_WINDOW,
                                   url,
                                   SVN_RA_SVN__DEFAULT_USERAGENT,
                                   client_string));
@@ -1363,6 +1373,11 @@ static svn_error_t *ra_svn_commit(svn_ra_session_t *session,
   SVN_ERR(handle_auth_request(sess_baton, pool));
   SVN_ERR(svn_ra_svn__read_cmd_response(conn, pool, ""));
 
+  /* Stream the edit without waiting for the server, if it supports that.
+     The editor will end windowed mode when the edit completes. */
+  if (svn_ra_svn_has_capability(conn, SVN_RA_SVN_CAP_EDIT_WINDOW))
+    svn_ra_svn__enable_edit_window(conn, TRUE);
+
   /* Remember a few arguments for when the commit is over. */
   ccb = apr_palloc(pool, sizeof(*ccb));
   ccb->sess_baton = sess_baton;
@@ -3086,6 +3101,7 @@ ra_svn_has_capability(svn_ra_session_t *session,
       {SVN_RA_CAPABILITY_GET_FILE_REVS_REVERSE,
                                        SVN_RA_SVN_CAP_GET_FILE_REVS_REVERSE},
       {SVN_RA_CAPABILITY_LIST, SVN_RA_SVN_CAP_LIST},
+      {SVN_RA_CAPABILITY_FILE_BLAME, SVN_RA_SVN_CAP_FILE_BLAME},
 
       {NULL, NULL} /* End of list marker */
   };
@@ -3268,6 +3284,73 @@ ra_svn_list(svn_ra_session_t *session,
   return SVN_NO_ERROR;
 }
 
+static svn_error_t *
+ra_svn_get_file_blame(svn_ra_session_t *session,
+                      const char *path,
+                      svn_revnum_t start,
+                      svn_revnum_t end,
+                      const apr_array_header_t *diff_options,
+                      svn_file_blame_receiver_t receiver,
+                      void *receiver_baton,
+                      apr_pool_t *scratch_pool)
+{
+  svn_ra_svn__session_baton_t *sess_baton = session->priv;
+  svn_ra_svn_conn_t *conn = sess_baton->conn;
+  int i;
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+
+  if (!svn_ra_svn_has_capability(conn, SVN_RA_SVN_CAP_FILE_BLAME))
+    return svn_error_create(SVN_ERR_RA_NOT_IMPLEMENTED, NULL, NULL);
+
+  path = reparent_path(session, path, scratch_pool);
+
+  /* Send the get-file-blame request. */
+  SVN_ERR(svn_ra_svn__write_tuple(conn, scratch_pool, "w(crr(!",
+                                  "get-file-blame", path, start, end));
+  if (diff_options)
+    for (i = 0; i < diff_options->nelts; ++i)
+      SVN_ERR(svn_ra_svn__write_cstring(conn, scratch_pool,
+                                        APR_ARRAY_IDX(diff_options, i,
+                                                      const char *)));
+  SVN_ERR(svn_ra_svn__write_tuple(conn, scratch_pool, "!))"));
+
+  /* Handle auth request by server */
+  SVN_ERR(handle_auth_request(sess_baton, scratch_pool));
+
+  /* Read and process the line ranges. */
+  while (1)
+    {
+      svn_ra_svn__item_t *item;
+      apr_uint64_t line_start, line_count;
+      svn_revnum_t rev;
+      svn_ra_svn__list_t *rev_proplist;
+      apr_hash_t *rev_props = NULL;
+
+      svn_pool_clear(iterpool);
+
+      SVN_ERR(svn_ra_svn__read_item(conn, iterpool, &item));
+      if (is_done_response(item))
+        break;
+      if (item->kind != SVN_RA_SVN_LIST)
+        return svn_error_create(SVN_ERR_RA_SVN_MALFORMED_DATA, NULL,
+                                _("Blame range not a list"));
+      SVN_ERR(svn_ra_svn__parse_tuple(&item->u.list, "nn(?r)(?l)",
+                                      &line_start, &line_count, &rev,
+                                      &rev_proplist));
+      if (rev_proplist)
+        SVN_ERR(svn_ra_svn__parse_proplist(rev_proplist, iterpool,
+                                           &rev_props));
+
+      SVN_ERR(receiver(receiver_baton, (apr_int64_t)line_start,
+                       (apr_int64_t)line_count, rev, rev_props, iterpool));
+    }
+  svn_pool_destroy(iterpool);
+
+  /* Read the actual command response. */
+  SVN_ERR(svn_ra_svn__read_cmd_response(conn, scratch_pool, ""));
+  return SVN_NO_ERROR;
+}
+
 static const svn_ra__vtable_t ra_svn_vtable = {
   svn_ra_svn_version,
   ra_svn_get_description,
@@ -3308,6 +3391,7 @@ static const svn_ra__vtable_t ra_svn_vtable = {
   ra_svn_get_inherited_props,
   NULL /* ra_set_svn_ra_open */,
   ra_svn_list,
+  ra_svn_get_file_blame,
   ra_svn_register_editor_shim_callbacks,
   NULL /* commit_ev2 */,
   NULL /* replay_range_ev2 */
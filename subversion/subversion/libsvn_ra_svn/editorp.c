@@ -37,6 +37,7 @@
 #include "svn_ra_svn.h"
 #include "svn_path.h"
 #include "svn_pools.h"
+#include "svn_sorts.h"
 #include "svn_private_config.h"
 
 #include "private/svn_atomic.h"
@@ -165,14 +166,118 @@ check_for_error_internal(ra_svn_edit_baton_t *eb, apr_pool_t *pool)
   return SVN_NO_ERROR;
 }
 
+/* The consumer answered with STATUS and PARAMS instead of acknowledging
+ * our windowed edit.  Abort the edit and return the consumer's error. */
+static svn_error_t *
+edit_window_failed(ra_svn_edit_baton_t *eb,
+                   const char *status,
+                   svn_ra_svn__list_t *params,
+                   apr_pool_t *pool)
+{
+  svn_error_t *err;
+
+  eb->got_status = TRUE;
+  svn_ra_svn__enable_edit_window(eb->conn, FALSE);
+
+  if (strcmp(status, "failure") == 0)
+    err = svn_ra_svn__handle_failure_status(params);
+  else
+    err = svn_error_createf(SVN_ERR_RA_SVN_MALFORMED_DATA, NULL,
+                            _("Unexpected status '%s' during edit"),
+                            status);
+
+  /* Let the consumer stop discarding our commands. */
+  return svn_error_compose_create(
+           err,
+           svn_error_compose_create(
+             svn_ra_svn__write_cmd_abort_edit(eb->conn, pool),
+             svn_ra_svn__flush(eb->conn, pool)));
+}
+
+/* Windowed variant of check_for_error_internal().  Every now and then,
+ * process the acknowledgements that the consumer sent for EB's edit.
+ * If the window is exhausted, wait for further acknowledgements.  If the
+ * consumer reported an error instead, abort the edit and return it. */
+static svn_error_t *
+check_edit_window(ra_svn_edit_baton_t *eb, apr_pool_t *pool)
+{
+  svn_ra_svn_conn_t *conn = eb->conn;
+  SVN_ERR_ASSERT(!eb->got_status);
+
+  if (   conn->edit_unacked_out < conn->edit_window
+      && conn->written_since_error_check
+           < conn->edit_window / SVN_RA_SVN__EDIT_ACK_FRACTION)
+    return SVN_NO_ERROR;
+
+  conn->written_since_error_check = 0;
+  while (TRUE)
+    {
+      const char *status;
+      svn_ra_svn__list_t *params;
+      apr_uint64_t acked;
+
+      /* Block only if we must. */
+      if (conn->edit_unacked_out < conn->edit_window)
+        {
+          svn_boolean_t available, terminated;
+          SVN_ERR(svn_ra_svn__has_command(&available, &terminated, conn,
+                                          pool));
+          if (!available)
+            break;
+        }
+
+      SVN_ERR(svn_ra_svn__read_tuple(conn, pool, "wl", &status, &params));
+      if (strcmp(status, "ack") != 0)
+        return svn_error_trace(edit_window_failed(eb, status, params, pool));
+
+      SVN_ERR(svn_ra_svn__parse_tuple(params, "n", &acked));
+      conn->edit_unacked_out -= MIN(acked, conn->edit_unacked_out);
+    }
+
+  return SVN_NO_ERROR;
+}
+
 static svn_error_t *
 check_for_error(ra_svn_edit_baton_t *eb, apr_pool_t *pool)
 {
+  if (eb->conn->edit_window)
+    return check_edit_window(eb, pool);
+
   return eb->conn->may_check_for_error
     ? check_for_error_internal(eb, pool)
     : SVN_NO_ERROR;
 }
 
+/* Read the consumer's response to the close-edit or abort-edit command
+ * that we just sent for EB.  Skip any acknowledgements that are still
+ * in the pipe and end windowed pipelining. */
+static svn_error_t *
+read_edit_response(ra_svn_edit_baton_t *eb, apr_pool_t *pool)
+{
+  svn_ra_svn_conn_t *conn = eb->conn;
+  const char *status;
+  svn_ra_svn__list_t *params;
+
+  if (!conn->edit_window)
+    return svn_error_trace(svn_ra_svn__read_cmd_response(conn, pool, ""));
+
+  svn_ra_svn__enable_edit_window(conn, FALSE);
+  do
+    {
+      SVN_ERR(svn_ra_svn__read_tuple(conn, pool, "wl", &status, &params));
+    }
+  while (strcmp(status, "ack") == 0);
+
+  if (strcmp(status, "success") == 0)
+    return SVN_NO_ERROR;
+  else if (strcmp(status, "failure") == 0)
+    return svn_error_trace(svn_ra_svn__handle_failure_status(params));
+
+  return svn_error_createf(SVN_ERR_RA_SVN_MALFORMED_DATA, NULL,
+                           _("Unknown status '%s' in command response"),
+                           status);
+}
+
 static svn_error_t *ra_svn_target_rev(void *edit_baton, svn_revnum_t rev,
                                       apr_pool_t *pool)
 {
@@ -405,7 +510,7 @@ static svn_error_t *ra_svn_close_edit(void *edit_baton, apr_pool_t *pool)
   SVN_ERR_ASSERT(!eb->got_status);
   eb->got_status = TRUE;
   SVN_ERR(svn_ra_svn__write_cmd_close_edit(eb->conn, pool));
-  err = svn_error_trace(svn_ra_svn__read_cmd_response(eb->conn, pool, ""));
+  err = svn_error_trace(read_edit_response(eb, pool));
   if (err)
     {
       return svn_error_compose_create(
@@ -425,7 +530,7 @@ static svn_error_t *ra_svn_abort_edit(void *edit_baton, apr_pool_t *pool)
   if (eb->got_status)
     return SVN_NO_ERROR;
   SVN_ERR(svn_ra_svn__write_cmd_abort_edit(eb->conn, pool));
-  SVN_ERR(svn_ra_svn__read_cmd_response(eb->conn, pool, ""));
+  SVN_ERR(read_edit_response(eb, pool));
   return SVN_NO_ERROR;
 }
 
@@ -1173,6 +1278,18 @@ svn_error_t *svn_ra_svn_drive_editor2(svn_ra_svn_conn_t *conn,
           break;
         }
       SVN_ERR(err);
+
+      /* In windowed mode, the driver waits for us to acknowledge the
+         data that we consumed. */
+      if (conn->edit_window && !state.done
+          && conn->edit_unacked_in
+               >= conn->edit_window / SVN_RA_SVN__EDIT_ACK_FRACTION)
+        {
+          SVN_ERR(svn_ra_svn__write_tuple(conn, subpool, "w(n)", "ack",
+                                          conn->edit_unacked_in));
+          conn->edit_unacked_in = 0;
+          SVN_ERR(svn_ra_svn__flush(conn, subpool));
+        }
     }
 
   /* Read and discard editing commands until the edit is complete.
@@ -206,6 +206,9 @@ svn_ra_svn_conn_t *svn_ra_svn_create_conn5(apr_socket_t *sock,
   conn->written_since_error_check = 0;
   conn->error_check_interval = error_check_interval;
   conn->may_check_for_error = error_check_interval == 0;
+  conn->edit_window = 0;
+  conn->edit_unacked_out = 0;
+  conn->edit_unacked_in = 0;
   conn->max_in = max_in;
   conn->current_in = 0;
   conn->max_out = max_out;
@@ -343,6 +346,15 @@ svn_ra_svn__reset_command_io_counters(svn_ra_svn_conn_t *conn)
   conn->current_out = 0;
 }
 
+void
+svn_ra_svn__enable_edit_window(svn_ra_svn_conn_t *conn,
+                               svn_boolean_t enable)
+{
+  conn->edit_window = enable ? SVN_RA_SVN__EDIT_WINDOW_SIZE : 0;
+  conn->edit_unacked_out = 0;
+  conn->edit_unacked_in = 0;
+}
+
 
 /* --- WRITE BUFFER MANAGEMENT --- */
 
@@ -408,6 +420,7 @@ static svn_error_t *writebuf_output(svn_ra_svn_conn_t *conn, apr_pool_t *pool,
     }
 
   conn->written_since_error_check += len;
+  conn->edit_unacked_out += len;
   conn->may_check_for_error
     = conn->written_since_error_check >= conn->error_check_interval;
 
@@ -509,6 +522,7 @@ static svn_error_t *readbuf_input(svn_ra_svn_conn_t *conn, char *data,
   if (*len == 0)
     return svn_error_create(SVN_ERR_RA_SVN_CONNECTION_CLOSED, NULL, NULL);
   conn->current_in += *len;
+  conn->edit_unacked_in += *len;
 
   if (session)
     {
@@ -540,6 +554,7 @@ static svn_error_t *readbuf_skip(svn_ra_svn_conn_t *conn, apr_uint64_t len)
     if (buflen == 0)
       return svn_error_create(SVN_ERR_RA_SVN_CONNECTION_CLOSED, NULL, NULL);
 
+    conn->edit_unacked_in += buflen;
     conn->read_end = conn->read_buf + buflen;
     conn->read_ptr = conn->read_buf;
   }
@@ -762,6 +777,64 @@ svn_ra_svn__write_string(svn_ra_svn_conn_t *conn,
   return SVN_NO_ERROR;
 }
 
+svn_error_t *
+svn_ra_svn__write_file_strings(svn_ra_svn_conn_t *conn,
+                               apr_pool_t *pool,
+                               apr_file_t *file,
+                               apr_off_t offset,
+                               svn_filesize_t length)
+{
+  svn_boolean_t use_sendfile = svn_ra_svn__stream_can_sendfile(conn->stream);
+  char *buffer = NULL;
+
+  if (!use_sendfile)
+    {
+      apr_off_t pos = offset;
+
+      buffer = apr_palloc(pool, SVN_RA_SVN__FILE_CHUNK_SIZE);
+      SVN_ERR(svn_io_file_seek(file, APR_SET, &pos, pool));
+    }
+
+  while (length > 0)
+    {
+      char prefix[SVN_INT64_BUFFER_SIZE + 1];
+      apr_size_t chunk = (apr_size_t)MIN(length, SVN_RA_SVN__FILE_CHUNK_SIZE);
+      apr_size_t prefix_len = svn__ui64toa(prefix, chunk);
+
+      prefix[prefix_len++] = ':';
+      SVN_ERR(writebuf_write(conn, pool, prefix, prefix_len));
+
+      if (use_sendfile)
+        {
+          /* Keep the order of data on the wire. */
+          SVN_ERR(writebuf_flush(conn, pool));
+
+          conn->current_out += chunk;
+          SVN_ERR(check_io_limits(conn));
+
+          SVN_ERR(svn_ra_svn__stream_sendfile(conn->stream, file, offset,
+                                              chunk));
+
+          conn->written_since_error_check += chunk;
+          conn->edit_unacked_out += chunk;
+          conn->may_check_for_error
+            = conn->written_since_error_check >= conn->error_check_interval;
+        }
+      else
+        {
+          SVN_ERR(svn_io_file_read_full2(file, buffer, chunk, NULL, NULL,
+                                         pool));
+          SVN_ERR(writebuf_write(conn, pool, buffer, chunk));
+        }
+
+      SVN_ERR(writebuf_writechar(conn, pool, ' '));
+      offset += chunk;
+      length -= chunk;
+    }
+
+  return SVN_NO_ERROR;
+}
+
 svn_error_t *
 svn_ra_svn__write_cstring(svn_ra_svn_conn_t *conn,
                           apr_pool_t *pool,
@@ -1903,6 +1976,42 @@ svn_ra_svn__has_command(svn_boolean_t *has_command,
   return svn_error_trace(err);
 }
 
+svn_error_t *
+svn_ra_svn__check_terminated(svn_boolean_t *terminated,
+                             svn_ra_svn_conn_t *conn,
+                             apr_pool_t *pool)
+{
+  svn_boolean_t available;
+  apr_size_t len;
+  svn_error_t *err;
+
+  *terminated = FALSE;
+
+  /* Unread data means that the other side is still talking to us. */
+  if (conn->read_ptr != conn->read_end)
+    return SVN_NO_ERROR;
+
+  SVN_ERR(svn_ra_svn__data_available(conn, &available));
+  if (!available)
+    return SVN_NO_ERROR;
+
+  /* A closed connection reads as "available" and returns no data. */
+  len = sizeof(conn->read_buf);
+  err = readbuf_input(conn, conn->read_buf, &len, pool);
+  if (err && err->apr_err == SVN_ERR_RA_SVN_CONNECTION_CLOSED)
+    {
+      *terminated = TRUE;
+      svn_error_clear(err);
+      return SVN_NO_ERROR;
+    }
+  SVN_ERR(err);
+
+  conn->read_ptr = conn->read_buf;
+  conn->read_end = conn->read_buf + len;
+
+  return SVN_NO_ERROR;
+}
+
 svn_error_t *
 svn_ra_svn__handle_command(svn_boolean_t *terminate,
                            apr_hash_t *cmd_hash,
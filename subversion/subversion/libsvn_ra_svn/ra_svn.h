@@ -67,6 +67,18 @@ typedef svn_error_t *(*ra_svn_block_handler_t)(svn_ra_svn_conn_t *conn,
 #define SVN_RA_SVN__READBUF_SIZE (4 * SVN_RA_SVN__PAGE_SIZE)
 #define SVN_RA_SVN__WRITEBUF_SIZE (4 * SVN_RA_SVN__PAGE_SIZE)
 
+/* Maximum number of editor command bytes that a windowed edit driver may
+ * send without having them acknowledged by the receiver.  The receiver
+ * acknowledges them in chunks of 1 / SVN_RA_SVN__EDIT_ACK_FRACTION of
+ * that window and the driver checks for acknowledgements and errors at
+ * the same rate. */
+#define SVN_RA_SVN__EDIT_WINDOW_SIZE (16 * 1024 * 1024)
+#define SVN_RA_SVN__EDIT_ACK_FRACTION 8
+
+/* Maximum size of the strings that svn_ra_svn__write_file_strings() splits
+ * the file contents into. */
+#define SVN_RA_SVN__FILE_CHUNK_SIZE (1024 * 1024)
+
 /* Create forward reference */
 typedef struct svn_ra_svn__session_baton_t svn_ra_svn__session_baton_t;
 
@@ -96,6 +108,11 @@ struct svn_ra_svn_conn_st {
   apr_size_t error_check_interval;
   svn_boolean_t may_check_for_error;
 
+  /* windowed edit pipelining; EDIT_WINDOW is 0 if disabled */
+  apr_uint64_t edit_window;
+  apr_uint64_t edit_unacked_out;
+  apr_uint64_t edit_unacked_in;
+
   /* I/O limits and tracking */
   apr_uint64_t max_in;
   apr_uint64_t current_in;
@@ -228,6 +245,21 @@ svn_error_t *svn_ra_svn__stream_write(svn_ra_svn__stream_t *stream,
 svn_error_t *svn_ra_svn__stream_read(svn_ra_svn__stream_t *stream,
                                      char *data, apr_size_t *len);
 
+/* Return TRUE if svn_ra_svn__stream_sendfile() may be used with STREAM.
+ */
+svn_boolean_t
+svn_ra_svn__stream_can_sendfile(svn_ra_svn__stream_t *stream);
+
+/* Write LEN bytes starting at OFFSET in FILE to STREAM, bypassing our
+ * user-space buffers.  svn_ra_svn__stream_can_sendfile() must have
+ * returned TRUE for STREAM.
+ */
+svn_error_t *
+svn_ra_svn__stream_sendfile(svn_ra_svn__stream_t *stream,
+                            apr_file_t *file,
+                            apr_off_t offset,
+                            apr_size_t len);
+
 /* Read the command word from CONN, return it in *COMMAND and skip to the
  * end of the command.  Allocate data in POOL.
  */
@@ -37,6 +37,7 @@
 #include "svn_ctype.h"
 #include "private/svn_atomic.h"
 #include "private/svn_fspath.h"
+#include "private/svn_mutex.h"
 #include "private/svn_repos_private.h"
 #include "private/svn_sorts_private.h"
 #include "private/svn_subr_private.h"
@@ -992,6 +993,11 @@ typedef struct lookup_state_t
   /* Rights that apply at PARENT_PATH, if PARENT_PATH is not empty. */
   limited_rights_t parent_rights;
 
+  /* Set by lookup().  TRUE, if RIGHTS apply to the full path that has
+   * been looked up.  FALSE, if the walk stopped early and RIGHTS apply
+   * to PARENT_PATH and describe its whole sub-tree. */
+  svn_boolean_t complete;
+
 } lookup_state_t;
 
 /* Constructor for lookup_state_t. */
@@ -1255,6 +1261,8 @@ lookup(lookup_state_t *state,
   while (path[0] == '/')
     ++path;     /* Don't update PATH_LEN as we won't need it anymore. */
 
+  state->complete = FALSE;
+
   /* Actually walk the path rule tree following PATH until we run out of
    * either tree or PATH. */
   while (state->current->nelts && path)
@@ -1360,6 +1368,10 @@ lookup(lookup_state_t *state,
           /* In STATE, PARENT_PATH, PARENT_RIGHTS and CURRENT are now in sync. */
           state->parent_rights = state->rights;
         }
+      else
+        {
+          state->complete = TRUE;
+        }
     }
 
   /* If we check recursively, none of the (potential) sub-paths must have
@@ -1375,6 +1387,253 @@ lookup(lookup_state_t *state,
 
 
 
+/*** Decision cache. ***/
+
+/* Upper limit to the number of entries in a decision cache.  Once it has
+ * been reached, the cache gets emptied and starts over. */
+#define DECISION_CACHE_SIZE 10000
+
+/* Memoized results of lookup() for one filtered path rule tree, i.e. for
+ * one combination of authz model, repository and user.  Since filtered
+ * trees are shared via FILTERED_POOL, all connections of the same user
+ * will use and fill the same decision cache.
+ */
+typedef struct decision_cache_t
+{
+  /* Maps normalized paths (a single leading '/', no trailing '/') to the
+   * limited_rights_t that lookup() found for the respective node.  These
+   * give the access rights for the path itself as well as the limits to
+   * the rights within its sub-tree.  The root is never cached. */
+  apr_hash_t *rights;
+
+  /* Serializes access to RIGHTS and POOL.  May be NULL. */
+  svn_mutex__t *mutex;
+
+  /* Pool containing RIGHTS and its contents.  Gets cleared whenever the
+   * cache becomes full. */
+  apr_pool_t *pool;
+} decision_cache_t;
+
+/* Return a new, empty decision cache allocated in RESULT_POOL.  Make it
+ * thread-safe if MULTI_THREADED is set. */
+static svn_error_t *
+create_decision_cache(decision_cache_t **cache_p,
+                      svn_boolean_t multi_threaded,
+                      apr_pool_t *result_pool)
+{
+  decision_cache_t *cache = apr_pcalloc(result_pool, sizeof(*cache));
+
+  SVN_ERR(svn_mutex__init(&cache->mutex, multi_threaded, result_pool));
+  cache->pool = svn_pool_create(result_pool);
+  cache->rights = svn_hash__make(cache->pool);
+
+  *cache_p = cache;
+  return SVN_NO_ERROR;
+}
+
+/* Return the length of PATH with its trailing '/' removed and set *START
+ * to the position of its last leading '/'.  The LENGTH bytes at *START
+ * are the key to use with decision caches. */
+static apr_size_t
+decision_key(const char **start,
+             const char *path)
+{
+  apr_size_t len = strlen(path);
+
+  while (len && path[len-1] == '/')
+    --len;
+
+  while (len > 1 && path[1] == '/')
+    {
+      ++path;
+      --len;
+    }
+
+  *start = path;
+  return len;
+}
+
+/* Baton type to be used with find_decision_body(). */
+typedef struct find_decision_baton_t
+{
+  /* Cache to search. */
+  decision_cache_t *cache;
+
+  /* Key of the path to look for and its length. */
+  const char *key;
+  apr_size_t key_len;
+
+  /* Required access and whether sub-paths must have it, too. */
+  authz_access_t required;
+  svn_boolean_t recursive;
+
+  /* Set to TRUE if a decision could be found. */
+  svn_boolean_t found;
+
+  /* The decision, if FOUND. */
+  svn_boolean_t access_granted;
+} find_decision_baton_t;
+
+/* Implements svn_mutex__with_lock callbacks.  Look for an entry in
+ * BATON->CACHE that decides the query described in BATON.  That may be
+ * the entry for BATON->KEY itself or any entry for a parent path whose
+ * sub-tree uniformly grants or denies the required access. */
+static svn_error_t *
+find_decision_body(void *baton)
+{
+  find_decision_baton_t *b = baton;
+  const limited_rights_t *rights;
+  apr_size_t len = b->key_len;
+
+  rights = apr_hash_get(b->cache->rights, b->key, len);
+  if (rights)
+    {
+      b->found = TRUE;
+      b->access_granted
+        = b->recursive
+        ? (rights->min_rights & b->required) == b->required
+        : (rights->access.rights & b->required) == b->required;
+
+      return SVN_NO_ERROR;
+    }
+
+  /* The deepest cached parent decides.  If it does not, none of its own
+   * parents will because their sub-trees contain its sub-tree. */
+  while (--len > 0)
+    if (b->key[len] == '/')
+      {
+        rights = apr_hash_get(b->cache->rights, b->key, len);
+        if (rights)
+          {
+            if ((rights->max_rights & b->required) != b->required)
+              {
+                b->found = TRUE;
+                b->access_granted = FALSE;
+              }
+            else if ((rights->min_rights & b->required) == b->required)
+              {
+                b->found = TRUE;
+                b->access_granted = TRUE;
+              }
+
+            break;
+          }
+      }
+
+  return SVN_NO_ERROR;
+}
+
+/* Set *FOUND and *ACCESS_GRANTED according to the entries in CACHE that
+ * decide whether the REQUIRED access to the path given by KEY and KEY_LEN
+ * (and all of its sub-paths, if RECURSIVE is set) shall be granted. */
+static svn_error_t *
+find_decision(svn_boolean_t *found,
+              svn_boolean_t *access_granted,
+              decision_cache_t *cache,
+              const char *key,
+              apr_size_t key_len,
+              authz_access_t required,
+              svn_boolean_t recursive)
+{
+  find_decision_baton_t baton;
+
+  baton.cache = cache;
+  baton.key = key;
+  baton.key_len = key_len;
+  baton.required = required;
+  baton.recursive = recursive;
+  baton.found = FALSE;
+  baton.access_granted = FALSE;
+
+  SVN_MUTEX__WITH_LOCK(cache->mutex, find_decision_body(&baton));
+
+  *found = baton.found;
+  *access_granted = baton.access_granted;
+
+  return SVN_NO_ERROR;
+}
+
+/* Baton type to be used with remember_decision_body(). */
+typedef struct remember_decision_baton_t
+{
+  /* Cache to update. */
+  decision_cache_t *cache;
+
+  /* Lookup state right after the lookup of KEY. */
+  const lookup_state_t *state;
+
+  /* Key of the path that has been looked up and its length. */
+  const char *key;
+  apr_size_t key_len;
+} remember_decision_baton_t;
+
+/* In CACHE, set the entry for the path given by KEY and KEY_LEN to RIGHTS,
+ * unless it is the root path. */
+static void
+set_decision(decision_cache_t *cache,
+             const char *key,
+             apr_size_t key_len,
+             const limited_rights_t *rights)
+{
+  if (key_len == 0 || apr_hash_get(cache->rights, key, key_len))
+    return;
+
+  apr_hash_set(cache->rights, apr_pstrmemdup(cache->pool, key, key_len),
+               key_len, apr_pmemdup(cache->pool, rights, sizeof(*rights)));
+}
+
+/* Implements svn_mutex__with_lock callbacks.  Add the rights that the
+ * lookup described by BATON found to BATON->CACHE. */
+static svn_error_t *
+remember_decision_body(void *baton)
+{
+  remember_decision_baton_t *b = baton;
+  const lookup_state_t *state = b->state;
+
+  if (apr_hash_count(b->cache->rights) >= DECISION_CACHE_SIZE)
+    {
+      svn_pool_clear(b->cache->pool);
+      b->cache->rights = svn_hash__make(b->cache->pool);
+    }
+
+  /* The parent path is always known and will serve lookups of siblings
+   * as well as of any other path in its sub-tree. */
+  if (state->complete)
+    {
+      set_decision(b->cache, b->key, b->key_len, &state->rights);
+      set_decision(b->cache, state->parent_path->data,
+                   state->parent_path->len, &state->parent_rights);
+    }
+  else
+    {
+      set_decision(b->cache, state->parent_path->data,
+                   state->parent_path->len, &state->rights);
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Add the result of the lookup of the path given by KEY and KEY_LEN, as
+ * recorded in STATE, to CACHE. */
+static svn_error_t *
+remember_decision(decision_cache_t *cache,
+                  const lookup_state_t *state,
+                  const char *key,
+                  apr_size_t key_len)
+{
+  remember_decision_baton_t baton;
+
+  baton.cache = cache;
+  baton.state = state;
+  baton.key = key;
+  baton.key_len = key_len;
+
+  SVN_MUTEX__WITH_LOCK(cache->mutex, remember_decision_body(&baton));
+
+  return SVN_NO_ERROR;
+}
+
+
 /*** The authz data structure. ***/
 
 /* An entry in svn_authz_t's USER_RULES cache.  All members must be
@@ -1398,6 +1657,10 @@ struct authz_user_rules_t
    * Will remain NULL until the first usage. */
   node_t *root;
 
+  /* Previous lookup results for ROOT.
+   * Will remain NULL until the first usage. */
+  decision_cache_t *decisions;
+
   /* Reusable lookup state instance. */
   lookup_state_t *lookup_state;
 
@@ -1460,6 +1723,7 @@ get_user_rules(svn_authz_t *authz,
   authz->filtered->user = user ? apr_pstrdup(pool, user) : NULL;
   authz->filtered->lookup_state = create_lookup_state(pool);
   authz->filtered->root = NULL;
+  authz->filtered->decisions = NULL;
 
   svn_authz__get_global_rights(&authz->filtered->global_rights,
                                authz->full, user, repos_name);
@@ -1467,6 +1731,39 @@ get_user_rules(svn_authz_t *authz,
   return authz->filtered;
 }
 
+/* A filtered path rule tree together with the decisions made using it.
+ * This is what gets cached in FILTERED_POOL. */
+typedef struct filtered_tree_t
+{
+  /* Root of the filtered path rule tree. */
+  node_t *root;
+
+  /* Previous lookup results for ROOT. */
+  decision_cache_t *decisions;
+} filtered_tree_t;
+
+/* Return a new filtered_tree_t for AUTHZ, REPOS_NAME and USER, allocated
+ * in RESULT_POOL.  Use SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+create_filtered_tree(filtered_tree_t **tree_p,
+                     authz_full_t *authz,
+                     const char *repos_name,
+                     const char *user,
+                     svn_boolean_t multi_threaded,
+                     apr_pool_t *result_pool,
+                     apr_pool_t *scratch_pool)
+{
+  filtered_tree_t *tree = apr_palloc(result_pool, sizeof(*tree));
+
+  tree->root = create_user_authz(authz, repos_name, user, result_pool,
+                                 scratch_pool);
+  SVN_ERR(create_decision_cache(&tree->decisions, multi_threaded,
+                                result_pool));
+
+  *tree_p = tree;
+  return SVN_NO_ERROR;
+}
+
 /* In AUTHZ's user rules, construct the actual filtered tree.
  * Use SCRATCH_POOL for temporary allocations.
  */
@@ -1477,7 +1774,7 @@ filter_tree(svn_authz_t *authz,
   apr_pool_t *pool = authz->filtered->pool;
   const char *repos_name = authz->filtered->repository;
   const char *user = authz->filtered->user;
-  node_t *root;
+  filtered_tree_t *tree;
 
   if (filtered_pool)
     {
@@ -1486,10 +1783,10 @@ filter_tree(svn_authz_t *authz,
                                                  scratch_pool);
 
       /* Cache lookup. */
-      SVN_ERR(svn_object_pool__lookup((void **)&root, filtered_pool, key,
+      SVN_ERR(svn_object_pool__lookup((void **)&tree, filtered_pool, key,
                                       pool));
 
-      if (!root)
+      if (!tree)
         {
           apr_pool_t *item_pool = svn_object_pool__new_item_pool(authz_pool);
           authz_full_t *add_ref = NULL;
@@ -1507,22 +1804,24 @@ filter_tree(svn_authz_t *authz,
                                                   item_pool));
           SVN_ERR_ASSERT(add_ref == authz->full);
 
-          /* Now construct the new filtered tree and cache it. */
-          root = create_user_authz(authz->full, repos_name, user, item_pool,
-                                   scratch_pool);
-          svn_error_clear(svn_object_pool__insert((void **)&root,
-                                                  filtered_pool, key, root,
+          /* Now construct the new filtered tree and cache it.  Since
+           * it will be shared, its decision cache must be thread-safe. */
+          SVN_ERR(create_filtered_tree(&tree, authz->full, repos_name, user,
+                                       TRUE, item_pool, scratch_pool));
+          svn_error_clear(svn_object_pool__insert((void **)&tree,
+                                                  filtered_pool, key, tree,
                                                   item_pool, pool));
         }
      }
   else
     {
-      root = create_user_authz(authz->full, repos_name, user, pool,
-                               scratch_pool);
+      SVN_ERR(create_filtered_tree(&tree, authz->full, repos_name, user,
+                                   FALSE, pool, scratch_pool));
     }
 
   /* Write a new entry. */
-  authz->filtered->root = root;
+  authz->filtered->root = tree->root;
+  authz->filtered->decisions = tree->decisions;
 
   return SVN_NO_ERROR;
 }
@@ -1675,6 +1974,9 @@ svn_repos_authz_check_access(svn_authz_t *authz, const char *repos_name,
   const authz_access_t required =
     ((required_access & svn_authz_read ? authz_access_read_flag : 0)
      | (required_access & svn_authz_write ? authz_access_write_flag : 0));
+  const svn_boolean_t recursive = !!(required_access & svn_authz_recursive);
+  const char *key;
+  apr_size_t key_len;
 
   /* Pick or create the suitable pre-filtered path rule tree. */
   authz_user_rules_t *rules = get_user_rules(
@@ -1713,6 +2015,19 @@ svn_repos_authz_check_access(svn_authz_t *authz, const char *repos_name,
   if (!rules->root)
     SVN_ERR(filter_tree(authz, pool));
 
+  /* Other lookups, possibly done by other connections of the same user,
+   * may already have decided this one.  The root path is cheap to look up
+   * and not worth caching. */
+  key_len = decision_key(&key, path);
+  if (key_len)
+    {
+      svn_boolean_t found;
+      SVN_ERR(find_decision(&found, access_granted, rules->decisions, key,
+                            key_len, required, recursive));
+      if (found)
+        return SVN_NO_ERROR;
+    }
+
   /* Re-use previous lookup results, if possible. */
   path = init_lockup_state(authz->filtered->lookup_state,
                            authz->filtered->root, path);
@@ -1722,8 +2037,12 @@ svn_repos_authz_check_access(svn_authz_t *authz, const char *repos_name,
 
   /* Determine the granted access for the requested path.
    * PATH does not need to be normalized for lockup(). */
-  *access_granted = lookup(rules->lookup_state, path, required,
-                           !!(required_access & svn_authz_recursive), pool);
+  *access_granted = lookup(rules->lookup_state, path, required, recursive,
+                           pool);
+
+  if (key_len)
+    SVN_ERR(remember_decision(rules->decisions, rules->lookup_state, key,
+                              key_len));
 
   return SVN_NO_ERROR;
 }
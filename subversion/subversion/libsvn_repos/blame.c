@@ -0,0 +1,328 @@
+/* blame.c : calculating line attribution on the server
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include <apr_pools.h>
+#include <apr_tables.h>
+
+#include "svn_pools.h"
+#include "svn_error.h"
+#include "svn_hash.h"
+#include "svn_io.h"
+#include "svn_diff.h"
+#include "svn_delta.h"
+#include "svn_props.h"
+#include "svn_repos.h"
+#include "svn_sorts.h"
+
+#include "svn_private_config.h"
+
+#include "repos.h"
+
+
+
+/* The state of a server-side blame, shared by all revisions. */
+typedef struct file_blame_baton_t
+{
+  /* Changes in revisions older than this are not attributed. */
+  svn_revnum_t start;
+
+  /* How to compare subsequent revisions of the file. */
+  svn_diff_file_options_t *diff_options;
+
+  /* The revision that last changed each line (svn_revnum_t) of
+     LAST_FILENAME. */
+  apr_array_header_t *lines;
+
+  /* The contents of the file in the last revision that changed them. */
+  const char *last_filename;
+
+  /* Revision properties (apr_hash_t *) keyed by svn_revnum_t for all
+     revisions that lines may have been attributed to. */
+  apr_hash_t *rev_props;
+
+  svn_cancel_func_t cancel_func;
+  void *cancel_baton;
+
+  /* Allocate data that lives for the whole operation in MAINPOOL.
+     LASTPOOL holds LINES and LAST_FILENAME and CURRPOOL the data of the
+     revision being processed; the two are swapped after each revision. */
+  apr_pool_t *mainpool;
+  apr_pool_t *lastpool;
+  apr_pool_t *currpool;
+} file_blame_baton_t;
+
+/* The baton for the text delta of a single revision. */
+typedef struct file_blame_delta_baton_t
+{
+  file_blame_baton_t *fbb;
+
+  /* The revision to attribute changed lines to. */
+  svn_revnum_t revision;
+
+  /* The stream of FBB->last_filename the delta is applied to. */
+  svn_stream_t *source_stream;
+
+  /* Where the new contents are written to. */
+  const char *filename;
+
+  svn_txdelta_window_handler_t wrapped_handler;
+  void *wrapped_baton;
+} file_blame_delta_baton_t;
+
+/* Baton for the diff output functions. */
+typedef struct diff_output_baton_t
+{
+  const apr_array_header_t *old_lines;
+  apr_array_header_t *new_lines;
+  svn_revnum_t revision;
+} diff_output_baton_t;
+
+/* Implements svn_diff_output_fns_t.output_common.  Copy the attribution
+   of unchanged lines. */
+static svn_error_t *
+output_common(void *baton,
+              apr_off_t original_start,
+              apr_off_t original_length,
+              apr_off_t modified_start,
+              apr_off_t modified_length,
+              apr_off_t latest_start,
+              apr_off_t latest_length)
+{
+  diff_output_baton_t *ob = baton;
+  apr_off_t i;
+
+  for (i = original_start; i < original_start + original_length; i++)
+    APR_ARRAY_PUSH(ob->new_lines, svn_revnum_t)
+      = APR_ARRAY_IDX(ob->old_lines, i, svn_revnum_t);
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_diff_output_fns_t.output_diff_modified.  Attribute
+   changed lines to the current revision. */
+static svn_error_t *
+output_diff_modified(void *baton,
+                     apr_off_t original_start,
+                     apr_off_t original_length,
+                     apr_off_t modified_start,
+                     apr_off_t modified_length,
+                     apr_off_t latest_start,
+                     apr_off_t latest_length)
+{
+  diff_output_baton_t *ob = baton;
+  apr_off_t i;
+
+  for (i = 0; i < modified_length; i++)
+    APR_ARRAY_PUSH(ob->new_lines, svn_revnum_t) = ob->revision;
+
+  return SVN_NO_ERROR;
+}
+
+static const svn_diff_output_fns_t output_fns = {
+        output_common,
+        output_diff_modified
+};
+
+/* Compare the contents of the new revision described by DB with the
+   previous ones and update the line attribution in DB->fbb. */
+static svn_error_t *
+update_blame(file_blame_delta_baton_t *db)
+{
+  file_blame_baton_t *fbb = db->fbb;
+  diff_output_baton_t ob;
+  svn_diff_t *diff;
+  apr_pool_t *tmp_pool;
+
+  SVN_ERR(svn_stream_close(db->source_stream));
+
+  ob.old_lines = fbb->lines;
+  ob.new_lines = apr_array_make(fbb->currpool, fbb->lines->nelts,
+                                sizeof(svn_revnum_t));
+  ob.revision = db->revision;
+
+  SVN_ERR(svn_diff_file_diff_2(&diff, fbb->last_filename, db->filename,
+                               fbb->diff_options, fbb->currpool));
+  SVN_ERR(svn_diff_output2(diff, &ob, &output_fns,
+                           fbb->cancel_func, fbb->cancel_baton));
+
+  fbb->lines = ob.new_lines;
+  fbb->last_filename = db->filename;
+
+  tmp_pool = fbb->lastpool;
+  fbb->lastpool = fbb->currpool;
+  fbb->currpool = tmp_pool;
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_txdelta_window_handler_t. */
+static svn_error_t *
+window_handler(svn_txdelta_window_t *window, void *baton)
+{
+  file_blame_delta_baton_t *db = baton;
+
+  SVN_ERR(db->wrapped_handler(window, db->wrapped_baton));
+
+  if (window)
+    return SVN_NO_ERROR;
+
+  return svn_error_trace(update_blame(db));
+}
+
+/* Implements svn_file_rev_handler_t. */
+static svn_error_t *
+file_rev_handler(void *baton,
+                 const char *path,
+                 svn_revnum_t revnum,
+                 apr_hash_t *rev_props,
+                 svn_boolean_t result_of_merge,
+                 svn_txdelta_window_handler_t *content_delta_handler,
+                 void **content_delta_baton,
+                 apr_array_header_t *prop_diffs,
+                 apr_pool_t *pool)
+{
+  file_blame_baton_t *fbb = baton;
+  file_blame_delta_baton_t *db;
+  svn_stream_t *cur_stream;
+
+  if (fbb->cancel_func)
+    SVN_ERR(fbb->cancel_func(fbb->cancel_baton));
+
+  /* Revisions that don't change the contents don't change the blame,
+     either. */
+  if (!content_delta_handler)
+    return SVN_NO_ERROR;
+
+  svn_pool_clear(fbb->currpool);
+
+  db = apr_pcalloc(fbb->currpool, sizeof(*db));
+  db->fbb = fbb;
+  if (revnum >= fbb->start)
+    {
+      db->revision = revnum;
+      apr_hash_set(fbb->rev_props,
+                   apr_pmemdup(fbb->mainpool, &revnum, sizeof(revnum)),
+                   sizeof(revnum),
+                   svn_prop_hash_dup(rev_props, fbb->mainpool));
+    }
+  else
+    {
+      /* This is the state of the file before START. */
+      db->revision = SVN_INVALID_REVNUM;
+    }
+
+  SVN_ERR(svn_stream_open_readonly(&db->source_stream, fbb->last_filename,
+                                   fbb->currpool, pool));
+  SVN_ERR(svn_stream_open_unique(&cur_stream, &db->filename, NULL,
+                                 svn_io_file_del_on_pool_cleanup,
+                                 fbb->currpool, pool));
+
+  svn_txdelta_apply(svn_stream_disown(db->source_stream, fbb->currpool),
+                    cur_stream, NULL, NULL, fbb->currpool,
+                    &db->wrapped_handler, &db->wrapped_baton);
+  *content_delta_handler = window_handler;
+  *content_delta_baton = db;
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_repos_get_file_blame(svn_repos_t *repos,
+                         const char *path,
+                         svn_revnum_t start,
+                         svn_revnum_t end,
+                         const apr_array_header_t *diff_options,
+                         svn_repos_authz_func_t authz_read_func,
+                         void *authz_read_baton,
+                         svn_file_blame_receiver_t receiver,
+                         void *receiver_baton,
+                         svn_cancel_func_t cancel_func,
+                         void *cancel_baton,
+                         apr_pool_t *scratch_pool)
+{
+  file_blame_baton_t fbb;
+  apr_file_t *empty_file;
+  apr_pool_t *iterpool;
+  int i, first;
+
+  if (start > end)
+    return svn_error_createf(SVN_ERR_INCORRECT_PARAMS, NULL,
+                             _("Cannot calculate blame information for "
+                               "the reversed revision range %ld:%ld"),
+                             start, end);
+
+  fbb.start = start;
+  fbb.diff_options = svn_diff_file_options_create(scratch_pool);
+  if (diff_options)
+    SVN_ERR(svn_diff_file_options_parse(fbb.diff_options, diff_options,
+                                        scratch_pool));
+  fbb.lines = apr_array_make(scratch_pool, 0, sizeof(svn_revnum_t));
+  fbb.rev_props = apr_hash_make(scratch_pool);
+  fbb.cancel_func = cancel_func;
+  fbb.cancel_baton = cancel_baton;
+  fbb.mainpool = scratch_pool;
+  fbb.lastpool = svn_pool_create(scratch_pool);
+  fbb.currpool = svn_pool_create(scratch_pool);
+
+  /* The first revision is delivered as a delta against the empty file. */
+  SVN_ERR(svn_io_open_unique_file3(&empty_file, &fbb.last_filename, NULL,
+                                   svn_io_file_del_on_pool_cleanup,
+                                   scratch_pool, scratch_pool));
+  SVN_ERR(svn_io_file_close(empty_file, scratch_pool));
+
+  /* Like the client, start one revision early to learn which lines
+     were changed in START itself. */
+  SVN_ERR(svn_repos_get_file_revs2(repos, path, MAX(0, start - 1), end,
+                                   FALSE, authz_read_func, authz_read_baton,
+                                   file_rev_handler, &fbb, scratch_pool));
+
+  /* Report ranges of lines attributed to the same revision. */
+  iterpool = svn_pool_create(scratch_pool);
+  for (first = 0; first < fbb.lines->nelts; first = i)
+    {
+      svn_revnum_t revision = APR_ARRAY_IDX(fbb.lines, first, svn_revnum_t);
+      apr_hash_t *rev_props = NULL;
+
+      svn_pool_clear(iterpool);
+
+      for (i = first + 1; i < fbb.lines->nelts; i++)
+        if (APR_ARRAY_IDX(fbb.lines, i, svn_revnum_t) != revision)
+          break;
+
+      /* Hand out the revision properties only once. */
+      if (SVN_IS_VALID_REVNUM(revision))
+        {
+          rev_props = apr_hash_get(fbb.rev_props, &revision,
+                                   sizeof(revision));
+          apr_hash_set(fbb.rev_props, &revision, sizeof(revision), NULL);
+        }
+
+      SVN_ERR(receiver(receiver_baton, first, i - first, revision,
+                       rev_props, iterpool));
+    }
+
+  svn_pool_destroy(iterpool);
+  svn_pool_destroy(fbb.currpool);
+  svn_pool_destroy(fbb.lastpool);
+
+  return SVN_NO_ERROR;
+}
@@ -40,11 +40,13 @@
 
 #include "private/svn_repos_private.h"
 #include "private/svn_mergeinfo_private.h"
+#include "private/svn_ordered_jobs.h"
 #include "private/svn_fs_private.h"
 #include "private/svn_sorts_private.h"
 #include "private/svn_utf_private.h"
 #include "private/svn_cache.h"
 #include "private/svn_fspath.h"
+#include "private/svn_subr_private.h"
 
 #define ARE_VALID_COPY_ARGS(p,r) ((p) && SVN_IS_VALID_REVNUM(r))
 
@@ -1997,10 +1999,359 @@ dump_filter_authz_func(svn_boolean_t *allowed,
 }
 
 
+/* Helper for svn_repos_dump_fs5.
+
+   Write the node records of revision REV in FS to writable STREAM.
+   START_REV, INCREMENTAL and USE_DELTAS are the parameters of the whole
+   dump; AUTHZ_FUNC and AUTHZ_BATON are passed directly to the repos layer.
+   Set *FOUND_OLD_REFERENCE and *FOUND_OLD_MERGEINFO if the respective
+   warnings have been sent to NOTIFY_FUNC with NOTIFY_BATON.  Use POOL
+   for temporary allocations.
+ */
+static svn_error_t *
+dump_revision_changes(svn_stream_t *stream,
+                      svn_fs_t *fs,
+                      svn_revnum_t rev,
+                      svn_revnum_t start_rev,
+                      svn_boolean_t incremental,
+                      svn_boolean_t use_deltas,
+                      svn_boolean_t *found_old_reference,
+                      svn_boolean_t *found_old_mergeinfo,
+                      svn_repos_notify_func_t notify_func,
+                      void *notify_baton,
+                      svn_repos_authz_func_t authz_func,
+                      void *authz_baton,
+                      apr_pool_t *pool)
+{
+  const svn_delta_editor_t *dump_editor;
+  void *dump_edit_baton = NULL;
+  svn_fs_root_t *to_root;
+  svn_boolean_t use_deltas_for_rev;
+
+  /* Fetch the editor which dumps nodes to a file.  Regardless of
+     what we've been told, don't use deltas for the first rev of a
+     non-incremental dump. */
+  use_deltas_for_rev = use_deltas && (incremental || rev != start_rev);
+  SVN_ERR(get_dump_editor(&dump_editor, &dump_edit_baton, fs, rev,
+                          "", stream, found_old_reference,
+                          found_old_mergeinfo, NULL,
+                          notify_func, notify_baton,
+                          start_rev, use_deltas_for_rev, FALSE, FALSE,
+                          pool));
+
+  /* Drive the editor in one way or another. */
+  SVN_ERR(svn_fs_revision_root(&to_root, fs, rev, pool));
+
+  /* If this is the first revision of a non-incremental dump,
+     we're in for a full tree dump.  Otherwise, we want to simply
+     replay the revision.  */
+  if ((rev == start_rev) && (! incremental))
+    {
+      /* Compare against revision 0, so everything appears to be added. */
+      svn_fs_root_t *from_root;
+      SVN_ERR(svn_fs_revision_root(&from_root, fs, 0, pool));
+      SVN_ERR(svn_repos_dir_delta2(from_root, "", "",
+                                   to_root, "",
+                                   dump_editor, dump_edit_baton,
+                                   authz_func, authz_baton,
+                                   FALSE, /* don't send text-deltas */
+                                   svn_depth_infinity,
+                                   FALSE, /* don't send entry props */
+                                   FALSE, /* don't ignore ancestry */
+                                   pool));
+    }
+  else
+    {
+      /* The normal case: compare consecutive revs. */
+      SVN_ERR(svn_repos_replay2(to_root, "", SVN_INVALID_REVNUM, FALSE,
+                                dump_editor, dump_edit_baton,
+                                authz_func, authz_baton, pool));
+
+      /* While our editor close_edit implementation is a no-op, we still
+         do this for completeness. */
+      SVN_ERR(dump_editor->close_edit(dump_edit_baton, pool));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+#if APR_HAS_THREADS
+
+/* Concurrent dumping and verification.
+ *
+ * A fixed number of worker threads, each with its own FS instance, claim
+ * revisions in ascending order using svn_ordered_jobs__start().  They
+ * buffer the outcome of each revision, including all notifications sent
+ * while processing it.  The main thread consumes the results in revision
+ * order and forwards them to the caller exactly like the sequential code
+ * would.
+ */
+
+/* The FS that every worker opens an instance of.  This is the first
+   member of the batons passed to open_job_fs(). */
+typedef struct job_fs_t
+{
+  const char *path;
+  apr_hash_t *config;
+} job_fs_t;
+
+/* Implement svn_ordered_jobs__init_func_t by opening the FS described by
+   the job_fs_t at the start of BATON. */
+static svn_error_t *
+open_job_fs(void **worker_baton,
+            void *baton,
+            apr_pool_t *worker_pool,
+            apr_pool_t *scratch_pool)
+{
+  job_fs_t *job_fs = baton;
+  svn_fs_t *fs;
+
+  SVN_ERR(svn_fs_open2(&fs, job_fs->path, job_fs->config, worker_pool,
+                       scratch_pool));
+  *worker_baton = fs;
+
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_repos_notify_func_t by appending a copy of NOTIFY to the
+   array of svn_repos_notify_t * given as BATON, allocated in the array's
+   pool. */
+static void
+buffer_notify(void *baton,
+              const svn_repos_notify_t *notify,
+              apr_pool_t *scratch_pool)
+{
+  apr_array_header_t *notifications = baton;
+  svn_repos_notify_t *copy = apr_pmemdup(notifications->pool, notify,
+                                         sizeof(*notify));
+
+  copy->warning_str = apr_pstrdup(notifications->pool, notify->warning_str);
+  copy->path = apr_pstrdup(notifications->pool, notify->path);
+
+  APR_ARRAY_PUSH(notifications, svn_repos_notify_t *) = copy;
+}
+
+/* Send the NOTIFICATIONS buffered by buffer_notify() to NOTIFY_FUNC with
+   NOTIFY_BATON.  Use SCRATCH_POOL for temporary allocations. */
+static void
+forward_notifications(const apr_array_header_t *notifications,
+                      svn_repos_notify_func_t notify_func,
+                      void *notify_baton,
+                      apr_pool_t *scratch_pool)
+{
+  int i;
+
+  for (i = 0; i < notifications->nelts; ++i)
+    notify_func(notify_baton,
+                APR_ARRAY_IDX(notifications, i, svn_repos_notify_t *),
+                scratch_pool);
+}
+
+/* Workers will not run more than DUMP_WINDOW_FACTOR * JOBS revisions
+ * ahead of the main thread and will keep at most DUMP_SPILL_MEMORY bytes
+ * of node records per revision in memory.
+ */
+#define DUMP_WINDOW_FACTOR 4
+#define DUMP_SPILL_BLOCKSIZE SVN__STREAM_CHUNK_SIZE
+#define DUMP_SPILL_MEMORY (1024 * 1024)
+
+/* Buffered outcome of dumping a single revision's changes. */
+typedef struct dump_rev_result_t
+{
+  /* The node records of this revision. */
+  svn_spillbuf_t *records;
+
+  /* Notifications sent while dumping (svn_repos_notify_t *). */
+  apr_array_header_t *notifications;
+
+  /* Whether the respective warnings have been found in this revision. */
+  svn_boolean_t found_old_reference;
+  svn_boolean_t found_old_mergeinfo;
+} dump_rev_result_t;
+
+/* Parameters to dump_revision_changes() common to all revisions. */
+typedef struct dump_jobs_t
+{
+  /* Must be the first member, see open_job_fs(). */
+  job_fs_t fs;
+
+  svn_revnum_t start_rev;
+  svn_boolean_t incremental;
+  svn_boolean_t use_deltas;
+  svn_repos_authz_func_t authz_func;
+  void *authz_baton;
+
+  /* Whether notifications need to be collected at all. */
+  svn_boolean_t notify;
+} dump_jobs_t;
+
+/* Implement svn_ordered_jobs__run_func_t by writing the node records of
+   revision REV as described by the dump_jobs_t BATON to a new
+   dump_rev_result_t, using the FS instance WORKER_BATON. */
+static svn_error_t *
+dump_job_run(void **result_p,
+             void *baton,
+             void *worker_baton,
+             apr_int64_t rev,
+             svn_cancel_func_t cancel_func,
+             void *cancel_baton,
+             apr_pool_t *result_pool,
+             apr_pool_t *scratch_pool)
+{
+  dump_jobs_t *jobs = baton;
+  dump_rev_result_t *result = apr_pcalloc(result_pool, sizeof(*result));
+
+  result->records = svn_spillbuf__create(DUMP_SPILL_BLOCKSIZE,
+                                         DUMP_SPILL_MEMORY, result_pool);
+  result->notifications = apr_array_make(result_pool, 1,
+                                         sizeof(svn_repos_notify_t *));
+  *result_p = result;
+
+  /* Revision 0 never has any changes. */
+  if (rev == 0)
+    return SVN_NO_ERROR;
+
+  return svn_error_trace(dump_revision_changes(
+                svn_stream__from_spillbuf(result->records, scratch_pool),
+                worker_baton, (svn_revnum_t)rev, jobs->start_rev,
+                jobs->incremental, jobs->use_deltas,
+                &result->found_old_reference, &result->found_old_mergeinfo,
+                jobs->notify ? buffer_notify : NULL, result->notifications,
+                jobs->authz_func, jobs->authz_baton, scratch_pool));
+}
+
+/* Copy the contents of RECORDS to STREAM.  Use SCRATCH_POOL for
+   temporary allocations. */
+static svn_error_t *
+write_buffered_records(svn_stream_t *stream,
+                       svn_spillbuf_t *records,
+                       apr_pool_t *scratch_pool)
+{
+  while (TRUE)
+    {
+      const char *data;
+      apr_size_t len;
+
+      SVN_ERR(svn_spillbuf__read(&data, &len, records, scratch_pool));
+      if (data == NULL)
+        break;
+
+      SVN_ERR(svn_stream_write(stream, data, &len));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Dump revisions START_REV to END_REV of REPOS to STREAM using JOBS
+ * worker threads.  The main thread writes the revision records and copies
+ * the buffered node records to STREAM, so the output is the same as that
+ * of the sequential code.  Set *FOUND_OLD_REFERENCE and
+ * *FOUND_OLD_MERGEINFO if the respective warnings have been sent to
+ * NOTIFY_FUNC.  The other parameters are the same as for
+ * svn_repos_dump_fs5.
+ */
+static svn_error_t *
+dump_revisions_concurrently(svn_repos_t *repos,
+                            svn_stream_t *stream,
+                            svn_revnum_t start_rev,
+                            svn_revnum_t end_rev,
+                            svn_boolean_t incremental,
+                            svn_boolean_t use_deltas,
+                            svn_boolean_t include_revprops,
+                            int jobs,
+                            svn_boolean_t *found_old_reference,
+                            svn_boolean_t *found_old_mergeinfo,
+                            svn_repos_notify_func_t notify_func,
+                            void *notify_baton,
+                            svn_repos_authz_func_t authz_func,
+                            void *authz_baton,
+                            svn_cancel_func_t cancel_func,
+                            void *cancel_baton,
+                            apr_pool_t *pool)
+{
+  svn_fs_t *fs = svn_repos_fs(repos);
+  dump_jobs_t *shared = apr_pcalloc(pool, sizeof(*shared));
+  svn_ordered_jobs__t *workers;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_repos_notify_t *notify = NULL;
+  svn_error_t *err = SVN_NO_ERROR;
+  svn_revnum_t rev;
+
+  if (notify_func)
+    notify = svn_repos_notify_create(svn_repos_notify_dump_rev_end, pool);
+
+  shared->fs.path = svn_fs_path(fs, pool);
+  shared->fs.config = svn_fs_config(fs, pool);
+  shared->start_rev = start_rev;
+  shared->incremental = incremental;
+  shared->use_deltas = use_deltas;
+  shared->authz_func = authz_func;
+  shared->authz_baton = authz_baton;
+  shared->notify = notify_func != NULL;
+
+  SVN_ERR(svn_ordered_jobs__start(&workers, start_rev, end_rev + 1, jobs,
+                                  DUMP_WINDOW_FACTOR * jobs,
+                                  open_job_fs, dump_job_run, shared,
+                                  pool, iterpool));
+
+  /* Consume the results in revision order. */
+  for (rev = start_rev; rev <= end_rev && !err; rev++)
+    {
+      dump_rev_result_t *result;
+      void *data;
+
+      svn_pool_clear(iterpool);
+
+      /* Check for cancellation. */
+      if (cancel_func)
+        {
+          err = cancel_func(cancel_baton);
+          if (err)
+            break;
+        }
+
+      /* Write the revision record while the workers are busy. */
+      err = write_revision_record(stream, repos, rev, include_revprops,
+                                  authz_func, authz_baton, iterpool);
+      if (err)
+        break;
+
+      err = svn_ordered_jobs__next(&data, workers);
+      result = data;
+
+      /* Forward everything as if the revision had been dumped here. */
+      if (notify_func && result)
+        forward_notifications(result->notifications, notify_func,
+                              notify_baton, iterpool);
+
+      if (!err)
+        err = write_buffered_records(stream, result->records, iterpool);
+
+      if (result && result->found_old_reference)
+        *found_old_reference = TRUE;
+      if (result && result->found_old_mergeinfo)
+        *found_old_mergeinfo = TRUE;
+
+      if (!err && notify_func)
+        {
+          notify->revision = rev;
+          notify_func(notify_baton, notify, iterpool);
+        }
+
+      svn_ordered_jobs__release(workers);
+    }
+
+  svn_ordered_jobs__stop(workers);
+  svn_pool_destroy(iterpool);
+
+  return svn_error_trace(err);
+}
+
+#endif
 
 /* The main dumper. */
 svn_error_t *
-svn_repos_dump_fs4(svn_repos_t *repos,
+svn_repos_dump_fs5(svn_repos_t *repos,
                    svn_stream_t *stream,
                    svn_revnum_t start_rev,
                    svn_revnum_t end_rev,
@@ -2008,6 +2359,7 @@ svn_repos_dump_fs4(svn_repos_t *repos,
                    svn_boolean_t use_deltas,
                    svn_boolean_t include_revprops,
                    svn_boolean_t include_changes,
+                   int jobs,
                    svn_repos_notify_func_t notify_func,
                    void *notify_baton,
                    svn_repos_dump_filter_func_t filter_func,
@@ -2016,8 +2368,6 @@ svn_repos_dump_fs4(svn_repos_t *repos,
                    void *cancel_baton,
                    apr_pool_t *pool)
 {
-  const svn_delta_editor_t *dump_editor;
-  void *dump_edit_baton = NULL;
   svn_revnum_t rev;
   svn_fs_t *fs = svn_repos_fs(repos);
   apr_pool_t *iterpool = svn_pool_create(pool);
@@ -2093,12 +2443,23 @@ svn_repos_dump_fs4(svn_repos_t *repos,
     notify = svn_repos_notify_create(svn_repos_notify_dump_rev_end,
                                      pool);
 
+#if APR_HAS_THREADS
+  /* Only the node records are worth being produced concurrently. */
+  if (jobs > 1 && include_changes && start_rev < end_rev)
+    SVN_ERR(dump_revisions_concurrently(repos, stream, start_rev, end_rev,
+                                        incremental, use_deltas,
+                                        include_revprops, jobs,
+                                        &found_old_reference,
+                                        &found_old_mergeinfo,
+                                        notify_func, notify_baton,
+                                        authz_func, &authz_baton,
+                                        cancel_func, cancel_baton,
+                                        pool));
+  else
+#endif
   /* Main loop:  we're going to dump revision REV.  */
   for (rev = start_rev; rev <= end_rev; rev++)
     {
-      svn_fs_root_t *to_root;
-      svn_boolean_t use_deltas_for_rev;
-
       svn_pool_clear(iterpool);
 
       /* Check for cancellation. */
@@ -2115,50 +2476,12 @@ svn_repos_dump_fs4(svn_repos_t *repos,
       if (rev == 0 || !include_changes)
         goto loop_end;
 
-      /* Fetch the editor which dumps nodes to a file.  Regardless of
-         what we've been told, don't use deltas for the first rev of a
-         non-incremental dump. */
-      use_deltas_for_rev = use_deltas && (incremental || rev != start_rev);
-      SVN_ERR(get_dump_editor(&dump_editor, &dump_edit_baton, fs, rev,
-                              "", stream, &found_old_reference,
-                              &found_old_mergeinfo, NULL,
-                              notify_func, notify_baton,
-                              start_rev, use_deltas_for_rev, FALSE, FALSE,
-                              iterpool));
-
-      /* Drive the editor in one way or another. */
-      SVN_ERR(svn_fs_revision_root(&to_root, fs, rev, iterpool));
-
-      /* If this is the first revision of a non-incremental dump,
-         we're in for a full tree dump.  Otherwise, we want to simply
-         replay the revision.  */
-      if ((rev == start_rev) && (! incremental))
-        {
-          /* Compare against revision 0, so everything appears to be added. */
-          svn_fs_root_t *from_root;
-          SVN_ERR(svn_fs_revision_root(&from_root, fs, 0, iterpool));
-          SVN_ERR(svn_repos_dir_delta2(from_root, "", "",
-                                       to_root, "",
-                                       dump_editor, dump_edit_baton,
-                                       authz_func, &authz_baton,
-                                       FALSE, /* don't send text-deltas */
-                                       svn_depth_infinity,
-                                       FALSE, /* don't send entry props */
-                                       FALSE, /* don't ignore ancestry */
-                                       iterpool));
-        }
-      else
-        {
-          /* The normal case: compare consecutive revs. */
-          SVN_ERR(svn_repos_replay2(to_root, "", SVN_INVALID_REVNUM, FALSE,
-                                    dump_editor, dump_edit_baton,
+      SVN_ERR(dump_revision_changes(stream, fs, rev, start_rev, incremental,
+                                    use_deltas, &found_old_reference,
+                                    &found_old_mergeinfo,
+                                    notify_func, notify_baton,
                                     authz_func, &authz_baton, iterpool));
 
-          /* While our editor close_edit implementation is a no-op, we still
-             do this for completeness. */
-          SVN_ERR(dump_editor->close_edit(dump_edit_baton, iterpool));
-        }
-
     loop_end:
       if (notify_func)
         {
@@ -2439,12 +2762,157 @@ report_error(svn_revnum_t revision,
     }
 }
 
+#if APR_HAS_THREADS
+
+/* Concurrent revision verification.
+ *
+ * This works like concurrent dumping (see dump_revisions_concurrently),
+ * except that all there is to buffer for a revision are the
+ * notifications sent and the error returned while verifying it.  To limit
+ * the amount of buffered data, workers will not run more than
+ * VERIFY_WINDOW_FACTOR * JOBS revisions ahead of the main thread.
+ */
+#define VERIFY_WINDOW_FACTOR 4
+
+/* Parameters to verify_one_revision() common to all revisions. */
+typedef struct verify_jobs_t
+{
+  /* Must be the first member, see open_job_fs(). */
+  job_fs_t fs;
+
+  svn_revnum_t start_rev;
+  svn_boolean_t check_normalization;
+
+  /* Whether notifications need to be collected at all. */
+  svn_boolean_t notify;
+} verify_jobs_t;
+
+/* Implement svn_ordered_jobs__run_func_t by verifying revision REV as
+   described by the verify_jobs_t BATON, using the FS instance
+   WORKER_BATON.  Return the notifications sent in a new array of
+   svn_repos_notify_t * in *RESULT_P. */
+static svn_error_t *
+verify_job_run(void **result_p,
+               void *baton,
+               void *worker_baton,
+               apr_int64_t rev,
+               svn_cancel_func_t cancel_func,
+               void *cancel_baton,
+               apr_pool_t *result_pool,
+               apr_pool_t *scratch_pool)
+{
+  verify_jobs_t *jobs = baton;
+  apr_array_header_t *notifications
+    = apr_array_make(result_pool, 1, sizeof(svn_repos_notify_t *));
+
+  *result_p = notifications;
+  return svn_error_trace(verify_one_revision(worker_baton,
+                                             (svn_revnum_t)rev,
+                                             jobs->notify ? buffer_notify
+                                                          : NULL,
+                                             notifications,
+                                             jobs->start_rev,
+                                             jobs->check_normalization,
+                                             cancel_func, cancel_baton,
+                                             scratch_pool));
+}
+
+/* Verify revisions START_REV to END_REV in FS using JOBS worker threads.
+ * The other parameters are the same as for svn_repos_verify_fs4.
+ */
+static svn_error_t *
+verify_revisions_concurrently(svn_fs_t *fs,
+                              svn_revnum_t start_rev,
+                              svn_revnum_t end_rev,
+                              svn_boolean_t check_normalization,
+                              int jobs,
+                              svn_repos_notify_func_t notify_func,
+                              void *notify_baton,
+                              svn_repos_verify_callback_t verify_callback,
+                              void *verify_baton,
+                              svn_cancel_func_t cancel_func,
+                              void *cancel_baton,
+                              apr_pool_t *pool)
+{
+  verify_jobs_t *shared = apr_pcalloc(pool, sizeof(*shared));
+  svn_ordered_jobs__t *workers;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_repos_notify_t *notify = NULL;
+  svn_error_t *err = SVN_NO_ERROR;
+  svn_revnum_t rev;
+
+  if (notify_func)
+    notify = svn_repos_notify_create(svn_repos_notify_verify_rev_end, pool);
+
+  shared->fs.path = svn_fs_path(fs, pool);
+  shared->fs.config = svn_fs_config(fs, pool);
+  shared->start_rev = start_rev;
+  shared->check_normalization = check_normalization;
+  shared->notify = notify_func != NULL;
+
+  SVN_ERR(svn_ordered_jobs__start(&workers, start_rev, end_rev + 1, jobs,
+                                  VERIFY_WINDOW_FACTOR * jobs,
+                                  open_job_fs, verify_job_run, shared,
+                                  pool, iterpool));
+
+  /* Consume the results in revision order. */
+  for (rev = start_rev; rev <= end_rev && !err; rev++)
+    {
+      apr_array_header_t *notifications;
+      svn_error_t *verify_err;
+      void *data;
+
+      svn_pool_clear(iterpool);
+
+      if (cancel_func)
+        {
+          err = cancel_func(cancel_baton);
+          if (err)
+            break;
+        }
+
+      verify_err = svn_ordered_jobs__next(&data, workers);
+      notifications = data;
+
+      /* Forward everything as if the revision had been verified here. */
+      if (notify_func && notifications)
+        forward_notifications(notifications, notify_func, notify_baton,
+                              iterpool);
+
+      if (verify_err && verify_err->apr_err == SVN_ERR_CANCELLED)
+        {
+          err = verify_err;
+        }
+      else if (verify_err)
+        {
+          err = report_error(rev, verify_err, verify_callback, verify_baton,
+                             iterpool);
+        }
+      else if (notify_func)
+        {
+          /* Tell the caller that we're done with this revision. */
+          notify->revision = rev;
+          notify_func(notify_baton, notify, iterpool);
+        }
+
+      svn_ordered_jobs__release(workers);
+    }
+
+  svn_ordered_jobs__stop(workers);
+  svn_pool_destroy(iterpool);
+
+  return svn_error_trace(err);
+}
+
+#endif
+
 svn_error_t *
-svn_repos_verify_fs3(svn_repos_t *repos,
+svn_repos_verify_fs4(svn_repos_t *repos,
                      svn_revnum_t start_rev,
                      svn_revnum_t end_rev,
                      svn_boolean_t check_normalization,
                      svn_boolean_t metadata_only,
+                     int jobs,
                      svn_repos_notify_func_t notify_func,
                      void *notify_baton,
                      svn_repos_verify_callback_t verify_callback,
@@ -2460,6 +2928,7 @@ svn_repos_verify_fs3(svn_repos_t *repos,
   svn_repos_notify_t *notify;
   svn_fs_progress_notify_func_t verify_notify = NULL;
   struct verify_fs_notify_func_baton_t *verify_notify_baton = NULL;
+  apr_hash_t *fs_config = svn_fs_config(fs, pool);
   svn_error_t *err;
 
   /* Make sure we catch up on the latest revprop changes.  This is the only
@@ -2501,8 +2970,20 @@ svn_repos_verify_fs3(svn_repos_t *repos,
         = svn_repos_notify_create(svn_repos_notify_verify_rev_structure, pool);
     }
 
+#if APR_HAS_THREADS
+  /* Let the backend use the same number of threads unless told otherwise. */
+  if (   jobs > 1
+      && !(fs_config && svn_hash_gets(fs_config, SVN_FS_CONFIG_FSFS_JOBS)))
+    {
+      fs_config = fs_config ? apr_hash_copy(pool, fs_config)
+                            : apr_hash_make(pool);
+      svn_hash_sets(fs_config, SVN_FS_CONFIG_FSFS_JOBS,
+                    apr_itoa(pool, jobs));
+    }
+#endif
+
   /* Verify global metadata and backend-specific data first. */
-  err = svn_fs_verify(svn_fs_path(fs, pool), svn_fs_config(fs, pool),
+  err = svn_fs_verify(svn_fs_path(fs, pool), fs_config,
                       start_rev, end_rev,
                       verify_notify, verify_notify_baton,
                       cancel_func, cancel_baton, pool);
@@ -2517,6 +2998,16 @@ svn_repos_verify_fs3(svn_repos_t *repos,
                            verify_baton, iterpool));
     }
 
+#if APR_HAS_THREADS
+  if (!metadata_only && jobs > 1 && start_rev < end_rev)
+    SVN_ERR(verify_revisions_concurrently(fs, start_rev, end_rev,
+                                          check_normalization, jobs,
+                                          notify_func, notify_baton,
+                                          verify_callback, verify_baton,
+                                          cancel_func, cancel_baton,
+                                          pool));
+  else
+#endif
   if (!metadata_only)
     for (rev = start_rev; rev <= end_rev; rev++)
       {
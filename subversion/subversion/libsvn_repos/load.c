@@ -22,6 +22,9 @@
 
 
 #include <apr.h>
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
 
 #include "svn_hash.h"
 #include "svn_pools.h"
@@ -32,7 +35,9 @@
 #include "svn_private_config.h"
 #include "svn_ctype.h"
 
+#include "private/svn_atomic.h"
 #include "private/svn_dep_compat.h"
+#include "private/svn_subr_private.h"
 
 /*----------------------------------------------------------------------*/
 
@@ -798,3 +803,722 @@ svn_repos_parse_dumpstream3(svn_stream_t *stream,
   svn_pool_destroy(nodepool);
   return SVN_NO_ERROR;
 }
+
+
+#if APR_HAS_THREADS
+
+/* Concurrent parsing.
+ *
+ * A reader thread runs svn_repos_parse_dumpstream3() on the dump stream
+ * with a vtable that merely records the callback invocations.  Headers
+ * and property values get copied and the contents of all text blocks go
+ * unchanged into a spill buffer.  The events of each revision form a
+ * batch that is handed over to the calling thread once the revision has
+ * been closed.  The calling thread replays the events of each batch
+ * against the caller's vtable, i.e. reading and parsing revision N+1
+ * overlaps with applying and committing revision N.  The reader will not
+ * get more than READ_AHEAD batches ahead of the calling thread and keeps
+ * at most PARSE_SPILL_MEMORY bytes of text per batch in memory.
+ */
+#define PARSE_SPILL_BLOCKSIZE SVN__STREAM_CHUNK_SIZE
+#define PARSE_SPILL_MEMORY (4 * 1024 * 1024)
+
+/* Kinds of recorded parser callback invocations. */
+typedef enum parse_event_kind_t
+{
+  parse_event_magic_header,
+  parse_event_uuid,
+  parse_event_new_revision,
+  parse_event_new_node,
+  parse_event_set_revision_property,
+  parse_event_set_node_property,
+  parse_event_delete_node_property,
+  parse_event_remove_node_props,
+  parse_event_text,
+  parse_event_close_node,
+  parse_event_close_revision
+} parse_event_kind_t;
+
+/* A recorded parser callback invocation. */
+typedef struct parse_event_t
+{
+  parse_event_kind_t kind;
+
+  /* Dumpfile format version of a magic header record. */
+  int version;
+
+  /* UUID or property name. */
+  const char *name;
+
+  /* Property value. */
+  const svn_string_t *value;
+
+  /* Headers of a new revision or node record. */
+  apr_hash_t *headers;
+
+  /* Whether a text block belongs to a node rather than to a revision
+     record, whether it contains svndiff data, and its length within
+     the batch's spill buffer. */
+  svn_boolean_t is_node;
+  svn_boolean_t is_delta;
+  svn_filesize_t text_len;
+} parse_event_t;
+
+/* The events recorded for one revision. */
+typedef struct parse_batch_t
+{
+  /* Thread-safe root pool for everything below.  Owned by the reader
+     until the batch has been queued and by the calling thread after. */
+  apr_pool_t *pool;
+
+  /* The recorded events (parse_event_t *). */
+  apr_array_header_t *events;
+
+  /* Contents of all text blocks of EVENTS, in that order. */
+  svn_spillbuf_reader_t *texts;
+
+  /* Set if this is the final batch of the stream. */
+  svn_boolean_t last;
+
+  /* Error that ended parsing after EVENTS.  Only set for the last
+     batch. */
+  svn_error_t *err;
+
+  /* Next batch in the queue. */
+  struct parse_batch_t *next;
+} parse_batch_t;
+
+struct parse_queue_t;
+
+/* Record baton given to the parser by the reader. */
+typedef struct parse_record_baton_t
+{
+  struct parse_queue_t *queue;
+  svn_boolean_t is_node;
+} parse_record_baton_t;
+
+/* State shared between the calling thread and the reader. */
+typedef struct parse_queue_t
+{
+  /* Serializes access to all members that are not marked as constant
+     or as being private to the reader. */
+  apr_thread_mutex_t *mutex;
+
+  /* Signaled whenever a batch has been queued or taken. */
+  apr_thread_cond_t *changed;
+
+  /* Set by the calling thread if the reader shall stop as soon as
+     possible.  May be read without holding MUTEX. */
+  volatile svn_atomic_t aborted;
+
+  /* Queued batches, oldest first. */
+  parse_batch_t *first;
+  parse_batch_t *last;
+  int count;
+
+  /* Maximum number of queued batches.  Constant. */
+  int read_ahead;
+
+  /* Parser parameters.  Constant. */
+  svn_stream_t *stream;
+  svn_boolean_t deltas_are_text;
+  const svn_repos_parse_fns3_t *recorder;
+
+  /* Record batons handed out by the recorder.  Constant. */
+  parse_record_baton_t revision_record;
+  parse_record_baton_t node_record;
+
+  /* The batch being recorded and the headers of the record being
+     parsed.  Private to the reader. */
+  parse_batch_t *current;
+  apr_hash_t *record_headers;
+
+  /* Thread-safe root pool of the reader. */
+  apr_pool_t *pool;
+} parse_queue_t;
+
+/* Baton for write_handler_batch_text(). */
+typedef struct batch_text_baton_t
+{
+  parse_batch_t *batch;
+  parse_event_t *event;
+} batch_text_baton_t;
+
+/* Start a new batch for the reader of QUEUE. */
+static void
+start_batch(parse_queue_t *queue)
+{
+  apr_pool_t *pool = svn_pool_create(NULL);
+  parse_batch_t *batch = apr_pcalloc(pool, sizeof(*batch));
+
+  batch->pool = pool;
+  batch->events = apr_array_make(pool, 16, sizeof(parse_event_t *));
+  batch->texts = svn_spillbuf__reader_create(PARSE_SPILL_BLOCKSIZE,
+                                             PARSE_SPILL_MEMORY, pool);
+  queue->current = batch;
+}
+
+/* Hand the current batch of QUEUE over to the calling thread, waiting
+   for room in the queue unless it is the last batch. */
+static svn_error_t *
+queue_batch(parse_queue_t *queue)
+{
+  parse_batch_t *batch = queue->current;
+
+  queue->current = NULL;
+
+  apr_thread_mutex_lock(queue->mutex);
+  while (   !svn_atomic_read(&queue->aborted)
+         && !batch->last
+         && queue->count >= queue->read_ahead)
+    apr_thread_cond_wait(queue->changed, queue->mutex);
+
+  if (svn_atomic_read(&queue->aborted))
+    {
+      apr_thread_mutex_unlock(queue->mutex);
+      svn_error_clear(batch->err);
+      svn_pool_destroy(batch->pool);
+
+      return svn_error_create(SVN_ERR_CANCELLED, NULL, NULL);
+    }
+
+  if (queue->last)
+    queue->last->next = batch;
+  else
+    queue->first = batch;
+  queue->last = batch;
+  queue->count++;
+
+  apr_thread_cond_broadcast(queue->changed);
+  apr_thread_mutex_unlock(queue->mutex);
+
+  return SVN_NO_ERROR;
+}
+
+/* Append a new event of KIND to the current batch of QUEUE and return
+   it. */
+static parse_event_t *
+record_event(parse_queue_t *queue,
+             parse_event_kind_t kind)
+{
+  parse_event_t *event = apr_pcalloc(queue->current->pool, sizeof(*event));
+
+  event->kind = kind;
+  APR_ARRAY_PUSH(queue->current->events, parse_event_t *) = event;
+
+  return event;
+}
+
+/* Return a copy of the dumpfile HEADERS allocated in RESULT_POOL. */
+static apr_hash_t *
+copy_headers(apr_hash_t *headers,
+             apr_pool_t *result_pool)
+{
+  apr_hash_t *copy = apr_hash_make(result_pool);
+  apr_hash_index_t *hi;
+
+  for (hi = apr_hash_first(result_pool, headers); hi; hi = apr_hash_next(hi))
+    svn_hash_sets(copy,
+                  apr_pstrdup(result_pool, apr_hash_this_key(hi)),
+                  apr_pstrdup(result_pool, apr_hash_this_val(hi)));
+
+  return copy;
+}
+
+/* Implement svn_write_fn_t by appending DATA to the texts of the batch
+   in the batch_text_baton_t BATON. */
+static svn_error_t *
+write_handler_batch_text(void *baton,
+                         const char *data,
+                         apr_size_t *len)
+{
+  batch_text_baton_t *btb = baton;
+
+  SVN_ERR(svn_spillbuf__reader_write(btb->batch->texts, data, *len,
+                                     btb->batch->pool));
+  btb->event->text_len += *len;
+
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_read_fn_t by reading from the texts of the
+   parse_batch_t BATON. */
+static svn_error_t *
+read_handler_batch_text(void *baton,
+                        char *buffer,
+                        apr_size_t *len)
+{
+  parse_batch_t *batch = baton;
+
+  return svn_error_trace(svn_spillbuf__reader_read(len, batch->texts,
+                                                   buffer, *len,
+                                                   batch->pool));
+}
+
+/* The recording vtable.  PARSE_BATON is the parse_queue_t, record batons
+   are parse_record_baton_t. */
+
+static svn_error_t *
+record_magic_header_record(int version,
+                           void *parse_baton,
+                           apr_pool_t *pool)
+{
+  parse_queue_t *queue = parse_baton;
+
+  record_event(queue, parse_event_magic_header)->version = version;
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_uuid_record(const char *uuid,
+                   void *parse_baton,
+                   apr_pool_t *pool)
+{
+  parse_queue_t *queue = parse_baton;
+
+  record_event(queue, parse_event_uuid)->name
+    = apr_pstrdup(queue->current->pool, uuid);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_new_revision_record(void **revision_baton,
+                           apr_hash_t *headers,
+                           void *parse_baton,
+                           apr_pool_t *pool)
+{
+  parse_queue_t *queue = parse_baton;
+
+  record_event(queue, parse_event_new_revision)->headers
+    = copy_headers(headers, queue->current->pool);
+  queue->record_headers = headers;
+  *revision_baton = &queue->revision_record;
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_new_node_record(void **node_baton,
+                       apr_hash_t *headers,
+                       void *revision_baton,
+                       apr_pool_t *pool)
+{
+  parse_record_baton_t *rb = revision_baton;
+  parse_queue_t *queue = rb->queue;
+
+  record_event(queue, parse_event_new_node)->headers
+    = copy_headers(headers, queue->current->pool);
+  queue->record_headers = headers;
+  *node_baton = &queue->node_record;
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_set_revision_property(void *baton,
+                             const char *name,
+                             const svn_string_t *value)
+{
+  parse_record_baton_t *rb = baton;
+  parse_queue_t *queue = rb->queue;
+  parse_event_t *event;
+
+  event = record_event(queue, parse_event_set_revision_property);
+  event->name = apr_pstrdup(queue->current->pool, name);
+  event->value = svn_string_dup(value, queue->current->pool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_set_node_property(void *baton,
+                         const char *name,
+                         const svn_string_t *value)
+{
+  parse_record_baton_t *rb = baton;
+  parse_queue_t *queue = rb->queue;
+  parse_event_t *event;
+
+  event = record_event(queue, parse_event_set_node_property);
+  event->name = apr_pstrdup(queue->current->pool, name);
+  event->value = svn_string_dup(value, queue->current->pool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_delete_node_property(void *baton,
+                            const char *name)
+{
+  parse_record_baton_t *rb = baton;
+  parse_queue_t *queue = rb->queue;
+
+  record_event(queue, parse_event_delete_node_property)->name
+    = apr_pstrdup(queue->current->pool, name);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_remove_node_props(void *baton)
+{
+  parse_record_baton_t *rb = baton;
+
+  record_event(rb->queue, parse_event_remove_node_props);
+
+  return SVN_NO_ERROR;
+}
+
+/* The reader parses with DELTAS_ARE_TEXT set, so this receives svndiff
+   data as well.  Decide whether it is one the same way the parser does. */
+static svn_error_t *
+record_set_fulltext(svn_stream_t **stream,
+                    void *record_baton)
+{
+  parse_record_baton_t *rb = record_baton;
+  parse_queue_t *queue = rb->queue;
+  parse_batch_t *batch = queue->current;
+  batch_text_baton_t *btb = apr_palloc(batch->pool, sizeof(*btb));
+  const char *delta = svn_hash_gets(queue->record_headers,
+                                    SVN_REPOS_DUMPFILE_TEXT_DELTA);
+
+  btb->batch = batch;
+  btb->event = record_event(queue, parse_event_text);
+  btb->event->is_node = rb->is_node;
+  btb->event->is_delta = !queue->deltas_are_text
+                         && delta && strcmp(delta, "true") == 0;
+
+  *stream = svn_stream_create(btb, batch->pool);
+  svn_stream_set_write(*stream, write_handler_batch_text);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+record_close_node(void *baton)
+{
+  parse_record_baton_t *rb = baton;
+
+  record_event(rb->queue, parse_event_close_node);
+
+  return SVN_NO_ERROR;
+}
+
+/* A closed revision completes the current batch. */
+static svn_error_t *
+record_close_revision(void *baton)
+{
+  parse_record_baton_t *rb = baton;
+  parse_queue_t *queue = rb->queue;
+
+  record_event(queue, parse_event_close_revision);
+  SVN_ERR(queue_batch(queue));
+  start_batch(queue);
+
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_cancel_func_t for the reader.  BATON is a
+   parse_queue_t. */
+static svn_error_t *
+parse_reader_cancel(void *baton)
+{
+  parse_queue_t *queue = baton;
+  if (svn_atomic_read(&queue->aborted))
+    return svn_error_create(SVN_ERR_CANCELLED, NULL, NULL);
+
+  return SVN_NO_ERROR;
+}
+
+/* Thread function of the reader for the parse_queue_t given by DATA. */
+static void * APR_THREAD_FUNC
+parse_reader_run(apr_thread_t *tid,
+                 void *data)
+{
+  parse_queue_t *queue = data;
+  svn_error_t *err;
+
+  err = svn_repos_parse_dumpstream3(queue->stream, queue->recorder, queue,
+                                    TRUE, parse_reader_cancel, queue,
+                                    queue->pool);
+
+  /* Hand over the remaining events together with the result.  If there
+     is no current batch, we have been aborted. */
+  if (queue->current)
+    {
+      queue->current->last = TRUE;
+      queue->current->err = err;
+      svn_error_clear(queue_batch(queue));
+    }
+  else
+    {
+      svn_error_clear(err);
+    }
+
+  apr_thread_exit(tid, APR_SUCCESS);
+
+  return NULL;
+}
+
+/* Invoke PARSE_FNS with PARSE_BATON for all events in BATCH.  *REV_BATON
+   and *NODE_BATON are the batons of the currently open records, REVPOOL
+   and NODEPOOL their respective pools.  Use BUFFER of size
+   SVN__STREAM_CHUNK_SIZE to copy text blocks.  The other parameters are
+   the same as for svn_repos_parse_dumpstream3(). */
+static svn_error_t *
+replay_batch(parse_batch_t *batch,
+             const svn_repos_parse_fns3_t *parse_fns,
+             void *parse_baton,
+             void **rev_baton,
+             void **node_baton,
+             apr_pool_t *revpool,
+             apr_pool_t *nodepool,
+             char *buffer,
+             svn_cancel_func_t cancel_func,
+             void *cancel_baton,
+             apr_pool_t *pool)
+{
+  svn_stream_t *texts = svn_stream_create(batch, batch->pool);
+  int i;
+
+  svn_stream_set_read2(texts, NULL /* only full read support */,
+                       read_handler_batch_text);
+
+  for (i = 0; i < batch->events->nelts; i++)
+    {
+      const parse_event_t *event = APR_ARRAY_IDX(batch->events, i,
+                                                 parse_event_t *);
+
+      switch (event->kind)
+        {
+          case parse_event_magic_header:
+            SVN_ERR(parse_fns->magic_header_record(event->version,
+                                                   parse_baton, pool));
+            break;
+
+          case parse_event_uuid:
+            SVN_ERR(parse_fns->uuid_record(event->name, parse_baton, pool));
+            break;
+
+          case parse_event_new_revision:
+            if (cancel_func)
+              SVN_ERR(cancel_func(cancel_baton));
+
+            SVN_ERR(parse_fns->new_revision_record(rev_baton,
+                                                   event->headers,
+                                                   parse_baton, revpool));
+            break;
+
+          case parse_event_new_node:
+            if (cancel_func)
+              SVN_ERR(cancel_func(cancel_baton));
+
+            SVN_ERR(parse_fns->new_node_record(node_baton, event->headers,
+                                               *rev_baton, nodepool));
+            break;
+
+          case parse_event_set_revision_property:
+            SVN_ERR(parse_fns->set_revision_property(*rev_baton,
+                                                     event->name,
+                                                     event->value));
+            break;
+
+          case parse_event_set_node_property:
+            SVN_ERR(parse_fns->set_node_property(*node_baton, event->name,
+                                                 event->value));
+            break;
+
+          case parse_event_delete_node_property:
+            SVN_ERR(parse_fns->delete_node_property(*node_baton,
+                                                    event->name));
+            break;
+
+          case parse_event_remove_node_props:
+            SVN_ERR(parse_fns->remove_node_props(*node_baton));
+            break;
+
+          case parse_event_text:
+            SVN_ERR(parse_text_block(texts, event->text_len, event->is_delta,
+                                     parse_fns,
+                                     event->is_node ? *node_baton
+                                                    : *rev_baton,
+                                     buffer, SVN__STREAM_CHUNK_SIZE,
+                                     event->is_node ? nodepool : revpool));
+            break;
+
+          case parse_event_close_node:
+            SVN_ERR(parse_fns->close_node(*node_baton));
+            svn_pool_clear(nodepool);
+            *node_baton = NULL;
+            break;
+
+          case parse_event_close_revision:
+            SVN_ERR(parse_fns->close_revision(*rev_baton));
+            svn_pool_clear(revpool);
+            *rev_baton = NULL;
+            break;
+        }
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_repos__parse_dumpstream_concurrently() for READ_AHEAD
+   larger than 1. */
+static svn_error_t *
+parse_dumpstream_concurrently(svn_stream_t *stream,
+                              const svn_repos_parse_fns3_t *parse_fns,
+                              void *parse_baton,
+                              svn_boolean_t deltas_are_text,
+                              int read_ahead,
+                              svn_cancel_func_t cancel_func,
+                              void *cancel_baton,
+                              apr_pool_t *pool)
+{
+  parse_queue_t *queue = apr_pcalloc(pool, sizeof(*queue));
+  svn_repos_parse_fns3_t *recorder = apr_pcalloc(pool, sizeof(*recorder));
+  char *buffer = apr_palloc(pool, SVN__STREAM_CHUNK_SIZE);
+  apr_pool_t *revpool;
+  apr_pool_t *nodepool;
+  void *rev_baton = NULL;
+  void *node_baton = NULL;
+  apr_thread_t *thread;
+  apr_status_t status, retval;
+  svn_boolean_t done = FALSE;
+  svn_error_t *err = SVN_NO_ERROR;
+
+  /* Make sure we can blindly invoke callbacks. */
+  parse_fns = complete_vtable(parse_fns, pool);
+
+  recorder->magic_header_record = record_magic_header_record;
+  recorder->uuid_record = record_uuid_record;
+  recorder->new_revision_record = record_new_revision_record;
+  recorder->new_node_record = record_new_node_record;
+  recorder->set_revision_property = record_set_revision_property;
+  recorder->set_node_property = record_set_node_property;
+  recorder->delete_node_property = record_delete_node_property;
+  recorder->remove_node_props = record_remove_node_props;
+  recorder->set_fulltext = record_set_fulltext;
+  recorder->close_node = record_close_node;
+  recorder->close_revision = record_close_revision;
+
+  status = apr_thread_mutex_create(&queue->mutex, APR_THREAD_MUTEX_DEFAULT,
+                                   pool);
+  if (!status)
+    status = apr_thread_cond_create(&queue->changed, pool);
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't create parser thread sync"));
+
+  queue->read_ahead = read_ahead;
+  queue->stream = stream;
+  queue->deltas_are_text = deltas_are_text;
+  queue->recorder = recorder;
+  queue->revision_record.queue = queue;
+  queue->revision_record.is_node = FALSE;
+  queue->node_record.queue = queue;
+  queue->node_record.is_node = TRUE;
+  queue->pool = svn_pool_create(NULL);
+  start_batch(queue);
+
+  status = apr_thread_create(&thread, NULL, parse_reader_run, queue,
+                             queue->pool);
+  if (status)
+    {
+      svn_pool_destroy(queue->current->pool);
+      svn_pool_destroy(queue->pool);
+      return svn_error_wrap_apr(status, _("Can't create parser thread"));
+    }
+
+  revpool = svn_pool_create(pool);
+  nodepool = svn_pool_create(pool);
+
+  /* Replay the batches in stream order. */
+  while (!done && !err)
+    {
+      parse_batch_t *batch;
+
+      apr_thread_mutex_lock(queue->mutex);
+      while (!queue->first)
+        apr_thread_cond_wait(queue->changed, queue->mutex);
+
+      batch = queue->first;
+      queue->first = batch->next;
+      if (!queue->first)
+        queue->last = NULL;
+      queue->count--;
+
+      apr_thread_cond_broadcast(queue->changed);
+      apr_thread_mutex_unlock(queue->mutex);
+
+      err = replay_batch(batch, parse_fns, parse_baton,
+                         &rev_baton, &node_baton, revpool, nodepool,
+                         buffer, cancel_func, cancel_baton, pool);
+
+      /* Parser errors come after all events recorded before them. */
+      if (!err)
+        {
+          err = batch->err;
+          batch->err = SVN_NO_ERROR;
+        }
+
+      done = batch->last;
+      svn_error_clear(batch->err);
+      svn_pool_destroy(batch->pool);
+    }
+
+  /* Stop the reader and release everything it did not hand over. */
+  apr_thread_mutex_lock(queue->mutex);
+  svn_atomic_set(&queue->aborted, TRUE);
+  apr_thread_cond_broadcast(queue->changed);
+  apr_thread_mutex_unlock(queue->mutex);
+
+  apr_thread_join(&retval, thread);
+
+  while (queue->first)
+    {
+      parse_batch_t *batch = queue->first;
+
+      queue->first = batch->next;
+      svn_error_clear(batch->err);
+      svn_pool_destroy(batch->pool);
+    }
+
+  svn_pool_destroy(queue->pool);
+  svn_pool_destroy(revpool);
+  svn_pool_destroy(nodepool);
+
+  return svn_error_trace(err);
+}
+
+#endif
+
+svn_error_t *
+svn_repos__parse_dumpstream_concurrently(
+                              svn_stream_t *stream,
+                              const svn_repos_parse_fns3_t *parse_fns,
+                              void *parse_baton,
+                              svn_boolean_t deltas_are_text,
+                              int read_ahead,
+                              svn_cancel_func_t cancel_func,
+                              void *cancel_baton,
+                              apr_pool_t *pool)
+{
+#if APR_HAS_THREADS
+  if (read_ahead > 1)
+    return svn_error_trace(parse_dumpstream_concurrently(stream, parse_fns,
+                                                         parse_baton,
+                                                         deltas_are_text,
+                                                         read_ahead,
+                                                         cancel_func,
+                                                         cancel_baton,
+                                                         pool));
+#endif
+
+  return svn_error_trace(svn_repos_parse_dumpstream3(stream, parse_fns,
+                                                     parse_baton,
+                                                     deltas_are_text,
+                                                     cancel_func,
+                                                     cancel_baton, pool));
+}
@@ -0,0 +1,107 @@
+/* This file is automatically generated from log-index-db.sql and subversion/libsvn_repos/token-map.h.
+ * Do not edit this file -- edit the source and rerun gen-make.py */
+
+#define STMT_CREATE_SCHEMA 0
+#define STMT_0_INFO {"STMT_CREATE_SCHEMA", NULL}
+#define STMT_0 \
+  "CREATE TABLE path_revs ( " \
+  "  path TEXT NOT NULL, " \
+  "  revision INTEGER NOT NULL, " \
+  "  PRIMARY KEY (path, revision) " \
+  "  ) WITHOUT ROWID; " \
+  "CREATE TABLE mergeinfo_changes ( " \
+  "  revision INTEGER NOT NULL, " \
+  "  path TEXT NOT NULL, " \
+  "  deleted TEXT, " \
+  "  added TEXT, " \
+  "  PRIMARY KEY (revision, path) " \
+  "  ) WITHOUT ROWID; " \
+  "CREATE TABLE indexed_rev ( " \
+  "  id INTEGER NOT NULL PRIMARY KEY, " \
+  "  revision INTEGER NOT NULL " \
+  "  ); " \
+  "INSERT INTO indexed_rev (id, revision) VALUES (0, -1); " \
+  "PRAGMA USER_VERSION = 1; " \
+  ""
+
+#define STMT_GET_INDEXED_REV 1
+#define STMT_1_INFO {"STMT_GET_INDEXED_REV", NULL}
+#define STMT_1 \
+  "SELECT revision " \
+  "FROM indexed_rev " \
+  "WHERE id = 0 " \
+  ""
+
+#define STMT_SET_INDEXED_REV 2
+#define STMT_2_INFO {"STMT_SET_INDEXED_REV", NULL}
+#define STMT_2 \
+  "UPDATE indexed_rev " \
+  "SET revision = ?1 " \
+  "WHERE id = 0 AND revision < ?1 " \
+  ""
+
+#define STMT_INSERT_PATH_REV 3
+#define STMT_3_INFO {"STMT_INSERT_PATH_REV", NULL}
+#define STMT_3 \
+  "INSERT OR IGNORE INTO path_revs (path, revision) " \
+  "VALUES (?1, ?2) " \
+  ""
+
+#define STMT_GET_YOUNGEST_PATH_REV 4
+#define STMT_4_INFO {"STMT_GET_YOUNGEST_PATH_REV", NULL}
+#define STMT_4 \
+  "SELECT revision " \
+  "FROM path_revs " \
+  "WHERE path = ?1 AND revision > ?2 AND revision <= ?3 " \
+  "ORDER BY revision DESC " \
+  "LIMIT 1 " \
+  ""
+
+#define STMT_INSERT_MERGEINFO_CHANGE 5
+#define STMT_5_INFO {"STMT_INSERT_MERGEINFO_CHANGE", NULL}
+#define STMT_5 \
+  "INSERT OR REPLACE INTO mergeinfo_changes (revision, path, deleted, added) " \
+  "VALUES (?1, ?2, ?3, ?4) " \
+  ""
+
+#define STMT_GET_MERGEINFO_CHANGES 6
+#define STMT_6_INFO {"STMT_GET_MERGEINFO_CHANGES", NULL}
+#define STMT_6 \
+  "SELECT path, deleted, added " \
+  "FROM mergeinfo_changes " \
+  "WHERE revision = ?1 " \
+  ""
+
+#define STMT_DELETE_ALL 7
+#define STMT_7_INFO {"STMT_DELETE_ALL", NULL}
+#define STMT_7 \
+  "DELETE FROM path_revs; " \
+  "DELETE FROM mergeinfo_changes; " \
+  "UPDATE indexed_rev SET revision = -1 WHERE id = 0; " \
+  ""
+
+#define LOG_INDEX_DB_SQL_DECLARE_STATEMENTS(varname) \
+  static const char * const varname[] = { \
+    STMT_0, \
+    STMT_1, \
+    STMT_2, \
+    STMT_3, \
+    STMT_4, \
+    STMT_5, \
+    STMT_6, \
+    STMT_7, \
+    NULL \
+  }
+
+#define LOG_INDEX_DB_SQL_DECLARE_STATEMENT_INFO(varname) \
+  static const char * const varname[][2] = { \
+    STMT_0_INFO, \
+    STMT_1_INFO, \
+    STMT_2_INFO, \
+    STMT_3_INFO, \
+    STMT_4_INFO, \
+    STMT_5_INFO, \
+    STMT_6_INFO, \
+    STMT_7_INFO, \
+    {NULL, NULL} \
+  }
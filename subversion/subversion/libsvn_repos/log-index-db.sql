@@ -0,0 +1,94 @@
+/* log-index-db.sql -- schema of the changed-paths log index
+ *   This is intended for use with SQLite 3
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+-- STMT_CREATE_SCHEMA
+/* A table listing, for every path that has been touched by a revision,
+   all revisions in which the path itself or any of its descendants got
+   changed.  The repository root is not listed because it is changed in
+   every revision. */
+CREATE TABLE path_revs (
+  path TEXT NOT NULL,
+  revision INTEGER NOT NULL,
+  PRIMARY KEY (path, revision)
+  ) WITHOUT ROWID;
+
+/* A table listing, for every revision, the paths on which svn:mergeinfo
+   got touched and the resulting mergeinfo changes as computed by
+   svn_repos__fs_mergeinfo_changed().  DELETED and ADDED are mergeinfo
+   strings; they are both NULL if the property got modified without
+   changing its value.  A row with an empty PATH marks a revision in
+   which some mergeinfo could not be parsed. */
+CREATE TABLE mergeinfo_changes (
+  revision INTEGER NOT NULL,
+  path TEXT NOT NULL,
+  deleted TEXT,
+  added TEXT,
+  PRIMARY KEY (revision, path)
+  ) WITHOUT ROWID;
+
+/* A single-row table recording the youngest revision that has been
+   fully indexed.  Revisions are indexed strictly in order. */
+CREATE TABLE indexed_rev (
+  id INTEGER NOT NULL PRIMARY KEY,
+  revision INTEGER NOT NULL
+  );
+
+INSERT INTO indexed_rev (id, revision) VALUES (0, -1);
+
+PRAGMA USER_VERSION = 1;
+
+-- STMT_GET_INDEXED_REV
+SELECT revision
+FROM indexed_rev
+WHERE id = 0
+
+-- STMT_SET_INDEXED_REV
+UPDATE indexed_rev
+SET revision = ?1
+WHERE id = 0 AND revision < ?1
+
+-- STMT_INSERT_PATH_REV
+INSERT OR IGNORE INTO path_revs (path, revision)
+VALUES (?1, ?2)
+
+-- STMT_GET_YOUNGEST_PATH_REV
+/* Youngest revision in the half-open range (?2, ?3] that touched ?1. */
+SELECT revision
+FROM path_revs
+WHERE path = ?1 AND revision > ?2 AND revision <= ?3
+ORDER BY revision DESC
+LIMIT 1
+
+-- STMT_INSERT_MERGEINFO_CHANGE
+INSERT OR REPLACE INTO mergeinfo_changes (revision, path, deleted, added)
+VALUES (?1, ?2, ?3, ?4)
+
+-- STMT_GET_MERGEINFO_CHANGES
+SELECT path, deleted, added
+FROM mergeinfo_changes
+WHERE revision = ?1
+
+-- STMT_DELETE_ALL
+DELETE FROM path_revs;
+DELETE FROM mergeinfo_changes;
+UPDATE indexed_rev SET revision = -1 WHERE id = 0;
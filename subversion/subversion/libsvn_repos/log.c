@@ -56,6 +56,10 @@ typedef struct log_callbacks_t
   void *revision_receiver_baton;
   svn_repos_authz_func_t authz_read_func;
   void *authz_read_baton;
+
+  /* The changed-paths log index of the repository, if it exists and
+     covers all revisions that we are going to look at.  May be NULL. */
+  svn_repos__log_index_t *log_index;
 } log_callbacks_t;
 
 
@@ -429,8 +433,128 @@ struct path_info
   svn_fs_history_t *hist;
   apr_pool_t *newpool;
   apr_pool_t *oldpool;
+
+  /* If not NULL, we don't use history objects at all but find the next
+     interesting revision through this changed-paths log index. */
+  svn_repos__log_index_t *log_index;
 };
 
+/* Advance to the next history for the path, using INFO->LOG_INDEX.
+ *
+ * Within a line of history that has no copies at INFO->PATH or any of its
+ * parents, the node at INFO->PATH changes exactly in those revisions that
+ * touch INFO->PATH or any of its descendants.  The index tells us these
+ * revisions directly.  The start of that line is either the revision that
+ * added the node or the latest copy to INFO->PATH or its parents.  From
+ * there, we continue at the copy source unless STRICT is set.
+ *
+ * Parameters and behavior are the same as for get_history().
+ */
+static svn_error_t *
+get_indexed_history(struct path_info *info,
+                    svn_fs_t *fs,
+                    svn_boolean_t strict,
+                    svn_repos_authz_func_t authz_read_func,
+                    void *authz_read_baton,
+                    svn_revnum_t start,
+                    apr_pool_t *scratch_pool)
+{
+  const char *path = info->path->data;
+  svn_revnum_t revision = info->history_rev;
+
+  /* Shall we report INFO->HISTORY_REV itself, if interesting? */
+  svn_boolean_t inclusive = info->first_time;
+  info->first_time = FALSE;
+
+  while (TRUE)
+    {
+      svn_fs_root_t *root, *copy_root;
+      const char *copy_path, *copy_src_path;
+      svn_revnum_t copy_rev = SVN_INVALID_REVNUM;
+      svn_revnum_t origin_rev, line_start, changed_rev, copy_src_rev;
+
+      if (revision < start)
+        {
+          info->done = TRUE;
+          return SVN_NO_ERROR;
+        }
+
+      /* Find the start of the current line of history. */
+      SVN_ERR(svn_fs_revision_root(&root, fs, revision, scratch_pool));
+      SVN_ERR(svn_fs_closest_copy(&copy_root, &copy_path, root, path,
+                                  scratch_pool));
+      if (copy_root)
+        copy_rev = svn_fs_revision_root_revision(copy_root);
+      SVN_ERR(svn_fs_node_origin_rev(&origin_rev, root, path,
+                                     scratch_pool));
+      line_start = MAX(copy_rev, origin_rev);
+
+      /* The start of the line is always interesting. */
+      SVN_ERR(svn_repos__log_index_youngest_change(&changed_rev,
+                                                   info->log_index, path,
+                                                   line_start,
+                                                   inclusive ? revision
+                                                             : revision - 1,
+                                                   scratch_pool));
+      if (SVN_IS_VALID_REVNUM(changed_rev))
+        {
+          revision = changed_rev;
+          break;
+        }
+      else if (inclusive || revision > line_start)
+        {
+          revision = line_start;
+          break;
+        }
+
+      /* We already reported the start of this line.  If the node did not
+         get here by a copy, its history ends here. */
+      if (strict || copy_rev != line_start || origin_rev == line_start)
+        {
+          info->done = TRUE;
+          return SVN_NO_ERROR;
+        }
+
+      /* Continue at the copy source. */
+      SVN_ERR(svn_fs_copied_from(&copy_src_rev, &copy_src_path,
+                                 copy_root, copy_path, scratch_pool));
+      path = svn_fspath__join(copy_src_path,
+                              svn_fspath__skip_ancestor(copy_path, path),
+                              scratch_pool);
+      revision = copy_src_rev;
+      inclusive = TRUE;
+    }
+
+  svn_stringbuf_set(info->path, path);
+  info->history_rev = revision;
+
+  /* If this history item predates our START revision then
+     don't fetch any more for this path. */
+  if (info->history_rev < start)
+    {
+      info->done = TRUE;
+      return SVN_NO_ERROR;
+    }
+
+  /* Is the history item readable?  If not, done with path. */
+  if (authz_read_func)
+    {
+      svn_boolean_t readable;
+      svn_fs_root_t *history_root;
+
+      SVN_ERR(svn_fs_revision_root(&history_root, fs, info->history_rev,
+                                   scratch_pool));
+      SVN_ERR(authz_read_func(&readable, history_root,
+                              info->path->data,
+                              authz_read_baton,
+                              scratch_pool));
+      if (! readable)
+        info->done = TRUE;
+    }
+
+  return SVN_NO_ERROR;
+}
+
 /* Advance to the next history for the path.
  *
  * If INFO->HIST is not NULL we do this using that existing history object,
@@ -462,6 +586,12 @@ get_history(struct path_info *info,
   apr_pool_t *subpool;
   const char *path;
 
+  if (info->log_index)
+    return svn_error_trace(get_indexed_history(info, fs, strict,
+                                               authz_read_func,
+                                               authz_read_baton, start,
+                                               scratch_pool));
+
   if (info->hist)
     {
       subpool = info->newpool;
@@ -609,18 +739,16 @@ next_history_rev(const apr_array_header_t *histories)
   return next_rev;
 }
 
-/* Set *DELETED_MERGEINFO_CATALOG and *ADDED_MERGEINFO_CATALOG to
-   catalogs describing how mergeinfo values on paths (which are the
-   keys of those catalogs) were changed in REV. */
 /* ### TODO: This would make a *great*, useful public function,
    ### svn_repos_fs_mergeinfo_changed()!  -- cmpilato  */
-static svn_error_t *
-fs_mergeinfo_changed(svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
-                     svn_mergeinfo_catalog_t *added_mergeinfo_catalog,
-                     svn_fs_t *fs,
-                     svn_revnum_t rev,
-                     apr_pool_t *result_pool,
-                     apr_pool_t *scratch_pool)
+svn_error_t *
+svn_repos__fs_mergeinfo_changed(
+  svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
+  svn_mergeinfo_catalog_t *added_mergeinfo_catalog,
+  svn_fs_t *fs,
+  svn_revnum_t rev,
+  apr_pool_t *result_pool,
+  apr_pool_t *scratch_pool)
 {
   svn_fs_root_t *root;
   apr_pool_t *iterpool, *iterator_pool;
@@ -877,13 +1005,15 @@ fs_mergeinfo_changed(svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
 
 /* Determine what (if any) mergeinfo for PATHS was modified in
    revision REV, returning the differences for added mergeinfo in
-   *ADDED_MERGEINFO and deleted mergeinfo in *DELETED_MERGEINFO. */
+   *ADDED_MERGEINFO and deleted mergeinfo in *DELETED_MERGEINFO.
+   If LOG_INDEX is not NULL, get the mergeinfo changes of REV from it. */
 static svn_error_t *
 get_combined_mergeinfo_changes(svn_mergeinfo_t *added_mergeinfo,
                                svn_mergeinfo_t *deleted_mergeinfo,
                                svn_fs_t *fs,
                                const apr_array_header_t *paths,
                                svn_revnum_t rev,
+                               svn_repos__log_index_t *log_index,
                                apr_pool_t *result_pool,
                                apr_pool_t *scratch_pool)
 {
@@ -907,10 +1037,16 @@ get_combined_mergeinfo_changes(svn_mergeinfo_t *added_mergeinfo,
     return SVN_NO_ERROR;
 
   /* Fetch the mergeinfo changes for REV. */
-  err = fs_mergeinfo_changed(&deleted_mergeinfo_catalog,
-                             &added_mergeinfo_catalog,
-                             fs, rev,
-                             scratch_pool, scratch_pool);
+  if (log_index)
+    err = svn_repos__log_index_mergeinfo_changed(&deleted_mergeinfo_catalog,
+                                                 &added_mergeinfo_catalog,
+                                                 log_index, rev,
+                                                 scratch_pool, scratch_pool);
+  else
+    err = svn_repos__fs_mergeinfo_changed(&deleted_mergeinfo_catalog,
+                                          &added_mergeinfo_catalog,
+                                          fs, rev,
+                                          scratch_pool, scratch_pool);
   if (err)
     {
       if (err->apr_err == SVN_ERR_MERGEINFO_PARSE_ERROR)
@@ -1390,7 +1526,10 @@ send_log(svn_revnum_t rev,
 /* Get the histories for PATHS, and store them in *HISTORIES.
 
    If IGNORE_MISSING_LOCATIONS is set, don't treat requests for bogus
-   repository locations as fatal -- just ignore them.  */
+   repository locations as fatal -- just ignore them.
+
+   If LOG_INDEX is not NULL, use it instead of history objects to find
+   the interesting revisions.  */
 static svn_error_t *
 get_path_histories(apr_array_header_t **histories,
                    svn_fs_t *fs,
@@ -1401,6 +1540,7 @@ get_path_histories(apr_array_header_t **histories,
                    svn_boolean_t ignore_missing_locations,
                    svn_repos_authz_func_t authz_read_func,
                    void *authz_read_baton,
+                   svn_repos__log_index_t *log_index,
                    apr_pool_t *pool)
 {
   svn_fs_root_t *root;
@@ -1442,8 +1582,18 @@ get_path_histories(apr_array_header_t **histories,
       info->done = FALSE;
       info->history_rev = hist_end;
       info->first_time = TRUE;
+      info->log_index = log_index;
 
-      if (i < MAX_OPEN_HISTORIES)
+      if (log_index)
+        {
+          /* Make the path look like what history objects would report. */
+          svn_stringbuf_set(info->path,
+                            svn_fspath__canonicalize(this_path, iterpool));
+          info->hist = NULL;
+          info->oldpool = NULL;
+          info->newpool = NULL;
+        }
+      else if (i < MAX_OPEN_HISTORIES)
         {
           err = svn_fs_node_history2(&info->hist, root, this_path, pool,
                                      iterpool);
@@ -2015,7 +2165,8 @@ do_logs(svn_fs_t *fs,
   SVN_ERR(get_path_histories(&histories, fs, paths, hist_start, hist_end,
                              strict_node_history, ignore_missing_locations,
                              callbacks->authz_read_func,
-                             callbacks->authz_read_baton, pool));
+                             callbacks->authz_read_baton,
+                             callbacks->log_index, pool));
 
   /* Loop through all the revisions in the range and add any
      where a path was changed to the array, or if they wanted
@@ -2077,6 +2228,7 @@ do_logs(svn_fs_t *fs,
                                                      &deleted_mergeinfo,
                                                      fs, cur_paths,
                                                      current,
+                                                     callbacks->log_index,
                                                      iterpool, iterpool));
               has_children = (apr_hash_count(added_mergeinfo) > 0
                               || apr_hash_count(deleted_mergeinfo) > 0);
@@ -2332,6 +2484,7 @@ svn_repos_get_logs5(svn_repos_t *repos,
   callbacks.revision_receiver_baton = revision_receiver_baton;
   callbacks.authz_read_func = authz_read_func;
   callbacks.authz_read_baton = authz_read_baton;
+  callbacks.log_index = NULL;
 
   if (revprops)
     {
@@ -2460,6 +2613,25 @@ svn_repos_get_logs5(svn_repos_t *repos,
       svn_pool_destroy(subpool);
     }
 
+  /* Use the changed-paths log index if it is available and up-to-date.
+     It is merely an optimization, so fall back to the node histories
+     if we can't read it for whatever reason. */
+  {
+    svn_revnum_t indexed_rev;
+    svn_error_t *err = svn_repos__log_index_open(&callbacks.log_index,
+                                                 &indexed_rev, repos,
+                                                 scratch_pool, scratch_pool);
+    if (err)
+      {
+        svn_error_clear(err);
+        callbacks.log_index = NULL;
+      }
+    else if (indexed_rev < end)
+      {
+        callbacks.log_index = NULL;
+      }
+  }
+
   return do_logs(repos->fs, paths, paths_history_mergeinfo, NULL, NULL,
                  start, end, limit, strict_node_history,
                  include_merged_revisions, FALSE, FALSE, FALSE,
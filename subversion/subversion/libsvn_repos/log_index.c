@@ -0,0 +1,544 @@
+/* log_index.c : the changed-paths log index
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include "svn_hash.h"
+#include "svn_pools.h"
+#include "svn_error.h"
+#include "svn_dirent_uri.h"
+#include "svn_fs.h"
+#include "svn_repos.h"
+#include "svn_mergeinfo.h"
+#include "svn_sorts.h"
+#include "repos.h"
+
+#include "private/svn_fspath.h"
+#include "private/svn_repos_private.h"
+#include "private/svn_sqlite.h"
+#include "private/svn_subr_private.h"
+
+#include "svn_private_config.h"
+
+#include "log-index-db.h"
+
+LOG_INDEX_DB_SQL_DECLARE_STATEMENTS(statements);
+
+
+/* Revisions are indexed in transactions of at most this many
+   revisions each. */
+#define INDEX_BATCH_SIZE 256
+
+/* Never let a commit catch up on more than this many revisions that
+   are missing from the index.  Leave it to svnadmin instead. */
+#define MAX_POST_COMMIT_CATCH_UP 64
+
+struct svn_repos__log_index_t
+{
+  /* The SQLite database holding the index. */
+  svn_sqlite__db_t *sdb;
+};
+
+
+/** Helper functions. **/
+
+/* Return the path of the log index database within REPOS. */
+static const char *
+log_index_db_path(svn_repos_t *repos,
+                  apr_pool_t *result_pool)
+{
+  return svn_dirent_join(repos->db_path, SVN_REPOS__LOG_INDEX_DB,
+                         result_pool);
+}
+
+/* Open the log index database of REPOS in MODE and return it in *SDB.
+   If the index does not exist and MODE does not allow creating it,
+   set *SDB to NULL.  Unless opening read-only, create the schema of
+   an uninitialized database; otherwise treat it as non-existent.
+   Allocate the result in RESULT_POOL and use SCRATCH_POOL for
+   temporaries. */
+static svn_error_t *
+open_db(svn_sqlite__db_t **sdb,
+        svn_repos_t *repos,
+        svn_sqlite__mode_t mode,
+        apr_pool_t *result_pool,
+        apr_pool_t *scratch_pool)
+{
+  const char *db_path = log_index_db_path(repos, scratch_pool);
+  svn_node_kind_t kind;
+  int version;
+
+  SVN_ERR(svn_io_check_path(db_path, &kind, scratch_pool));
+  if (kind == svn_node_none && mode != svn_sqlite__mode_rwcreate)
+    {
+      *sdb = NULL;
+      return SVN_NO_ERROR;
+    }
+
+#ifndef WIN32
+  if (kind == svn_node_none)
+    {
+      /* Give the new index the same permissions as the filesystem's
+         'current' file, so every committer can update it. */
+      const char *current = svn_dirent_join(repos->db_path, "current",
+                                            scratch_pool);
+      svn_error_t *err = svn_io_file_create_empty(db_path, scratch_pool);
+
+      if (err && !APR_STATUS_IS_EEXIST(err->apr_err))
+        return svn_error_trace(err);
+      else if (err)
+        svn_error_clear(err);
+      else
+        {
+          SVN_ERR(svn_io_check_path(current, &kind, scratch_pool));
+          if (kind == svn_node_file)
+            SVN_ERR(svn_io_copy_perms(current, db_path, scratch_pool));
+        }
+    }
+#endif
+
+  SVN_ERR(svn_sqlite__open(sdb, db_path, mode, statements, 0, NULL, 0,
+                           result_pool, scratch_pool));
+
+  SVN_SQLITE__ERR_CLOSE(svn_sqlite__read_schema_version(&version, *sdb,
+                                                        scratch_pool),
+                        *sdb);
+  if (version <= 0 && mode == svn_sqlite__mode_readonly)
+    {
+      /* Somebody is just about to create the index. */
+      SVN_ERR(svn_sqlite__close(*sdb));
+      *sdb = NULL;
+    }
+  else if (version <= 0)
+    SVN_SQLITE__ERR_CLOSE(svn_sqlite__exec_statements(*sdb,
+                                                      STMT_CREATE_SCHEMA),
+                          *sdb);
+  else if (version != 1)
+    return svn_error_createf(SVN_ERR_SQLITE_UNSUPPORTED_SCHEMA,
+                             svn_sqlite__close(*sdb),
+                             _("Log index '%s' has unsupported schema "
+                               "version %d"),
+                             svn_dirent_local_style(db_path, scratch_pool),
+                             version);
+
+  return SVN_NO_ERROR;
+}
+
+/* Set *INDEXED_REV to the youngest revision covered by the index in SDB. */
+static svn_error_t *
+get_indexed_rev(svn_revnum_t *indexed_rev,
+                svn_sqlite__db_t *sdb)
+{
+  svn_sqlite__stmt_t *stmt;
+  svn_boolean_t have_row;
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, sdb, STMT_GET_INDEXED_REV));
+  SVN_ERR(svn_sqlite__step(&have_row, stmt));
+  *indexed_rev = have_row ? svn_sqlite__column_revnum(stmt, 0)
+                          : SVN_INVALID_REVNUM;
+
+  return svn_error_trace(svn_sqlite__reset(stmt));
+}
+
+/* Record in SDB the mergeinfo changes in revision REV of FS.
+   MERGEINFO_PATHS lists the paths on which svn:mergeinfo got touched
+   in REV.  Use SCRATCH_POOL for temporaries. */
+static svn_error_t *
+index_mergeinfo_changes(svn_sqlite__db_t *sdb,
+                        svn_fs_t *fs,
+                        svn_revnum_t rev,
+                        const apr_array_header_t *mergeinfo_paths,
+                        apr_pool_t *scratch_pool)
+{
+  svn_mergeinfo_catalog_t deleted_catalog, added_catalog;
+  svn_sqlite__stmt_t *stmt;
+  apr_hash_index_t *hi;
+  svn_error_t *err;
+  int i;
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, sdb,
+                                    STMT_INSERT_MERGEINFO_CHANGE));
+  for (i = 0; i < mergeinfo_paths->nelts; i++)
+    {
+      const char *path = APR_ARRAY_IDX(mergeinfo_paths, i, const char *);
+
+      SVN_ERR(svn_sqlite__bindf(stmt, "rs", rev, path));
+      SVN_ERR(svn_sqlite__step_done(stmt));
+    }
+
+  /* Issue #3896: Readers ignore invalid mergeinfo, so we only need
+     to remember that there was some. */
+  err = svn_repos__fs_mergeinfo_changed(&deleted_catalog, &added_catalog,
+                                        fs, rev, scratch_pool, scratch_pool);
+  if (err && err->apr_err == SVN_ERR_MERGEINFO_PARSE_ERROR)
+    {
+      svn_error_clear(err);
+
+      SVN_ERR(svn_sqlite__bindf(stmt, "rs", rev, ""));
+      return svn_error_trace(svn_sqlite__step_done(stmt));
+    }
+  SVN_ERR(err);
+
+  for (hi = apr_hash_first(scratch_pool, deleted_catalog);
+       hi;
+       hi = apr_hash_next(hi))
+    {
+      const char *path = apr_hash_this_key(hi);
+      svn_mergeinfo_t deleted = apr_hash_this_val(hi);
+      svn_mergeinfo_t added = svn_hash_gets(added_catalog, path);
+      svn_string_t *deleted_str, *added_str;
+
+      SVN_ERR(svn_mergeinfo_to_string(&deleted_str, deleted, scratch_pool));
+      SVN_ERR(svn_mergeinfo_to_string(&added_str, added, scratch_pool));
+
+      SVN_ERR(svn_sqlite__bindf(stmt, "rsss", rev, path,
+                                deleted_str->data, added_str->data));
+      SVN_ERR(svn_sqlite__step_done(stmt));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Record in SDB all paths touched by revision REV of FS, i.e. every
+   changed path plus all of its parents except the root, as well as
+   all mergeinfo changes.  Use SCRATCH_POOL for temporaries. */
+static svn_error_t *
+index_revision(svn_sqlite__db_t *sdb,
+               svn_fs_t *fs,
+               svn_revnum_t rev,
+               apr_pool_t *scratch_pool)
+{
+  svn_fs_root_t *root;
+  svn_fs_path_change_iterator_t *iterator;
+  svn_fs_path_change3_t *change;
+  svn_sqlite__stmt_t *stmt;
+  apr_hash_t *touched = apr_hash_make(scratch_pool);
+  apr_array_header_t *mergeinfo_paths
+    = apr_array_make(scratch_pool, 0, sizeof(const char *));
+
+  SVN_ERR(svn_fs_revision_root(&root, fs, rev, scratch_pool));
+  SVN_ERR(svn_fs_paths_changed3(&iterator, root, scratch_pool,
+                                scratch_pool));
+  SVN_ERR(svn_sqlite__get_statement(&stmt, sdb, STMT_INSERT_PATH_REV));
+
+  SVN_ERR(svn_fs_path_change_get(&change, iterator));
+  while (change)
+    {
+      const char *path = svn_fspath__canonicalize(change->path.data,
+                                                  scratch_pool);
+
+      /* If there was a prop change and we are not positive that _no_
+         mergeinfo change happened, we must assume that it might have. */
+      if (change->prop_mod && change->mergeinfo_mod != svn_tristate_false)
+        APR_ARRAY_PUSH(mergeinfo_paths, const char *)
+          = apr_pstrmemdup(scratch_pool, change->path.data,
+                           change->path.len);
+
+      /* Walk up the tree until we reach the root or a path that we
+         already recorded along with all its parents. */
+      while (!svn_fspath__is_root(path, strlen(path))
+             && !svn_hash_gets(touched, path))
+        {
+          svn_hash_sets(touched, path, path);
+
+          SVN_ERR(svn_sqlite__bindf(stmt, "sr", path, rev));
+          SVN_ERR(svn_sqlite__step_done(stmt));
+
+          path = svn_fspath__dirname(path, scratch_pool);
+        }
+
+      SVN_ERR(svn_fs_path_change_get(&change, iterator));
+    }
+
+  if (mergeinfo_paths->nelts)
+    SVN_ERR(index_mergeinfo_changes(sdb, fs, rev, mergeinfo_paths,
+                                    scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Index all revisions of FS that are younger than the youngest revision
+   already recorded in SDB, up to and including LAST_REV.  Then record
+   LAST_REV as the youngest indexed revision.  This must be called
+   within an SQLite transaction.  Use SCRATCH_POOL for temporaries. */
+static svn_error_t *
+index_revisions(svn_sqlite__db_t *sdb,
+                svn_fs_t *fs,
+                svn_revnum_t last_rev,
+                apr_pool_t *scratch_pool)
+{
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  svn_sqlite__stmt_t *stmt;
+  svn_revnum_t rev;
+
+  /* Another process may have been faster than us. */
+  SVN_ERR(get_indexed_rev(&rev, sdb));
+  for (++rev; rev <= last_rev; ++rev)
+    {
+      svn_pool_clear(iterpool);
+      SVN_ERR(index_revision(sdb, fs, rev, iterpool));
+    }
+
+  svn_pool_destroy(iterpool);
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, sdb, STMT_SET_INDEXED_REV));
+  SVN_ERR(svn_sqlite__bind_revnum(stmt, 1, last_rev));
+  return svn_error_trace(svn_sqlite__step_done(stmt));
+}
+
+/* Bring the index in SDB up-to-date with revision LAST_REV of FS.
+   CANCEL_FUNC and CANCEL_BATON will be used to check for cancellation.
+   Use SCRATCH_POOL for temporaries. */
+static svn_error_t *
+catch_up(svn_sqlite__db_t *sdb,
+         svn_fs_t *fs,
+         svn_revnum_t last_rev,
+         svn_cancel_func_t cancel_func,
+         void *cancel_baton,
+         apr_pool_t *scratch_pool)
+{
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  svn_revnum_t indexed_rev;
+
+  SVN_ERR(get_indexed_rev(&indexed_rev, sdb));
+  while (indexed_rev < last_rev)
+    {
+      svn_revnum_t batch_end = MIN(last_rev, indexed_rev + INDEX_BATCH_SIZE);
+
+      svn_pool_clear(iterpool);
+      if (cancel_func)
+        SVN_ERR(cancel_func(cancel_baton));
+
+      SVN_SQLITE__WITH_IMMEDIATE_TXN(index_revisions(sdb, fs, batch_end,
+                                                     iterpool),
+                                     sdb);
+      SVN_ERR(get_indexed_rev(&indexed_rev, sdb));
+    }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+
+/** Library-private API's. **/
+
+svn_error_t *
+svn_repos__log_index_open(svn_repos__log_index_t **index_p,
+                          svn_revnum_t *indexed_rev,
+                          svn_repos_t *repos,
+                          apr_pool_t *result_pool,
+                          apr_pool_t *scratch_pool)
+{
+  svn_sqlite__db_t *sdb;
+
+  *index_p = NULL;
+  *indexed_rev = SVN_INVALID_REVNUM;
+
+  SVN_ERR(open_db(&sdb, repos, svn_sqlite__mode_readonly, result_pool,
+                  scratch_pool));
+  if (sdb)
+    {
+      SVN_SQLITE__ERR_CLOSE(get_indexed_rev(indexed_rev, sdb), sdb);
+
+      *index_p = apr_pcalloc(result_pool, sizeof(**index_p));
+      (*index_p)->sdb = sdb;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_repos__log_index_youngest_change(svn_revnum_t *changed_rev,
+                                     svn_repos__log_index_t *index,
+                                     const char *path,
+                                     svn_revnum_t after,
+                                     svn_revnum_t upto,
+                                     apr_pool_t *scratch_pool)
+{
+  svn_sqlite__stmt_t *stmt;
+  svn_boolean_t have_row;
+
+  *changed_rev = SVN_INVALID_REVNUM;
+  if (upto <= after)
+    return SVN_NO_ERROR;
+
+  /* The root gets changed in every revision and is not in the index. */
+  path = svn_fspath__canonicalize(path, scratch_pool);
+  if (svn_fspath__is_root(path, strlen(path)))
+    {
+      *changed_rev = upto;
+      return SVN_NO_ERROR;
+    }
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, index->sdb,
+                                    STMT_GET_YOUNGEST_PATH_REV));
+  SVN_ERR(svn_sqlite__bindf(stmt, "srr", path, after, upto));
+  SVN_ERR(svn_sqlite__step(&have_row, stmt));
+  if (have_row)
+    *changed_rev = svn_sqlite__column_revnum(stmt, 0);
+
+  return svn_error_trace(svn_sqlite__reset(stmt));
+}
+
+svn_error_t *
+svn_repos__log_index_mergeinfo_changed(
+  svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
+  svn_mergeinfo_catalog_t *added_mergeinfo_catalog,
+  svn_repos__log_index_t *index,
+  svn_revnum_t rev,
+  apr_pool_t *result_pool,
+  apr_pool_t *scratch_pool)
+{
+  svn_sqlite__stmt_t *stmt;
+  svn_boolean_t have_row;
+  svn_error_t *err = SVN_NO_ERROR;
+
+  *deleted_mergeinfo_catalog = svn_hash__make(result_pool);
+  *added_mergeinfo_catalog = svn_hash__make(result_pool);
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, index->sdb,
+                                    STMT_GET_MERGEINFO_CHANGES));
+  SVN_ERR(svn_sqlite__bind_revnum(stmt, 1, rev));
+  SVN_ERR(svn_sqlite__step(&have_row, stmt));
+  while (have_row && !err)
+    {
+      const char *path = svn_sqlite__column_text(stmt, 0, result_pool);
+      svn_mergeinfo_t deleted, added;
+
+      if (*path == '\0')
+        err = svn_error_createf(SVN_ERR_MERGEINFO_PARSE_ERROR, NULL,
+                                _("Invalid mergeinfo in revision %ld"),
+                                rev);
+      else if (! svn_sqlite__column_is_null(stmt, 1))
+        {
+          err = svn_mergeinfo_parse(&deleted,
+                                    svn_sqlite__column_text(stmt, 1, NULL),
+                                    result_pool);
+          if (!err)
+            err = svn_mergeinfo_parse(&added,
+                                      svn_sqlite__column_text(stmt, 2, NULL),
+                                      result_pool);
+          if (!err)
+            {
+              svn_hash_sets(*deleted_mergeinfo_catalog, path, deleted);
+              svn_hash_sets(*added_mergeinfo_catalog, path, added);
+            }
+        }
+
+      if (!err)
+        err = svn_sqlite__step(&have_row, stmt);
+    }
+
+  return svn_error_compose_create(err, svn_sqlite__reset(stmt));
+}
+
+svn_error_t *
+svn_repos__log_index_mergeinfo_touched(const char **touched_path,
+                                       svn_repos__log_index_t *index,
+                                       svn_revnum_t rev,
+                                       const char *path,
+                                       apr_pool_t *result_pool,
+                                       apr_pool_t *scratch_pool)
+{
+  svn_sqlite__stmt_t *stmt;
+  svn_boolean_t have_row;
+
+  *touched_path = NULL;
+
+  SVN_ERR(svn_sqlite__get_statement(&stmt, index->sdb,
+                                    STMT_GET_MERGEINFO_CHANGES));
+  SVN_ERR(svn_sqlite__bind_revnum(stmt, 1, rev));
+  SVN_ERR(svn_sqlite__step(&have_row, stmt));
+  while (have_row)
+    {
+      const char *changed_path = svn_sqlite__column_text(stmt, 0, NULL);
+
+      /* Find the changed path closest to PATH. */
+      if (   *changed_path
+          && svn_fspath__skip_ancestor(changed_path, path)
+          && (   !*touched_path
+              || svn_fspath__skip_ancestor(*touched_path, changed_path)))
+        *touched_path = apr_pstrdup(result_pool, changed_path);
+
+      SVN_ERR(svn_sqlite__step(&have_row, stmt));
+    }
+
+  return svn_error_trace(svn_sqlite__reset(stmt));
+}
+
+svn_error_t *
+svn_repos__log_index_post_commit(svn_repos_t *repos,
+                                 svn_revnum_t new_rev,
+                                 apr_pool_t *scratch_pool)
+{
+  svn_sqlite__db_t *sdb;
+  svn_revnum_t indexed_rev;
+  svn_error_t *err;
+
+  SVN_ERR(open_db(&sdb, repos, svn_sqlite__mode_readwrite, scratch_pool,
+                  scratch_pool));
+  if (! sdb)
+    return SVN_NO_ERROR;
+
+  err = get_indexed_rev(&indexed_rev, sdb);
+  if (!err && indexed_rev < new_rev
+      && new_rev - indexed_rev <= MAX_POST_COMMIT_CATCH_UP)
+    err = catch_up(sdb, repos->fs, new_rev, NULL, NULL, scratch_pool);
+
+  return svn_error_compose_create(err, svn_sqlite__close(sdb));
+}
+
+svn_error_t *
+svn_repos__log_index_build(svn_revnum_t *indexed_rev,
+                           svn_repos_t *repos,
+                           svn_cancel_func_t cancel_func,
+                           void *cancel_baton,
+                           apr_pool_t *scratch_pool)
+{
+  svn_sqlite__db_t *sdb;
+  svn_revnum_t youngest;
+  svn_error_t *err;
+
+  SVN_ERR(open_db(&sdb, repos, svn_sqlite__mode_rwcreate, scratch_pool,
+                  scratch_pool));
+
+  /* Start from scratch.  Concurrent commits will wait for us to finish
+     indexing a batch and then find nothing left for them to do. */
+  err = svn_sqlite__exec_statements(sdb, STMT_DELETE_ALL);
+  if (!err)
+    err = get_indexed_rev(indexed_rev, sdb);
+
+  /* Commits made while we are busy will not catch up on the index
+     themselves, so keep going until we are done with all of them. */
+  while (!err)
+    {
+      err = svn_fs_youngest_rev(&youngest, repos->fs, scratch_pool);
+      if (err || *indexed_rev >= youngest)
+        break;
+
+      err = catch_up(sdb, repos->fs, youngest, cancel_func, cancel_baton,
+                     scratch_pool);
+      if (!err)
+        err = get_indexed_rev(indexed_rev, sdb);
+    }
+
+  return svn_error_compose_create(err, svn_sqlite__close(sdb));
+}
@@ -21,6 +21,10 @@
  * ====================================================================
  */
 
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
+
 #include "svn_dirent_uri.h"
 #include "svn_hash.h"
 #include "svn_path.h"
@@ -31,6 +35,7 @@
 #include "svn_repos.h"
 #include "svn_pools.h"
 #include "svn_props.h"
+#include "svn_cache_config.h"
 #include "repos.h"
 #include "svn_private_config.h"
 
@@ -100,11 +105,14 @@ typedef struct revision_info_t
   svn_string_t* author;        /* name of the revisions' author */
 } revision_info_t;
 
+/* Text delta prefetching state, see below. */
+typedef struct prefetcher_t prefetcher_t;
+
 /* A structure used by the routines within the `reporter' vtable,
    driven by the client as it describes its working copy revisions. */
 typedef struct report_baton_t
 {
-  /* Parameters remembered from svn_repos_begin_report3 */
+  /* Parameters remembered from svn_repos_begin_report4 */
   svn_repos_t *repos;
   const char *fs_base;         /* fspath corresponding to wc anchor */
   const char *s_operand;       /* anchor-relative wc target (may be empty) */
@@ -113,6 +121,8 @@ typedef struct report_baton_t
   svn_boolean_t text_deltas;   /* Whether to report text deltas */
   apr_size_t zero_copy_limit;  /* Max item size that will be sent using
                                   the zero-copy code path. */
+  int prefetch_jobs;           /* Max. number of text delta prefetching
+                                  threads. */
 
   /* If the client requested a specific depth, record it here; if the
      client did not, then this is svn_depth_unknown, and the depth of
@@ -143,6 +153,9 @@ typedef struct report_baton_t
 
   /* This will not change. So, fetch it once and reuse it. */
   svn_string_t *repos_uuid;
+
+  /* Computes text deltas ahead of the editor drive.  NULL if disabled. */
+  prefetcher_t *prefetcher;
   apr_pool_t *pool;
 } report_baton_t;
 
@@ -662,6 +675,498 @@ send_zero_copy_delta(const unsigned char *contents,
 }
 
 
+/* --- PREFETCHING TEXT DELTAS --- */
+
+/* During a large checkout or update, most of the time is spent computing
+   text deltas for files, one after another.  If enabled, we compute them
+   ahead of time in worker threads, each one using its own FS instance.
+   While the editor drive in the main thread enters a directory, upcoming
+   files in it get queued.  The workers buffer the resulting delta windows,
+   which delta_files() then simply replays in the usual editor order.
+   Otherwise, i.e. for files that have not been processed, yet, or that
+   turned out to be too large to buffer, delta_files() falls back to
+   computing the deltas itself.  Then, the FS caches will still have been
+   primed by the workers.
+
+   The number of files that have been queued but not yet been consumed is
+   limited to PREFETCH_WINDOW_FACTOR times the number of workers. */
+#define PREFETCH_WINDOW_FACTOR 4
+
+/* Maximum amount of delta data to buffer per file. */
+#define PREFETCH_MAX_DELTA_SIZE 0x100000
+
+#if APR_HAS_THREADS
+
+/* Processing state of a prefetch_item_t. */
+typedef enum prefetch_state_t
+{
+  prefetch_queued,
+  prefetch_running,
+  prefetch_done
+} prefetch_state_t;
+
+/* A file whose text delta shall be prefetched. */
+typedef struct prefetch_item_t
+{
+  /* Thread-safe root pool containing this item and its results. */
+  apr_pool_t *pool;
+
+  /* The delta to compute is from S_REV/S_PATH to the target root's
+     T_PATH.  S_PATH may be NULL.  Constant. */
+  const char *t_path;
+  svn_revnum_t s_rev;
+  const char *s_path;
+
+  /* Processing state.  Protected by the prefetcher's mutex. */
+  prefetch_state_t state;
+
+  /* Set by the main thread if it is no longer interested in the results.
+     The item will then be destroyed by the worker.  Protected by the
+     prefetcher's mutex. */
+  svn_boolean_t abandoned;
+
+  /* The following are only valid in prefetch_done state. */
+
+  /* Error returned by the worker. */
+  svn_error_t *err;
+
+  /* Whether the contents differ from the source.  Always TRUE without
+     S_PATH. */
+  svn_boolean_t changed;
+
+  /* MD5 of the source contents.  NULL without S_PATH or if not
+     CHANGED. */
+  const char *s_hex_digest;
+
+  /* The delta windows (svn_txdelta_window_t *).  NULL if text deltas
+     have not been requested or if they have been too large. */
+  apr_array_header_t *windows;
+
+  /* Next item in the prefetcher's queue.  Protected by its mutex. */
+  struct prefetch_item_t *next;
+} prefetch_item_t;
+
+/* A worker thread. */
+typedef struct prefetch_worker_t
+{
+  /* The thread and its private, thread-safe root pool. */
+  apr_thread_t *thread;
+  apr_pool_t *pool;
+
+  /* The worker's own FS instance and target root. */
+  svn_fs_t *fs;
+  svn_fs_root_t *t_root;
+
+  /* Shared state. */
+  prefetcher_t *prefetcher;
+} prefetch_worker_t;
+
+struct prefetcher_t
+{
+  /* Serializes access to all members that are not marked as constant or
+     as being owned by the main thread. */
+  apr_thread_mutex_t *mutex;
+
+  /* Signaled whenever an item got queued or completed. */
+  apr_thread_cond_t *changed;
+
+  /* Set by the main thread when the workers shall terminate. */
+  svn_boolean_t shutdown;
+
+  /* FIFO of items in prefetch_queued state, including abandoned ones. */
+  prefetch_item_t *head;
+  prefetch_item_t *tail;
+
+  /* Maps target paths to all items not yet taken or abandoned by the main
+     thread.  Owned by the main thread. */
+  apr_hash_t *items;
+
+  /* Maximum number of entries in ITEMS.  Constant. */
+  int limit;
+
+  /* The target revision and whether to compute deltas at all.
+     Constant. */
+  svn_revnum_t t_rev;
+  svn_boolean_t text_deltas;
+
+  /* All workers (prefetch_worker_t *).  Owned by the main thread. */
+  apr_array_header_t *workers;
+};
+
+/* Compute the results for ITEM using WORKER's FS.  Allocate them in
+   ITEM->POOL and use SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+prefetch_file(prefetch_worker_t *worker,
+              prefetch_item_t *item,
+              apr_pool_t *scratch_pool)
+{
+  svn_fs_root_t *s_root = NULL;
+  svn_txdelta_stream_t *dstream;
+  apr_pool_t *iterpool;
+  apr_size_t size = 0;
+
+  if (!worker->t_root)
+    SVN_ERR(svn_fs_revision_root(&worker->t_root, worker->fs,
+                                 worker->prefetcher->t_rev, worker->pool));
+
+  item->changed = TRUE;
+  if (item->s_path)
+    {
+      svn_checksum_t *s_checksum;
+
+      SVN_ERR(svn_fs_revision_root(&s_root, worker->fs, item->s_rev,
+                                   scratch_pool));
+      SVN_ERR(svn_fs_contents_different(&item->changed, worker->t_root,
+                                        item->t_path, s_root, item->s_path,
+                                        scratch_pool));
+      if (!item->changed)
+        return SVN_NO_ERROR;
+
+      SVN_ERR(svn_fs_file_checksum(&s_checksum, svn_checksum_md5, s_root,
+                                   item->s_path, TRUE, scratch_pool));
+      item->s_hex_digest = svn_checksum_to_cstring(s_checksum, item->pool);
+    }
+
+  if (!worker->prefetcher->text_deltas)
+    return SVN_NO_ERROR;
+
+  SVN_ERR(svn_fs_get_file_delta_stream(&dstream, s_root, item->s_path,
+                                       worker->t_root, item->t_path,
+                                       scratch_pool));
+
+  item->windows = apr_array_make(item->pool, 4,
+                                 sizeof(svn_txdelta_window_t *));
+  iterpool = svn_pool_create(scratch_pool);
+  while (TRUE)
+    {
+      svn_txdelta_window_t *window;
+
+      svn_pool_clear(iterpool);
+      SVN_ERR(svn_txdelta_next_window(&window, dstream, iterpool));
+      if (!window)
+        break;
+
+      /* Don't hog memory.  The main thread will redo the delta. */
+      size += window->num_ops * sizeof(*window->ops)
+            + (window->new_data ? window->new_data->len : 0);
+      if (size > PREFETCH_MAX_DELTA_SIZE)
+        {
+          item->windows = NULL;
+          break;
+        }
+
+      APR_ARRAY_PUSH(item->windows, svn_txdelta_window_t *)
+        = svn_txdelta_window_dup(window, item->pool);
+    }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+/* Thread function for the prefetch_worker_t given by DATA. */
+static void * APR_THREAD_FUNC
+prefetch_worker_run(apr_thread_t *tid,
+                    void *data)
+{
+  prefetch_worker_t *worker = data;
+  prefetcher_t *prefetcher = worker->prefetcher;
+  apr_pool_t *iterpool = svn_pool_create(worker->pool);
+
+  while (TRUE)
+    {
+      prefetch_item_t *item;
+      svn_boolean_t abandoned;
+      svn_error_t *err;
+
+      svn_pool_clear(iterpool);
+
+      /* Claim the next item that somebody is still interested in. */
+      apr_thread_mutex_lock(prefetcher->mutex);
+      while (!prefetcher->shutdown && !prefetcher->head)
+        apr_thread_cond_wait(prefetcher->changed, prefetcher->mutex);
+
+      item = prefetcher->shutdown ? NULL : prefetcher->head;
+      if (item)
+        {
+          prefetcher->head = item->next;
+          if (!prefetcher->head)
+            prefetcher->tail = NULL;
+
+          item->state = prefetch_running;
+          abandoned = item->abandoned;
+        }
+      apr_thread_mutex_unlock(prefetcher->mutex);
+
+      if (!item)
+        break;
+
+      if (abandoned)
+        {
+          svn_pool_destroy(item->pool);
+          continue;
+        }
+
+      err = prefetch_file(worker, item, iterpool);
+
+      apr_thread_mutex_lock(prefetcher->mutex);
+      item->err = err;
+      item->state = prefetch_done;
+      abandoned = item->abandoned;
+      apr_thread_cond_broadcast(prefetcher->changed);
+      apr_thread_mutex_unlock(prefetcher->mutex);
+
+      if (abandoned)
+        {
+          svn_error_clear(item->err);
+          svn_pool_destroy(item->pool);
+        }
+    }
+
+  svn_pool_destroy(iterpool);
+  apr_thread_exit(tid, APR_SUCCESS);
+
+  return NULL;
+}
+
+/* Stop all workers of B's prefetcher, wait for them to finish and release
+   all resources held by them and the prefetcher. */
+static void
+stop_prefetching(report_baton_t *b)
+{
+  prefetcher_t *prefetcher = b->prefetcher;
+  prefetch_item_t *item;
+  apr_hash_index_t *hi;
+  int i;
+
+  if (!prefetcher)
+    return;
+
+  apr_thread_mutex_lock(prefetcher->mutex);
+  prefetcher->shutdown = TRUE;
+  apr_thread_cond_broadcast(prefetcher->changed);
+  apr_thread_mutex_unlock(prefetcher->mutex);
+
+  for (i = 0; i < prefetcher->workers->nelts; ++i)
+    {
+      prefetch_worker_t *worker
+        = APR_ARRAY_IDX(prefetcher->workers, i, prefetch_worker_t *);
+      apr_status_t retval;
+
+      if (worker->thread)
+        apr_thread_join(&retval, worker->thread);
+
+      svn_pool_destroy(worker->pool);
+    }
+
+  /* Now, all items are either still queued or done. */
+  for (hi = apr_hash_first(b->pool, prefetcher->items); hi;
+       hi = apr_hash_next(hi))
+    {
+      item = apr_hash_this_val(hi);
+      if (item->state == prefetch_done)
+        {
+          svn_error_clear(item->err);
+          svn_pool_destroy(item->pool);
+        }
+    }
+
+  while (prefetcher->head)
+    {
+      item = prefetcher->head;
+      prefetcher->head = item->next;
+      svn_pool_destroy(item->pool);
+    }
+
+  b->prefetcher = NULL;
+}
+
+/* Start B->PREFETCH_JOBS prefetching workers for B, unless prefetching
+   has been disabled.  Use SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+start_prefetching(report_baton_t *b,
+                  apr_pool_t *scratch_pool)
+{
+  prefetcher_t *prefetcher;
+  const char *fs_path = svn_fs_path(b->repos->fs, scratch_pool);
+  apr_hash_t *fs_config = svn_fs_config(b->repos->fs, scratch_pool);
+  svn_error_t *err = SVN_NO_ERROR;
+  apr_status_t status;
+  int i;
+
+  /* The workers share the process-wide caches with us. */
+  if (b->prefetch_jobs < 2 || svn_cache_config_get()->single_threaded)
+    return SVN_NO_ERROR;
+
+  prefetcher = apr_pcalloc(b->pool, sizeof(*prefetcher));
+  status = apr_thread_mutex_create(&prefetcher->mutex,
+                                   APR_THREAD_MUTEX_DEFAULT, b->pool);
+  if (!status)
+    status = apr_thread_cond_create(&prefetcher->changed, b->pool);
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't create prefetch thread sync"));
+
+  prefetcher->items = apr_hash_make(b->pool);
+  prefetcher->limit = PREFETCH_WINDOW_FACTOR * b->prefetch_jobs;
+  prefetcher->t_rev = b->t_rev;
+  prefetcher->text_deltas = b->text_deltas;
+  prefetcher->workers = apr_array_make(b->pool, b->prefetch_jobs,
+                                       sizeof(prefetch_worker_t *));
+  b->prefetcher = prefetcher;
+
+  for (i = 0; i < b->prefetch_jobs && !err; ++i)
+    {
+      prefetch_worker_t *worker;
+      apr_pool_t *worker_pool = svn_pool_create(NULL);
+
+      worker = apr_pcalloc(worker_pool, sizeof(*worker));
+      worker->pool = worker_pool;
+      worker->prefetcher = prefetcher;
+      APR_ARRAY_PUSH(prefetcher->workers, prefetch_worker_t *) = worker;
+
+      err = svn_fs_open2(&worker->fs, fs_path, fs_config, worker_pool,
+                         scratch_pool);
+    }
+
+  for (i = 0; i < prefetcher->workers->nelts && !err; ++i)
+    {
+      prefetch_worker_t *worker
+        = APR_ARRAY_IDX(prefetcher->workers, i, prefetch_worker_t *);
+
+      status = apr_thread_create(&worker->thread, NULL, prefetch_worker_run,
+                                 worker, worker->pool);
+      if (status)
+        err = svn_error_wrap_apr(status, _("Can't create prefetch thread"));
+    }
+
+  if (err)
+    stop_prefetching(b);
+
+  return svn_error_trace(err);
+}
+
+/* Queue the file T_PATH for prefetching its delta against S_REV/S_PATH
+   in B.  S_PATH may be NULL.  Return FALSE in *QUEUED if too many items
+   are pending already. */
+static void
+prefetch_queue_file(svn_boolean_t *queued,
+                    report_baton_t *b,
+                    svn_revnum_t s_rev,
+                    const char *s_path,
+                    const char *t_path)
+{
+  prefetcher_t *prefetcher = b->prefetcher;
+  prefetch_item_t *item;
+  apr_pool_t *item_pool;
+
+  *queued = apr_hash_count(prefetcher->items) < prefetcher->limit;
+  if (!*queued || svn_hash_gets(prefetcher->items, t_path))
+    return;
+
+  item_pool = svn_pool_create(NULL);
+  item = apr_pcalloc(item_pool, sizeof(*item));
+  item->pool = item_pool;
+  item->t_path = apr_pstrdup(item_pool, t_path);
+  item->s_rev = s_rev;
+  item->s_path = s_path ? apr_pstrdup(item_pool, s_path) : NULL;
+  item->state = prefetch_queued;
+
+  svn_hash_sets(prefetcher->items, item->t_path, item);
+
+  apr_thread_mutex_lock(prefetcher->mutex);
+  if (prefetcher->tail)
+    prefetcher->tail->next = item;
+  else
+    prefetcher->head = item;
+  prefetcher->tail = item;
+
+  /* The main thread may be waiting on the same condition. */
+  apr_thread_cond_broadcast(prefetcher->changed);
+  apr_thread_mutex_unlock(prefetcher->mutex);
+}
+
+/* Remove the item for T_PATH from B's prefetcher.  If WAIT is set and a
+   worker is currently processing it, wait for the result.  If a result is
+   available, return the item in *ITEM_P and pass its ownership on to the
+   caller.  Otherwise, set *ITEM_P to NULL. */
+static void
+prefetch_take(prefetch_item_t **item_p,
+              report_baton_t *b,
+              const char *t_path,
+              svn_boolean_t wait)
+{
+  prefetcher_t *prefetcher = b->prefetcher;
+  prefetch_item_t *item = svn_hash_gets(prefetcher->items, t_path);
+
+  *item_p = NULL;
+  if (!item)
+    return;
+
+  svn_hash_sets(prefetcher->items, t_path, NULL);
+
+  apr_thread_mutex_lock(prefetcher->mutex);
+  while (wait && item->state == prefetch_running)
+    apr_thread_cond_wait(prefetcher->changed, prefetcher->mutex);
+
+  if (item->state == prefetch_done)
+    *item_p = item;
+  else
+    item->abandoned = TRUE;
+  apr_thread_mutex_unlock(prefetcher->mutex);
+}
+
+/* Tell B's prefetcher that the item for T_PATH, if any, won't be
+   needed. */
+static void
+prefetch_discard(report_baton_t *b,
+                 const char *t_path)
+{
+  prefetch_item_t *item;
+
+  prefetch_take(&item, b, t_path, FALSE);
+  if (item)
+    {
+      svn_error_clear(item->err);
+      svn_pool_destroy(item->pool);
+    }
+}
+
+/* Send the prefetched contents change ITEM for FILE_BATON to B's editor.
+   Use POOL for temporary allocations. */
+static svn_error_t *
+send_prefetched_delta(report_baton_t *b,
+                      void *file_baton,
+                      const prefetch_item_t *item,
+                      apr_pool_t *pool)
+{
+  svn_txdelta_window_handler_t dhandler;
+  void *dbaton;
+  int i;
+
+  if (!item->changed)
+    return SVN_NO_ERROR;
+
+  SVN_ERR(b->editor->apply_textdelta(file_baton,
+                                     apr_pstrdup(pool, item->s_hex_digest),
+                                     pool, &dhandler, &dbaton));
+
+  if (dhandler != svn_delta_noop_window_handler)
+    {
+      if (b->text_deltas)
+        for (i = 0; i < item->windows->nelts; ++i)
+          SVN_ERR(dhandler(APR_ARRAY_IDX(item->windows, i,
+                                         svn_txdelta_window_t *),
+                           dbaton));
+
+      SVN_ERR(dhandler(NULL, dbaton));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+#endif /* APR_HAS_THREADS */
+
+
 /* Make the appropriate edits on FILE_BATON to change its contents and
    properties from those in S_REV/S_PATH to those in B->t_root/T_PATH,
    possibly using LOCK_TOKEN to determine if the client's lock on the file
@@ -682,6 +1187,37 @@ delta_files(report_baton_t *b, void *file_baton, svn_revnum_t s_rev,
   SVN_ERR(delta_proplists(b, s_rev, s_path, t_path, lock_token,
                           change_file_prop, file_baton, pool));
 
+#if APR_HAS_THREADS
+  /* Use the prefetched contents delta, if it is complete and has been
+     computed against the same source. */
+  if (b->prefetcher)
+    {
+      prefetch_item_t *item;
+
+      prefetch_take(&item, b, t_path, TRUE);
+      if (item)
+        {
+          svn_error_t *err = SVN_NO_ERROR;
+          svn_boolean_t usable
+            = !item->err
+              && (item->windows || !item->changed || !b->text_deltas)
+              && (s_path
+                  ? item->s_path && item->s_rev == s_rev
+                    && strcmp(item->s_path, s_path) == 0
+                  : !item->s_path);
+
+          if (usable)
+            err = send_prefetched_delta(b, file_baton, item, pool);
+
+          svn_error_clear(item->err);
+          svn_pool_destroy(item->pool);
+
+          if (usable)
+            return svn_error_trace(err);
+        }
+    }
+#endif
+
   if (s_path)
     {
       svn_boolean_t changed;
@@ -1099,6 +1635,64 @@ update_entry(report_baton_t *b, svn_revnum_t s_rev, const char *s_path,
 #define DEPTH_BELOW_HERE(depth) ((depth) == svn_depth_immediates) ? \
                                  svn_depth_empty : (depth)
 
+#if APR_HAS_THREADS
+/* Queue files from the target directory entries T_ORDERED_ENTRIES for
+   prefetching in B, starting at index *NEXT, until B's prefetcher does
+   not accept any more items.  Update *NEXT accordingly.  The remaining
+   parameters are the same as for delta_dirs() and are used to predict
+   which source each file will be compared to.  Use SCRATCH_POOL for
+   temporary allocations. */
+static void
+prefetch_entries(report_baton_t *b,
+                 const apr_array_header_t *t_ordered_entries,
+                 int *next,
+                 apr_hash_t *s_entries,
+                 svn_revnum_t s_rev,
+                 const char *s_path,
+                 const char *t_path,
+                 svn_depth_t wc_depth,
+                 svn_depth_t requested_depth,
+                 apr_pool_t *scratch_pool)
+{
+  for (; *next < t_ordered_entries->nelts; ++*next)
+    {
+      const svn_fs_dirent_t *t_entry
+         = APR_ARRAY_IDX(t_ordered_entries, *next, svn_fs_dirent_t *);
+      const svn_fs_dirent_t *s_entry = NULL;
+      svn_boolean_t queued;
+
+      if (t_entry->kind != svn_node_file)
+        continue;
+
+      /* Same selection as in delta_dirs(). */
+      if (!is_depth_upgrade(wc_depth, requested_depth, t_entry->kind))
+        {
+          if (requested_depth == svn_depth_unknown
+              && wc_depth < svn_depth_files)
+            continue;
+
+          s_entry = s_entries ? svn_hash_gets(s_entries, t_entry->name)
+                              : NULL;
+        }
+
+      /* update_entry() won't send deltas for unchanged files nor
+         against sources of a different kind. */
+      if (s_entry && (s_entry->kind != svn_node_file
+                      || svn_fs_compare_ids(s_entry->id, t_entry->id) == 0))
+        continue;
+
+      prefetch_queue_file(&queued, b, s_rev,
+                          s_entry ? svn_fspath__join(s_path, t_entry->name,
+                                                     scratch_pool)
+                                  : NULL,
+                          svn_fspath__join(t_path, t_entry->name,
+                                           scratch_pool));
+      if (!queued)
+        break;
+    }
+}
+#endif
+
 /* Emit edits within directory DIR_BATON (with corresponding path
    E_PATH) with the changes from the directory S_REV/S_PATH to the
    directory B->t_rev/T_PATH.  S_PATH may be NULL if the entry does
@@ -1165,6 +1759,9 @@ delta_dirs(report_baton_t *b, svn_revnum_t s_rev, const char *s_path,
   apr_pool_t *subpool = svn_pool_create(pool);
   apr_array_header_t *t_ordered_entries = NULL;
   int i;
+#if APR_HAS_THREADS
+  int next_prefetch = 0;
+#endif
 
   /* Compare the property lists.  If we're starting empty, pass a NULL
      source path so that we add all the properties.
@@ -1313,6 +1910,19 @@ delta_dirs(report_baton_t *b, svn_revnum_t s_rev, const char *s_path,
 
           svn_pool_clear(iterpool);
 
+#if APR_HAS_THREADS
+          /* Let the workers run ahead of us. */
+          if (b->prefetcher)
+            {
+              if (next_prefetch <= i)
+                next_prefetch = i + 1;
+
+              prefetch_entries(b, t_ordered_entries, &next_prefetch,
+                               s_entries, s_rev, s_path, t_path, wc_depth,
+                               requested_depth, iterpool);
+            }
+#endif
+
           if (is_depth_upgrade(wc_depth, requested_depth, t_entry->kind))
             {
               /* We're making the working copy deeper, pretend the source
@@ -1348,6 +1958,12 @@ delta_dirs(report_baton_t *b, svn_revnum_t s_rev, const char *s_path,
                                DEPTH_BELOW_HERE(wc_depth),
                                DEPTH_BELOW_HERE(requested_depth),
                                iterpool));
+
+#if APR_HAS_THREADS
+          /* Results that update_entry() did not use are obsolete now. */
+          if (b->prefetcher && t_entry->kind == svn_node_file)
+            prefetch_discard(b, t_fullpath);
+#endif
         }
 
       /* iterpool is destroyed by destroying its parent (subpool) below */
@@ -1471,9 +2087,18 @@ finish_report(report_baton_t *b, apr_pool_t *pool)
   for (i = 0; i < NUM_CACHED_SOURCE_ROOTS; i++)
     b->s_roots[i] = NULL;
 
+#if APR_HAS_THREADS
+  /* Prefetching is merely an optimization. */
+  svn_error_clear(start_prefetching(b, pool));
+#endif
+
   {
     svn_error_t *err = svn_error_trace(drive(b, s_rev, info, pool));
 
+#if APR_HAS_THREADS
+    stop_prefetching(b);
+#endif
+
     if (err == SVN_NO_ERROR)
       return svn_error_trace(b->editor->close_edit(b->edit_baton, pool));
 
@@ -1583,7 +2208,7 @@ svn_repos_abort_report(void *baton, apr_pool_t *pool)
 
 
 svn_error_t *
-svn_repos_begin_report3(void **report_baton,
+svn_repos_begin_report4(void **report_baton,
                         svn_revnum_t revnum,
                         svn_repos_t *repos,
                         const char *fs_base,
@@ -1598,6 +2223,7 @@ svn_repos_begin_report3(void **report_baton,
                         svn_repos_authz_func_t authz_read_func,
                         void *authz_read_baton,
                         apr_size_t zero_copy_limit,
+                        int prefetch_jobs,
                         apr_pool_t *pool)
 {
   report_baton_t *b;
@@ -1620,6 +2246,8 @@ svn_repos_begin_report3(void **report_baton,
                           : svn_fspath__join(b->fs_base, s_operand, pool);
   b->text_deltas = text_deltas;
   b->zero_copy_limit = zero_copy_limit;
+  b->prefetch_jobs = prefetch_jobs;
+  b->prefetcher = NULL;
   b->requested_depth = depth;
   b->ignore_ancestry = ignore_ancestry;
   b->send_copyfrom_args = send_copyfrom_args;
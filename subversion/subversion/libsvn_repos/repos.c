@@ -878,6 +878,12 @@ create_conf(svn_repos_t *repos, apr_pool_t *pool)
 "### Unless you specify an absolute path, the file's location is relative"   NL
 "### to the directory containing this file."                                 NL
 "# hooks-env = " SVN_REPOS__CONF_HOOKS_ENV                                   NL
+"### The file-blame option controls whether clients may ask the server to"   NL
+"### calculate 'svn blame' results.  Doing so makes the server read and"     NL
+"### diff every revision of the file in question.  If disabled, clients"     NL
+"### fall back to fetching the file revisions and calculating the blame"     NL
+"### themselves.  Default is true."                                         NL
+"# file-blame = true"                                                        NL
 ""                                                                           NL
 "[sasl]"                                                                     NL
 "### This option specifies whether you want to use the Cyrus SASL"           NL
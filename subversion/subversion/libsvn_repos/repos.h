@@ -70,6 +70,10 @@ extern "C" {
 #define SVN_REPOS__DB_LOCKFILE "db.lock" /* Our Berkeley lockfile. */
 #define SVN_REPOS__DB_LOGS_LOCKFILE "db-logs.lock" /* BDB logs lockfile. */
 
+/* The optional changed-paths log index.  It lives in the db directory
+   and is neither hotcopied nor dumped; svnadmin can rebuild it. */
+#define SVN_REPOS__LOG_INDEX_DB "log-index.db"
+
 /* In the repository hooks directory, look for these files. */
 #define SVN_REPOS__HOOK_START_COMMIT    "start-commit"
 #define SVN_REPOS__HOOK_PRE_COMMIT      "pre-commit"
@@ -363,8 +367,102 @@ svn_repos__hooks_post_unlock(svn_repos_t *repos,
                              apr_pool_t *pool);
 
 
+/*** Changed-paths Log Index ***/
+
+/* The changed-paths log index maps every path that has been touched by
+   a revision to the list of revisions that changed that path or any of
+   its descendants.  It allows svn_repos_get_logs5() to find the
+   interesting revisions on a path's line of history without walking the
+   node history one step at a time.
+
+   It also records the mergeinfo changes of every revision, i.e. which
+   merge sources and revision ranges got merged into which paths in that
+   revision.  Merge-aware log and file-revs use this instead of reading
+   and comparing svn:mergeinfo properties for every revision they visit.
+
+   The index is optional.  It only exists after it has been built with
+   svn_repos__log_index_build() and is then kept up-to-date by
+   svn_repos__log_index_post_commit(). */
+typedef struct svn_repos__log_index_t svn_repos__log_index_t;
+
+/* Open the log index of REPOS for reading and set *INDEX_P to it.
+   Set *INDEXED_REV to the youngest revision covered by the index.
+   If REPOS has no log index, set *INDEX_P to NULL and *INDEXED_REV to
+   SVN_INVALID_REVNUM.
+
+   Allocate the result in RESULT_POOL; the index will be closed when
+   RESULT_POOL gets cleaned up.  Use SCRATCH_POOL for temporaries. */
+svn_error_t *
+svn_repos__log_index_open(svn_repos__log_index_t **index_p,
+                          svn_revnum_t *indexed_rev,
+                          svn_repos_t *repos,
+                          apr_pool_t *result_pool,
+                          apr_pool_t *scratch_pool);
+
+/* Set *CHANGED_REV to the youngest revision in the range (AFTER, UPTO]
+   in which PATH or any of its descendants got changed, according to
+   INDEX.  Set it to SVN_INVALID_REVNUM if there is no such revision.
+   PATH is an fspath.  Use SCRATCH_POOL for temporaries. */
+svn_error_t *
+svn_repos__log_index_youngest_change(svn_revnum_t *changed_rev,
+                                     svn_repos__log_index_t *index,
+                                     const char *path,
+                                     svn_revnum_t after,
+                                     svn_revnum_t upto,
+                                     apr_pool_t *scratch_pool);
+
+/* Like svn_repos__fs_mergeinfo_changed() but use the data recorded in
+   INDEX.  REV must be covered by INDEX.  Return SVN_ERR_MERGEINFO_PARSE_ERROR
+   if REV contains invalid mergeinfo. */
+svn_error_t *
+svn_repos__log_index_mergeinfo_changed(
+  svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
+  svn_mergeinfo_catalog_t *added_mergeinfo_catalog,
+  svn_repos__log_index_t *index,
+  svn_revnum_t rev,
+  apr_pool_t *result_pool,
+  apr_pool_t *scratch_pool);
+
+/* Set *TOUCHED_PATH to the path closest to PATH, i.e. PATH itself or its
+   youngest parent, on which the svn:mergeinfo property may have changed
+   in REV, according to INDEX.  Set it to NULL if there is no such path.
+   Allocate the result in RESULT_POOL and use SCRATCH_POOL for
+   temporaries. */
+svn_error_t *
+svn_repos__log_index_mergeinfo_touched(const char **touched_path,
+                                       svn_repos__log_index_t *index,
+                                       svn_revnum_t rev,
+                                       const char *path,
+                                       apr_pool_t *result_pool,
+                                       apr_pool_t *scratch_pool);
+
+/* Add NEW_REV, which has just been committed to REPOS, to the log index
+   of REPOS.  If REPOS has no log index, this is a no-op.  Revisions
+   that have not been indexed yet, e.g. because they have been created
+   by svnadmin load, are indexed as well as long as there are only few
+   of them.  Otherwise, the index is left behind and will simply not be
+   used until it gets rebuilt.  Use SCRATCH_POOL for temporaries. */
+svn_error_t *
+svn_repos__log_index_post_commit(svn_repos_t *repos,
+                                 svn_revnum_t new_rev,
+                                 apr_pool_t *scratch_pool);
+
+
 /*** Utility Functions ***/
 
+/* Set *DELETED_MERGEINFO_CATALOG and *ADDED_MERGEINFO_CATALOG to
+   catalogs describing how mergeinfo values on paths (which are the
+   keys of those catalogs) were changed in REV of FS.  Allocate the
+   catalogs in RESULT_POOL and use SCRATCH_POOL for temporaries. */
+svn_error_t *
+svn_repos__fs_mergeinfo_changed(
+  svn_mergeinfo_catalog_t *deleted_mergeinfo_catalog,
+  svn_mergeinfo_catalog_t *added_mergeinfo_catalog,
+  svn_fs_t *fs,
+  svn_revnum_t rev,
+  apr_pool_t *result_pool,
+  apr_pool_t *scratch_pool);
+
 /* Set *PREV_PATH and *PREV_REV to the path and revision which
    represent the location at which PATH in FS was located immediately
    prior to REVISION iff there was a copy operation (to PATH or one of
@@ -387,6 +485,28 @@ svn_repos__prev_location(svn_revnum_t *appeared_rev,
                          const char *path,
                          apr_pool_t *pool);
 
+
+/*** Dump stream parsing. ***/
+
+/* Like svn_repos_parse_dumpstream3(), but if READ_AHEAD is larger than 1
+   and APR has thread support, read and parse STREAM in a separate thread.
+   That thread will buffer up to READ_AHEAD revisions ahead of the one
+   PARSE_FNS are currently being invoked for.
+
+   PARSE_FNS and CANCEL_FUNC are only called from the calling thread and
+   in the same order as with svn_repos_parse_dumpstream3().  STREAM is
+   only read from the separate thread. */
+svn_error_t *
+svn_repos__parse_dumpstream_concurrently(
+                              svn_stream_t *stream,
+                              const svn_repos_parse_fns3_t *parse_fns,
+                              void *parse_baton,
+                              svn_boolean_t deltas_are_text,
+                              int read_ahead,
+                              svn_cancel_func_t cancel_func,
+                              void *cancel_baton,
+                              apr_pool_t *pool);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
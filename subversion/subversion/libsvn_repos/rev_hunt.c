@@ -1001,10 +1001,13 @@ struct path_revision
 /* Check for merges in OLD_PATH_REV->PATH at OLD_PATH_REV->REVNUM.  Store
    the mergeinfo difference in *MERGED_MERGEINFO, allocated in POOL.  The
    difference is the union of both additions and (negated) deletions.  The
-   returned *MERGED_MERGEINFO will be NULL if there are no changes. */
+   returned *MERGED_MERGEINFO will be NULL if there are no changes.
+   If LOG_INDEX is not NULL, use it to find mergeinfo changes instead of
+   scanning the changed paths list. */
 static svn_error_t *
 get_merged_mergeinfo(apr_hash_t **merged_mergeinfo,
                      svn_repos_t *repos,
+                     svn_repos__log_index_t *log_index,
                      struct path_revision *old_path_rev,
                      apr_pool_t *result_pool,
                      apr_pool_t *scratch_pool)
@@ -1022,23 +1025,35 @@ get_merged_mergeinfo(apr_hash_t **merged_mergeinfo,
      if there is a property change. */
   SVN_ERR(svn_fs_revision_root(&root, repos->fs, old_path_rev->revnum,
                                scratch_pool));
-  SVN_ERR(svn_fs_paths_changed3(&iterator, root, scratch_pool, scratch_pool));
-  SVN_ERR(svn_fs_path_change_get(&change, iterator));
-
-  /* Find the changed PATH closest to START_PATH which may have a mergeinfo
-   * change. */
-  while (change)
+  if (log_index)
     {
-      if (   change->prop_mod
-          && change->mergeinfo_mod != svn_tristate_false
-          && svn_fspath__skip_ancestor(change->path.data, start_path))
+      SVN_ERR(svn_repos__log_index_mergeinfo_touched(&path, log_index,
+                                                     old_path_rev->revnum,
+                                                     start_path,
+                                                     scratch_pool,
+                                                     scratch_pool));
+    }
+  else
+    {
+      SVN_ERR(svn_fs_paths_changed3(&iterator, root, scratch_pool,
+                                    scratch_pool));
+      SVN_ERR(svn_fs_path_change_get(&change, iterator));
+
+      /* Find the changed PATH closest to START_PATH which may have a
+       * mergeinfo change. */
+      while (change)
         {
-          if (!path || svn_fspath__skip_ancestor(path, change->path.data))
-            path = apr_pstrmemdup(scratch_pool, change->path.data,
-                                  change->path.len);
-        }
+          if (   change->prop_mod
+              && change->mergeinfo_mod != svn_tristate_false
+              && svn_fspath__skip_ancestor(change->path.data, start_path))
+            {
+              if (!path || svn_fspath__skip_ancestor(path, change->path.data))
+                path = apr_pstrmemdup(scratch_pool, change->path.data,
+                                      change->path.len);
+            }
 
-      SVN_ERR(svn_fs_path_change_get(&change, iterator));
+          SVN_ERR(svn_fs_path_change_get(&change, iterator));
+        }
     }
 
   if (path == NULL)
@@ -1110,6 +1125,7 @@ get_merged_mergeinfo(apr_hash_t **merged_mergeinfo,
 static svn_error_t *
 find_interesting_revisions(apr_array_header_t *path_revisions,
                            svn_repos_t *repos,
+                           svn_repos__log_index_t *log_index,
                            const char *path,
                            svn_revnum_t start,
                            svn_revnum_t end,
@@ -1188,7 +1204,8 @@ find_interesting_revisions(apr_array_header_t *path_revisions,
 
       if (include_merged_revisions)
         SVN_ERR(get_merged_mergeinfo(&path_rev->merged_mergeinfo, repos,
-                                     path_rev, result_pool, iterpool));
+                                     log_index, path_rev, result_pool,
+                                     iterpool));
       else
         path_rev->merged_mergeinfo = NULL;
 
@@ -1233,6 +1250,7 @@ find_merged_revisions(apr_array_header_t **merged_path_revisions_out,
                       svn_revnum_t start,
                       const apr_array_header_t *mainline_path_revisions,
                       svn_repos_t *repos,
+                      svn_repos__log_index_t *log_index,
                       apr_hash_t *duplicate_path_revs,
                       svn_repos_authz_func_t authz_read_func,
                       void *authz_read_baton,
@@ -1303,7 +1321,7 @@ find_merged_revisions(apr_array_header_t **merged_path_revisions_out,
 
                   /* Search and find revisions to add to the NEW list. */
                   SVN_ERR(find_interesting_revisions(new_merged_path_revs,
-                                                     repos, path,
+                                                     repos, log_index, path,
                                                      range->start, range->end,
                                                      TRUE, TRUE,
                                                      duplicate_path_revs,
@@ -1620,6 +1638,7 @@ svn_repos_get_file_revs2(svn_repos_t *repos,
 {
   apr_array_header_t *mainline_path_revisions, *merged_path_revisions;
   apr_hash_t *duplicate_path_revs;
+  svn_repos__log_index_t *log_index = NULL;
   struct send_baton sb;
   int mainline_pos, merged_pos;
 
@@ -1670,11 +1689,30 @@ svn_repos_get_file_revs2(svn_repos_t *repos,
    * may be needed. */
   sb.include_merged_revisions = include_merged_revisions;
 
+  /* The log index, if present and up-to-date, tells us which revisions
+     changed mergeinfo without having to scan their changed paths lists.
+     It is only an accelerator, so silently fall back if we can't use it. */
+  if (include_merged_revisions)
+    {
+      svn_revnum_t indexed_rev;
+      svn_error_t *err = svn_repos__log_index_open(&log_index, &indexed_rev,
+                                                   repos, scratch_pool,
+                                                   scratch_pool);
+      if (err)
+        {
+          svn_error_clear(err);
+          log_index = NULL;
+        }
+      else if (log_index && indexed_rev < end)
+        log_index = NULL;
+    }
+
   /* Get the revisions we are interested in. */
   duplicate_path_revs = apr_hash_make(scratch_pool);
   mainline_path_revisions = apr_array_make(scratch_pool, 100,
                                            sizeof(struct path_revision *));
-  SVN_ERR(find_interesting_revisions(mainline_path_revisions, repos, path,
+  SVN_ERR(find_interesting_revisions(mainline_path_revisions, repos,
+                                     log_index, path,
                                      start, end, include_merged_revisions,
                                      FALSE, duplicate_path_revs,
                                      authz_read_func, authz_read_baton,
@@ -1683,7 +1721,7 @@ svn_repos_get_file_revs2(svn_repos_t *repos,
   /* If we are including merged revisions, go get those, too. */
   if (include_merged_revisions)
     SVN_ERR(find_merged_revisions(&merged_path_revisions, start,
-                                  mainline_path_revisions, repos,
+                                  mainline_path_revisions, repos, log_index,
                                   duplicate_path_revs, authz_read_func,
                                   authz_read_baton,
                                   scratch_pool, sb.iterpool));
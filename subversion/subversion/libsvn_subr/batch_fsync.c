@@ -23,13 +23,13 @@
 #include <apr_thread_pool.h>
 #include <apr_thread_cond.h>
 
-#include "batch_fsync.h"
 #include "svn_pools.h"
 #include "svn_hash.h"
 #include "svn_dirent_uri.h"
 #include "svn_private_config.h"
 
 #include "private/svn_atomic.h"
+#include "private/svn_batch_fsync.h"
 #include "private/svn_dep_compat.h"
 #include "private/svn_mutex.h"
 #include "private/svn_subr_private.h"
@@ -177,7 +177,7 @@ waitable_counter__reset(waitable_counter_t *counter)
   return SVN_NO_ERROR;
 }
 
-/* Entry type for the svn_fs_x__batch_fsync_t collection.  There is one
+/* Entry type for the svn_batch_fsync__t collection.  There is one
  * instance per file handle.
  */
 typedef struct to_sync_t
@@ -197,7 +197,7 @@ typedef struct to_sync_t
 } to_sync_t;
 
 /* The actual collection object. */
-struct svn_fs_x__batch_fsync_t
+struct svn_batch_fsync__t
 {
   /* Maps open file handles: C-string path to to_sync_t *. */
   apr_hash_t *files;
@@ -259,7 +259,7 @@ thread_pool_pre_cleanup(void *data)
 
 #endif
 
-/* Core implementation of svn_fs_x__batch_fsync_init. */
+/* Core implementation of svn_batch_fsync__init. */
 static svn_error_t *
 create_thread_pool(void *baton,
                    apr_pool_t *owning_pool)
@@ -272,7 +272,7 @@ create_thread_pool(void *baton,
   /* This thread pool will get cleaned up automatically when GLOBAL_POOL
      gets cleared.  No additional cleanup callback is needed. */
   WRAP_APR_ERR(apr_thread_pool_create(&thread_pool, 0, MAX_THREADS, pool),
-               _("Can't create fsync thread pool in FSX"));
+               _("Can't create fsync thread pool"));
 
   /* Work around an APR bug:  The cleanup must happen in the pre-cleanup
      hook instead of the normal cleanup hook.  Otherwise, the sub-pools
@@ -293,7 +293,7 @@ create_thread_pool(void *baton,
 }
 
 svn_error_t *
-svn_fs_x__batch_fsync_init(apr_pool_t *owning_pool)
+svn_batch_fsync__init(apr_pool_t *owning_pool)
 {
   /* Protect against multiple calls. */
   return svn_error_trace(svn_atomic__init_once(&thread_pool_initialized,
@@ -301,12 +301,12 @@ svn_fs_x__batch_fsync_init(apr_pool_t *owning_pool)
                                                NULL, owning_pool));
 }
 
-/* Destructor for svn_fs_x__batch_fsync_t.  Releases all global pool memory
+/* Destructor for svn_batch_fsync__t.  Releases all global pool memory
  * and closes all open file handles. */
 static apr_status_t
 fsync_batch_cleanup(void *data)
 {
-  svn_fs_x__batch_fsync_t *batch = data;
+  svn_batch_fsync__t *batch = data;
   apr_hash_index_t *hi;
 
   /* Close all files (implicitly) and release memory. */
@@ -322,11 +322,11 @@ fsync_batch_cleanup(void *data)
 }
 
 svn_error_t *
-svn_fs_x__batch_fsync_create(svn_fs_x__batch_fsync_t **result_p,
-                             svn_boolean_t flush_to_disk,
-                             apr_pool_t *result_pool)
+svn_batch_fsync__create(svn_batch_fsync__t **result_p,
+                        svn_boolean_t flush_to_disk,
+                        apr_pool_t *result_pool)
 {
-  svn_fs_x__batch_fsync_t *result = apr_pcalloc(result_pool, sizeof(*result));
+  svn_batch_fsync__t *result = apr_pcalloc(result_pool, sizeof(*result));
   result->files = svn_hash__make(result_pool);
   result->flush_to_disk = flush_to_disk;
 
@@ -345,7 +345,7 @@ svn_fs_x__batch_fsync_create(svn_fs_x__batch_fsync_t **result_p,
  */
 static svn_error_t *
 internal_open_file(apr_file_t **file,
-                   svn_fs_x__batch_fsync_t *batch,
+                   svn_batch_fsync__t *batch,
                    const char *path,
                    apr_int32_t flags,
                    apr_pool_t *scratch_pool)
@@ -370,7 +370,7 @@ internal_open_file(apr_file_t **file,
    * exists.  If it doesn't, be sure to schedule parent folder updates, if
    * required on this platform.
    *
-   * See svn_fs_x__batch_fsync_new_path() for when such extra fsyncs may be
+   * See svn_batch_fsync__new_path() for when such extra fsyncs may be
    * needed at all. */
 
 #ifdef SVN_ON_POSIX
@@ -414,7 +414,7 @@ internal_open_file(apr_file_t **file,
 #ifdef SVN_ON_POSIX
 
   if (is_new_file)
-    SVN_ERR(svn_fs_x__batch_fsync_new_path(batch, path, scratch_pool));
+    SVN_ERR(svn_batch_fsync__new_path(batch, path, scratch_pool));
 
 #endif
 
@@ -422,10 +422,10 @@ internal_open_file(apr_file_t **file,
 }
 
 svn_error_t *
-svn_fs_x__batch_fsync_open_file(apr_file_t **file,
-                                svn_fs_x__batch_fsync_t *batch,
-                                const char *filename,
-                                apr_pool_t *scratch_pool)
+svn_batch_fsync__open_file(apr_file_t **file,
+                           svn_batch_fsync__t *batch,
+                           const char *filename,
+                           apr_pool_t *scratch_pool)
 {
   apr_off_t offset = 0;
 
@@ -437,9 +437,32 @@ svn_fs_x__batch_fsync_open_file(apr_file_t **file,
 }
 
 svn_error_t *
-svn_fs_x__batch_fsync_new_path(svn_fs_x__batch_fsync_t *batch,
-                               const char *path,
-                               apr_pool_t *scratch_pool)
+svn_batch_fsync__add_file(svn_batch_fsync__t *batch,
+                          const char *filename,
+                          apr_pool_t *scratch_pool)
+{
+  apr_file_t *file;
+
+  /* We must not require write access to FILENAME.  flush_file() takes
+   * care of platforms that can't flush read-only handles. */
+  SVN_ERR(internal_open_file(&file, batch, filename, APR_READ,
+                             scratch_pool));
+
+#ifdef SVN_ON_POSIX
+
+  /* We can't tell whether the file is new, so always schedule its
+   * directory entry. */
+  SVN_ERR(svn_batch_fsync__new_path(batch, filename, scratch_pool));
+
+#endif
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_batch_fsync__new_path(svn_batch_fsync__t *batch,
+                          const char *path,
+                          apr_pool_t *scratch_pool)
 {
   apr_file_t *file;
 
@@ -466,6 +489,58 @@ svn_fs_x__batch_fsync_new_path(svn_fs_x__batch_fsync_t *batch,
   return SVN_NO_ERROR;
 }
 
+/* Flush FILE to disk.  Use SCRATCH_POOL for temporary allocations.
+ *
+ * fsync() works on read-only handles but Windows' FlushFileBuffers()
+ * needs write access.  There, flush handles opened read-only through
+ * a temporary writable handle.  If the file itself is read-only, clear
+ * that flag for as long as we need it, like svn_io_file_rename2() does.
+ */
+static svn_error_t *
+flush_file(apr_file_t *file,
+           apr_pool_t *scratch_pool)
+{
+#ifdef WIN32
+  if (!(apr_file_flags_get(file) & APR_WRITE))
+    {
+      const char *path;
+      apr_file_t *writable;
+      svn_boolean_t was_read_only = FALSE;
+      svn_error_t *err;
+
+      SVN_ERR(svn_io_file_name_get(&path, file, scratch_pool));
+      err = svn_io_file_open(&writable, path, APR_WRITE, APR_OS_DEFAULT,
+                             scratch_pool);
+      if (err && APR_STATUS_IS_EACCES(err->apr_err))
+        {
+          svn_error_clear(err);
+          SVN_ERR(svn_io_set_file_read_write(path, FALSE, scratch_pool));
+          was_read_only = TRUE;
+
+          err = svn_io_file_open(&writable, path, APR_WRITE, APR_OS_DEFAULT,
+                                 scratch_pool);
+        }
+
+      if (!err)
+        {
+          err = svn_io_file_flush_to_disk(writable, scratch_pool);
+          err = svn_error_compose_create(err,
+                                         svn_io_file_close(writable,
+                                                           scratch_pool));
+        }
+
+      if (was_read_only)
+        err = svn_error_compose_create(err,
+                                       svn_io_set_file_read_only(path, FALSE,
+                                                                 scratch_pool));
+
+      return svn_error_trace(err);
+    }
+#endif
+
+  return svn_error_trace(svn_io_file_flush_to_disk(file, scratch_pool));
+}
+
 /* Thread-pool task Flush the to_sync_t instance given by DATA. */
 static void * APR_THREAD_FUNC
 flush_task(apr_thread_t *tid,
@@ -473,8 +548,8 @@ flush_task(apr_thread_t *tid,
 {
   to_sync_t *to_sync = data;
 
-  to_sync->result = svn_error_trace(svn_io_file_flush_to_disk
-                                        (to_sync->file, to_sync->pool));
+  to_sync->result = svn_error_trace(flush_file(to_sync->file,
+                                               to_sync->pool));
 
   /* As soon as the increment call returns, TO_SYNC may be invalid
      (the main thread may have woken up and released the struct.
@@ -489,8 +564,8 @@ flush_task(apr_thread_t *tid,
 }
 
 svn_error_t *
-svn_fs_x__batch_fsync_run(svn_fs_x__batch_fsync_t *batch,
-                          apr_pool_t *scratch_pool)
+svn_batch_fsync__run(svn_batch_fsync__t *batch,
+                     apr_pool_t *scratch_pool)
 {
   apr_hash_index_t *hi;
 
@@ -553,9 +628,8 @@ svn_fs_x__batch_fsync_run(svn_fs_x__batch_fsync_t *batch,
 #endif
 
             {
-              to_sync->result = svn_error_trace(svn_io_file_flush_to_disk
-                                                  (to_sync->file,
-                                                   to_sync->pool));
+              to_sync->result = svn_error_trace(flush_file(to_sync->file,
+                                                           to_sync->pool));
             }
         }
     }
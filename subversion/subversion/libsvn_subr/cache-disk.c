@@ -0,0 +1,1092 @@
+/*
+ * cache-disk.c: persistent, memory-mapped second-level cache
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include <apr_mmap.h>
+#include <apr_strings.h>
+
+#include "svn_pools.h"
+#include "svn_hash.h"
+#include "svn_dirent_uri.h"
+#include "svn_io.h"
+#include "svn_version.h"
+
+#include "svn_private_config.h"
+#include "private/svn_atomic.h"
+#include "private/svn_mutex.h"
+#include "private/svn_subr_private.h"
+
+#include "cache.h"
+
+/* A note on the design:
+ *
+ * The disk cache is a single file of fixed size that gets memory-mapped
+ * by every process using it.  It consists of three sections:
+ *
+ * - a small header identifying the file format and holding the write
+ *   position within the data section,
+ * - a 4-way associative index mapping 64 bit key hashes to records and
+ * - the data section, used as a ring buffer of variable-sized records.
+ *
+ * New records are always appended at the write position, wrapping around
+ * at the end of the data section.  Old records simply get overwritten.
+ * Index entries pointing to them are not cleaned up but become invalid
+ * automatically because every record carries its key hash, its full key
+ * and a checksum over its contents.  A reader copies the record first and
+ * verifies it afterwards.  Hence, readers never need to take a lock, and
+ * a torn write - be it due to a concurrent writer or a crash - simply
+ * results in a cache miss.
+ *
+ * Writers serialize on an in-process mutex plus an exclusive file lock.
+ * Record contents are written through the file handle rather than the
+ * mapping such that running out of disk space gets reported as an error
+ * instead of faulting on a page of a sparse file.  Only the header and
+ * the index, which are allocated when the file gets initialized, are
+ * modified through the mapping.
+ *
+ * The file is a mere cache.  Its contents are never synced to disk
+ * explicitly and it gets reset whenever its header does not match the
+ * expected format or size.  The cached items are serialized data
+ * structures whose layout may change between releases and depends on
+ * the pointer size.  Therefore, the header also records the version and
+ * the pointer size of the build that wrote it and any other build resets
+ * the file as well.
+ */
+
+#if APR_HAS_MMAP
+
+/* Identifies the file format.  Bump the number when changing it. */
+#define DISK_CACHE_MAGIC "svnDC02"
+
+/* Written in native byte order; used to detect files from other
+ * platforms sharing the same storage. */
+#define BYTE_ORDER_MARK 0x01020304
+
+/* Number of entries per index group. */
+#define GROUP_SIZE 4
+
+/* We assume records to be this large on average when deciding on the
+ * number of index entries. */
+#define AVERAGE_RECORD_SIZE 0x2000
+
+/* Alignment of the data section and of the records within it. */
+#define SECTION_ALIGNMENT 0x1000
+#define RECORD_ALIGNMENT 8
+
+/* Disk caches smaller than this do not make sense. */
+#define MIN_DISK_CACHE_SIZE 0x100000
+
+/* Larger records would evict too much of the other cache contents. */
+#define MAX_RECORD_SIZE_RATIO 16
+
+/* File header.  Lives at offset 0 in the file.
+ */
+typedef struct disk_header_t
+{
+  /* DISK_CACHE_MAGIC including the terminating NUL. */
+  char magic[8];
+
+  /* BYTE_ORDER_MARK */
+  apr_uint32_t byte_order;
+
+  /* sizeof(void *) of the build that wrote the file. */
+  apr_uint32_t pointer_size;
+
+  /* SVN_VER_NUMBER of the build that wrote the file, NUL-padded. */
+  char version[32];
+
+  /* Number of index groups of GROUP_SIZE entries each. */
+  apr_uint32_t group_count;
+
+  /* Keeps the following members at the same offsets in all builds. */
+  apr_uint32_t reserved;
+
+  /* Total size of the file in bytes. */
+  apr_uint64_t file_size;
+
+  /* Offset of the data section within the file. */
+  apr_uint64_t data_offset;
+
+  /* Size of the data section in bytes. */
+  apr_uint64_t data_size;
+
+  /* Offset within the data section at which to write the next record. */
+  apr_uint64_t write_pos;
+} disk_header_t;
+
+/* Index entry.  Unused entries have a HASH of 0.
+ */
+typedef struct disk_entry_t
+{
+  /* Hash over the full key. */
+  apr_uint64_t hash;
+
+  /* Offset of the record within the data section. */
+  apr_uint64_t offset;
+
+  /* Size of the record incl. its header and padding. */
+  apr_uint64_t size;
+} disk_entry_t;
+
+/* Header of each record in the data section.  The key follows directly,
+ * then the data.
+ */
+typedef struct record_header_t
+{
+  /* Hash over the full key.  Must match the index entry. */
+  apr_uint64_t hash;
+
+  /* svn__fnv1a_64x4 over the data. */
+  apr_uint64_t checksum;
+
+  /* Length of the key in bytes. */
+  apr_uint32_t key_len;
+
+  /* Length of the data in bytes. */
+  apr_uint32_t data_len;
+} record_header_t;
+
+/* The disk cache object.  All members are constant after creation, the
+ * file contents are being modified under MUTEX and the file lock only.
+ */
+struct svn_cache__disk_t
+{
+  /* Absolute path of the cache file. */
+  const char *path;
+
+  /* Open handle to the cache file.  Used for locking and for writing
+   * record contents. */
+  apr_file_t *file;
+
+  /* Mapping of the whole file. */
+  apr_mmap_t *mmap;
+
+  /* Pointers into the mapping. */
+  disk_header_t *header;
+  disk_entry_t *entries;
+  const char *data;
+
+  /* Copies of the respective header values. */
+  apr_uint32_t group_count;
+  apr_uint64_t data_offset;
+  apr_uint64_t data_size;
+
+  /* Largest record that we accept. */
+  apr_uint64_t max_record_size;
+
+  /* Serializes writers within this process.  fcntl() locks don't. */
+  svn_mutex__t *mutex;
+};
+
+/* All disk caches opened in this process, keyed by absolute path.
+ * Access is serialized by DISK_CACHES_MUTEX.  Allocated in
+ * DISK_CACHES_POOL, which lives until the end of the process.
+ */
+static volatile svn_atomic_t disk_caches_init_state = 0;
+static svn_mutex__t *disk_caches_mutex = NULL;
+static apr_pool_t *disk_caches_pool = NULL;
+static apr_hash_t *disk_caches = NULL;
+
+/* Implements svn_atomic__err_init_func_t. */
+static svn_error_t *
+init_disk_caches(void *baton,
+                 apr_pool_t *pool)
+{
+  disk_caches_pool = svn_pool_create(NULL);
+  disk_caches = apr_hash_make(disk_caches_pool);
+  SVN_ERR(svn_mutex__init(&disk_caches_mutex, TRUE, disk_caches_pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Return the size of a record with KEY_LEN and DATA_LEN, incl. padding.
+ */
+static apr_uint64_t
+record_size(apr_size_t key_len,
+            apr_size_t data_len)
+{
+  apr_uint64_t size = (apr_uint64_t)sizeof(record_header_t)
+                    + key_len + data_len;
+
+  return (size + RECORD_ALIGNMENT - 1) & ~(apr_uint64_t)(RECORD_ALIGNMENT - 1);
+}
+
+/* Return the hash over the LEN bytes of KEY.  Never 0.
+ */
+static apr_uint64_t
+key_hash(const void *key,
+         apr_size_t len)
+{
+  apr_uint64_t hash = svn__fnv1a_64x4(key, len);
+  return hash ? hash : 1;
+}
+
+/* Fill *HEADER with the layout of a cache file of SIZE bytes.
+ */
+static void
+init_header(disk_header_t *header,
+            apr_uint64_t size)
+{
+  apr_uint64_t groups = size / (GROUP_SIZE * AVERAGE_RECORD_SIZE);
+  apr_uint64_t index_end;
+
+  if (groups < 16)
+    groups = 16;
+  if (groups > APR_UINT32_MAX)
+    groups = APR_UINT32_MAX;
+
+  index_end = sizeof(*header) + groups * GROUP_SIZE * sizeof(disk_entry_t);
+
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, DISK_CACHE_MAGIC, sizeof(header->magic));
+  header->byte_order = BYTE_ORDER_MARK;
+  header->pointer_size = sizeof(void *);
+  apr_cpystrn(header->version, SVN_VER_NUMBER, sizeof(header->version));
+  header->group_count = (apr_uint32_t)groups;
+  header->file_size = size;
+  header->data_offset = (index_end + SECTION_ALIGNMENT - 1)
+                      & ~(apr_uint64_t)(SECTION_ALIGNMENT - 1);
+  header->data_size = size - header->data_offset;
+  header->write_pos = 0;
+}
+
+/* Return TRUE, if the file header at ACTUAL matches EXPECTED except for
+ * the write position, which must merely be valid.
+ */
+static svn_boolean_t
+header_matches(const disk_header_t *actual,
+               const disk_header_t *expected)
+{
+  return memcmp(actual->magic, expected->magic, sizeof(actual->magic)) == 0
+      && actual->byte_order == expected->byte_order
+      && actual->pointer_size == expected->pointer_size
+      && memcmp(actual->version, expected->version,
+                sizeof(actual->version)) == 0
+      && actual->group_count == expected->group_count
+      && actual->file_size == expected->file_size
+      && actual->data_offset == expected->data_offset
+      && actual->data_size == expected->data_size
+      && actual->write_pos <= expected->data_size;
+}
+
+/* Acquire the exclusive file lock on DISK.  The in-process mutex must
+ * already be held.  Use SCRATCH_POOL for temporary allocations.
+ */
+static svn_error_t *
+lock_file(svn_cache__disk_t *disk,
+          apr_pool_t *scratch_pool)
+{
+  apr_status_t status = apr_file_lock(disk->file, APR_FLOCK_EXCLUSIVE);
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't lock disk cache '%s'"),
+                              svn_dirent_local_style(disk->path,
+                                                     scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Release the file lock on DISK and return ERR.  Use SCRATCH_POOL for
+ * temporary allocations.
+ */
+static svn_error_t *
+unlock_file(svn_cache__disk_t *disk,
+            svn_error_t *err,
+            apr_pool_t *scratch_pool)
+{
+  apr_status_t status = apr_file_unlock(disk->file);
+  if (status && !err)
+    return svn_error_wrap_apr(status, _("Can't unlock disk cache '%s'"),
+                              svn_dirent_local_style(disk->path,
+                                                     scratch_pool));
+
+  return err;
+}
+
+/* Reset the contents of the cache file in DISK according to EXPECTED.
+ * The file lock must be held.  Use SCRATCH_POOL for temporaries.
+ */
+static svn_error_t *
+reset_file(svn_cache__disk_t *disk,
+           const disk_header_t *expected,
+           apr_pool_t *scratch_pool)
+{
+  apr_uint64_t to_clear = expected->data_offset;
+  apr_size_t chunk_size = 0x10000;
+  char *zeros = apr_pcalloc(scratch_pool, chunk_size);
+  apr_off_t offset = 0;
+  disk_header_t header = *expected;
+
+  /* Clear header and index through the file handle.  This allocates the
+   * disk space for them, too. */
+  SVN_ERR(svn_io_file_seek(disk->file, APR_SET, &offset, scratch_pool));
+  while (to_clear > 0)
+    {
+      apr_size_t to_write = to_clear > chunk_size
+                          ? chunk_size
+                          : (apr_size_t)to_clear;
+      SVN_ERR(svn_io_file_write_full(disk->file, zeros, to_write, NULL,
+                                     scratch_pool));
+      to_clear -= to_write;
+    }
+
+  /* Write the magic last.  If we crash before that, the next process will
+   * simply reset the file again. */
+  memset(header.magic, 0, sizeof(header.magic));
+  *disk->header = header;
+  memcpy(disk->header->magic, expected->magic, sizeof(expected->magic));
+
+  return SVN_NO_ERROR;
+}
+
+/* Open the cache file at PATH and map it into memory.  Make sure it is
+ * SIZE bytes large and has a valid layout.  Return the new cache object
+ * in *DISK_P, allocated in RESULT_POOL.  Use SCRATCH_POOL for temporaries.
+ */
+static svn_error_t *
+open_disk_cache(svn_cache__disk_t **disk_p,
+                const char *path,
+                apr_uint64_t size,
+                apr_pool_t *result_pool,
+                apr_pool_t *scratch_pool)
+{
+  svn_cache__disk_t *disk = apr_pcalloc(result_pool, sizeof(*disk));
+  disk_header_t expected;
+  svn_filesize_t file_size;
+  apr_status_t status;
+  svn_error_t *err;
+
+  init_header(&expected, size);
+
+  disk->path = apr_pstrdup(result_pool, path);
+  SVN_ERR(svn_mutex__init(&disk->mutex, TRUE, result_pool));
+  SVN_ERR(svn_io_file_open(&disk->file, path,
+                           APR_READ | APR_WRITE | APR_CREATE | APR_BINARY,
+                           APR_OS_DEFAULT, result_pool));
+
+  status = apr_file_lock(disk->file, APR_FLOCK_EXCLUSIVE);
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't lock disk cache '%s'"),
+                              svn_dirent_local_style(path, scratch_pool));
+
+  /* Bring the file to the desired size.  Never shrink it, though, as other
+   * processes may still have it mapped. */
+  err = svn_io_file_size_get(&file_size, disk->file, scratch_pool);
+  if (!err && (apr_uint64_t)file_size > size
+      && (   sizeof(apr_size_t) >= sizeof(apr_uint64_t)
+          || (apr_uint64_t)file_size <= APR_SIZE_MAX))
+    {
+      size = (apr_uint64_t)file_size;
+      init_header(&expected, size);
+    }
+  else if (!err && (apr_uint64_t)file_size < size)
+    {
+      err = svn_io_file_trunc(disk->file, (apr_off_t)size, scratch_pool);
+    }
+
+  /* Map the whole thing and verify the layout. */
+  if (!err)
+    {
+      status = apr_mmap_create(&disk->mmap, disk->file, 0, (apr_size_t)size,
+                               APR_MMAP_READ | APR_MMAP_WRITE, result_pool);
+      if (status)
+        err = svn_error_wrap_apr(status, _("Can't map disk cache '%s'"),
+                                 svn_dirent_local_style(path, scratch_pool));
+    }
+
+  if (!err)
+    {
+      disk->header = disk->mmap->mm;
+      if (!header_matches(disk->header, &expected))
+        err = reset_file(disk, &expected, scratch_pool);
+    }
+
+  status = apr_file_unlock(disk->file);
+  if (status && !err)
+    err = svn_error_wrap_apr(status, _("Can't unlock disk cache '%s'"),
+                             svn_dirent_local_style(path, scratch_pool));
+  SVN_ERR(err);
+
+  disk->entries = (disk_entry_t *)((char *)disk->mmap->mm
+                                   + sizeof(disk_header_t));
+  disk->data = (const char *)disk->mmap->mm + expected.data_offset;
+  disk->group_count = expected.group_count;
+  disk->data_offset = expected.data_offset;
+  disk->data_size = expected.data_size;
+  disk->max_record_size = expected.data_size / MAX_RECORD_SIZE_RATIO;
+
+  *disk_p = disk;
+
+  return SVN_NO_ERROR;
+}
+
+/* Set *DISK_P to the disk cache instance for ABSPATH, opening the file
+ * with SIZE bytes if we have not done so before.  The caller must hold
+ * DISK_CACHES_MUTEX.  Use SCRATCH_POOL for temporary allocations.
+ */
+static svn_error_t *
+find_or_open_disk_cache(svn_cache__disk_t **disk_p,
+                        const char *abspath,
+                        apr_uint64_t size,
+                        apr_pool_t *scratch_pool)
+{
+  apr_pool_t *result_pool;
+  svn_error_t *err;
+
+  *disk_p = svn_hash_gets(disk_caches, abspath);
+  if (*disk_p)
+    return SVN_NO_ERROR;
+
+  /* Don't leak file handles and mappings upon failure. */
+  result_pool = svn_pool_create(disk_caches_pool);
+  err = open_disk_cache(disk_p, abspath, size, result_pool, scratch_pool);
+  if (err)
+    {
+      svn_pool_destroy(result_pool);
+      return svn_error_trace(err);
+    }
+
+  svn_hash_sets(disk_caches, (*disk_p)->path, *disk_p);
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_cache__get_disk_cache(svn_cache__disk_t **disk_p,
+                          const char *path,
+                          apr_uint64_t size,
+                          apr_pool_t *scratch_pool)
+{
+  const char *abspath;
+
+  SVN_ERR(svn_atomic__init_once(&disk_caches_init_state, init_disk_caches,
+                                NULL, scratch_pool));
+  SVN_ERR(svn_dirent_get_absolute(&abspath, path, scratch_pool));
+
+  /* Keep the mapping addressable on 32 bit systems. */
+  if (size < MIN_DISK_CACHE_SIZE)
+    size = MIN_DISK_CACHE_SIZE;
+  if (sizeof(apr_size_t) < sizeof(apr_uint64_t) && size > 0x40000000)
+    size = 0x40000000;
+
+  SVN_MUTEX__WITH_LOCK(disk_caches_mutex,
+                       find_or_open_disk_cache(disk_p, abspath, size,
+                                               scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Look for the record with KEY of length KEY_LEN in DISK.  If found, set
+ * *FOUND and return a copy of its data in *DATA and *DATA_LEN, allocated
+ * in RESULT_POOL.  Otherwise, set *FOUND to FALSE.
+ *
+ * This does not take any locks.
+ */
+static void
+disk_cache_lookup(char **data,
+                  apr_size_t *data_len,
+                  svn_boolean_t *found,
+                  svn_cache__disk_t *disk,
+                  const char *key,
+                  apr_size_t key_len,
+                  apr_pool_t *result_pool)
+{
+  apr_uint64_t hash = key_hash(key, key_len);
+  const disk_entry_t *group
+    = disk->entries + (hash % disk->group_count) * GROUP_SIZE;
+  int i;
+
+  *found = FALSE;
+  for (i = 0; i < GROUP_SIZE; ++i)
+    {
+      record_header_t header;
+      apr_uint64_t offset, size;
+      char *buffer;
+
+      if (group[i].hash != hash)
+        continue;
+
+      /* Other processes may modify the entry and the record while we are
+       * reading them.  Don't trust anything we have not validated. */
+      offset = group[i].offset;
+      size = group[i].size;
+      if (   offset > disk->data_size
+          || size > disk->data_size - offset
+          || size < sizeof(header))
+        continue;
+
+      memcpy(&header, disk->data + offset, sizeof(header));
+      if (   header.hash != hash
+          || header.key_len != key_len
+          || record_size(header.key_len, header.data_len) != size)
+        continue;
+
+      buffer = apr_palloc(result_pool, header.data_len);
+      memcpy(buffer, disk->data + offset + sizeof(header) + key_len,
+             header.data_len);
+
+      if (   svn__fnv1a_64x4(buffer, header.data_len) != header.checksum
+          || memcmp(disk->data + offset + sizeof(header), key, key_len))
+        continue;
+
+      *data = buffer;
+      *data_len = header.data_len;
+      *found = TRUE;
+
+      return;
+    }
+}
+
+/* Append a record for KEY of length KEY_LEN with DATA_LEN bytes of DATA
+ * to DISK and update the index.  The caller must hold DISK->MUTEX.
+ * Use SCRATCH_POOL for temporary allocations.
+ */
+static svn_error_t *
+disk_cache_store(svn_cache__disk_t *disk,
+                 const char *key,
+                 apr_size_t key_len,
+                 const void *data,
+                 apr_size_t data_len,
+                 apr_pool_t *scratch_pool)
+{
+  record_header_t header;
+  apr_uint64_t size = record_size(key_len, data_len);
+  apr_uint64_t pos;
+  apr_off_t offset;
+  disk_entry_t *group;
+  disk_entry_t *entry = NULL;
+  apr_uint64_t max_age = 0;
+  int i;
+
+  header.hash = key_hash(key, key_len);
+  header.checksum = svn__fnv1a_64x4(data, data_len);
+  header.key_len = (apr_uint32_t)key_len;
+  header.data_len = (apr_uint32_t)data_len;
+
+  /* Find the place for the new record, wrapping around at the end.
+   * Be robust against a corrupted write position. */
+  pos = disk->header->write_pos;
+  pos &= ~(apr_uint64_t)(RECORD_ALIGNMENT - 1);
+  if (pos > disk->data_size || size > disk->data_size - pos)
+    pos = 0;
+
+  /* Replace an older version of the same record, use an empty entry
+   * or evict the entry that has been written the longest time ago. */
+  group = disk->entries + (header.hash % disk->group_count) * GROUP_SIZE;
+  for (i = 0; i < GROUP_SIZE && entry == NULL; ++i)
+    if (group[i].hash == header.hash)
+      entry = &group[i];
+
+  for (i = 0; i < GROUP_SIZE && entry == NULL; ++i)
+    if (group[i].hash == 0)
+      entry = &group[i];
+
+  for (i = 0; i < GROUP_SIZE && entry == NULL; ++i)
+    {
+      apr_uint64_t age
+        = (pos + disk->data_size - group[i].offset) % disk->data_size;
+      if (age >= max_age)
+        max_age = age;
+    }
+
+  if (entry == NULL)
+    for (i = 0; i < GROUP_SIZE && entry == NULL; ++i)
+      if ((pos + disk->data_size - group[i].offset) % disk->data_size
+          == max_age)
+        entry = &group[i];
+
+  /* Readers must not follow the entry while we are updating it. */
+  entry->hash = 0;
+
+  /* Write the record through the file handle. */
+  offset = (apr_off_t)(disk->data_offset + pos);
+  SVN_ERR(svn_io_file_seek(disk->file, APR_SET, &offset, scratch_pool));
+  SVN_ERR(svn_io_file_write_full(disk->file, &header, sizeof(header), NULL,
+                                 scratch_pool));
+  SVN_ERR(svn_io_file_write_full(disk->file, key, key_len, NULL,
+                                 scratch_pool));
+  SVN_ERR(svn_io_file_write_full(disk->file, data, data_len, NULL,
+                                 scratch_pool));
+
+  /* Publish it. */
+  entry->offset = pos;
+  entry->size = size;
+  entry->hash = header.hash;
+  disk->header->write_pos = pos + size;
+
+  return SVN_NO_ERROR;
+}
+
+/* Call disk_cache_store() for DISK, KEY, KEY_LEN, DATA, DATA_LEN and
+ * SCRATCH_POOL while holding the file lock.  The caller must hold
+ * DISK->MUTEX.
+ */
+static svn_error_t *
+locked_store(svn_cache__disk_t *disk,
+             const char *key,
+             apr_size_t key_len,
+             const void *data,
+             apr_size_t data_len,
+             apr_pool_t *scratch_pool)
+{
+  SVN_ERR(lock_file(disk, scratch_pool));
+  return svn_error_trace(
+           unlock_file(disk,
+                       disk_cache_store(disk, key, key_len, data, data_len,
+                                        scratch_pool),
+                       scratch_pool));
+}
+
+/* Return TRUE if DISK would accept a record with a key of KEY_LEN bytes
+ * and DATA_LEN bytes of data.
+ */
+static svn_boolean_t
+disk_cache_is_cachable(svn_cache__disk_t *disk,
+                       apr_size_t key_len,
+                       apr_size_t data_len)
+{
+  return record_size(key_len, data_len) <= disk->max_record_size;
+}
+
+/* Store the record for KEY of length KEY_LEN with DATA_LEN bytes of DATA
+ * in DISK, taking out the necessary locks.  Records that are too large
+ * will silently be dropped.  Use SCRATCH_POOL for temporary allocations.
+ */
+static svn_error_t *
+disk_cache_set(svn_cache__disk_t *disk,
+               const char *key,
+               apr_size_t key_len,
+               const void *data,
+               apr_size_t data_len,
+               apr_pool_t *scratch_pool)
+{
+  if (!disk_cache_is_cachable(disk, key_len, data_len))
+    return SVN_NO_ERROR;
+
+  SVN_MUTEX__WITH_LOCK(disk->mutex,
+                       locked_store(disk, key, key_len, data, data_len,
+                                    scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
+#else /* !APR_HAS_MMAP */
+
+struct svn_cache__disk_t
+{
+  /* Not used; we can't even create instances. */
+  int dummy;
+};
+
+svn_error_t *
+svn_cache__get_disk_cache(svn_cache__disk_t **disk_p,
+                          const char *path,
+                          apr_uint64_t size,
+                          apr_pool_t *scratch_pool)
+{
+  return svn_error_create(SVN_ERR_UNSUPPORTED_FEATURE, NULL,
+                          _("Disk caches require memory-mapped files"));
+}
+
+static void
+disk_cache_lookup(char **data,
+                  apr_size_t *data_len,
+                  svn_boolean_t *found,
+                  svn_cache__disk_t *disk,
+                  const char *key,
+                  apr_size_t key_len,
+                  apr_pool_t *result_pool)
+{
+  *found = FALSE;
+}
+
+static svn_boolean_t
+disk_cache_is_cachable(svn_cache__disk_t *disk,
+                       apr_size_t key_len,
+                       apr_size_t data_len)
+{
+  return FALSE;
+}
+
+static svn_error_t *
+disk_cache_set(svn_cache__disk_t *disk,
+               const char *key,
+               apr_size_t key_len,
+               const void *data,
+               apr_size_t data_len,
+               apr_pool_t *scratch_pool)
+{
+  return SVN_NO_ERROR;
+}
+
+#endif /* APR_HAS_MMAP */
+
+
+/* String keys longer than this are not written to the disk cache.  This
+ * gives us an upper limit for the key length in svn_cache__is_cachable.
+ */
+#define MAX_STRING_KEY_LEN 0x400
+
+/* The svn_cache__t front-end combining a first level cache with a disk
+ * cache.
+ */
+typedef struct disk_backed_cache_t
+{
+  /* First level cache.  Gets queried first and updated upon disk hits. */
+  svn_cache__t *l1;
+
+  /* The second level. */
+  svn_cache__disk_t *disk;
+
+  /* Prefix for all keys written to DISK, incl. the terminating NUL. */
+  const char *prefix;
+  apr_size_t prefix_len;
+
+  /* The size of the key: either a fixed number of bytes or
+   * APR_HASH_KEY_STRING. */
+  apr_ssize_t klen;
+
+  /* Maximum length of the keys written to DISK, incl. PREFIX. */
+  apr_size_t max_key_len;
+
+  /* Used to marshal values in and out of the disk cache.
+   * NULL for svn_stringbuf_t values. */
+  svn_cache__serialize_func_t serialize_func;
+  svn_cache__deserialize_func_t deserialize_func;
+} disk_backed_cache_t;
+
+/* Set *FULL_KEY and *FULL_LEN to the disk cache key for KEY in CACHE.
+ * Allocate it in POOL.
+ */
+static void
+combine_key(const char **full_key,
+            apr_size_t *full_len,
+            disk_backed_cache_t *cache,
+            const void *key,
+            apr_pool_t *pool)
+{
+  apr_size_t key_len = cache->klen == APR_HASH_KEY_STRING
+                     ? strlen(key)
+                     : (apr_size_t)cache->klen;
+  char *result = apr_palloc(pool, cache->prefix_len + key_len);
+
+  memcpy(result, cache->prefix, cache->prefix_len);
+  memcpy(result + cache->prefix_len, key, key_len);
+
+  *full_key = result;
+  *full_len = cache->prefix_len + key_len;
+}
+
+/* Serialize VALUE for CACHE into *DATA and *DATA_LEN.  Use POOL for
+ * allocations.
+ */
+static svn_error_t *
+serialize_value(void **data,
+                apr_size_t *data_len,
+                disk_backed_cache_t *cache,
+                void *value,
+                apr_pool_t *pool)
+{
+  if (cache->serialize_func)
+    {
+      SVN_ERR((cache->serialize_func)(data, data_len, value, pool));
+    }
+  else
+    {
+      svn_stringbuf_t *value_str = value;
+      *data = value_str->data;
+      *data_len = value_str->len + 1; /* copy trailing NUL */
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Turn DATA_LEN bytes of DATA read from the disk cache of CACHE into
+ * *VALUE_P.  DATA must have been allocated in RESULT_POOL.
+ */
+static svn_error_t *
+deserialize_value(void **value_p,
+                  disk_backed_cache_t *cache,
+                  char *data,
+                  apr_size_t data_len,
+                  apr_pool_t *result_pool)
+{
+  if (cache->deserialize_func)
+    {
+      SVN_ERR((cache->deserialize_func)(value_p, data, data_len,
+                                        result_pool));
+    }
+  else
+    {
+      svn_stringbuf_t *value = svn_stringbuf_create_empty(result_pool);
+      value->data = data;
+      value->blocksize = data_len;
+      value->len = data_len - 1; /* account for trailing NUL */
+      *value_p = value;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+disk_backed_cache_get(void **value_p,
+                      svn_boolean_t *found,
+                      void *cache_void,
+                      const void *key,
+                      apr_pool_t *result_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+  const char *full_key;
+  apr_size_t full_len;
+  char *data;
+  apr_size_t data_len;
+
+  SVN_ERR(svn_cache__get(value_p, found, cache->l1, key, result_pool));
+  if (*found)
+    return SVN_NO_ERROR;
+
+  combine_key(&full_key, &full_len, cache, key, result_pool);
+  disk_cache_lookup(&data, &data_len, found, cache->disk, full_key,
+                    full_len, result_pool);
+  if (!*found)
+    return SVN_NO_ERROR;
+
+  /* Promote the item to L1. */
+  SVN_ERR(deserialize_value(value_p, cache, data, data_len, result_pool));
+  SVN_ERR(svn_cache__set(cache->l1, key, *value_p, result_pool));
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+disk_backed_cache_has_key(svn_boolean_t *found,
+                          void *cache_void,
+                          const void *key,
+                          apr_pool_t *scratch_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+  const char *full_key;
+  apr_size_t full_len;
+  char *data;
+  apr_size_t data_len;
+
+  SVN_ERR(svn_cache__has_key(found, cache->l1, key, scratch_pool));
+  if (*found)
+    return SVN_NO_ERROR;
+
+  combine_key(&full_key, &full_len, cache, key, scratch_pool);
+  disk_cache_lookup(&data, &data_len, found, cache->disk, full_key,
+                    full_len, scratch_pool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+disk_backed_cache_set(void *cache_void,
+                      const void *key,
+                      void *value,
+                      apr_pool_t *scratch_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+  apr_pool_t *subpool;
+  const char *full_key;
+  apr_size_t full_len;
+  void *data;
+  apr_size_t data_len;
+
+  SVN_ERR(svn_cache__set(cache->l1, key, value, scratch_pool));
+
+  /* Write through to disk.  Eviction from L1 is not observable and the
+   * disk copy is what survives process restarts. */
+  subpool = svn_pool_create(scratch_pool);
+  combine_key(&full_key, &full_len, cache, key, subpool);
+  if (full_len <= cache->max_key_len)
+    {
+      SVN_ERR(serialize_value(&data, &data_len, cache, value, subpool));
+      SVN_ERR(disk_cache_set(cache->disk, full_key, full_len, data,
+                             data_len, subpool));
+    }
+  svn_pool_destroy(subpool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+disk_backed_cache_iter(svn_boolean_t *completed,
+                       void *cache_void,
+                       svn_iter_apr_hash_cb_t user_cb,
+                       void *user_baton,
+                       apr_pool_t *scratch_pool)
+{
+  return svn_error_create(SVN_ERR_UNSUPPORTED_FEATURE, NULL,
+                          _("Can't iterate a disk-backed cache"));
+}
+
+static svn_error_t *
+disk_backed_cache_get_partial(void **value_p,
+                              svn_boolean_t *found,
+                              void *cache_void,
+                              const void *key,
+                              svn_cache__partial_getter_func_t func,
+                              void *baton,
+                              apr_pool_t *result_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+  apr_pool_t *subpool;
+  const char *full_key;
+  apr_size_t full_len;
+  char *data;
+  apr_size_t data_len;
+  void *value;
+
+  SVN_ERR(svn_cache__get_partial(value_p, found, cache->l1, key, func,
+                                 baton, result_pool));
+  if (*found)
+    return SVN_NO_ERROR;
+
+  subpool = svn_pool_create(result_pool);
+  combine_key(&full_key, &full_len, cache, key, subpool);
+  disk_cache_lookup(&data, &data_len, found, cache->disk, full_key,
+                    full_len, subpool);
+
+  if (*found)
+    {
+      SVN_ERR(func(value_p, data, data_len, baton, result_pool));
+
+      /* Promote the item to L1.  Deserialization may modify the buffer
+       * in-place, so do that only after FUNC is done with it. */
+      SVN_ERR(deserialize_value(&value, cache, data, data_len, subpool));
+      SVN_ERR(svn_cache__set(cache->l1, key, value, subpool));
+    }
+
+  svn_pool_destroy(subpool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+disk_backed_cache_set_partial(void *cache_void,
+                              const void *key,
+                              svn_cache__partial_setter_func_t func,
+                              void *baton,
+                              apr_pool_t *scratch_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+  apr_pool_t *subpool;
+  const char *full_key;
+  apr_size_t full_len;
+  char *data;
+  apr_size_t data_len;
+  svn_boolean_t found;
+
+  SVN_ERR(svn_cache__set_partial(cache->l1, key, func, baton,
+                                 scratch_pool));
+
+  /* Keep the disk copy in sync, if there is one. */
+  subpool = svn_pool_create(scratch_pool);
+  combine_key(&full_key, &full_len, cache, key, subpool);
+  disk_cache_lookup(&data, &data_len, &found, cache->disk, full_key,
+                    full_len, subpool);
+
+  if (found)
+    {
+      void *new_data = data;
+      SVN_ERR(func(&new_data, &data_len, baton, subpool));
+      SVN_ERR(disk_cache_set(cache->disk, full_key, full_len, new_data,
+                             data_len, subpool));
+    }
+
+  svn_pool_destroy(subpool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_boolean_t
+disk_backed_cache_is_cachable(void *cache_void,
+                              apr_size_t size)
+{
+  disk_backed_cache_t *cache = cache_void;
+
+  /* Items that L1 rejects may still find a place on disk. */
+  return svn_cache__is_cachable(cache->l1, size)
+      || disk_cache_is_cachable(cache->disk, cache->max_key_len, size);
+}
+
+static svn_error_t *
+disk_backed_cache_get_info(void *cache_void,
+                           svn_cache__info_t *info,
+                           svn_boolean_t reset,
+                           apr_pool_t *result_pool)
+{
+  disk_backed_cache_t *cache = cache_void;
+
+  /* The disk cache is shared and has no meaningful per-cache statistics.
+   * Report the L1 usage. */
+  return svn_error_trace((cache->l1->vtable->get_info)(
+                            cache->l1->cache_internal, info, reset,
+                            result_pool));
+}
+
+static svn_cache__vtable_t disk_backed_cache_vtable = {
+  disk_backed_cache_get,
+  disk_backed_cache_has_key,
+  disk_backed_cache_set,
+  disk_backed_cache_iter,
+  disk_backed_cache_is_cachable,
+  disk_backed_cache_get_partial,
+  disk_backed_cache_set_partial,
+  disk_backed_cache_get_info
+};
+
+svn_error_t *
+svn_cache__create_disk_backed(svn_cache__t **cache_p,
+                              svn_cache__t *l1,
+                              svn_cache__disk_t *disk,
+                              svn_cache__serialize_func_t serialize_func,
+                              svn_cache__deserialize_func_t deserialize_func,
+                              apr_ssize_t klen,
+                              const char *prefix,
+                              apr_pool_t *result_pool)
+{
+  svn_cache__t *wrapper = apr_pcalloc(result_pool, sizeof(*wrapper));
+  disk_backed_cache_t *cache = apr_pcalloc(result_pool, sizeof(*cache));
+
+  cache->l1 = l1;
+  cache->disk = disk;
+  cache->prefix = apr_pstrdup(result_pool, prefix);
+  cache->prefix_len = strlen(prefix) + 1;
+  cache->klen = klen;
+  cache->max_key_len = cache->prefix_len
+                     + (klen == APR_HASH_KEY_STRING
+                          ? MAX_STRING_KEY_LEN
+                          : (apr_size_t)klen);
+  cache->serialize_func = serialize_func;
+  cache->deserialize_func = deserialize_func;
+
+  wrapper->vtable = &disk_backed_cache_vtable;
+  wrapper->cache_internal = cache;
+  wrapper->error_handler = 0;
+  wrapper->error_baton = 0;
+  wrapper->pretend_empty = !!getenv("SVN_X_DOES_NOT_MARK_THE_SPOT");
+
+  *cache_p = wrapper;
+  return SVN_NO_ERROR;
+}
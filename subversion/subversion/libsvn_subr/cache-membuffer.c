@@ -24,6 +24,8 @@
 #include <assert.h>
 #include <apr_md5.h>
 #include <apr_thread_rwlock.h>
+#include <apr_shm.h>
+#include <apr_global_mutex.h>
 
 #include "svn_pools.h"
 #include "svn_checksum.h"
@@ -129,6 +131,15 @@
  * to scale well despite that bottleneck, we simply segment the cache into
  * a number of independent caches (segments). Items will be multiplexed based
  * on their hash key.
+ *
+ * Hot keys still make all readers of a segment hammer its lock.  Therefore,
+ * lookups first try to read the item without taking the lock at all.  Every
+ * writer increments the segment's WRITE_SEQUENCE once when it starts and
+ * once when it is done modifying the segment, i.e. the number is odd while
+ * a write is in progress.  The optimistic reader checks that number before
+ * and after copying the data and falls back to regular locking if it
+ * changed.  While it runs, the reader only follows index values after
+ * checking them against the buffer bounds because they may be half-written.
  */
 
 /* APR's read-write lock implementation on Windows is horribly inefficient.
@@ -146,6 +157,45 @@
 #  define USE_SIMPLE_MUTEX 0
 #endif
 
+/* Lock-free lookups need memory barriers, which APR does not provide.
+ * They also update the 64 bit statistics counters without holding the
+ * lock, which requires atomic 64 bit additions that APR does not provide
+ * either.  Enable them only where we know how to issue those barriers and
+ * additions and don't need to verify the cache contents under the lock
+ * (debug mode).
+ */
+#if !APR_HAS_THREADS || defined(SVN_DEBUG_CACHE_MEMBUFFER)
+#  define OPTIMISTIC_READS 0
+#elif (   defined(__clang__) \
+       || (defined(__GNUC__) && (__GNUC__ > 4 \
+                                 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)))) \
+   && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && __GCC_ATOMIC_LLONG_LOCK_FREE == 2
+#  define OPTIMISTIC_READS 1
+#  define READ_BARRIER() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#  define WRITE_BARRIER() __atomic_thread_fence(__ATOMIC_RELEASE)
+#  define STAT_ADD(counter, value) \
+     ((void)__atomic_fetch_add(&(counter), (value), __ATOMIC_RELAXED))
+#elif defined(_MSC_VER)
+#  define OPTIMISTIC_READS 1
+#  define READ_BARRIER() MemoryBarrier()
+#  define WRITE_BARRIER() MemoryBarrier()
+#  define STAT_ADD(counter, value) \
+     ((void)InterlockedExchangeAdd64((volatile LONG64 *)&(counter), \
+                                     (LONG64)(value)))
+#else
+#  define OPTIMISTIC_READS 0
+#endif
+
+#if !OPTIMISTIC_READS
+#  define WRITE_BARRIER()
+#  define STAT_ADD(counter, value) ((void)((counter) += (value)))
+#endif
+
+/* Add 1 to the statistics COUNTER.  Readers update these concurrently and
+ * optimistic readers do so even while a writer holds the lock.
+ */
+#define STAT_INC(counter) STAT_ADD(counter, 1)
+
 /* For more efficient copy operations, let's align all data items properly.
  * Since we can't portably align pointers, this is rather the item size
  * granularity which ensures *relative* alignment within the cache - still
@@ -177,6 +227,27 @@
  */
 #define MAX_SEGMENT_SIZE APR_UINT64_C(0xffff0000)
 
+/* Caches in shared memory don't give each segment its own lock but stripe
+ * their segments over this many global mutexes.  Depending on the lock
+ * mechanism, each of them may use up a system-wide resource such as a
+ * SysV semaphore set.
+ */
+#define MAX_SHARED_LOCK_COUNT 8
+
+/* Lock mechanism to use for caches in shared memory.  Process-shared
+ * pthread mutexes don't need any system-wide resources and APR makes them
+ * robust where the platform supports it.  That is, they get released when
+ * their holder dies.  SysV semaphores, fcntl() and flock() locks behave
+ * the same way.  POSIX semaphores, which may be the default on some
+ * platforms, don't; a process dying while holding the lock will block
+ * all other users of the respective segments.
+ */
+#if APR_HAS_PROC_PTHREAD_SERIALIZE
+#define SHARED_LOCK_MECH APR_LOCK_PROC_PTHREAD
+#else
+#define SHARED_LOCK_MECH APR_LOCK_DEFAULT
+#endif
+
 /* We don't mark the initialization status for every group but initialize
  * a number of groups at once. That will allow for a very small init flags
  * vector that is likely to fit into the CPU caches even for fairly large
@@ -566,7 +637,8 @@ typedef struct entry_t
   apr_size_t size;
 
   /* Number of (read) hits for this entry. Will be reset upon write.
-   * Only valid for used entries.
+   * Only valid for used entries.  Optimistic readers increment it without
+   * holding the lock, so writers must use svn_atomic_* to modify it.
    */
   svn_atomic_t hit_count;
 
@@ -777,8 +849,8 @@ struct svn_membuffer_t
 
   /* Total number of calls to membuffer_cache_get.
    * Purely statistical information that may be used for profiling only.
-   * Updates are not synchronized and values may be nonsensicle on some
-   * platforms.
+   * Readers update it through STAT_INC, which is only atomic where
+   * optimistic reads are enabled.
    */
   apr_uint64_t total_reads;
 
@@ -791,11 +863,41 @@ struct svn_membuffer_t
 
   /* Total number of hits since the cache's creation.
    * Purely statistical information that may be used for profiling only.
-   * Updates are not synchronized and values may be nonsensicle on some
-   * platforms.
+   * Readers update it through STAT_INC, which is only atomic where
+   * optimistic reads are enabled.
    */
   apr_uint64_t total_hits;
 
+  /* Total number of lookups served without taking the lock.
+   * Purely statistical information that may be used for profiling only.
+   * Readers update it through STAT_INC, which is only atomic where
+   * optimistic reads are enabled.
+   */
+  apr_uint64_t optimistic_reads;
+
+  /* Total number of lock-free lookups that collided with a writer and had
+   * to be repeated under the lock.
+   * Purely statistical information that may be used for profiling only.
+   * Readers update it through STAT_INC, which is only atomic where
+   * optimistic reads are enabled.
+   */
+  apr_uint64_t optimistic_retries;
+
+  /* Total number of lock acquisitions that had to wait for another thread
+   * and the total time in microseconds spent waiting for them.
+   * Purely statistical information that may be used for profiling only.
+   * Readers update them through STAT_INC and STAT_ADD, which are only
+   * atomic where optimistic reads are enabled.
+   */
+  apr_uint64_t lock_waits;
+  apr_uint64_t lock_wait_time;
+
+  /* Incremented before and after every modification of this segment.
+   * Odd values mean that some writer is currently active.  Only modified
+   * while holding the write lock.  See begin_write() and end_write().
+   */
+  volatile apr_uint32_t write_sequence;
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
   /* A lock for intra-process synchronization to the cache, or NULL if
    * the cache's creator doesn't feel the cache needs to be
@@ -805,13 +907,26 @@ struct svn_membuffer_t
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
   /* Same for read-write lock. */
   apr_thread_rwlock_t *lock;
+#endif
 
   /* If set, write access will wait until they get exclusive access.
    * Otherwise, they will become no-ops if the segment is currently
-   * read-locked.  Only used when LOCK is an r/w lock.
+   * locked.  Only used when LOCK is an r/w lock or with SHARED_LOCK.
    */
   svn_boolean_t allow_blocking_writes;
-#endif
+
+  /* If the cache lives in a shared memory region, these SHARED_LOCK_COUNT
+   * global mutexes serialize all access to its segments across processes
+   * and threads.  This segment uses the one at SHARED_LOCK_INDEX.  LOCK
+   * will not be used in that case.  NULL for process-local caches.
+   *
+   * The array itself is process-local.  It gets allocated before the
+   * workers are forked and has therefore the same address in all of them.
+   * svn_cache__membuffer_child_init() updates each process' own copy.
+   */
+  apr_global_mutex_t **shared_locks;
+  apr_uint32_t shared_lock_count;
+  apr_uint32_t shared_lock_index;
 
   /* A write lock counter, must be either 0 or 1.
    * This one is only used in debug assertions to verify that you used
@@ -823,17 +938,147 @@ struct svn_membuffer_t
  */
 #define ALIGN_VALUE(value) (((value) + ITEM_ALIGNMENT-1) & -ITEM_ALIGNMENT)
 
+/* Remove all entries from the segment CACHE.
+ * The caller must hold the write lock.
+ */
+static void
+reset_segment(svn_membuffer_t *cache)
+{
+  /* Length of the group_initialized array in bytes.
+     See also svn_cache__membuffer_cache_create(). */
+  apr_size_t group_init_size
+    = 1 + (cache->group_count + cache->spare_group_count)
+            / (8 * GROUP_INIT_GRANULARITY);
+
+  /* Mark all groups as "not initialized", which implies "empty". */
+  cache->first_spare_group = NO_INDEX;
+  cache->max_spare_used = 0;
+
+  memset(cache->group_initialized, 0, group_init_size);
+
+  /* Unlink L1 contents. */
+  cache->l1.first = NO_INDEX;
+  cache->l1.last = NO_INDEX;
+  cache->l1.next = NO_INDEX;
+  cache->l1.current_data = cache->l1.start_offset;
+
+  /* Unlink L2 contents. */
+  cache->l2.first = NO_INDEX;
+  cache->l2.last = NO_INDEX;
+  cache->l2.next = NO_INDEX;
+  cache->l2.current_data = cache->l2.start_offset;
+
+  /* Reset content counters. */
+  cache->data_used = 0;
+  cache->used_entries = 0;
+}
+
+/* Update the lock contention statistics in CACHE after we had to wait
+ * for its lock since START.  Call this while holding the lock.
+ */
+static void
+count_lock_wait(svn_membuffer_t *cache, apr_time_t start)
+{
+  STAT_INC(cache->lock_waits);
+  STAT_ADD(cache->lock_wait_time, apr_time_now() - start);
+}
+
+/* Acquire the shared lock for CACHE, counting contention in CACHE.  If
+ * BLOCKING is not set and the lock is currently held by someone else, set
+ * *SUCCESS to FALSE and return without acquiring the lock.
+ */
+static svn_error_t *
+shared_lock_cache(svn_membuffer_t *cache,
+                  svn_boolean_t blocking,
+                  svn_boolean_t *success)
+{
+  apr_global_mutex_t *lock = cache->shared_locks[cache->shared_lock_index];
+  apr_status_t status = apr_global_mutex_trylock(lock);
+  if (SVN_LOCK_IS_BUSY(status) || APR_STATUS_IS_ENOTIMPL(status))
+    {
+      apr_time_t start;
+      if (!blocking && !APR_STATUS_IS_ENOTIMPL(status))
+        {
+          *success = FALSE;
+          return SVN_NO_ERROR;
+        }
+
+      start = apr_time_now();
+      status = apr_global_mutex_lock(lock);
+      if (status == APR_SUCCESS)
+        count_lock_wait(cache, start);
+    }
+
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't lock shared cache mutex"));
+
+  /* Writers keep WRITE_SEQUENCE odd while they modify the segment.  If it
+   * is odd now, the previous lock holder died in the middle of an update.
+   * The segment contents can't be trusted anymore, so drop them. */
+  if (cache->write_sequence & 1)
+    {
+      reset_segment(cache);
+      cache->write_sequence++;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+#if (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
+
+/* Acquire a read lock for CACHE->LOCK, counting contention in CACHE.
+ */
+static apr_status_t
+rdlock_counted(svn_membuffer_t *cache)
+{
+  apr_status_t status = apr_thread_rwlock_tryrdlock(cache->lock);
+  if (SVN_LOCK_IS_BUSY(status))
+    {
+      apr_time_t start = apr_time_now();
+      status = apr_thread_rwlock_rdlock(cache->lock);
+      if (status == APR_SUCCESS)
+        count_lock_wait(cache, start);
+    }
+
+  return status;
+}
+
+/* Acquire a write lock for CACHE->LOCK, counting contention in CACHE.
+ */
+static apr_status_t
+wrlock_counted(svn_membuffer_t *cache)
+{
+  apr_status_t status = apr_thread_rwlock_trywrlock(cache->lock);
+  if (SVN_LOCK_IS_BUSY(status))
+    {
+      apr_time_t start = apr_time_now();
+      status = apr_thread_rwlock_wrlock(cache->lock);
+      if (status == APR_SUCCESS)
+        count_lock_wait(cache, start);
+    }
+
+  return status;
+}
+
+#endif
+
 /* If locking is supported for CACHE, acquire a read lock for it.
  */
 static svn_error_t *
 read_lock_cache(svn_membuffer_t *cache)
 {
+  if (cache->shared_locks)
+    {
+      svn_boolean_t success = TRUE;
+      return shared_lock_cache(cache, TRUE, &success);
+    }
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
   return svn_mutex__lock(cache->lock);
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
   if (cache->lock)
   {
-    apr_status_t status = apr_thread_rwlock_rdlock(cache->lock);
+    apr_status_t status = rdlock_counted(cache);
     if (status)
       return svn_error_wrap_apr(status, _("Can't lock cache mutex"));
   }
@@ -851,6 +1096,9 @@ read_lock_cache(svn_membuffer_t *cache)
 static svn_error_t *
 write_lock_cache(svn_membuffer_t *cache, svn_boolean_t *success)
 {
+  if (cache->shared_locks)
+    return shared_lock_cache(cache, cache->allow_blocking_writes, success);
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
   return svn_mutex__lock(cache->lock);
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
@@ -859,7 +1107,7 @@ write_lock_cache(svn_membuffer_t *cache, svn_boolean_t *success)
       apr_status_t status;
       if (cache->allow_blocking_writes)
         {
-          status = apr_thread_rwlock_wrlock(cache->lock);
+          status = wrlock_counted(cache);
         }
       else
         {
@@ -888,13 +1136,22 @@ write_lock_cache(svn_membuffer_t *cache, svn_boolean_t *success)
 static svn_error_t *
 force_write_lock_cache(svn_membuffer_t *cache)
 {
+  if (cache->shared_locks)
+    {
+      svn_boolean_t success = TRUE;
+      return shared_lock_cache(cache, TRUE, &success);
+    }
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
   return svn_mutex__lock(cache->lock);
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
-  apr_status_t status = apr_thread_rwlock_wrlock(cache->lock);
-  if (status)
-    return svn_error_wrap_apr(status,
-                              _("Can't write-lock cache mutex"));
+  if (cache->lock)
+    {
+      apr_status_t status = wrlock_counted(cache);
+      if (status)
+        return svn_error_wrap_apr(status,
+                                  _("Can't write-lock cache mutex"));
+    }
 
   return SVN_NO_ERROR;
 #else
@@ -908,6 +1165,21 @@ force_write_lock_cache(svn_membuffer_t *cache)
 static svn_error_t *
 unlock_cache(svn_membuffer_t *cache, svn_error_t *err)
 {
+  if (cache->shared_locks)
+    {
+      apr_global_mutex_t *lock
+        = cache->shared_locks[cache->shared_lock_index];
+      apr_status_t status = apr_global_mutex_unlock(lock);
+      if (err)
+        return err;
+
+      if (status)
+        return svn_error_wrap_apr(status,
+                                  _("Can't unlock shared cache mutex"));
+
+      return SVN_NO_ERROR;
+    }
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
   return svn_mutex__unlock(cache->lock, err);
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
@@ -927,6 +1199,28 @@ unlock_cache(svn_membuffer_t *cache, svn_error_t *err)
 #endif
 }
 
+/* Tell optimistic readers that we are about to modify CACHE.
+ * The caller must hold the write lock.
+ */
+static APR_INLINE void
+begin_write(svn_membuffer_t *cache)
+{
+  cache->write_sequence++;
+  WRITE_BARRIER();
+}
+
+/* Tell optimistic readers that we finished modifying CACHE.
+ * The caller must still hold the write lock.  Return ERR.
+ */
+static APR_INLINE svn_error_t *
+end_write(svn_membuffer_t *cache, svn_error_t *err)
+{
+  WRITE_BARRIER();
+  cache->write_sequence++;
+
+  return err;
+}
+
 /* If supported, guard the execution of EXPR with a read lock to CACHE.
  * The macro has been modeled after SVN_MUTEX__WITH_LOCK.
  */
@@ -959,7 +1253,8 @@ do {                                                            \
       else                                                      \
         break;                                                  \
     }                                                           \
-  SVN_ERR(unlock_cache(cache, (expr)));                         \
+  begin_write(cache);                                           \
+  SVN_ERR(unlock_cache(cache, end_write(cache, (expr))));       \
 } while (0)
 
 /* Returns 0 if the entry group identified by GROUP_INDEX in CACHE has not
@@ -1314,7 +1609,7 @@ insert_entry(svn_membuffer_t *cache, entry_t *entry)
    */
   cache->used_entries++;
   cache->data_used += entry->size;
-  entry->hit_count = 0;
+  svn_atomic_set(&entry->hit_count, 0);
   group->header.used++;
 
   /* update entry chain
@@ -1353,11 +1648,14 @@ get_group_index(svn_membuffer_t **cache,
 static APR_INLINE void
 let_entry_age(svn_membuffer_t *cache, entry_t *entry)
 {
-  apr_uint32_t hits_removed = (entry->hit_count + 1) >> 1;
+  apr_uint32_t hit_count = svn_atomic_read(&entry->hit_count);
+  apr_uint32_t hits_removed = (hit_count + 1) >> 1;
 
   if (hits_removed)
     {
-      entry->hit_count -= hits_removed;
+      /* Optimistic readers may count a hit in between.  Losing that is
+       * fine but the counter must never be torn. */
+      svn_atomic_set(&entry->hit_count, hit_count - hits_removed);
     }
   else
     {
@@ -1832,17 +2130,57 @@ ensure_data_insertable_l1(svn_membuffer_t *cache, apr_size_t size)
    * right answer. */
 }
 
-svn_error_t *
-svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
-                                  apr_size_t total_size,
-                                  apr_size_t directory_size,
-                                  apr_size_t segment_count,
-                                  svn_boolean_t thread_safe,
-                                  svn_boolean_t allow_blocking_writes,
-                                  apr_pool_t *pool)
+/* Allocate an anonymous shared memory region of at least SIZE bytes,
+ * aligned to ITEM_ALIGNMENT, and return it in *REGION.  Its
+ * lifetime is bound to POOL.  The region will be shared with all processes
+ * forked after this call.
+ */
+static svn_error_t *
+create_shared_region(unsigned char **region,
+                     apr_size_t size,
+                     apr_pool_t *pool)
+{
+#if APR_HAS_SHARED_MEMORY
+  apr_shm_t *shm;
+  apr_uintptr_t base;
+
+  apr_status_t status = apr_shm_create(&shm, size + ITEM_ALIGNMENT, NULL,
+                                       pool);
+  if (status)
+    return svn_error_wrap_apr(status,
+                              _("Can't allocate shared cache memory"));
+
+  base = (apr_uintptr_t)apr_shm_baseaddr_get(shm);
+  *region = (unsigned char *)ALIGN_VALUE(base);
+
+  return SVN_NO_ERROR;
+#else
+  return svn_error_create(SVN_ERR_UNSUPPORTED_FEATURE, NULL,
+                          _("Shared memory is not supported on this "
+                            "platform"));
+#endif
+}
+
+/* Implement svn_cache__membuffer_cache_create and
+ * svn_cache__membuffer_cache_create_shared.  If SHARED is set, place all
+ * cache structures into a shared memory region and use cross-process
+ * locks.  THREAD_SAFE is ignored in that case.
+ */
+static svn_error_t *
+membuffer_cache_create(svn_membuffer_t **cache,
+                       apr_size_t total_size,
+                       apr_size_t directory_size,
+                       apr_size_t segment_count,
+                       svn_boolean_t thread_safe,
+                       svn_boolean_t allow_blocking_writes,
+                       svn_boolean_t shared,
+                       apr_pool_t *pool)
 {
   svn_membuffer_t *c;
   prefix_pool_t *prefix_pool;
+  unsigned char *region = NULL;
+  apr_global_mutex_t **shared_locks = NULL;
+  apr_uint32_t shared_lock_count = 0;
 
   apr_uint32_t seg;
   apr_uint32_t group_count;
@@ -1853,10 +2191,19 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
   apr_uint64_t max_entry_size;
 
   /* Allocate 1% of the cache capacity to the prefix string pool.
+   * Prefix indexes are process-local, so shared caches must always
+   * store the full keys.  Give them an empty prefix pool.
    */
-  SVN_ERR(prefix_pool_create(&prefix_pool, total_size / 100, thread_safe,
-                             pool));
-  total_size -= total_size / 100;
+  if (shared)
+    {
+      SVN_ERR(prefix_pool_create(&prefix_pool, 0, FALSE, pool));
+    }
+  else
+    {
+      SVN_ERR(prefix_pool_create(&prefix_pool, total_size / 100,
+                                 thread_safe, pool));
+      total_size -= total_size / 100;
+    }
 
   /* Limit the total size (only relevant if we can address > 4GB)
    */
@@ -1910,9 +2257,6 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
          && segment_count < MAX_SEGMENT_COUNT)
     segment_count *= 2;
 
-  /* allocate cache as an array of segments / cache objects */
-  c = apr_palloc(pool, segment_count * sizeof(*c));
-
   /* Split total cache size into segments of equal size
    */
   total_size /= segment_count;
@@ -1963,6 +2307,47 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
   assert(spare_group_count > 0 && main_group_count > 0);
 
   group_init_size = 1 + group_count / (8 * GROUP_INIT_GRANULARITY);
+
+  /* allocate cache as an array of segments / cache objects.
+   * Shared caches get all their segments' buffers from a single region
+   * that we carve up below. */
+  if (shared)
+    {
+      apr_uint64_t region_size
+        = ALIGN_VALUE(segment_count * sizeof(*c))
+        + segment_count * (  ALIGN_VALUE(group_count * sizeof(entry_group_t))
+                           + ALIGN_VALUE(group_init_size)
+                           + ALIGN_VALUE(data_size));
+      if (region_size > APR_SIZE_MAX - ITEM_ALIGNMENT)
+        return svn_error_wrap_apr(APR_ENOMEM, "OOM");
+
+      SVN_ERR(create_shared_region(&region, (apr_size_t)region_size, pool));
+      c = (svn_membuffer_t *)region;
+      region += ALIGN_VALUE(segment_count * sizeof(*c));
+
+      /* Shared segments are serialized by cross-process locks that also
+       * cover all threads within each process.  Keep them in process-local
+       * memory as each process may need to re-initialize them.
+       */
+      shared_lock_count = (apr_uint32_t)MIN(segment_count,
+                                            MAX_SHARED_LOCK_COUNT);
+      shared_locks = apr_pcalloc(pool,
+                                 shared_lock_count * sizeof(*shared_locks));
+      for (seg = 0; seg < shared_lock_count; ++seg)
+        {
+          apr_status_t status =
+              apr_global_mutex_create(&shared_locks[seg], NULL,
+                                      SHARED_LOCK_MECH, pool);
+          if (status)
+            return svn_error_wrap_apr(status,
+                                      _("Can't create shared cache mutex"));
+        }
+    }
+  else
+    {
+      c = apr_palloc(pool, segment_count * sizeof(*c));
+    }
+
   for (seg = 0; seg < segment_count; ++seg)
     {
       /* allocate buffers and initialize cache members
@@ -1978,12 +2363,29 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
       /* Allocate but don't clear / zero the directory because it would add
          significantly to the server start-up time if the caches are large.
          Group initialization will take care of that in stead. */
-      c[seg].directory = apr_palloc(pool,
-                                    group_count * sizeof(entry_group_t));
+      if (shared)
+        {
+          c[seg].directory = (entry_group_t *)region;
+          region += ALIGN_VALUE(group_count * sizeof(entry_group_t));
+        }
+      else
+        {
+          c[seg].directory = apr_palloc(pool,
+                                        group_count * sizeof(entry_group_t));
+        }
 
       /* Allocate and initialize directory entries as "not initialized",
          hence "unused" */
-      c[seg].group_initialized = apr_pcalloc(pool, group_init_size);
+      if (shared)
+        {
+          c[seg].group_initialized = region;
+          memset(region, 0, group_init_size);
+          region += ALIGN_VALUE(group_init_size);
+        }
+      else
+        {
+          c[seg].group_initialized = apr_pcalloc(pool, group_init_size);
+        }
 
       /* Allocate 1/4th of the data buffer to L1
        */
@@ -2004,7 +2406,15 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
       c[seg].l2.current_data = c[seg].l2.start_offset;
 
       /* This cast is safe because DATA_SIZE <= MAX_SEGMENT_SIZE. */
-      c[seg].data = apr_palloc(pool, (apr_size_t)ALIGN_VALUE(data_size));
+      if (shared)
+        {
+          c[seg].data = region;
+          region += ALIGN_VALUE(data_size);
+        }
+      else
+        {
+          c[seg].data = apr_palloc(pool, (apr_size_t)ALIGN_VALUE(data_size));
+        }
       c[seg].data_used = 0;
       c[seg].max_entry_size = max_entry_size;
 
@@ -2012,6 +2422,11 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
       c[seg].total_reads = 0;
       c[seg].total_writes = 0;
       c[seg].total_hits = 0;
+      c[seg].optimistic_reads = 0;
+      c[seg].optimistic_retries = 0;
+      c[seg].lock_waits = 0;
+      c[seg].lock_wait_time = 0;
+      c[seg].write_sequence = 0;
 
       /* were allocations successful?
        * If not, initialize a minimal cache structure.
@@ -2023,27 +2438,35 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
           return svn_error_wrap_apr(APR_ENOMEM, "OOM");
         }
 
+      /* Stripe shared segments over the global mutexes. */
+      c[seg].shared_locks = shared_locks;
+      c[seg].shared_lock_count = shared_lock_count;
+      c[seg].shared_lock_index = shared_lock_count
+                               ? seg % shared_lock_count
+                               : 0;
+
 #if (APR_HAS_THREADS && USE_SIMPLE_MUTEX)
       /* A lock for intra-process synchronization to the cache, or NULL if
        * the cache's creator doesn't feel the cache needs to be
        * thread-safe.
        */
-      SVN_ERR(svn_mutex__init(&c[seg].lock, thread_safe, pool));
+      SVN_ERR(svn_mutex__init(&c[seg].lock, thread_safe && !shared, pool));
 #elif (APR_HAS_THREADS && !USE_SIMPLE_MUTEX)
       /* Same for read-write lock. */
       c[seg].lock = NULL;
-      if (thread_safe)
+      if (thread_safe && !shared)
         {
           apr_status_t status =
               apr_thread_rwlock_create(&(c[seg].lock), pool);
           if (status)
             return svn_error_wrap_apr(status, _("Can't create cache mutex"));
         }
+#endif
 
       /* Select the behavior of write operations.
        */
       c[seg].allow_blocking_writes = allow_blocking_writes;
-#endif
+
       /* No writers at the moment. */
       c[seg].write_lock_count = 0;
     }
@@ -2054,18 +2477,83 @@ svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
   return SVN_NO_ERROR;
 }
 
+svn_error_t *
+svn_cache__membuffer_cache_create(svn_membuffer_t **cache,
+                                  apr_size_t total_size,
+                                  apr_size_t directory_size,
+                                  apr_size_t segment_count,
+                                  svn_boolean_t thread_safe,
+                                  svn_boolean_t allow_blocking_writes,
+                                  apr_pool_t *pool)
+{
+  return svn_error_trace(membuffer_cache_create(cache, total_size,
+                                                directory_size,
+                                                segment_count, thread_safe,
+                                                allow_blocking_writes,
+                                                FALSE, pool));
+}
+
+svn_error_t *
+svn_cache__membuffer_cache_create_shared(svn_membuffer_t **cache,
+                                         apr_size_t total_size,
+                                         apr_size_t directory_size,
+                                         apr_size_t segment_count,
+                                         svn_boolean_t allow_blocking_writes,
+                                         apr_pool_t *pool)
+{
+  return svn_error_trace(membuffer_cache_create(cache, total_size,
+                                                directory_size,
+                                                segment_count, TRUE,
+                                                allow_blocking_writes,
+                                                TRUE, pool));
+}
+
+svn_error_t *
+svn_cache__membuffer_child_init(svn_membuffer_t *cache,
+                                apr_pool_t *pool)
+{
+  apr_uint32_t i;
+
+  if (cache == NULL || cache->shared_locks == NULL)
+    return SVN_NO_ERROR;
+
+  for (i = 0; i < cache->shared_lock_count; ++i)
+    {
+      apr_global_mutex_t **lock = &cache->shared_locks[i];
+      apr_status_t status
+        = apr_global_mutex_child_init(lock,
+                                      apr_global_mutex_lockfile(*lock),
+                                      pool);
+      if (status)
+        return svn_error_wrap_apr(status,
+                                  _("Can't re-open shared cache mutex"));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+apr_array_header_t *
+svn_cache__membuffer_get_mutexes(svn_membuffer_t *cache,
+                                 apr_pool_t *result_pool)
+{
+  apr_uint32_t i;
+  apr_array_header_t *result
+    = apr_array_make(result_pool, MAX_SHARED_LOCK_COUNT,
+                     sizeof(apr_global_mutex_t *));
+
+  if (cache && cache->shared_locks)
+    for (i = 0; i < cache->shared_lock_count; ++i)
+      APR_ARRAY_PUSH(result, apr_global_mutex_t *) = cache->shared_locks[i];
+
+  return result;
+}
+
 svn_error_t *
 svn_cache__membuffer_clear(svn_membuffer_t *cache)
 {
   apr_size_t seg;
   apr_size_t segment_count = cache->segment_count;
 
-  /* Length of the group_initialized array in bytes.
-     See also svn_cache__membuffer_cache_create(). */
-  apr_size_t group_init_size
-    = 1 + (cache->group_count + cache->spare_group_count)
-            / (8 * GROUP_INIT_GRANULARITY);
-
   /* Clear segment by segment.  This implies that other thread may read
      and write to other segments after we cleared them and before the
      last segment is done.
@@ -2078,31 +2566,12 @@ svn_cache__membuffer_clear(svn_membuffer_t *cache)
     {
       /* Unconditionally acquire the write lock. */
       SVN_ERR(force_write_lock_cache(&cache[seg]));
-
-      /* Mark all groups as "not initialized", which implies "empty". */
-      cache[seg].first_spare_group = NO_INDEX;
-      cache[seg].max_spare_used = 0;
-
-      memset(cache[seg].group_initialized, 0, group_init_size);
-
-      /* Unlink L1 contents. */
-      cache[seg].l1.first = NO_INDEX;
-      cache[seg].l1.last = NO_INDEX;
-      cache[seg].l1.next = NO_INDEX;
-      cache[seg].l1.current_data = cache[seg].l1.start_offset;
-
-      /* Unlink L2 contents. */
-      cache[seg].l2.first = NO_INDEX;
-      cache[seg].l2.last = NO_INDEX;
-      cache[seg].l2.next = NO_INDEX;
-      cache[seg].l2.current_data = cache[seg].l2.start_offset;
-
-      /* Reset content counters. */
-      cache[seg].data_used = 0;
-      cache[seg].used_entries = 0;
+      begin_write(&cache[seg]);
+      reset_segment(&cache[seg]);
 
       /* Segment may be used again. */
-      SVN_ERR(unlock_cache(&cache[seg], SVN_NO_ERROR));
+      SVN_ERR(unlock_cache(&cache[seg], end_write(&cache[seg],
+                                                  SVN_NO_ERROR)));
     }
 
   /* done here */
@@ -2363,11 +2832,15 @@ increment_hit_counters(svn_membuffer_t *cache, entry_t *entry)
   /* To minimize the memory footprint of the cache index, we limit local
    * hit counters to 32 bits.  These may overflow but we don't really
    * care because at worst, ENTRY will be dropped from cache once every
-   * few billion hits. */
+   * few billion hits.
+   *
+   * Optimistic readers call this without holding the lock.  A writer may
+   * then have replaced ENTRY in the meantime and we count the hit for the
+   * new item.  That only skews the eviction heuristics a little. */
   svn_atomic_inc(&entry->hit_count);
 
   /* That one is for stats only. */
-  cache->total_hits++;
+  STAT_INC(cache->total_hits);
 }
 
 /* Look for the cache entry in group GROUP_INDEX of CACHE, identified
@@ -2394,7 +2867,7 @@ membuffer_cache_get_internal(svn_membuffer_t *cache,
   /* The actual cache data access needs to sync'ed
    */
   entry = find_entry(cache, group_index, to_find, FALSE);
-  cache->total_reads++;
+  STAT_INC(cache->total_reads);
   if (entry == NULL)
     {
       /* no such entry found.
@@ -2433,6 +2906,141 @@ membuffer_cache_get_internal(svn_membuffer_t *cache,
   return SVN_NO_ERROR;
 }
 
+#if OPTIMISTIC_READS
+
+/* Lock-free variant of find_entry() with FIND_EMPTY being FALSE.
+ *
+ * Writers may modify CACHE while we run, so we check every index read
+ * from the directory before using it and will never access memory outside
+ * the CACHE buffers.  Other than that, the result is only valid if the
+ * caller verifies that no write happened in the meantime.
+ */
+static entry_t *
+find_entry_optimistic(svn_membuffer_t *cache,
+                      apr_uint32_t group_index,
+                      const full_key_t *to_find)
+{
+  apr_uint32_t total_groups = cache->group_count + cache->spare_group_count;
+  apr_uint64_t data_size = cache->l1.size + cache->l2.size;
+  entry_group_t *group = &cache->directory[group_index];
+  apr_size_t chain_length = 0;
+  apr_size_t i;
+
+  if (! is_group_initialized(cache, group_index))
+    return NULL;
+
+  while (1)
+    {
+      apr_size_t used = MIN(group->header.used, GROUP_SIZE);
+      apr_uint32_t next;
+
+      for (i = 0; i < used; ++i)
+        if (entry_keys_match(&group->entries[i].key, &to_find->entry_key))
+          {
+            entry_t *entry = &group->entries[i];
+            apr_uint64_t offset = entry->offset;
+
+            /* If the full key is fully defined in prefix_id & mangeled
+             * key, we are done. */
+            if (!to_find->entry_key.key_len)
+              return entry;
+
+            /* Compare the full key.  The length matched TO_FIND's. */
+            if (   offset + to_find->entry_key.key_len <= data_size
+                && memcmp(to_find->full_key.data, cache->data + offset,
+                          to_find->entry_key.key_len) == 0)
+              return entry;
+
+            return NULL;
+          }
+
+      /* end of chain? */
+      next = group->header.next;
+      if (   next == NO_INDEX
+          || next >= total_groups
+          || ++chain_length > MAX_GROUP_CHAIN_LENGTH)
+        return NULL;
+
+      group = &cache->directory[next];
+    }
+}
+
+/* Try to do what membuffer_cache_get_internal() does but without holding
+ * any lock on CACHE.  Return FALSE if a concurrent write may have
+ * interfered.  The caller must then repeat the lookup under the read lock.
+ */
+static svn_boolean_t
+membuffer_cache_get_optimistic(svn_membuffer_t *cache,
+                               apr_uint32_t group_index,
+                               const full_key_t *to_find,
+                               char **buffer,
+                               apr_size_t *item_size,
+                               apr_pool_t *result_pool)
+{
+  apr_uint32_t sequence = cache->write_sequence;
+  entry_t *entry;
+  apr_uint64_t offset = 0;
+  apr_size_t size = 0;
+  apr_size_t key_len = 0;
+  apr_size_t copy_size;
+
+  READ_BARRIER();
+  if (sequence & 1)
+    {
+      STAT_INC(cache->optimistic_retries);
+      return FALSE;
+    }
+
+  entry = find_entry_optimistic(cache, group_index, to_find);
+  if (entry)
+    {
+      offset = entry->offset;
+      size = entry->size;
+      key_len = entry->key.key_len;
+    }
+
+  /* Did we get a consistent snapshot of the index? */
+  READ_BARRIER();
+  if (cache->write_sequence != sequence)
+    {
+      STAT_INC(cache->optimistic_retries);
+      return FALSE;
+    }
+
+  if (entry == NULL)
+    {
+      STAT_INC(cache->total_reads);
+      STAT_INC(cache->optimistic_reads);
+      *buffer = NULL;
+      *item_size = 0;
+
+      return TRUE;
+    }
+
+  /* OFFSET, SIZE and KEY_LEN are consistent, i.e. the copy will stay
+   * within the data buffer.  A writer may still modify the data while
+   * we copy it, though. */
+  copy_size = ALIGN_VALUE(size) - key_len;
+  *buffer = apr_palloc(result_pool, copy_size);
+  memcpy(*buffer, cache->data + offset + key_len, copy_size);
+
+  READ_BARRIER();
+  if (cache->write_sequence != sequence)
+    {
+      STAT_INC(cache->optimistic_retries);
+      return FALSE;
+    }
+
+  STAT_INC(cache->total_reads);
+  STAT_INC(cache->optimistic_reads);
+  increment_hit_counters(cache, entry);
+  *item_size = size - key_len;
+
+  return TRUE;
+}
+
+#endif /* OPTIMISTIC_READS */
+
 /* Look for the *ITEM identified by KEY. If no item has been stored
  * for KEY, *ITEM will be NULL. Otherwise, the DESERIALIZER is called
  * to re-construct the proper object from the serialized data.
@@ -2453,14 +3061,18 @@ membuffer_cache_get(svn_membuffer_t *cache,
   /* find the entry group that will hold the key.
    */
   group_index = get_group_index(&cache, &key->entry_key);
-  WITH_READ_LOCK(cache,
-                 membuffer_cache_get_internal(cache,
-                                              group_index,
-                                              key,
-                                              &buffer,
-                                              &size,
-                                              DEBUG_CACHE_MEMBUFFER_TAG
-                                              result_pool));
+#if OPTIMISTIC_READS
+  if (!membuffer_cache_get_optimistic(cache, group_index, key,
+                                      &buffer, &size, result_pool))
+#endif
+    WITH_READ_LOCK(cache,
+                   membuffer_cache_get_internal(cache,
+                                                group_index,
+                                                key,
+                                                &buffer,
+                                                &size,
+                                                DEBUG_CACHE_MEMBUFFER_TAG
+                                                result_pool));
 
   /* re-construct the original data object from its serialized form.
    */
@@ -2515,7 +3127,7 @@ membuffer_cache_has_key(svn_membuffer_t *cache,
   /* find the entry group that will hold the key.
    */
   apr_uint32_t group_index = get_group_index(&cache, &key->entry_key);
-  cache->total_reads++;
+  STAT_INC(cache->total_reads);
 
   WITH_READ_LOCK(cache,
                  membuffer_cache_has_key_internal(cache,
@@ -2549,7 +3161,7 @@ membuffer_cache_get_partial_internal(svn_membuffer_t *cache,
                                      apr_pool_t *result_pool)
 {
   entry_t *entry = find_entry(cache, group_index, to_find, FALSE);
-  cache->total_reads++;
+  STAT_INC(cache->total_reads);
   if (entry == NULL)
     {
       *item = NULL;
@@ -2632,7 +3244,7 @@ membuffer_cache_set_partial_internal(svn_membuffer_t *cache,
   /* cache item lookup
    */
   entry_t *entry = find_entry(cache, group_index, to_find, FALSE);
-  cache->total_reads++;
+  STAT_INC(cache->total_reads);
 
   /* this function is a no-op if the item is not in cache
    */
@@ -3452,6 +4064,14 @@ svn_membuffer_get_global_segment_info(svn_membuffer_t *segment,
   info->sets += segment->total_writes;
   info->hits += segment->total_hits;
 
+  info->segments++;
+  info->optimistic_reads += segment->optimistic_reads;
+  info->optimistic_retries += segment->optimistic_retries;
+  info->lock_waits += segment->lock_waits;
+  info->lock_wait_time += segment->lock_wait_time;
+  info->max_segment_lock_waits = MAX(info->max_segment_lock_waits,
+                                     segment->lock_waits);
+
   WITH_READ_LOCK(segment,
                   svn_membuffer_get_segment_info(segment, info, TRUE));
 
@@ -258,6 +258,30 @@ svn_cache__format_info(const svn_cache__info_t *info,
                  / (double)(info->total_entries ? info->total_entries : 1);
 
   const char *histogram = "";
+  const char *contention = "";
+  if (!access_only && info->segments)
+    {
+      double retry_rate = (100.0 * (double)info->optimistic_retries)
+                        / (double)(info->optimistic_reads
+                                   + info->optimistic_retries
+                                   ? info->optimistic_reads
+                                     + info->optimistic_retries
+                                   : 1);
+
+      contention = svn_string_createf(result_pool,
+                            "locks   : %" APR_UINT64_T_FMT " waits"
+                            " (%" APR_UINT64_T_FMT " ms)"
+                            ", max. %" APR_UINT64_T_FMT " waits"
+                            " in one of %" APR_UINT64_T_FMT " segments\n"
+                            "          %" APR_UINT64_T_FMT
+                            " lock-free reads (%5.2f%% retried)\n",
+                            info->lock_waits,
+                            info->lock_wait_time / 1000,
+                            info->max_segment_lock_waits,
+                            info->segments,
+                            info->optimistic_reads, retry_rate)->data;
+    }
+
   if (!access_only)
     {
       svn_stringbuf_t *text = svn_stringbuf_create_empty(result_pool);
@@ -300,7 +324,7 @@ svn_cache__format_info(const svn_cache__info_t *info,
                             " of %" APR_UINT64_T_FMT " MB data cache"
                             " / %" APR_UINT64_T_FMT " MB total cache memory\n"
                             "          %" APR_UINT64_T_FMT " entries (%5.2f%%)"
-                            " of %" APR_UINT64_T_FMT " total\n%s",
+                            " of %" APR_UINT64_T_FMT " total\n%s%s",
 
                             info->id,
 
@@ -315,5 +339,6 @@ svn_cache__format_info(const svn_cache__info_t *info,
 
                             info->used_entries, data_entry_rate,
                             info->total_entries,
+                            contention,
                             histogram);
 }
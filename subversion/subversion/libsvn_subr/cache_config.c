@@ -64,6 +64,16 @@ static svn_cache_config_t cache_settings =
 #endif
 };
 
+/* Number of segments to create in the global membuffer cache.
+ * 0 lets the cache pick a default based on its size.
+ */
+static apr_size_t cache_segment_count = 0;
+
+/* The process-global membuffer cache if it lives in shared memory.
+ * Takes precedence over the process-local one.
+ */
+static svn_membuffer_t *shared_cache = NULL;
+
 /* Get the current FSFS cache configuration. */
 const svn_cache_config_t *
 svn_cache_config_get(void)
@@ -124,7 +134,7 @@ initialize_cache(void *baton, apr_pool_t *unused_pool)
           &cache,
           (apr_size_t)cache_size,
           (apr_size_t)(cache_size / 5),
-          0,
+          cache_segment_count,
           ! svn_cache_config_get()->single_threaded,
           FALSE,
           pool);
@@ -161,8 +171,11 @@ svn_cache__get_global_membuffer_cache(void)
   static svn_membuffer_t *cache = NULL;
   static svn_atomic_t initialized = 0;
 
-  svn_error_t *err
-    = svn_atomic__init_once(&initialized, initialize_cache, &cache, NULL);
+  svn_error_t *err;
+  if (shared_cache)
+    return shared_cache;
+
+  err = svn_atomic__init_once(&initialized, initialize_cache, &cache, NULL);
   if (err)
     {
       /* no caches today ... */
@@ -179,3 +192,57 @@ svn_cache_config_set(const svn_cache_config_t *settings)
   cache_settings = *settings;
 }
 
+void
+svn_cache__set_global_membuffer_segment_count(apr_size_t segment_count)
+{
+  cache_segment_count = segment_count;
+}
+
+/* Pool cleanup function forgetting about the shared global cache
+ * because its memory is about to be released.
+ */
+static apr_status_t
+reset_shared_cache(void *data)
+{
+  shared_cache = NULL;
+
+  return APR_SUCCESS;
+}
+
+svn_error_t *
+svn_cache__create_global_membuffer_shared(apr_pool_t *pool)
+{
+  svn_membuffer_t *cache;
+  apr_pool_t *cache_pool;
+  svn_error_t *err;
+
+  /* Same limit as for the process-local cache. */
+  apr_uint64_t cache_size = MIN(cache_settings.cache_size,
+                                (apr_uint64_t)SVN_MAX_OBJECT_SIZE / 2);
+
+  if (shared_cache || cache_size == 0)
+    return SVN_NO_ERROR;
+
+  /* Release any partially allocated cache upon failure. */
+  cache_pool = svn_pool_create(pool);
+  err = svn_cache__membuffer_cache_create_shared(&cache,
+                                                 (apr_size_t)cache_size,
+                                                 (apr_size_t)(cache_size / 5),
+                                                 cache_segment_count,
+                                                 FALSE,
+                                                 cache_pool);
+  if (err)
+    {
+      svn_pool_destroy(cache_pool);
+      return svn_error_trace(err);
+    }
+
+  /* Registered after the shared memory and lock cleanups, so this runs
+   * before them. */
+  apr_pool_cleanup_register(cache_pool, NULL, reset_shared_cache,
+                            apr_pool_cleanup_null);
+  shared_cache = cache;
+
+  return SVN_NO_ERROR;
+}
+
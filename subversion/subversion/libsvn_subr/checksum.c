@@ -35,6 +35,7 @@
 
 #include "checksum.h"
 #include "fnv1a.h"
+#include "sha1.h"
 
 #include "private/svn_subr_private.h"
 
@@ -64,12 +65,18 @@ static const unsigned char fnv1a_32x4_empty_string_digest_array[] = {
   0xcd, 0x6d, 0x9a, 0x85
 };
 
+/* The 64 bit modified FNV-1a digest for the empty string. */
+static const unsigned char fnv1a_64x4_empty_string_digest_array[] = {
+  0xa1, 0x12, 0xfa, 0x43, 0xc9, 0x92, 0x22, 0xc5
+};
+
 /* Digests for an empty string, indexed by checksum type */
 static const unsigned char * empty_string_digests[] = {
   md5_empty_string_digest_array,
   sha1_empty_string_digest_array,
   fnv1a_32_empty_string_digest_array,
-  fnv1a_32x4_empty_string_digest_array
+  fnv1a_32x4_empty_string_digest_array,
+  fnv1a_64x4_empty_string_digest_array
 };
 
 /* Digest sizes in bytes, indexed by checksum type */
@@ -77,7 +84,8 @@ static const apr_size_t digest_sizes[] = {
   APR_MD5_DIGESTSIZE,
   APR_SHA1_DIGESTSIZE,
   sizeof(apr_uint32_t),
-  sizeof(apr_uint32_t)
+  sizeof(apr_uint32_t),
+  sizeof(apr_uint64_t)
 };
 
 /* Checksum type prefixes used in serialized checksums. */
@@ -86,12 +94,13 @@ static const char *ckind_str[] = {
   "$sha1$",
   "$fnv1$",
   "$fnvm$",
+  "$fnvq$",
   /* ### svn_checksum_deserialize() assumes all these have the same strlen() */
 };
 
 /* Returns the digest size of it's argument. */
 #define DIGESTSIZE(k) \
-  (((k) < svn_checksum_md5 || (k) > svn_checksum_fnv1a_32x4) ? 0 : digest_sizes[k])
+  (((k) < svn_checksum_md5 || (k) > svn_checksum_fnv1a_64x4) ? 0 : digest_sizes[k])
 
 /* Largest supported digest size */
 #define MAX_DIGESTSIZE (MAX(APR_MD5_DIGESTSIZE,APR_SHA1_DIGESTSIZE))
@@ -148,12 +157,21 @@ svn__digests_match(const unsigned char d1[],
           || (memcmp(d1, zeros, digest_size) == 0));
 }
 
+/* Store VALUE in DIGEST as 8 bytes in big endian order. */
+static void
+store_uint64_be(unsigned char *digest, apr_uint64_t value)
+{
+  int i;
+  for (i = 7; i >= 0; --i, value >>= 8)
+    digest[i] = (unsigned char)value;
+}
+
 /* Check to see if KIND is something we recognize.  If not, return
  * SVN_ERR_BAD_CHECKSUM_KIND */
 static svn_error_t *
 validate_kind(svn_checksum_kind_t kind)
 {
-  if (kind >= svn_checksum_md5 && kind <= svn_checksum_fnv1a_32x4)
+  if (kind >= svn_checksum_md5 && kind <= svn_checksum_fnv1a_64x4)
     return SVN_NO_ERROR;
   else
     return svn_error_create(SVN_ERR_BAD_CHECKSUM_KIND, NULL, NULL);
@@ -202,6 +220,7 @@ svn_checksum_create(svn_checksum_kind_t kind,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         digest_size = digest_sizes[kind];
         break;
 
@@ -267,6 +286,7 @@ svn_checksum_match(const svn_checksum_t *checksum1,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return svn__digests_match(checksum1->digest,
                                   checksum2->digest,
                                   digest_sizes[checksum1->kind]);
@@ -287,6 +307,7 @@ svn_checksum_to_cstring_display(const svn_checksum_t *checksum,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return svn__digest_to_cstring_display(checksum->digest,
                                               digest_sizes[checksum->kind],
                                               pool);
@@ -310,6 +331,7 @@ svn_checksum_to_cstring(const svn_checksum_t *checksum,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return svn__digest_to_cstring(checksum->digest,
                                       digest_sizes[checksum->kind],
                                       pool);
@@ -327,7 +349,7 @@ svn_checksum_serialize(const svn_checksum_t *checksum,
                        apr_pool_t *scratch_pool)
 {
   SVN_ERR_ASSERT_NO_RETURN(checksum->kind >= svn_checksum_md5
-                           || checksum->kind <= svn_checksum_fnv1a_32x4);
+                           && checksum->kind <= svn_checksum_fnv1a_64x4);
   return apr_pstrcat(result_pool,
                      ckind_str[checksum->kind],
                      svn_checksum_to_cstring(checksum, scratch_pool),
@@ -353,7 +375,7 @@ svn_checksum_deserialize(const svn_checksum_t **checksum,
                              _("Invalid prefix in checksum '%s'"),
                              data);
 
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     if (strncmp(ckind_str[kind], data, prefix_len) == 0)
       {
         SVN_ERR(svn_checksum_parse_hex(&parsed_checksum, kind,
@@ -460,6 +482,7 @@ svn_checksum_dup(const svn_checksum_t *checksum,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return checksum_create(checksum->kind, checksum->digest, pool);
 
       default:
@@ -475,8 +498,6 @@ svn_checksum(svn_checksum_t **checksum,
              apr_size_t len,
              apr_pool_t *pool)
 {
-  apr_sha1_ctx_t sha1_ctx;
-
   SVN_ERR(validate_kind(kind));
   *checksum = svn_checksum_create(kind, pool);
 
@@ -487,9 +508,7 @@ svn_checksum(svn_checksum_t **checksum,
         break;
 
       case svn_checksum_sha1:
-        apr_sha1_init(&sha1_ctx);
-        apr_sha1_update(&sha1_ctx, data, (unsigned int)len);
-        apr_sha1_final((unsigned char *)(*checksum)->digest, &sha1_ctx);
+        svn__sha1((unsigned char *)(*checksum)->digest, data, len);
         break;
 
       case svn_checksum_fnv1a_32:
@@ -502,6 +521,11 @@ svn_checksum(svn_checksum_t **checksum,
           = htonl(svn__fnv1a_32x4(data, len));
         break;
 
+      case svn_checksum_fnv1a_64x4:
+        store_uint64_be((unsigned char *)(*checksum)->digest,
+                        svn__fnv1a_64x4(data, len));
+        break;
+
       default:
         /* We really shouldn't get here, but if we do... */
         return svn_error_create(SVN_ERR_BAD_CHECKSUM_KIND, NULL, NULL);
@@ -521,6 +545,7 @@ svn_checksum_empty_checksum(svn_checksum_kind_t kind,
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return checksum_create(kind, empty_string_digests[kind], pool);
 
       default:
@@ -550,8 +575,7 @@ svn_checksum_ctx_create(svn_checksum_kind_t kind,
         break;
 
       case svn_checksum_sha1:
-        ctx->apr_ctx = apr_palloc(pool, sizeof(apr_sha1_ctx_t));
-        apr_sha1_init(ctx->apr_ctx);
+        ctx->apr_ctx = svn_sha1__context_create(pool);
         break;
 
       case svn_checksum_fnv1a_32:
@@ -562,6 +586,10 @@ svn_checksum_ctx_create(svn_checksum_kind_t kind,
         ctx->apr_ctx = svn_fnv1a_32x4__context_create(pool);
         break;
 
+      case svn_checksum_fnv1a_64x4:
+        ctx->apr_ctx = svn_fnv1a_64x4__context_create(pool);
+        break;
+
       default:
         SVN_ERR_MALFUNCTION_NO_RETURN();
     }
@@ -580,8 +608,7 @@ svn_checksum_ctx_reset(svn_checksum_ctx_t *ctx)
         break;
 
       case svn_checksum_sha1:
-        memset(ctx->apr_ctx, 0, sizeof(apr_sha1_ctx_t));
-        apr_sha1_init(ctx->apr_ctx);
+        svn_sha1__context_reset(ctx->apr_ctx);
         break;
 
       case svn_checksum_fnv1a_32:
@@ -592,6 +619,10 @@ svn_checksum_ctx_reset(svn_checksum_ctx_t *ctx)
         svn_fnv1a_32x4__context_reset(ctx->apr_ctx);
         break;
 
+      case svn_checksum_fnv1a_64x4:
+        svn_fnv1a_64x4__context_reset(ctx->apr_ctx);
+        break;
+
       default:
         SVN_ERR_MALFUNCTION();
     }
@@ -611,7 +642,7 @@ svn_checksum_update(svn_checksum_ctx_t *ctx,
         break;
 
       case svn_checksum_sha1:
-        apr_sha1_update(ctx->apr_ctx, data, (unsigned int)len);
+        svn_sha1__update(ctx->apr_ctx, data, len);
         break;
 
       case svn_checksum_fnv1a_32:
@@ -622,6 +653,10 @@ svn_checksum_update(svn_checksum_ctx_t *ctx,
         svn_fnv1a_32x4__update(ctx->apr_ctx, data, len);
         break;
 
+      case svn_checksum_fnv1a_64x4:
+        svn_fnv1a_64x4__update(ctx->apr_ctx, data, len);
+        break;
+
       default:
         /* We really shouldn't get here, but if we do... */
         return svn_error_create(SVN_ERR_BAD_CHECKSUM_KIND, NULL, NULL);
@@ -644,7 +679,7 @@ svn_checksum_final(svn_checksum_t **checksum,
         break;
 
       case svn_checksum_sha1:
-        apr_sha1_final((unsigned char *)(*checksum)->digest, ctx->apr_ctx);
+        svn_sha1__final((unsigned char *)(*checksum)->digest, ctx->apr_ctx);
         break;
 
       case svn_checksum_fnv1a_32:
@@ -657,6 +692,11 @@ svn_checksum_final(svn_checksum_t **checksum,
           = htonl(svn_fnv1a_32x4__finalize(ctx->apr_ctx));
         break;
 
+      case svn_checksum_fnv1a_64x4:
+        store_uint64_be((unsigned char *)(*checksum)->digest,
+                        svn_fnv1a_64x4__finalize(ctx->apr_ctx));
+        break;
+
       default:
         /* We really shouldn't get here, but if we do... */
         return svn_error_create(SVN_ERR_BAD_CHECKSUM_KIND, NULL, NULL);
@@ -665,6 +705,35 @@ svn_checksum_final(svn_checksum_t **checksum,
   return SVN_NO_ERROR;
 }
 
+/* svn_checksum__update_pair() feeds the data to both contexts in slices
+ * of this size.  That is small enough for the second pass over each slice
+ * to be served from the L1 cache. */
+#define UPDATE_PAIR_SLICE 0x1000
+
+svn_error_t *
+svn_checksum__update_pair(svn_checksum_ctx_t *ctx1,
+                          svn_checksum_ctx_t *ctx2,
+                          const void *data,
+                          apr_size_t len)
+{
+  const char *input = data;
+
+  if (ctx2 == NULL)
+    return svn_error_trace(svn_checksum_update(ctx1, data, len));
+
+  for (; len > UPDATE_PAIR_SLICE; len -= UPDATE_PAIR_SLICE)
+    {
+      SVN_ERR(svn_checksum_update(ctx1, input, UPDATE_PAIR_SLICE));
+      SVN_ERR(svn_checksum_update(ctx2, input, UPDATE_PAIR_SLICE));
+      input += UPDATE_PAIR_SLICE;
+    }
+
+  SVN_ERR(svn_checksum_update(ctx1, input, len));
+  SVN_ERR(svn_checksum_update(ctx2, input, len));
+
+  return SVN_NO_ERROR;
+}
+
 apr_size_t
 svn_checksum_size(const svn_checksum_t *checksum)
 {
@@ -708,6 +777,7 @@ svn_checksum_is_empty_checksum(svn_checksum_t *checksum)
       case svn_checksum_sha1:
       case svn_checksum_fnv1a_32:
       case svn_checksum_fnv1a_32x4:
+      case svn_checksum_fnv1a_64x4:
         return svn__digests_match(checksum->digest,
                                   svn__empty_string_digest(checksum->kind),
                                   digest_sizes[checksum->kind]);
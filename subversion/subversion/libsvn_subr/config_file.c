@@ -1513,6 +1513,11 @@ svn_config_ensure(const char *config_dir, apr_pool_t *pool)
         "### to show meaningful differences for binary file formats.  [New"  NL
         "### in 1.9]"                                                        NL
         "# diff-ignore-content-type = no"                                    NL
+        "### Set server-blame to 'no' to make 'svn blame' always calculate"  NL
+        "### the blame itself from the revisions of the file, instead of"    NL
+        "### letting servers that support it calculate the blame.  [New in"  NL
+        "### 1.11]"                                                          NL
+        "# server-blame = yes"                                               NL
         ""                                                                   NL
         "### Section for configuring automatic properties."                  NL
         "[auto-props]"                                                       NL
@@ -1554,6 +1559,21 @@ svn_config_ensure(const char *config_dir, apr_pool_t *pool)
         "### returning an error.  The default is 10000, i.e. 10 seconds."    NL
         "### Longer values may be useful when exclusive locking is enabled." NL
         "# busy-timeout = 10000"                                             NL
+        "### Set the number of threads used to read directory listings"     NL
+        "### while walking the working copy for 'svn status'.  Values of"    NL
+        "### 0 or 1 read all directories on the calling thread, which is"    NL
+        "### the default.  Larger values may help on slow or network file"   NL
+        "### systems; status is still reported in the same order."           NL
+        "# status-threads = 0"                                               NL
+        "### Set to true to let 'svn status' and 'svn commit' skip reading"  NL
+        "### directories that a file system watcher did not report as"       NL
+        "### changed in the file .svn/status-journal of the working copy."   NL
+        "### Only enable this while such a watcher is running."             NL
+        "# status-journal = false"                                           NL
+        "### Set the number of threads used to write files into the working" NL
+        "### copy during checkout, update and similar operations.  Values"   NL
+        "### of 0 or 1 write one file at a time, which is the default."      NL
+        "# install-threads = 0"                                              NL
         ;
 
       err = svn_io_file_open(&f, path,
@@ -39,6 +39,12 @@
 #define FNV1_PRIME_32 0x01000193
 #define FNV1_BASE_32 2166136261U
 
+/* FNV-1 64 bit constants taken from
+ * http://www.isthe.com/chongo/tech/comp/fnv/
+ */
+#define FNV1_PRIME_64 APR_UINT64_C(0x100000001b3)
+#define FNV1_BASE_64 APR_UINT64_C(0xcbf29ce484222325)
+
 /* FNV-1a core implementation returning a 32 bit checksum over the first
  * LEN bytes in INPUT.  HASH is the checksum over preceding data (if any).
  */
@@ -114,6 +120,75 @@ finalize_fnv1a_32x4(apr_uint32_t hashes[SCALING],
                   sizeof(apr_uint32_t) * SCALING + len);
 }
 
+/* FNV-1a core implementation returning a 64 bit checksum over the first
+ * LEN bytes in INPUT.  HASH is the checksum over preceding data (if any).
+ */
+static apr_uint64_t
+fnv1a_64(apr_uint64_t hash, const void *input, apr_size_t len)
+{
+  const unsigned char *data = input;
+  const unsigned char *end = data + len;
+
+  for (; data != end; ++data)
+    {
+      hash ^= *data;
+      hash *= FNV1_PRIME_64;
+    }
+
+  return hash;
+}
+
+/* 64 bit variant of fnv1a_32x4.  Update the 4 interleaved checksums in
+ * HASHES over the first LEN bytes in INPUT and return the number of bytes
+ * processed.  LEN - ReturnValue < 4.
+ */
+static apr_size_t
+fnv1a_64x4(apr_uint64_t hashes[SCALING], const void *input, apr_size_t len)
+{
+  const unsigned char *data = input;
+  const unsigned char *end = data + len;
+  for (; data + SCALING <= end; data += SCALING)
+    {
+      hashes[0] ^= data[0];
+      hashes[0] *= FNV1_PRIME_64;
+      hashes[1] ^= data[1];
+      hashes[1] *= FNV1_PRIME_64;
+      hashes[2] ^= data[2];
+      hashes[2] *= FNV1_PRIME_64;
+      hashes[3] ^= data[3];
+      hashes[3] *= FNV1_PRIME_64;
+    }
+
+  return data - (const unsigned char *)input;
+}
+
+/* Combine interleaved HASHES plus LEN bytes from INPUT into a single
+ * 64 bit hash value and return that.  LEN must be < 4.
+ */
+static apr_uint64_t
+finalize_fnv1a_64x4(const apr_uint64_t hashes[SCALING],
+                    const void *input,
+                    apr_size_t len)
+{
+  unsigned char final_data[sizeof(apr_uint64_t) * SCALING + SCALING - 1];
+  apr_size_t i, k;
+  assert(len < SCALING);
+
+  /* Serialize the interleaved checksums in big endian order, so the
+     result does not depend on the platform. */
+  for (i = 0; i < SCALING; ++i)
+    for (k = 0; k < sizeof(apr_uint64_t); ++k)
+      final_data[i * sizeof(apr_uint64_t) + k]
+        = (unsigned char)(hashes[i] >> (8 * (sizeof(apr_uint64_t) - 1 - k)));
+
+  if (len)
+    memcpy(final_data + sizeof(apr_uint64_t) * SCALING, input, len);
+
+  return fnv1a_64(FNV1_BASE_64,
+                  final_data,
+                  sizeof(apr_uint64_t) * SCALING + len);
+}
+
 apr_uint32_t
 svn__fnv1a_32(const void *input, apr_size_t len)
 {
@@ -132,6 +207,18 @@ svn__fnv1a_32x4(const void *input, apr_size_t len)
                              len - processed);
 }
 
+apr_uint64_t
+svn__fnv1a_64x4(const void *input, apr_size_t len)
+{
+  apr_uint64_t hashes[SCALING]
+    = { FNV1_BASE_64, FNV1_BASE_64, FNV1_BASE_64, FNV1_BASE_64 };
+  apr_size_t processed = fnv1a_64x4(hashes, input, len);
+
+  return finalize_fnv1a_64x4(hashes,
+                             (const char *)input + processed,
+                             len - processed);
+}
+
 void
 svn__fnv1a_32x4_raw(apr_uint32_t hashes[4],
                     const void *input,
@@ -261,3 +348,74 @@ svn_fnv1a_32x4__finalize(svn_fnv1a_32x4__context_t *context)
                              context->buffer,
                              context->buffered);
 }
+
+
+struct svn_fnv1a_64x4__context_t
+{
+  apr_uint64_t hashes[SCALING];
+  apr_size_t buffered;
+  char buffer[SCALING];
+};
+
+svn_fnv1a_64x4__context_t *
+svn_fnv1a_64x4__context_create(apr_pool_t *pool)
+{
+  svn_fnv1a_64x4__context_t *context = apr_palloc(pool, sizeof(*context));
+  svn_fnv1a_64x4__context_reset(context);
+
+  return context;
+}
+
+void
+svn_fnv1a_64x4__context_reset(svn_fnv1a_64x4__context_t *context)
+{
+  context->hashes[0] = FNV1_BASE_64;
+  context->hashes[1] = FNV1_BASE_64;
+  context->hashes[2] = FNV1_BASE_64;
+  context->hashes[3] = FNV1_BASE_64;
+
+  context->buffered = 0;
+}
+
+void
+svn_fnv1a_64x4__update(svn_fnv1a_64x4__context_t *context,
+                       const void *data,
+                       apr_size_t len)
+{
+  apr_size_t processed;
+
+  if (context->buffered)
+    {
+      apr_size_t to_copy = SCALING - context->buffered;
+      if (to_copy > len)
+        {
+          memcpy(context->buffer + context->buffered, data, len);
+          context->buffered += len;
+          return;
+        }
+
+      memcpy(context->buffer + context->buffered, data, to_copy);
+      data = (const char *)data + to_copy;
+      len -= to_copy;
+
+      fnv1a_64x4(context->hashes, context->buffer, SCALING);
+      context->buffered = 0;
+    }
+
+  processed = fnv1a_64x4(context->hashes, data, len);
+  if (processed != len)
+    {
+      context->buffered = len - processed;
+      memcpy(context->buffer,
+             (const char*)data + processed,
+             len - processed);
+    }
+}
+
+apr_uint64_t
+svn_fnv1a_64x4__finalize(svn_fnv1a_64x4__context_t *context)
+{
+  return finalize_fnv1a_64x4(context->hashes,
+                             context->buffer,
+                             context->buffered);
+}
@@ -86,6 +86,36 @@ svn_fnv1a_32x4__update(svn_fnv1a_32x4__context_t *context,
 apr_uint32_t
 svn_fnv1a_32x4__finalize(svn_fnv1a_32x4__context_t *context);
 
+
+/* Opaque 64 bit modified FNV-1a checksum creation context type.
+ */
+typedef struct svn_fnv1a_64x4__context_t svn_fnv1a_64x4__context_t;
+
+/* Return a new 64 bit modified FNV-1a checksum creation context allocated
+ * in POOL.
+ */
+svn_fnv1a_64x4__context_t *
+svn_fnv1a_64x4__context_create(apr_pool_t *pool);
+
+/* Reset the 64 bit modified FNV-1a checksum CONTEXT to initial state.
+ */
+void
+svn_fnv1a_64x4__context_reset(svn_fnv1a_64x4__context_t *context);
+
+/* Feed LEN bytes from DATA into the 64 bit modified FNV-1a checksum
+ * creation CONTEXT.
+ */
+void
+svn_fnv1a_64x4__update(svn_fnv1a_64x4__context_t *context,
+                       const void *data,
+                       apr_size_t len);
+
+/* Return the 64 bit modified FNV-1a checksum over all data fed into
+ * CONTEXT.
+ */
+apr_uint64_t
+svn_fnv1a_64x4__finalize(svn_fnv1a_64x4__context_t *context);
+
 /* Set HASHES to the 4 partial hash sums produced by the modified FVN-1a
  * over INPUT of LEN bytes.
  */
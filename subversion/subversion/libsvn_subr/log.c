@@ -306,6 +306,14 @@ svn_log__get_file_revs(const char *path, svn_revnum_t start, svn_revnum_t end,
                       log_include_merged_revisions(include_merged_revisions));
 }
 
+const char *
+svn_log__get_file_blame(const char *path, svn_revnum_t start,
+                        svn_revnum_t end, apr_pool_t *pool)
+{
+  return apr_psprintf(pool, "get-file-blame %s r%ld:%ld",
+                      svn_path_uri_encode(path, pool), start, end);
+}
+
 const char *
 svn_log__lock(apr_hash_t *targets,
               svn_boolean_t steal, apr_pool_t *pool)
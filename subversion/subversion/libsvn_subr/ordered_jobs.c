@@ -0,0 +1,326 @@
+/* ordered_jobs.c --- process a range of items on worker threads, in order
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
+
+#include "svn_pools.h"
+#include "svn_private_config.h"
+
+#include "private/svn_atomic.h"
+#include "private/svn_ordered_jobs.h"
+
+#if APR_HAS_THREADS
+
+/* Outcome of a single item. */
+typedef struct result_slot_t
+{
+  /* Thread-safe root pool for RESULT.  Owned by the worker while DONE is
+     not set and by the calling thread otherwise. */
+  apr_pool_t *pool;
+
+  /* Set once the worker completed this item. */
+  svn_boolean_t done;
+
+  /* What the run function returned. */
+  void *result;
+  svn_error_t *err;
+} result_slot_t;
+
+/* A worker thread. */
+typedef struct worker_t
+{
+  /* The thread and its private, thread-safe root pool. */
+  apr_thread_t *thread;
+  apr_pool_t *pool;
+
+  /* As returned by the init function. */
+  void *baton;
+
+  /* Shared state. */
+  svn_ordered_jobs__t *jobs;
+} worker_t;
+
+struct svn_ordered_jobs__t
+{
+  /* Serializes access to all members that are not marked as constant. */
+  apr_thread_mutex_t *mutex;
+
+  /* Signaled whenever a result has been stored or released. */
+  apr_thread_cond_t *changed;
+
+  /* Set if workers shall stop as soon as possible.  May be read without
+     holding MUTEX. */
+  volatile svn_atomic_t aborted;
+
+  /* Next item to be claimed by some worker. */
+  apr_int64_t next_item;
+
+  /* The item the calling thread is waiting for.  Older ones have been
+     released already. */
+  apr_int64_t current_item;
+
+  /* End of the item range.  Constant. */
+  apr_int64_t end_item;
+
+  /* Ring buffer of WINDOW slots, indexed by item.  Constant. */
+  result_slot_t *slots;
+  int window;
+
+  /* The workers (worker_t *).  Only used by the calling thread. */
+  apr_array_header_t *workers;
+
+  /* Callback and its baton.  Constant. */
+  svn_ordered_jobs__run_func_t run_func;
+  void *baton;
+
+  /* Set by svn_ordered_jobs__stop().  Only used by the calling thread. */
+  svn_boolean_t stopped;
+};
+
+/* Implement svn_cancel_func_t for workers.  BATON is a
+   svn_ordered_jobs__t. */
+static svn_error_t *
+worker_cancel(void *baton)
+{
+  svn_ordered_jobs__t *jobs = baton;
+  if (svn_atomic_read(&jobs->aborted))
+    return svn_error_create(SVN_ERR_CANCELLED, NULL, NULL);
+
+  return SVN_NO_ERROR;
+}
+
+/* Thread function for the worker_t given by DATA. */
+static void * APR_THREAD_FUNC
+worker_run(apr_thread_t *tid,
+           void *data)
+{
+  worker_t *worker = data;
+  svn_ordered_jobs__t *jobs = worker->jobs;
+  apr_pool_t *iterpool = svn_pool_create(worker->pool);
+
+  while (TRUE)
+    {
+      apr_int64_t item = -1;
+      result_slot_t *slot;
+      void *result = NULL;
+      svn_error_t *err;
+
+      svn_pool_clear(iterpool);
+
+      /* Claim the next item unless we would get too far ahead. */
+      apr_thread_mutex_lock(jobs->mutex);
+      while (   !svn_atomic_read(&jobs->aborted)
+             && jobs->next_item < jobs->end_item
+             && jobs->next_item >= jobs->current_item + jobs->window)
+        apr_thread_cond_wait(jobs->changed, jobs->mutex);
+
+      if (   !svn_atomic_read(&jobs->aborted)
+          && jobs->next_item < jobs->end_item)
+        item = jobs->next_item++;
+      apr_thread_mutex_unlock(jobs->mutex);
+
+      if (item < 0)
+        break;
+
+      /* The slot is ours until we mark it as done. */
+      slot = &jobs->slots[item % jobs->window];
+      err = jobs->run_func(&result, jobs->baton, worker->baton, item,
+                           worker_cancel, jobs, slot->pool, iterpool);
+
+      apr_thread_mutex_lock(jobs->mutex);
+      slot->result = result;
+      slot->err = err;
+      slot->done = TRUE;
+      apr_thread_cond_broadcast(jobs->changed);
+      apr_thread_mutex_unlock(jobs->mutex);
+    }
+
+  svn_pool_destroy(iterpool);
+  apr_thread_exit(tid, APR_SUCCESS);
+
+  return NULL;
+}
+
+/* Pool cleanup handler calling svn_ordered_jobs__stop() for DATA. */
+static apr_status_t
+stop_jobs(void *data)
+{
+  svn_ordered_jobs__stop(data);
+  return APR_SUCCESS;
+}
+
+svn_error_t *
+svn_ordered_jobs__start(svn_ordered_jobs__t **jobs_p,
+                        apr_int64_t first_item,
+                        apr_int64_t end_item,
+                        int threads,
+                        int window,
+                        svn_ordered_jobs__init_func_t init_func,
+                        svn_ordered_jobs__run_func_t run_func,
+                        void *baton,
+                        apr_pool_t *result_pool,
+                        apr_pool_t *scratch_pool)
+{
+  svn_ordered_jobs__t *jobs = apr_pcalloc(result_pool, sizeof(*jobs));
+  svn_error_t *err = SVN_NO_ERROR;
+  apr_status_t status;
+  int i;
+
+  SVN_ERR_ASSERT(first_item >= 0 && first_item <= end_item);
+  SVN_ERR_ASSERT(threads > 0 && window >= threads);
+
+  /* There is no point in having more workers than items. */
+  if (threads > end_item - first_item)
+    threads = (int)(end_item - first_item);
+
+  status = apr_thread_mutex_create(&jobs->mutex, APR_THREAD_MUTEX_DEFAULT,
+                                   result_pool);
+  if (!status)
+    status = apr_thread_cond_create(&jobs->changed, result_pool);
+  if (status)
+    return svn_error_wrap_apr(status, _("Can't create thread sync"));
+
+  jobs->next_item = first_item;
+  jobs->current_item = first_item;
+  jobs->end_item = end_item;
+  jobs->window = window;
+  jobs->slots = apr_pcalloc(result_pool, window * sizeof(*jobs->slots));
+  for (i = 0; i < window; ++i)
+    jobs->slots[i].pool = svn_pool_create(NULL);
+  jobs->workers = apr_array_make(result_pool, threads, sizeof(worker_t *));
+  jobs->run_func = run_func;
+  jobs->baton = baton;
+
+  /* From here on, stopping releases everything allocated above. */
+  apr_pool_cleanup_register(result_pool, jobs, stop_jobs,
+                            apr_pool_cleanup_null);
+
+  /* Set up all workers up-front such that setup errors get reported
+     right away and not as part of some random item. */
+  for (i = 0; i < threads && !err; ++i)
+    {
+      worker_t *worker;
+      apr_pool_t *worker_pool = svn_pool_create(NULL);
+
+      worker = apr_pcalloc(worker_pool, sizeof(*worker));
+      worker->pool = worker_pool;
+      worker->jobs = jobs;
+      APR_ARRAY_PUSH(jobs->workers, worker_t *) = worker;
+
+      if (init_func)
+        err = init_func(&worker->baton, baton, worker_pool, scratch_pool);
+    }
+
+  for (i = 0; i < jobs->workers->nelts && !err; ++i)
+    {
+      worker_t *worker = APR_ARRAY_IDX(jobs->workers, i, worker_t *);
+
+      status = apr_thread_create(&worker->thread, NULL, worker_run,
+                                 worker, worker->pool);
+      if (status)
+        err = svn_error_wrap_apr(status, _("Can't create thread"));
+    }
+
+  if (err)
+    {
+      svn_ordered_jobs__stop(jobs);
+      return svn_error_trace(err);
+    }
+
+  *jobs_p = jobs;
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_ordered_jobs__next(void **result,
+                       svn_ordered_jobs__t *jobs)
+{
+  result_slot_t *slot = &jobs->slots[jobs->current_item % jobs->window];
+  svn_error_t *err;
+
+  SVN_ERR_ASSERT(!jobs->stopped && jobs->current_item < jobs->end_item);
+
+  apr_thread_mutex_lock(jobs->mutex);
+  while (!slot->done)
+    apr_thread_cond_wait(jobs->changed, jobs->mutex);
+  apr_thread_mutex_unlock(jobs->mutex);
+
+  *result = slot->result;
+  err = slot->err;
+  slot->err = SVN_NO_ERROR;
+
+  return svn_error_trace(err);
+}
+
+void
+svn_ordered_jobs__release(svn_ordered_jobs__t *jobs)
+{
+  result_slot_t *slot = &jobs->slots[jobs->current_item % jobs->window];
+
+  /* Hand the slot back to the workers. */
+  svn_pool_clear(slot->pool);
+  slot->result = NULL;
+
+  apr_thread_mutex_lock(jobs->mutex);
+  slot->done = FALSE;
+  jobs->current_item++;
+  apr_thread_cond_broadcast(jobs->changed);
+  apr_thread_mutex_unlock(jobs->mutex);
+}
+
+void
+svn_ordered_jobs__stop(svn_ordered_jobs__t *jobs)
+{
+  int i;
+
+  if (jobs->stopped)
+    return;
+  jobs->stopped = TRUE;
+
+  apr_thread_mutex_lock(jobs->mutex);
+  svn_atomic_set(&jobs->aborted, TRUE);
+  apr_thread_cond_broadcast(jobs->changed);
+  apr_thread_mutex_unlock(jobs->mutex);
+
+  for (i = 0; i < jobs->workers->nelts; ++i)
+    {
+      worker_t *worker = APR_ARRAY_IDX(jobs->workers, i, worker_t *);
+      apr_status_t retval;
+
+      if (worker->thread)
+        apr_thread_join(&retval, worker->thread);
+      svn_pool_destroy(worker->pool);
+    }
+
+  for (i = 0; i < jobs->window; ++i)
+    {
+      result_slot_t *slot = &jobs->slots[i];
+      if (slot->done)
+        svn_error_clear(slot->err);
+      svn_pool_destroy(slot->pool);
+    }
+}
+
+#endif /* APR_HAS_THREADS */
@@ -0,0 +1,657 @@
+/*
+ * sha1.c :  SHA-1 checksums using CPU extensions where available
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include <string.h>
+
+#include <apr_sha1.h>
+
+#include "private/svn_atomic.h"
+#include "sha1.h"
+
+/* Select the block function to use if the CPU supports it.  x86 CPUs
+ * report the SHA extensions at runtime, so we compile that code path
+ * with the respective target options and pick it only after checking
+ * CPUID.  On AArch64, the compiler tells us whether we may assume the
+ * crypto extensions.  In all other cases, we simply use APR.
+ *
+ * Define SVN_DISABLE_SHA1_EXTENSIONS to always use the APR code.
+ */
+#if defined(SVN_DISABLE_SHA1_EXTENSIONS)
+  /* APR only */
+#elif defined(__GNUC__) && (defined(__clang__) || __GNUC__ >= 5) \
+   && (defined(__x86_64__) || defined(__i386__))
+#  include <cpuid.h>
+#  include <immintrin.h>
+#  define SHA1_X86
+#  define SHA1_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#elif defined(_MSC_VER) && _MSC_VER >= 1900 \
+   && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  include <immintrin.h>
+#  define SHA1_X86
+#  define SHA1_TARGET
+#elif defined(__aarch64__) \
+   && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+#  include <arm_neon.h>
+#  define SHA1_ARMV8
+#endif
+
+#if defined(SHA1_X86) || defined(SHA1_ARMV8)
+#  define SHA1_BLOCKS
+#endif
+
+/* SHA-1 processes the data in blocks of this many bytes. */
+#define SHA1_BLOCK_SIZE 64
+
+/* apr_sha1_update() takes at most this many bytes per call. */
+#define APR_SHA1_MAX_CHUNK 0x40000000
+
+struct svn_sha1__context_t
+{
+  /* If set, delegate everything to APR_CTX. */
+  svn_boolean_t use_apr;
+  apr_sha1_ctx_t apr_ctx;
+
+  /* State used by sha1_blocks(). */
+  apr_uint32_t state[5];
+
+  /* Total number of bytes fed into this context. */
+  apr_uint64_t length;
+
+  /* Incomplete block data that we could not process yet. */
+  apr_size_t buffered;
+  unsigned char buffer[SHA1_BLOCK_SIZE];
+};
+
+#ifdef SHA1_BLOCKS
+
+#ifdef SHA1_X86
+
+/* Run the SHA-1 compression function over COUNT blocks of 64 bytes each
+ * starting at DATA and update STATE accordingly.  This uses the x86 SHA
+ * extensions.  Only call this after detect_sha1_extensions() found them.
+ */
+static SHA1_TARGET void
+sha1_blocks(apr_uint32_t state[5],
+            const unsigned char *data,
+            apr_size_t count)
+{
+  const __m128i mask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                    8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i abcd, e0, e1, msg0, msg1, msg2, msg3;
+
+  abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1b);
+  e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+  for (; count; --count, data += SHA1_BLOCK_SIZE)
+    {
+      __m128i abcd_save = abcd;
+      __m128i e0_save = e0;
+
+      /* Rounds 0-3 */
+      msg0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)),
+                                 mask);
+      e0 = _mm_add_epi32(e0, msg0);
+      e1 = abcd;
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+      /* Rounds 4-7 */
+      msg1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)),
+                                 mask);
+      e1 = _mm_sha1nexte_epu32(e1, msg1);
+      e0 = abcd;
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+      msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+      /* Rounds 8-11 */
+      msg2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)),
+                                 mask);
+      e0 = _mm_sha1nexte_epu32(e0, msg2);
+      e1 = abcd;
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+      msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+      msg0 = _mm_xor_si128(msg0, msg2);
+
+      /* Rounds 12-15 */
+      msg3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)),
+                                 mask);
+      e1 = _mm_sha1nexte_epu32(e1, msg3);
+      e0 = abcd;
+      msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+      msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+      msg1 = _mm_xor_si128(msg1, msg3);
+
+      /* Rounds 16-19 */
+      e0 = _mm_sha1nexte_epu32(e0, msg0);
+      e1 = abcd;
+      msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+      msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+      msg2 = _mm_xor_si128(msg2, msg0);
+
+      /* Rounds 20-23 */
+      e1 = _mm_sha1nexte_epu32(e1, msg1);
+      e0 = abcd;
+      msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+      msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+      msg3 = _mm_xor_si128(msg3, msg1);
+
+      /* Rounds 24-27 */
+      e0 = _mm_sha1nexte_epu32(e0, msg2);
+      e1 = abcd;
+      msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+      msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+      msg0 = _mm_xor_si128(msg0, msg2);
+
+      /* Rounds 28-31 */
+      e1 = _mm_sha1nexte_epu32(e1, msg3);
+      e0 = abcd;
+      msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+      msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+      msg1 = _mm_xor_si128(msg1, msg3);
+
+      /* Rounds 32-35 */
+      e0 = _mm_sha1nexte_epu32(e0, msg0);
+      e1 = abcd;
+      msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+      msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+      msg2 = _mm_xor_si128(msg2, msg0);
+
+      /* Rounds 36-39 */
+      e1 = _mm_sha1nexte_epu32(e1, msg1);
+      e0 = abcd;
+      msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+      msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+      msg3 = _mm_xor_si128(msg3, msg1);
+
+      /* Rounds 40-43 */
+      e0 = _mm_sha1nexte_epu32(e0, msg2);
+      e1 = abcd;
+      msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+      msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+      msg0 = _mm_xor_si128(msg0, msg2);
+
+      /* Rounds 44-47 */
+      e1 = _mm_sha1nexte_epu32(e1, msg3);
+      e0 = abcd;
+      msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+      msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+      msg1 = _mm_xor_si128(msg1, msg3);
+
+      /* Rounds 48-51 */
+      e0 = _mm_sha1nexte_epu32(e0, msg0);
+      e1 = abcd;
+      msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+      msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+      msg2 = _mm_xor_si128(msg2, msg0);
+
+      /* Rounds 52-55 */
+      e1 = _mm_sha1nexte_epu32(e1, msg1);
+      e0 = abcd;
+      msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+      msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+      msg3 = _mm_xor_si128(msg3, msg1);
+
+      /* Rounds 56-59 */
+      e0 = _mm_sha1nexte_epu32(e0, msg2);
+      e1 = abcd;
+      msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+      msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+      msg0 = _mm_xor_si128(msg0, msg2);
+
+      /* Rounds 60-63 */
+      e1 = _mm_sha1nexte_epu32(e1, msg3);
+      e0 = abcd;
+      msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+      msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+      msg1 = _mm_xor_si128(msg1, msg3);
+
+      /* Rounds 64-67 */
+      e0 = _mm_sha1nexte_epu32(e0, msg0);
+      e1 = abcd;
+      msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+      msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+      msg2 = _mm_xor_si128(msg2, msg0);
+
+      /* Rounds 68-71 */
+      e1 = _mm_sha1nexte_epu32(e1, msg1);
+      e0 = abcd;
+      msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+      msg3 = _mm_xor_si128(msg3, msg1);
+
+      /* Rounds 72-75 */
+      e0 = _mm_sha1nexte_epu32(e0, msg2);
+      e1 = abcd;
+      msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+      abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+      /* Rounds 76-79 */
+      e1 = _mm_sha1nexte_epu32(e1, msg3);
+      e0 = abcd;
+      abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+
+      e0 = _mm_sha1nexte_epu32(e0, e0_save);
+      abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+  _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = (apr_uint32_t)_mm_extract_epi32(e0, 3);
+}
+
+/* Set REGS to EAX, EBX, ECX and EDX as returned by CPUID for LEAF. */
+static void
+get_cpuid(unsigned int regs[4], unsigned int leaf)
+{
+#ifdef _MSC_VER
+  int info[4];
+  __cpuidex(info, (int)leaf, 0);
+  regs[0] = info[0];
+  regs[1] = info[1];
+  regs[2] = info[2];
+  regs[3] = info[3];
+#else
+  __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+#endif /* SHA1_X86 */
+
+#ifdef SHA1_ARMV8
+
+/* Run the SHA-1 compression function over COUNT blocks of 64 bytes each
+ * starting at DATA and update STATE accordingly.  This uses the ARMv8
+ * crypto extensions.
+ */
+static void
+sha1_blocks(apr_uint32_t state[5],
+            const unsigned char *data,
+            apr_size_t count)
+{
+  static const apr_uint32_t k[4]
+    = { 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6 };
+  uint32x4_t abcd, msg0, msg1, msg2, msg3, tmp0, tmp1;
+  apr_uint32_t e0, e1;
+
+  abcd = vld1q_u32(state);
+  e0 = state[4];
+
+  for (; count; --count, data += SHA1_BLOCK_SIZE)
+    {
+      uint32x4_t abcd_save = abcd;
+      apr_uint32_t e0_save = e0;
+
+      msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+      msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+      msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+      msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+      tmp0 = vaddq_u32(msg0, vdupq_n_u32(k[0]));
+      tmp1 = vaddq_u32(msg1, vdupq_n_u32(k[0]));
+
+      /* Rounds 0-3 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg2, vdupq_n_u32(k[0]));
+      msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+      /* Rounds 4-7 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg3, vdupq_n_u32(k[0]));
+      msg0 = vsha1su1q_u32(msg0, msg3);
+      msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+      /* Rounds 8-11 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg0, vdupq_n_u32(k[0]));
+      msg1 = vsha1su1q_u32(msg1, msg0);
+      msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+      /* Rounds 12-15 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg1, vdupq_n_u32(k[1]));
+      msg2 = vsha1su1q_u32(msg2, msg1);
+      msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+      /* Rounds 16-19 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg2, vdupq_n_u32(k[1]));
+      msg3 = vsha1su1q_u32(msg3, msg2);
+      msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+      /* Rounds 20-23 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg3, vdupq_n_u32(k[1]));
+      msg0 = vsha1su1q_u32(msg0, msg3);
+      msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+      /* Rounds 24-27 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg0, vdupq_n_u32(k[1]));
+      msg1 = vsha1su1q_u32(msg1, msg0);
+      msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+      /* Rounds 28-31 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg1, vdupq_n_u32(k[1]));
+      msg2 = vsha1su1q_u32(msg2, msg1);
+      msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+      /* Rounds 32-35 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg2, vdupq_n_u32(k[2]));
+      msg3 = vsha1su1q_u32(msg3, msg2);
+      msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+      /* Rounds 36-39 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg3, vdupq_n_u32(k[2]));
+      msg0 = vsha1su1q_u32(msg0, msg3);
+      msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+      /* Rounds 40-43 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg0, vdupq_n_u32(k[2]));
+      msg1 = vsha1su1q_u32(msg1, msg0);
+      msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+      /* Rounds 44-47 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg1, vdupq_n_u32(k[2]));
+      msg2 = vsha1su1q_u32(msg2, msg1);
+      msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+      /* Rounds 48-51 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg2, vdupq_n_u32(k[2]));
+      msg3 = vsha1su1q_u32(msg3, msg2);
+      msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+      /* Rounds 52-55 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg3, vdupq_n_u32(k[3]));
+      msg0 = vsha1su1q_u32(msg0, msg3);
+      msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+      /* Rounds 56-59 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg0, vdupq_n_u32(k[3]));
+      msg1 = vsha1su1q_u32(msg1, msg0);
+      msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+      /* Rounds 60-63 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg1, vdupq_n_u32(k[3]));
+      msg2 = vsha1su1q_u32(msg2, msg1);
+      msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+      /* Rounds 64-67 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e0, tmp0);
+      tmp0 = vaddq_u32(msg2, vdupq_n_u32(k[3]));
+      msg3 = vsha1su1q_u32(msg3, msg2);
+
+      /* Rounds 68-71 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+      tmp1 = vaddq_u32(msg3, vdupq_n_u32(k[3]));
+
+      /* Rounds 72-75 */
+      e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e0, tmp0);
+
+      /* Rounds 76-79 */
+      e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e1, tmp1);
+
+
+      e0 += e0_save;
+      abcd = vaddq_u32(abcd, abcd_save);
+    }
+
+  vst1q_u32(state, abcd);
+  state[4] = e0;
+}
+
+#endif /* SHA1_ARMV8 */
+
+/* Set if sha1_blocks() may be used on this machine. */
+static svn_boolean_t sha1_extensions = FALSE;
+
+/* Implements svn_atomic__str_init_func_t.
+ * Set sha1_extensions if the CPU supports the instructions used by
+ * sha1_blocks().
+ */
+static const char *
+detect_sha1_extensions(void *baton)
+{
+#ifdef SHA1_X86
+  unsigned int regs[4];
+
+  get_cpuid(regs, 0);
+  if (regs[0] >= 7)
+    {
+      /* SSSE3 and SSE4.1 are flagged in ECX of leaf 1,
+         the SHA extensions in EBX of leaf 7. */
+      get_cpuid(regs, 1);
+      if ((regs[2] & (1u << 9)) && (regs[2] & (1u << 19)))
+        {
+          get_cpuid(regs, 7);
+          sha1_extensions = (regs[1] & (1u << 29)) != 0;
+        }
+    }
+#else
+  sha1_extensions = TRUE;
+#endif
+
+  return NULL;
+}
+
+#endif /* SHA1_BLOCKS */
+
+svn_boolean_t
+svn_sha1__is_accelerated(void)
+{
+#ifdef SHA1_BLOCKS
+  static volatile svn_atomic_t detect_state = 0;
+  svn_atomic__init_once_no_error(&detect_state, detect_sha1_extensions, NULL);
+
+  return sha1_extensions;
+#else
+  return FALSE;
+#endif
+}
+
+svn_sha1__context_t *
+svn_sha1__context_create(apr_pool_t *pool)
+{
+  svn_sha1__context_t *context = apr_palloc(pool, sizeof(*context));
+  svn_sha1__context_reset(context);
+
+  return context;
+}
+
+void
+svn_sha1__context_reset(svn_sha1__context_t *context)
+{
+  context->use_apr = !svn_sha1__is_accelerated();
+  if (context->use_apr)
+    {
+      apr_sha1_init(&context->apr_ctx);
+      return;
+    }
+
+  context->state[0] = 0x67452301;
+  context->state[1] = 0xefcdab89;
+  context->state[2] = 0x98badcfe;
+  context->state[3] = 0x10325476;
+  context->state[4] = 0xc3d2e1f0;
+  context->length = 0;
+  context->buffered = 0;
+}
+
+void
+svn_sha1__update(svn_sha1__context_t *context,
+                 const void *data,
+                 apr_size_t len)
+{
+#ifdef SHA1_BLOCKS
+  const unsigned char *input = data;
+  apr_size_t count;
+#endif
+
+  if (context->use_apr)
+    {
+      while (len > APR_SHA1_MAX_CHUNK)
+        {
+          apr_sha1_update(&context->apr_ctx, data, APR_SHA1_MAX_CHUNK);
+          data = (const char *)data + APR_SHA1_MAX_CHUNK;
+          len -= APR_SHA1_MAX_CHUNK;
+        }
+
+      apr_sha1_update(&context->apr_ctx, data, (unsigned int)len);
+      return;
+    }
+
+#ifdef SHA1_BLOCKS
+  context->length += len;
+
+  /* Complete a partial block first. */
+  if (context->buffered)
+    {
+      apr_size_t to_copy = SHA1_BLOCK_SIZE - context->buffered;
+      if (to_copy > len)
+        {
+          memcpy(context->buffer + context->buffered, input, len);
+          context->buffered += len;
+          return;
+        }
+
+      memcpy(context->buffer + context->buffered, input, to_copy);
+      sha1_blocks(context->state, context->buffer, 1);
+      context->buffered = 0;
+
+      input += to_copy;
+      len -= to_copy;
+    }
+
+  /* Process all complete blocks directly from the source buffer. */
+  count = len / SHA1_BLOCK_SIZE;
+  if (count)
+    {
+      sha1_blocks(context->state, input, count);
+      input += count * SHA1_BLOCK_SIZE;
+      len -= count * SHA1_BLOCK_SIZE;
+    }
+
+  /* Keep the rest for later. */
+  memcpy(context->buffer, input, len);
+  context->buffered = len;
+#endif
+}
+
+void
+svn_sha1__final(unsigned char digest[APR_SHA1_DIGESTSIZE],
+                svn_sha1__context_t *context)
+{
+#ifdef SHA1_BLOCKS
+  unsigned char tail[2 * SHA1_BLOCK_SIZE];
+  apr_size_t tail_len;
+  apr_uint64_t bits;
+  int i;
+#endif
+
+  if (context->use_apr)
+    {
+      apr_sha1_final(digest, &context->apr_ctx);
+      return;
+    }
+
+#ifdef SHA1_BLOCKS
+  /* Append the 0x80 marker, zero padding and the 64 bit message length
+     in bits.  That may spill over into a second block. */
+  tail_len = context->buffered + 1 + 8 <= SHA1_BLOCK_SIZE
+           ? SHA1_BLOCK_SIZE
+           : 2 * SHA1_BLOCK_SIZE;
+
+  memcpy(tail, context->buffer, context->buffered);
+  tail[context->buffered] = 0x80;
+  memset(tail + context->buffered + 1, 0,
+         tail_len - context->buffered - 1 - 8);
+
+  bits = context->length * 8;
+  for (i = 0; i < 8; ++i)
+    tail[tail_len - 1 - i] = (unsigned char)(bits >> (8 * i));
+
+  sha1_blocks(context->state, tail, tail_len / SHA1_BLOCK_SIZE);
+
+  for (i = 0; i < 5; ++i)
+    {
+      digest[4 * i + 0] = (unsigned char)(context->state[i] >> 24);
+      digest[4 * i + 1] = (unsigned char)(context->state[i] >> 16);
+      digest[4 * i + 2] = (unsigned char)(context->state[i] >> 8);
+      digest[4 * i + 3] = (unsigned char)(context->state[i]);
+    }
+#endif
+}
+
+void
+svn__sha1(unsigned char digest[APR_SHA1_DIGESTSIZE],
+          const void *input,
+          apr_size_t len)
+{
+  svn_sha1__context_t context;
+
+  svn_sha1__context_reset(&context);
+  svn_sha1__update(&context, input, len);
+  svn_sha1__final(digest, &context);
+}
@@ -35,6 +35,10 @@
 #include "private/svn_dep_compat.h"
 #include "private/svn_string_private.h"
 
+#if SVN_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 #include "svn_private_config.h"
 
 
@@ -1501,6 +1505,20 @@ svn_string__similarity(const svn_string_t *stringa,
     return SVN_STRING__SIM_RANGE_MAX;
 }
 
+#if SVN_HAVE_SSE2
+/* Whether the match length functions below may use the SSE2 code.
+   Only the test suite ever clears this. */
+static svn_boolean_t use_sse2 = TRUE;
+#endif
+
+void
+svn_cstring__set_simd_enabled(svn_boolean_t enabled)
+{
+#if SVN_HAVE_SSE2
+  use_sse2 = enabled;
+#endif
+}
+
 apr_size_t
 svn_cstring__match_length(const char *a,
                           const char *b,
@@ -1508,6 +1526,21 @@ svn_cstring__match_length(const char *a,
 {
   apr_size_t pos = 0;
 
+#if SVN_HAVE_SSE2
+
+  /* Compare 16 bytes at a time.  Unaligned loads are fine here.
+   * Upon mismatch, the code below will find the exact position. */
+  for (; use_sse2 && max_len - pos >= sizeof(__m128i);
+       pos += sizeof(__m128i))
+    {
+      __m128i va = _mm_loadu_si128((const __m128i *)(a + pos));
+      __m128i vb = _mm_loadu_si128((const __m128i *)(b + pos));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xffff)
+        break;
+    }
+
+#endif
+
 #if SVN_UNALIGNED_ACCESS_IS_OK
 
   /* Chunky processing is so much faster ...
@@ -1536,6 +1569,24 @@ svn_cstring__reverse_match_length(const char *a,
 {
   apr_size_t pos = 0;
 
+#if SVN_HAVE_SSE2
+
+  /* Same as in svn_cstring__match_length but backwards. */
+  if (use_sse2)
+    {
+      for (pos = sizeof(__m128i); pos <= max_len; pos += sizeof(__m128i))
+        {
+          __m128i va = _mm_loadu_si128((const __m128i *)(a - pos));
+          __m128i vb = _mm_loadu_si128((const __m128i *)(b - pos));
+          if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xffff)
+            break;
+        }
+
+      pos -= sizeof(__m128i);
+    }
+
+#endif
+
 #if SVN_UNALIGNED_ACCESS_IS_OK
 
   /* Chunky processing is so much faster ...
@@ -1544,7 +1595,7 @@ svn_cstring__reverse_match_length(const char *a,
    * because A and B will probably have different alignment. So, skipping
    * the first few chars until alignment is reached is not an option.
    */
-  for (pos = sizeof(apr_size_t); pos <= max_len; pos += sizeof(apr_size_t))
+  for (pos += sizeof(apr_size_t); pos <= max_len; pos += sizeof(apr_size_t))
     if (*(const apr_size_t*)(a - pos) != *(const apr_size_t*)(b - pos))
       break;
 
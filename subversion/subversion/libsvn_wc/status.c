@@ -29,6 +29,10 @@
 #include <apr_pools.h>
 #include <apr_file_io.h>
 #include <apr_hash.h>
+#include <apr_strings.h>
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
 
 #include "svn_pools.h"
 #include "svn_types.h"
@@ -46,6 +50,7 @@
 
 #include "wc.h"
 #include "props.h"
+#include "status_journal.h"
 
 #include "private/svn_sorts_private.h"
 #include "private/svn_wc_private.h"
@@ -100,6 +105,12 @@ struct walk_status_baton
 
   /* Repository locks, if set. */
   apr_hash_t *repos_locks;
+
+  /* Reads directories ahead of the walk, if not NULL. */
+  struct dirent_prefetch_t *prefetch;
+
+  /* Tells which directories need to be read, if not NULL. */
+  svn_wc__status_journal_t *journal;
 };
 
 /*** Editor batons ***/
@@ -1188,6 +1199,439 @@ one_child_status(const struct walk_status_baton *wb,
   return SVN_NO_ERROR;
 }
 
+/*** Reading directories in parallel ***/
+
+/* Walking the status of a large working copy spends much of its time
+   waiting for the file system to list directories.  The prefetcher
+   below lets a few worker threads read the directories that the walk
+   is about to enter, while the walk itself and all wc.db access stay
+   on the calling thread, so the order in which status is reported does
+   not change.
+
+   Directories are queued in the order the walk will visit them; the
+   children of a directory are put in front of whatever is still queued,
+   which matches the depth-first walk.  When the walk needs a directory
+   that no worker has started on yet, it reads it itself. */
+
+/* Maximum number of directory listings read ahead per worker thread
+   that have not yet been taken by the walk. */
+#define PREFETCH_READY_PER_THREAD 16
+
+/* State of a prefetch_slot_t. */
+typedef enum prefetch_state_e
+{
+  prefetch_queued,
+  prefetch_running,
+  prefetch_done
+} prefetch_state_e;
+
+/* One directory to read. */
+typedef struct prefetch_slot_t
+{
+  /* The directory to read. */
+  const char *local_abspath;
+
+  /* The result of reading it, allocated in POOL. */
+  apr_hash_t *dirents;
+  svn_error_t *err;
+
+  /* Root pool created by the worker reading this slot; NULL before. */
+  apr_pool_t *pool;
+
+  prefetch_state_e state;
+
+  /* Set when the walk no longer wants the result of a running slot; the
+     worker then releases it instead of marking it done. */
+  svn_boolean_t abandoned;
+
+  /* Link in the queue while STATE is prefetch_queued. */
+  struct prefetch_slot_t *next;
+} prefetch_slot_t;
+
+struct dirent_prefetch_t
+{
+  /* Passed to svn_io_get_dirents3(). */
+  svn_boolean_t only_check_type;
+
+#if APR_HAS_THREADS
+  /* Protects all members below and the STATE and NEXT members of all
+     slots. */
+  apr_thread_mutex_t *mutex;
+
+  /* Signalled whenever the queue, a slot's state or SHUTDOWN changes. */
+  apr_thread_cond_t *cond;
+
+  /* The worker threads and the private root pool they were created in.
+     The threads must not live in a pool owned by the walk: that would be
+     destroyed before the threads are joined. */
+  apr_array_header_t *threads;
+  apr_pool_t *thread_pool;
+#endif
+
+  /* Pool for the slots. */
+  apr_pool_t *pool;
+
+  /* Slots that have not been taken by the walk yet.
+     const char *local_abspath -> prefetch_slot_t * */
+  apr_hash_t *slots;
+
+  /* Queued slots in the order they should be read. */
+  prefetch_slot_t *queue;
+
+  /* Number of slots in prefetch_done state. */
+  int ready;
+  int max_ready;
+
+  /* Tells the workers to exit. */
+  svn_boolean_t shutdown;
+};
+
+#if APR_HAS_THREADS
+
+/* Release the result of SLOT. */
+static void
+free_slot(prefetch_slot_t *slot)
+{
+  svn_error_clear(slot->err);
+  slot->err = SVN_NO_ERROR;
+  if (slot->pool)
+    svn_pool_destroy(slot->pool);
+  slot->pool = NULL;
+  slot->dirents = NULL;
+}
+
+/* Read the directory of SLOT into SLOT. */
+static void
+read_slot(prefetch_slot_t *slot,
+          svn_boolean_t only_check_type)
+{
+  apr_pool_t *scratch_pool;
+
+  /* Not a subpool of anything the walk owns: pools are not thread-safe. */
+  slot->pool = svn_pool_create(NULL);
+  scratch_pool = svn_pool_create(slot->pool);
+
+  slot->err = svn_io_get_dirents3(&slot->dirents, slot->local_abspath,
+                                  only_check_type,
+                                  slot->pool, scratch_pool);
+  svn_pool_destroy(scratch_pool);
+}
+
+/* Worker thread reading the queued directories of the prefetcher DATA. */
+static void * APR_THREAD_FUNC
+prefetch_worker(apr_thread_t *thread,
+                void *data)
+{
+  struct dirent_prefetch_t *pf = data;
+
+  apr_thread_mutex_lock(pf->mutex);
+  while (TRUE)
+    {
+      prefetch_slot_t *slot;
+
+      while (!pf->shutdown && (!pf->queue || pf->ready >= pf->max_ready))
+        apr_thread_cond_wait(pf->cond, pf->mutex);
+
+      if (pf->shutdown)
+        break;
+
+      slot = pf->queue;
+      pf->queue = slot->next;
+      slot->next = NULL;
+      slot->state = prefetch_running;
+      apr_thread_mutex_unlock(pf->mutex);
+
+      read_slot(slot, pf->only_check_type);
+
+      apr_thread_mutex_lock(pf->mutex);
+      if (slot->abandoned)
+        {
+          /* Nobody can see this slot any more. */
+          free_slot(slot);
+          continue;
+        }
+      slot->state = prefetch_done;
+      pf->ready++;
+      apr_thread_cond_broadcast(pf->cond);
+    }
+  apr_thread_mutex_unlock(pf->mutex);
+
+  apr_thread_exit(thread, APR_SUCCESS);
+  return NULL;
+}
+
+/* Pool cleanup handler destroying the root pool DATA. */
+static apr_status_t
+destroy_root_pool(void *data)
+{
+  svn_pool_destroy(data);
+  return APR_SUCCESS;
+}
+
+/* Pool pre-cleanup handler stopping the workers of the prefetcher DATA
+   and releasing all slots that were not taken. */
+static apr_status_t
+shutdown_prefetch(void *data)
+{
+  struct dirent_prefetch_t *pf = data;
+  apr_hash_index_t *hi;
+  int i;
+
+  apr_thread_mutex_lock(pf->mutex);
+  pf->shutdown = TRUE;
+  apr_thread_cond_broadcast(pf->cond);
+  apr_thread_mutex_unlock(pf->mutex);
+
+  for (i = 0; i < pf->threads->nelts; i++)
+    {
+      apr_status_t retval;
+
+      apr_thread_join(&retval, APR_ARRAY_IDX(pf->threads, i, apr_thread_t *));
+    }
+  svn_pool_destroy(pf->thread_pool);
+
+  /* All workers are gone; no slot can be running any more. */
+  for (hi = apr_hash_first(NULL, pf->slots); hi; hi = apr_hash_next(hi))
+    {
+      free_slot(apr_hash_this_val(hi));
+    }
+
+  return APR_SUCCESS;
+}
+
+#endif /* APR_HAS_THREADS */
+
+/* Set *PREFETCH to a new prefetcher using THREADS worker threads for
+   svn_io_get_dirents3(ONLY_CHECK_TYPE), or to NULL if THREADS is less
+   than 2 or threads are not available.  The workers are stopped when
+   RESULT_POOL is cleaned up. */
+static svn_error_t *
+prefetch_create(struct dirent_prefetch_t **prefetch,
+                int threads,
+                svn_boolean_t only_check_type,
+                apr_pool_t *result_pool)
+{
+#if APR_HAS_THREADS
+  struct dirent_prefetch_t *pf;
+  int i;
+
+  *prefetch = NULL;
+  if (threads < 2)
+    return SVN_NO_ERROR;
+
+  pf = apr_pcalloc(result_pool, sizeof(*pf));
+  pf->pool = result_pool;
+  pf->only_check_type = only_check_type;
+  pf->slots = apr_hash_make(result_pool);
+  pf->max_ready = threads * PREFETCH_READY_PER_THREAD;
+  pf->threads = apr_array_make(result_pool, threads, sizeof(apr_thread_t *));
+
+  SVN_ERR(svn_error_wrap_apr(apr_thread_mutex_create(&pf->mutex,
+                                                     APR_THREAD_MUTEX_DEFAULT,
+                                                     result_pool),
+                             _("Can't create mutex")));
+  SVN_ERR(svn_error_wrap_apr(apr_thread_cond_create(&pf->cond, result_pool),
+                             _("Can't create condition variable")));
+
+  /* Register the cleanup before starting any thread, so that the threads
+     are joined however we leave this function.  It must run before
+     RESULT_POOL destroys its children, which the workers still use. */
+  pf->thread_pool = svn_pool_create(NULL);
+  apr_pool_pre_cleanup_register(result_pool, pf, shutdown_prefetch);
+
+  for (i = 0; i < threads; i++)
+    {
+      apr_thread_t *thread;
+      apr_status_t status;
+
+      status = apr_thread_create(&thread, NULL, prefetch_worker, pf,
+                                 pf->thread_pool);
+      if (status)
+        {
+          /* Run with the workers we have, if any. */
+          if (i > 0)
+            break;
+          return svn_error_wrap_apr(status, _("Can't create thread"));
+        }
+
+      APR_ARRAY_PUSH(pf->threads, apr_thread_t *) = thread;
+    }
+
+  *prefetch = pf;
+#else
+  *prefetch = NULL;
+#endif
+
+  return SVN_NO_ERROR;
+}
+
+/* Queue the directories LOCAL_ABSPATHS (const char *), in order, to be
+   read by PF ahead of all directories that are already queued. */
+static void
+prefetch_queue(struct dirent_prefetch_t *pf,
+               const apr_array_header_t *local_abspaths)
+{
+#if APR_HAS_THREADS
+  prefetch_slot_t *head = NULL;
+  prefetch_slot_t **tail = &head;
+  int i;
+
+  if (!local_abspaths->nelts)
+    return;
+
+  apr_thread_mutex_lock(pf->mutex);
+
+  for (i = 0; i < local_abspaths->nelts; i++)
+    {
+      const char *local_abspath = APR_ARRAY_IDX(local_abspaths, i,
+                                                const char *);
+      prefetch_slot_t *slot;
+
+      if (svn_hash_gets(pf->slots, local_abspath))
+        continue;
+
+      slot = apr_pcalloc(pf->pool, sizeof(*slot));
+      slot->local_abspath = apr_pstrdup(pf->pool, local_abspath);
+      slot->state = prefetch_queued;
+
+      svn_hash_sets(pf->slots, slot->local_abspath, slot);
+      *tail = slot;
+      tail = &slot->next;
+    }
+
+  *tail = pf->queue;
+  pf->queue = head;
+
+  apr_thread_cond_broadcast(pf->cond);
+  apr_thread_mutex_unlock(pf->mutex);
+#endif
+}
+
+/* Give up on the directories LOCAL_ABSPATHS (const char *) queued in PF
+   that the walk has not taken.  Queued ones are not read any more, and
+   the results of those already read are released, so that they no longer
+   count against the read-ahead limit. */
+static void
+prefetch_release(struct dirent_prefetch_t *pf,
+                 const apr_array_header_t *local_abspaths)
+{
+#if APR_HAS_THREADS
+  int i;
+
+  if (!local_abspaths->nelts)
+    return;
+
+  apr_thread_mutex_lock(pf->mutex);
+
+  for (i = 0; i < local_abspaths->nelts; i++)
+    {
+      const char *local_abspath = APR_ARRAY_IDX(local_abspaths, i,
+                                                const char *);
+      prefetch_slot_t *slot = svn_hash_gets(pf->slots, local_abspath);
+
+      if (!slot)
+        continue;
+
+      svn_hash_sets(pf->slots, local_abspath, NULL);
+
+      if (slot->state == prefetch_queued)
+        {
+          prefetch_slot_t **link = &pf->queue;
+
+          while (*link != slot)
+            link = &(*link)->next;
+          *link = slot->next;
+        }
+      else if (slot->state == prefetch_running)
+        slot->abandoned = TRUE;
+      else
+        {
+          free_slot(slot);
+          pf->ready--;
+        }
+    }
+
+  apr_thread_cond_broadcast(pf->cond);
+  apr_thread_mutex_unlock(pf->mutex);
+#endif
+}
+
+/* Like svn_io_get_dirents3(), but take the result from PF if PF is not
+   NULL and LOCAL_ABSPATH was queued in it. */
+static svn_error_t *
+prefetch_get_dirents(apr_hash_t **dirents,
+                     struct dirent_prefetch_t *pf,
+                     const char *local_abspath,
+                     svn_boolean_t only_check_type,
+                     apr_pool_t *result_pool,
+                     apr_pool_t *scratch_pool)
+{
+#if APR_HAS_THREADS
+  prefetch_slot_t *slot = NULL;
+
+  if (pf)
+    {
+      apr_thread_mutex_lock(pf->mutex);
+
+      slot = svn_hash_gets(pf->slots, local_abspath);
+      if (slot && slot->state == prefetch_queued)
+        {
+          /* No worker got to it yet; unlink it and read it ourselves. */
+          prefetch_slot_t **link = &pf->queue;
+
+          while (*link != slot)
+            link = &(*link)->next;
+          *link = slot->next;
+
+          svn_hash_sets(pf->slots, local_abspath, NULL);
+          apr_thread_mutex_unlock(pf->mutex);
+
+          slot = NULL;
+        }
+      else if (slot)
+        {
+          while (slot->state != prefetch_done)
+            apr_thread_cond_wait(pf->cond, pf->mutex);
+
+          svn_hash_sets(pf->slots, local_abspath, NULL);
+          pf->ready--;
+          apr_thread_cond_broadcast(pf->cond);
+          apr_thread_mutex_unlock(pf->mutex);
+        }
+      else
+        apr_thread_mutex_unlock(pf->mutex);
+    }
+
+  if (slot)
+    {
+      /* Hand the listing over to RESULT_POOL. */
+      apr_pool_cleanup_register(result_pool, slot->pool, destroy_root_pool,
+                                apr_pool_cleanup_null);
+      *dirents = slot->dirents;
+      return svn_error_trace(slot->err);
+    }
+#endif
+
+  return svn_error_trace(svn_io_get_dirents3(dirents, local_abspath,
+                                             only_check_type,
+                                             result_pool, scratch_pool));
+}
+
+/* Return TRUE if the directory LOCAL_ABSPATH must be read from disk
+   according to JOURNAL, given its own DIRENT from the listing of its
+   parent. */
+static svn_boolean_t
+status_journal_must_read(svn_wc__status_journal_t *journal,
+                         const char *local_abspath,
+                         const svn_io_dirent2_t *dirent)
+{
+  /* A missing or obstructed directory has no children on disk. */
+  if (!dirent || dirent->kind != svn_node_dir || dirent->special)
+    return TRUE;
+
+  return svn_wc__status_journal_dir_changed(journal, local_abspath);
+}
+
 /* Send svn_wc_status3_t * structures for the directory LOCAL_ABSPATH and
    for all its child nodes (according to DEPTH) through STATUS_FUNC /
    STATUS_BATON.
@@ -1232,6 +1676,7 @@ get_dir_status(const struct walk_status_baton *wb,
   const char *dir_repos_uuid;
   apr_hash_t *dirents, *nodes, *conflicts, *all_children;
   apr_array_header_t *sorted_children;
+  apr_array_header_t *prefetched = NULL;
   apr_array_header_t *collected_ignore_patterns = NULL;
   apr_pool_t *iterpool;
   svn_error_t *err;
@@ -1245,24 +1690,6 @@ get_dir_status(const struct walk_status_baton *wb,
 
   iterpool = svn_pool_create(scratch_pool);
 
-  if (wb->check_working_copy)
-    {
-      err = svn_io_get_dirents3(&dirents, local_abspath,
-                                wb->ignore_text_mods /* only_check_type*/,
-                                scratch_pool, iterpool);
-      if (err
-          && (APR_STATUS_IS_ENOENT(err->apr_err)
-              || SVN__APR_STATUS_IS_ENOTDIR(err->apr_err)))
-        {
-          svn_error_clear(err);
-          dirents = apr_hash_make(scratch_pool);
-        }
-      else
-        SVN_ERR(err);
-    }
-  else
-    dirents = apr_hash_make(scratch_pool);
-
   if (!dir_info)
     SVN_ERR(svn_wc__db_read_single_info(&dir_info, wb->db, local_abspath,
                                         !wb->check_working_copy,
@@ -1283,6 +1710,41 @@ get_dir_status(const struct walk_status_baton *wb,
                                         !wb->check_working_copy,
                                         scratch_pool, iterpool));
 
+  if (wb->check_working_copy)
+    {
+      dirents = NULL;
+
+      /* If nothing changed here since the last walk, and we can tell
+         what the directory looks like from NODES, don't read it. */
+      if (wb->journal
+          && !status_journal_must_read(wb->journal, local_abspath, dirent))
+        svn_wc__status_journal_predict_dirents(&dirents, nodes,
+                                               scratch_pool);
+
+      if (!dirents)
+        {
+          err = prefetch_get_dirents(&dirents, wb->prefetch, local_abspath,
+                                     wb->ignore_text_mods
+                                       /* only_check_type */,
+                                     scratch_pool, iterpool);
+          if (err
+              && (APR_STATUS_IS_ENOENT(err->apr_err)
+                  || SVN__APR_STATUS_IS_ENOTDIR(err->apr_err)))
+            {
+              svn_error_clear(err);
+              dirents = apr_hash_make(scratch_pool);
+            }
+          else
+            SVN_ERR(err);
+
+          if (wb->journal)
+            svn_wc__status_journal_note_dir(wb->journal, local_abspath,
+                                            nodes, dirents, iterpool);
+        }
+    }
+  else
+    dirents = apr_hash_make(scratch_pool);
+
   all_children = apr_hash_overlay(scratch_pool, nodes, dirents);
   if (apr_hash_count(conflicts) > 0)
     all_children = apr_hash_overlay(scratch_pool, conflicts, all_children);
@@ -1340,6 +1802,46 @@ get_dir_status(const struct walk_status_baton *wb,
   sorted_children = svn_sort__hash(all_children,
                                    svn_sort_compare_items_lexically,
                                    scratch_pool);
+
+  /* Let the prefetcher read the subdirectories we are going to descend
+     into, in the order one_child_status() will need them. */
+  if (wb->prefetch && depth == svn_depth_infinity)
+    {
+      prefetched = apr_array_make(scratch_pool, 16, sizeof(const char *));
+
+      for (i = 0; i < sorted_children->nelts; i++)
+        {
+          svn_sort__item_t item = APR_ARRAY_IDX(sorted_children, i,
+                                                svn_sort__item_t);
+          const struct svn_wc__db_info_t *child_info;
+          const char *child_abspath;
+
+          child_info = apr_hash_get(nodes, item.key, item.klen);
+          if (child_info
+              && child_info->has_descendants
+              && child_info->status != svn_wc__db_status_not_present
+              && child_info->status != svn_wc__db_status_excluded
+              && child_info->status != svn_wc__db_status_server_excluded
+              && !(child_info->kind == svn_node_unknown
+                   && child_info->status == svn_wc__db_status_normal))
+            {
+              child_abspath = svn_dirent_join(local_abspath, item.key,
+                                              scratch_pool);
+
+              /* Don't read ahead what the journal lets us skip. */
+              if (wb->journal
+                  && !status_journal_must_read(
+                        wb->journal, child_abspath,
+                        apr_hash_get(dirents, item.key, item.klen)))
+                continue;
+
+              APR_ARRAY_PUSH(prefetched, const char *) = child_abspath;
+            }
+        }
+
+      prefetch_queue(wb->prefetch, prefetched);
+    }
+
   for (i = 0; i < sorted_children->nelts; i++)
     {
       const void *key;
@@ -1381,6 +1883,10 @@ get_dir_status(const struct walk_status_baton *wb,
                                iterpool));
     }
 
+  /* Don't let listings we did not descend into hold up the workers. */
+  if (prefetched)
+    prefetch_release(wb->prefetch, prefetched);
+
   /* Destroy our subpools. */
   svn_pool_destroy(iterpool);
 
@@ -2644,6 +3150,8 @@ svn_wc__internal_walk_status(svn_wc__db_t *db,
   wb.check_working_copy = TRUE;
   wb.repos_root = NULL;
   wb.repos_locks = NULL;
+  wb.prefetch = NULL;
+  wb.journal = NULL;
 
   /* Use the caller-provided ignore patterns if provided; the build-time
      configured defaults otherwise. */
@@ -2690,6 +3198,27 @@ svn_wc__internal_walk_status(svn_wc__db_t *db,
       && info->status != svn_wc__db_status_excluded
       && info->status != svn_wc__db_status_server_excluded)
     {
+      if (depth == svn_depth_infinity || depth == svn_depth_unknown)
+        SVN_ERR(prefetch_create(&wb.prefetch,
+                                svn_wc__db_get_status_threads(db),
+                                ignore_text_mods, scratch_pool));
+
+      if (svn_wc__db_get_status_journal(db))
+        {
+          const char *wcroot_abspath;
+
+          /* Only a complete walk sees everything that must be recorded. */
+          SVN_ERR(svn_wc__db_get_wcroot(&wcroot_abspath, db, local_abspath,
+                                        scratch_pool, scratch_pool));
+          SVN_ERR(svn_wc__status_journal_open(
+                    &wb.journal, wcroot_abspath,
+                    (!ignore_text_mods
+                     && (depth == svn_depth_infinity
+                         || depth == svn_depth_unknown)
+                     && strcmp(wcroot_abspath, local_abspath) == 0),
+                    scratch_pool, scratch_pool));
+        }
+
       SVN_ERR(get_dir_status(&wb,
                              local_abspath,
                              FALSE /* skip_root */,
@@ -2703,6 +3232,9 @@ svn_wc__internal_walk_status(svn_wc__db_t *db,
                              status_func, status_baton,
                              cancel_func, cancel_baton,
                              scratch_pool));
+
+      if (wb.journal)
+        SVN_ERR(svn_wc__status_journal_save(wb.journal, scratch_pool));
     }
   else
     {
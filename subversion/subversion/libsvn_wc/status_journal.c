@@ -0,0 +1,489 @@
+/*
+ * status_journal.c :  skipping unchanged directories in status walks
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+
+
+#include <string.h>
+
+#include <apr_pools.h>
+#include <apr_hash.h>
+#include <apr_strings.h>
+
+#include "svn_hash.h"
+#include "svn_types.h"
+#include "svn_pools.h"
+#include "svn_string.h"
+#include "svn_error.h"
+#include "svn_dirent_uri.h"
+#include "svn_io.h"
+#include "svn_wc.h"
+
+#include "wc.h"
+#include "adm_files.h"
+#include "wc_db.h"
+#include "status_journal.h"
+
+#include "svn_private_config.h"
+
+/* File names in the administrative directory of the working copy root. */
+#define JOURNAL_FILE  "status-journal"
+#define CACHE_FILE    "status-cache"
+#define SDB_FILE      "wc.db"
+
+struct svn_wc__status_journal_t
+{
+  const char *wcroot_abspath;
+
+  /* If TRUE, the cache was not usable and every directory must be read. */
+  svn_boolean_t read_all;
+
+  /* Relpaths of the directories that must be read.
+     const char *relpath -> "" */
+  apr_hash_t *changed_dirs;
+
+  /* Relpaths of the changed nodes themselves.  A directory that was
+     created or moved in may bring a whole subtree the watcher never
+     reported, so everything below these must be read as well.
+     const char *relpath -> "" */
+  apr_hash_t *changed_paths;
+
+  /* What identifies the state the next walk will start from. */
+  const char *generation;
+  apr_off_t journal_offset;
+  apr_off_t sdb_size;
+  apr_time_t sdb_mtime;
+
+  /* Relpaths of the nodes that did not match wc.db, if recording;
+     NULL otherwise. */
+  apr_array_header_t *mismatches;
+
+  apr_pool_t *pool;
+};
+
+/* Mark the parent directory of RELPATH and RELPATH itself, including
+   anything below it, as changed in JOURNAL. */
+static void
+add_changed_path(svn_wc__status_journal_t *journal,
+                 const char *relpath)
+{
+  const char *dir_relpath;
+
+  relpath = svn_relpath_canonicalize(relpath, journal->pool);
+
+  /* Changes in the administrative area don't affect status. */
+  if (svn_wc_is_adm_dir(svn_relpath_prefix(relpath, 1, journal->pool),
+                        journal->pool))
+    return;
+
+  dir_relpath = svn_relpath_dirname(relpath, journal->pool);
+  svn_hash_sets(journal->changed_dirs, dir_relpath, "");
+  svn_hash_sets(journal->changed_dirs, relpath, "");
+  svn_hash_sets(journal->changed_paths, relpath, "");
+}
+
+/* Read the status cache of JOURNAL into JOURNAL and return TRUE, if it
+   describes the current GENERATION and wc.db state and does not extend
+   past JOURNAL_LEN bytes of the journal.  Otherwise return FALSE. */
+static svn_error_t *
+read_cache(svn_boolean_t *valid,
+           svn_wc__status_journal_t *journal,
+           const char *generation,
+           apr_off_t journal_len,
+           apr_pool_t *scratch_pool)
+{
+  svn_stringbuf_t *contents;
+  apr_array_header_t *lines;
+  apr_array_header_t *fields;
+  apr_int64_t offset, sdb_size, sdb_mtime;
+  svn_error_t *err;
+  int i;
+
+  *valid = FALSE;
+
+  err = svn_stringbuf_from_file2(&contents,
+                                 svn_wc__adm_child(journal->wcroot_abspath,
+                                                   CACHE_FILE,
+                                                   scratch_pool),
+                                 scratch_pool);
+  if (err && APR_STATUS_IS_ENOENT(err->apr_err))
+    {
+      svn_error_clear(err);
+      return SVN_NO_ERROR;
+    }
+  SVN_ERR(err);
+
+  lines = svn_cstring_split(contents->data, "\n", FALSE, scratch_pool);
+  if (lines->nelts < 2
+      || strcmp(APR_ARRAY_IDX(lines, 0, const char *), generation) != 0)
+    return SVN_NO_ERROR;
+
+  fields = svn_cstring_split(APR_ARRAY_IDX(lines, 1, const char *), " ",
+                             TRUE, scratch_pool);
+  if (fields->nelts != 3)
+    return SVN_NO_ERROR;
+
+  err = svn_cstring_atoi64(&offset, APR_ARRAY_IDX(fields, 0, const char *));
+  if (!err)
+    err = svn_cstring_atoi64(&sdb_size,
+                             APR_ARRAY_IDX(fields, 1, const char *));
+  if (!err)
+    err = svn_cstring_atoi64(&sdb_mtime,
+                             APR_ARRAY_IDX(fields, 2, const char *));
+  if (err)
+    {
+      /* A broken cache is just not usable. */
+      svn_error_clear(err);
+      return SVN_NO_ERROR;
+    }
+
+  if (offset > journal_len
+      || sdb_size != journal->sdb_size
+      || sdb_mtime != journal->sdb_mtime)
+    return SVN_NO_ERROR;
+
+  for (i = 2; i < lines->nelts; i++)
+    add_changed_path(journal, APR_ARRAY_IDX(lines, i, const char *));
+
+  journal->journal_offset = (apr_off_t)offset;
+  *valid = TRUE;
+
+  return SVN_NO_ERROR;
+}
+
+svn_error_t *
+svn_wc__status_journal_open(svn_wc__status_journal_t **journal,
+                            const char *wcroot_abspath,
+                            svn_boolean_t record,
+                            apr_pool_t *result_pool,
+                            apr_pool_t *scratch_pool)
+{
+  svn_wc__status_journal_t *j;
+  apr_file_t *file;
+  apr_finfo_t finfo;
+  svn_stringbuf_t *generation;
+  svn_stringbuf_t *entries;
+  const char *eol;
+  svn_boolean_t eof;
+  svn_boolean_t valid;
+  apr_off_t start;
+  const char *p, *end;
+  svn_error_t *err;
+
+  *journal = NULL;
+
+  err = svn_io_file_open(&file,
+                         svn_wc__adm_child(wcroot_abspath, JOURNAL_FILE,
+                                           scratch_pool),
+                         APR_READ | APR_BUFFERED, APR_OS_DEFAULT,
+                         scratch_pool);
+  if (err && APR_STATUS_IS_ENOENT(err->apr_err))
+    {
+      /* No watcher. */
+      svn_error_clear(err);
+      return SVN_NO_ERROR;
+    }
+  SVN_ERR(err);
+
+  /* A journal without a complete generation line is not ready for use. */
+  SVN_ERR(svn_io_file_readline(file, &generation, &eol, &eof, APR_SIZE_MAX,
+                               result_pool, scratch_pool));
+  if (!eol || strcmp(eol, "\n") != 0 || generation->len == 0)
+    return svn_error_trace(svn_io_file_close(file, scratch_pool));
+
+  j = apr_pcalloc(result_pool, sizeof(*j));
+  j->wcroot_abspath = apr_pstrdup(result_pool, wcroot_abspath);
+  j->changed_dirs = apr_hash_make(result_pool);
+  j->changed_paths = apr_hash_make(result_pool);
+  j->generation = generation->data;
+  j->pool = result_pool;
+
+  /* Changes to wc.db are not reported by the watcher, and may change
+     what the on-disk state should be. */
+  SVN_ERR(svn_io_stat(&finfo, svn_wc__adm_child(wcroot_abspath, SDB_FILE,
+                                                scratch_pool),
+                      APR_FINFO_SIZE | APR_FINFO_MTIME, scratch_pool));
+  j->sdb_size = finfo.size;
+  j->sdb_mtime = finfo.mtime;
+
+  SVN_ERR(svn_io_file_get_offset(&start, file, scratch_pool));
+  SVN_ERR(svn_io_file_info_get(&finfo, APR_FINFO_SIZE, file, scratch_pool));
+  SVN_ERR(read_cache(&valid, j, j->generation, finfo.size, scratch_pool));
+
+  if (valid && j->journal_offset > start)
+    {
+      start = j->journal_offset;
+      SVN_ERR(svn_io_file_seek(file, APR_SET, &start, scratch_pool));
+    }
+  j->read_all = !valid;
+
+  /* Collect the paths changed since the cache was written.  If there is
+     no valid cache we still need to know where the complete lines end. */
+  SVN_ERR(svn_stringbuf_from_aprfile(&entries, file, scratch_pool));
+  SVN_ERR(svn_io_file_close(file, scratch_pool));
+
+  p = entries->data;
+  end = entries->data + entries->len;
+  while (p < end)
+    {
+      const char *nl = memchr(p, '\n', end - p);
+
+      if (!nl)
+        break; /* The watcher is still writing this line. */
+
+      if (valid && nl > p)
+        add_changed_path(j, apr_pstrmemdup(scratch_pool, p, nl - p));
+
+      p = nl + 1;
+    }
+  j->journal_offset = start + (p - entries->data);
+
+  if (record)
+    j->mismatches = apr_array_make(result_pool, 16, sizeof(const char *));
+
+  *journal = j;
+  return SVN_NO_ERROR;
+}
+
+svn_boolean_t
+svn_wc__status_journal_dir_changed(svn_wc__status_journal_t *journal,
+                                   const char *dir_abspath)
+{
+  const char *relpath;
+  apr_ssize_t len;
+
+  if (journal->read_all)
+    return TRUE;
+
+  relpath = svn_dirent_skip_ancestor(journal->wcroot_abspath, dir_abspath);
+  if (!relpath)
+    return TRUE;
+
+  if (svn_hash_gets(journal->changed_dirs, relpath))
+    return TRUE;
+
+  /* Check every ancestor, as the watcher may only have seen the root of
+     a subtree that was moved in. */
+  len = strlen(relpath);
+  while (len > 0)
+    {
+      while (--len > 0 && relpath[len] != '/')
+        ;
+      if (apr_hash_get(journal->changed_paths, relpath, len))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+/* Set *DIRENT to the dirent svn_io_get_dirents3() would return for the
+   node described by INFO if it matches wc.db, or to NULL if it should not
+   exist on disk.  Return FALSE if this can't be predicted. */
+static svn_boolean_t
+predict_dirent(const svn_io_dirent2_t **dirent,
+               const struct svn_wc__db_info_t *info,
+               apr_pool_t *result_pool)
+{
+  svn_io_dirent2_t *predicted;
+
+  *dirent = NULL;
+  if (!info)
+    return TRUE;
+
+  switch (info->status)
+    {
+      case svn_wc__db_status_not_present:
+      case svn_wc__db_status_excluded:
+      case svn_wc__db_status_server_excluded:
+      case svn_wc__db_status_deleted:
+        return TRUE;
+
+      default:
+        break;
+    }
+
+  if (info->kind == svn_node_dir)
+    {
+      predicted = svn_io_dirent2_create(result_pool);
+      predicted->kind = svn_node_dir;
+      *dirent = predicted;
+      return TRUE;
+    }
+
+  /* Files without a recorded size and timestamp are always read. */
+  if (info->kind != svn_node_file
+#ifdef HAVE_SYMLINK
+      || info->special
+#endif
+      || info->recorded_size == SVN_INVALID_FILESIZE
+      || info->recorded_time == 0)
+    return FALSE;
+
+  predicted = svn_io_dirent2_create(result_pool);
+  predicted->kind = svn_node_file;
+  predicted->filesize = info->recorded_size;
+  predicted->mtime = info->recorded_time;
+  *dirent = predicted;
+
+  return TRUE;
+}
+
+/* Return TRUE if ACTUAL, as read from disk, matches PREDICTED. */
+static svn_boolean_t
+dirent_matches(const svn_io_dirent2_t *actual,
+               const svn_io_dirent2_t *predicted)
+{
+  if (!actual || actual->kind == svn_node_none)
+    return predicted == NULL;
+
+  if (!predicted
+      || actual->kind != predicted->kind
+      || actual->special != predicted->special)
+    return FALSE;
+
+  if (actual->kind == svn_node_file)
+    return (actual->filesize == predicted->filesize
+            && actual->mtime == predicted->mtime);
+
+  return TRUE;
+}
+
+void
+svn_wc__status_journal_predict_dirents(apr_hash_t **dirents,
+                                       apr_hash_t *nodes,
+                                       apr_pool_t *result_pool)
+{
+  apr_hash_t *predicted = apr_hash_make(result_pool);
+  apr_hash_index_t *hi;
+
+  for (hi = apr_hash_first(result_pool, nodes); hi; hi = apr_hash_next(hi))
+    {
+      const svn_io_dirent2_t *dirent;
+
+      if (!predict_dirent(&dirent, apr_hash_this_val(hi), result_pool))
+        {
+          *dirents = NULL;
+          return;
+        }
+
+      if (dirent)
+        apr_hash_set(predicted, apr_hash_this_key(hi),
+                     apr_hash_this_key_len(hi), dirent);
+    }
+
+  *dirents = predicted;
+}
+
+/* Note the node NAME in the directory DIR_RELPATH as a mismatch in
+   JOURNAL, unless ACTUAL matches what INFO predicts. */
+static void
+note_node(svn_wc__status_journal_t *journal,
+          const char *dir_relpath,
+          const char *name,
+          const struct svn_wc__db_info_t *info,
+          const svn_io_dirent2_t *actual,
+          apr_pool_t *scratch_pool)
+{
+  const svn_io_dirent2_t *predicted;
+
+  if (svn_wc_is_adm_dir(name, scratch_pool))
+    return;
+
+  if (predict_dirent(&predicted, info, scratch_pool)
+      && dirent_matches(actual, predicted))
+    return;
+
+  APR_ARRAY_PUSH(journal->mismatches, const char *)
+    = svn_relpath_join(dir_relpath, name, journal->pool);
+}
+
+void
+svn_wc__status_journal_note_dir(svn_wc__status_journal_t *journal,
+                                const char *dir_abspath,
+                                apr_hash_t *nodes,
+                                apr_hash_t *dirents,
+                                apr_pool_t *scratch_pool)
+{
+  const char *dir_relpath;
+  apr_hash_index_t *hi;
+
+  if (!journal->mismatches)
+    return;
+
+  dir_relpath = svn_dirent_skip_ancestor(journal->wcroot_abspath,
+                                         dir_abspath);
+  if (!dir_relpath)
+    return;
+
+  for (hi = apr_hash_first(scratch_pool, dirents); hi; hi = apr_hash_next(hi))
+    {
+      const char *name = apr_hash_this_key(hi);
+
+      note_node(journal, dir_relpath, name, svn_hash_gets(nodes, name),
+                apr_hash_this_val(hi), scratch_pool);
+    }
+
+  for (hi = apr_hash_first(scratch_pool, nodes); hi; hi = apr_hash_next(hi))
+    {
+      const char *name = apr_hash_this_key(hi);
+
+      if (!svn_hash_gets(dirents, name))
+        note_node(journal, dir_relpath, name, apr_hash_this_val(hi), NULL,
+                  scratch_pool);
+    }
+}
+
+svn_error_t *
+svn_wc__status_journal_save(svn_wc__status_journal_t *journal,
+                            apr_pool_t *scratch_pool)
+{
+  svn_stringbuf_t *contents;
+  int i;
+
+  if (!journal->mismatches)
+    return SVN_NO_ERROR;
+
+  contents = svn_stringbuf_createf(scratch_pool,
+                                   "%s\n%" APR_OFF_T_FMT " %" APR_OFF_T_FMT
+                                   " %" APR_TIME_T_FMT "\n",
+                                   journal->generation,
+                                   journal->journal_offset,
+                                   journal->sdb_size,
+                                   journal->sdb_mtime);
+
+  for (i = 0; i < journal->mismatches->nelts; i++)
+    {
+      svn_stringbuf_appendcstr(contents,
+                               APR_ARRAY_IDX(journal->mismatches, i,
+                                             const char *));
+      svn_stringbuf_appendbyte(contents, '\n');
+    }
+
+  return svn_error_trace(
+            svn_io_write_atomic2(svn_wc__adm_child(journal->wcroot_abspath,
+                                                   CACHE_FILE,
+                                                   scratch_pool),
+                                 contents->data, contents->len,
+                                 NULL /* copy_perms_path */,
+                                 FALSE /* flush_to_disk */,
+                                 scratch_pool));
+}
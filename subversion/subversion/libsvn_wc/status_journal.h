@@ -0,0 +1,119 @@
+/*
+ * status_journal.h :  skipping unchanged directories in status walks
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+/* The status journal lets the status walk skip reading directories whose
+   on-disk state did not change since the previous walk.
+
+   It needs help from outside Subversion: a file system watcher (e.g. one
+   using inotify) maintains the file "status-journal" in the administrative
+   directory of the working copy root.  Its first line is a generation
+   string, which the watcher must change whenever it may have missed
+   events, for instance after it was restarted.  Every following line is
+   the path, relative to the working copy root with '/' separators and in
+   UTF-8, of a node that the watcher saw being created, deleted, renamed
+   or modified.  Lines are only ever appended, and only complete lines
+   (ending in "\n") are read.  Changes below administrative directories
+   don't have to be reported.
+
+   After walking the status of the whole working copy, the walk stores
+   the paths whose on-disk state did not match what wc.db records (local
+   modifications, unversioned nodes, ...) in the file "status-cache",
+   together with the journal generation, the length of the journal it
+   has read, and the size and timestamp of wc.db.  A later walk only reads
+   directories containing one of these paths or a path appended to the
+   journal since; it assumes that all other directories match wc.db.  A
+   new journal generation, a shorter journal, or any change to wc.db
+   makes the cache invalid, and all directories are read again.
+ */
+
+#ifndef SVN_LIBSVN_WC_STATUS_JOURNAL_H
+#define SVN_LIBSVN_WC_STATUS_JOURNAL_H
+
+#include <apr_pools.h>
+#include <apr_hash.h>
+
+#include "svn_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+typedef struct svn_wc__status_journal_t svn_wc__status_journal_t;
+
+/* Open the status journal of the working copy rooted at WCROOT_ABSPATH
+   and set *JOURNAL to it, or to NULL if there is no usable journal.
+
+   If RECORD is TRUE, the caller is going to walk the whole working copy
+   and tell the journal about every directory it reads, so that the
+   result can be stored by svn_wc__status_journal_save().
+
+   Allocate *JOURNAL in RESULT_POOL, use SCRATCH_POOL for temporary
+   allocations. */
+svn_error_t *
+svn_wc__status_journal_open(svn_wc__status_journal_t **journal,
+                            const char *wcroot_abspath,
+                            svn_boolean_t record,
+                            apr_pool_t *result_pool,
+                            apr_pool_t *scratch_pool);
+
+/* Return TRUE if the listing of the directory DIR_ABSPATH may have
+   changed since the last recorded walk of JOURNAL's working copy. */
+svn_boolean_t
+svn_wc__status_journal_dir_changed(svn_wc__status_journal_t *journal,
+                                   const char *dir_abspath);
+
+/* Set *DIRENTS to a hash mapping the names in NODES, the hash of
+   struct svn_wc__db_info_t * returned by svn_wc__db_read_children_info(),
+   to the svn_io_dirent2_t * that svn_io_get_dirents3() would return for
+   them if they match what wc.db records.  Nodes that should not exist on
+   disk are left out.  Set *DIRENTS to NULL if this can't be predicted for
+   some node.  Allocate *DIRENTS in RESULT_POOL. */
+void
+svn_wc__status_journal_predict_dirents(apr_hash_t **dirents,
+                                       apr_hash_t *nodes,
+                                       apr_pool_t *result_pool);
+
+/* Tell JOURNAL that the directory DIR_ABSPATH, whose children are
+   described by NODES as in svn_wc__status_journal_predict_dirents(), has
+   been read into DIRENTS.  Does nothing unless JOURNAL was opened to
+   record.  Use SCRATCH_POOL for temporary allocations. */
+void
+svn_wc__status_journal_note_dir(svn_wc__status_journal_t *journal,
+                                const char *dir_abspath,
+                                apr_hash_t *nodes,
+                                apr_hash_t *dirents,
+                                apr_pool_t *scratch_pool);
+
+/* Store what JOURNAL learned during a complete walk, if it was opened
+   to record.  Use SCRATCH_POOL for temporary allocations. */
+svn_error_t *
+svn_wc__status_journal_save(svn_wc__status_journal_t *journal,
+                            apr_pool_t *scratch_pool);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SVN_LIBSVN_WC_STATUS_JOURNAL_H */
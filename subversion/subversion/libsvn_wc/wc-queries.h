@@ -1106,68 +1106,74 @@
   "SELECT id, work FROM work_queue ORDER BY id LIMIT 1 " \
   ""
 
-#define STMT_DELETE_WORK_ITEM 105
-#define STMT_105_INFO {"STMT_DELETE_WORK_ITEM", NULL}
+#define STMT_SELECT_WORK_ITEMS 105
+#define STMT_105_INFO {"STMT_SELECT_WORK_ITEMS", NULL}
 #define STMT_105 \
-  "DELETE FROM work_queue WHERE id = ?1 " \
+  "SELECT id, work FROM work_queue ORDER BY id LIMIT ?1 " \
   ""
 
-#define STMT_INSERT_OR_IGNORE_PRISTINE 106
-#define STMT_106_INFO {"STMT_INSERT_OR_IGNORE_PRISTINE", NULL}
+#define STMT_DELETE_WORK_ITEM 106
+#define STMT_106_INFO {"STMT_DELETE_WORK_ITEM", NULL}
 #define STMT_106 \
+  "DELETE FROM work_queue WHERE id = ?1 " \
+  ""
+
+#define STMT_INSERT_OR_IGNORE_PRISTINE 107
+#define STMT_107_INFO {"STMT_INSERT_OR_IGNORE_PRISTINE", NULL}
+#define STMT_107 \
   "INSERT OR IGNORE INTO pristine (checksum, md5_checksum, size, refcount) " \
   "VALUES (?1, ?2, ?3, 0) " \
   ""
 
-#define STMT_INSERT_PRISTINE 107
-#define STMT_107_INFO {"STMT_INSERT_PRISTINE", NULL}
-#define STMT_107 \
+#define STMT_INSERT_PRISTINE 108
+#define STMT_108_INFO {"STMT_INSERT_PRISTINE", NULL}
+#define STMT_108 \
   "INSERT INTO pristine (checksum, md5_checksum, size, refcount) " \
   "VALUES (?1, ?2, ?3, 0) " \
   ""
 
-#define STMT_SELECT_PRISTINE 108
-#define STMT_108_INFO {"STMT_SELECT_PRISTINE", NULL}
-#define STMT_108 \
+#define STMT_SELECT_PRISTINE 109
+#define STMT_109_INFO {"STMT_SELECT_PRISTINE", NULL}
+#define STMT_109 \
   "SELECT md5_checksum " \
   "FROM pristine " \
   "WHERE checksum = ?1 " \
   ""
 
-#define STMT_SELECT_PRISTINE_SIZE 109
-#define STMT_109_INFO {"STMT_SELECT_PRISTINE_SIZE", NULL}
-#define STMT_109 \
+#define STMT_SELECT_PRISTINE_SIZE 110
+#define STMT_110_INFO {"STMT_SELECT_PRISTINE_SIZE", NULL}
+#define STMT_110 \
   "SELECT size " \
   "FROM pristine " \
   "WHERE checksum = ?1 LIMIT 1 " \
   ""
 
-#define STMT_SELECT_PRISTINE_BY_MD5 110
-#define STMT_110_INFO {"STMT_SELECT_PRISTINE_BY_MD5", NULL}
-#define STMT_110 \
+#define STMT_SELECT_PRISTINE_BY_MD5 111
+#define STMT_111_INFO {"STMT_SELECT_PRISTINE_BY_MD5", NULL}
+#define STMT_111 \
   "SELECT checksum " \
   "FROM pristine " \
   "WHERE md5_checksum = ?1 " \
   ""
 
-#define STMT_SELECT_UNREFERENCED_PRISTINES 111
-#define STMT_111_INFO {"STMT_SELECT_UNREFERENCED_PRISTINES", NULL}
-#define STMT_111 \
+#define STMT_SELECT_UNREFERENCED_PRISTINES 112
+#define STMT_112_INFO {"STMT_SELECT_UNREFERENCED_PRISTINES", NULL}
+#define STMT_112 \
   "SELECT checksum " \
   "FROM pristine " \
   "WHERE refcount = 0 " \
   ""
 
-#define STMT_DELETE_PRISTINE_IF_UNREFERENCED 112
-#define STMT_112_INFO {"STMT_DELETE_PRISTINE_IF_UNREFERENCED", NULL}
-#define STMT_112 \
+#define STMT_DELETE_PRISTINE_IF_UNREFERENCED 113
+#define STMT_113_INFO {"STMT_DELETE_PRISTINE_IF_UNREFERENCED", NULL}
+#define STMT_113 \
   "DELETE FROM pristine " \
   "WHERE checksum = ?1 AND refcount = 0 " \
   ""
 
-#define STMT_SELECT_COPY_PRISTINES 113
-#define STMT_113_INFO {"STMT_SELECT_COPY_PRISTINES", NULL}
-#define STMT_113 \
+#define STMT_SELECT_COPY_PRISTINES 114
+#define STMT_114_INFO {"STMT_SELECT_COPY_PRISTINES", NULL}
+#define STMT_114 \
   "SELECT n.checksum, md5_checksum, size " \
   "FROM nodes_current n " \
   "LEFT JOIN pristine p ON n.checksum = p.checksum " \
@@ -1185,62 +1191,62 @@
   "  AND n.checksum IS NOT NULL " \
   ""
 
-#define STMT_VACUUM 114
-#define STMT_114_INFO {"STMT_VACUUM", NULL}
-#define STMT_114 \
+#define STMT_VACUUM 115
+#define STMT_115_INFO {"STMT_VACUUM", NULL}
+#define STMT_115 \
   "VACUUM " \
   ""
 
-#define STMT_SELECT_CONFLICT_VICTIMS 115
-#define STMT_115_INFO {"STMT_SELECT_CONFLICT_VICTIMS", NULL}
-#define STMT_115 \
+#define STMT_SELECT_CONFLICT_VICTIMS 116
+#define STMT_116_INFO {"STMT_SELECT_CONFLICT_VICTIMS", NULL}
+#define STMT_116 \
   "SELECT local_relpath, conflict_data " \
   "FROM actual_node " \
   "WHERE wc_id = ?1 AND parent_relpath = ?2 AND " \
   "  NOT (conflict_data IS NULL) " \
   ""
 
-#define STMT_INSERT_WC_LOCK 116
-#define STMT_116_INFO {"STMT_INSERT_WC_LOCK", NULL}
-#define STMT_116 \
+#define STMT_INSERT_WC_LOCK 117
+#define STMT_117_INFO {"STMT_INSERT_WC_LOCK", NULL}
+#define STMT_117 \
   "INSERT INTO wc_lock (wc_id, local_dir_relpath, locked_levels) " \
   "VALUES (?1, ?2, ?3) " \
   ""
 
-#define STMT_SELECT_WC_LOCK 117
-#define STMT_117_INFO {"STMT_SELECT_WC_LOCK", NULL}
-#define STMT_117 \
+#define STMT_SELECT_WC_LOCK 118
+#define STMT_118_INFO {"STMT_SELECT_WC_LOCK", NULL}
+#define STMT_118 \
   "SELECT locked_levels FROM wc_lock " \
   "WHERE wc_id = ?1 AND local_dir_relpath = ?2 " \
   ""
 
-#define STMT_SELECT_ANCESTOR_WCLOCKS 118
-#define STMT_118_INFO {"STMT_SELECT_ANCESTOR_WCLOCKS", NULL}
-#define STMT_118 \
+#define STMT_SELECT_ANCESTOR_WCLOCKS 119
+#define STMT_119_INFO {"STMT_SELECT_ANCESTOR_WCLOCKS", NULL}
+#define STMT_119 \
   "SELECT local_dir_relpath, locked_levels FROM wc_lock " \
   "WHERE wc_id = ?1 " \
   "  AND ((local_dir_relpath >= ?3 AND local_dir_relpath <= ?2) " \
   "       OR local_dir_relpath = '') " \
   ""
 
-#define STMT_DELETE_WC_LOCK 119
-#define STMT_119_INFO {"STMT_DELETE_WC_LOCK", NULL}
-#define STMT_119 \
+#define STMT_DELETE_WC_LOCK 120
+#define STMT_120_INFO {"STMT_DELETE_WC_LOCK", NULL}
+#define STMT_120 \
   "DELETE FROM wc_lock " \
   "WHERE wc_id = ?1 AND local_dir_relpath = ?2 " \
   ""
 
-#define STMT_FIND_WC_LOCK 120
-#define STMT_120_INFO {"STMT_FIND_WC_LOCK", NULL}
-#define STMT_120 \
+#define STMT_FIND_WC_LOCK 121
+#define STMT_121_INFO {"STMT_FIND_WC_LOCK", NULL}
+#define STMT_121 \
   "SELECT local_dir_relpath FROM wc_lock " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_dir_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_dir_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_FIND_CONFLICT_DESCENDANT 121
-#define STMT_121_INFO {"STMT_FIND_CONFLICT_DESCENDANT", NULL}
-#define STMT_121 \
+#define STMT_FIND_CONFLICT_DESCENDANT 122
+#define STMT_122_INFO {"STMT_FIND_CONFLICT_DESCENDANT", NULL}
+#define STMT_122 \
   "SELECT 1 FROM actual_node " \
   "WHERE wc_id = ?1 " \
   "  AND local_relpath > (?2 || '/') " \
@@ -1249,9 +1255,9 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_DELETE_WC_LOCK_ORPHAN 122
-#define STMT_122_INFO {"STMT_DELETE_WC_LOCK_ORPHAN", NULL}
-#define STMT_122 \
+#define STMT_DELETE_WC_LOCK_ORPHAN 123
+#define STMT_123_INFO {"STMT_DELETE_WC_LOCK_ORPHAN", NULL}
+#define STMT_123 \
   "DELETE FROM wc_lock " \
   "WHERE wc_id = ?1 AND local_dir_relpath = ?2 " \
   "AND NOT EXISTS (SELECT 1 FROM nodes " \
@@ -1259,9 +1265,9 @@
   "                   AND nodes.local_relpath = wc_lock.local_dir_relpath) " \
   ""
 
-#define STMT_DELETE_WC_LOCK_ORPHAN_RECURSIVE 123
-#define STMT_123_INFO {"STMT_DELETE_WC_LOCK_ORPHAN_RECURSIVE", NULL}
-#define STMT_123 \
+#define STMT_DELETE_WC_LOCK_ORPHAN_RECURSIVE 124
+#define STMT_124_INFO {"STMT_DELETE_WC_LOCK_ORPHAN_RECURSIVE", NULL}
+#define STMT_124 \
   "DELETE FROM wc_lock " \
   "WHERE wc_id = ?1 " \
   "  AND (local_dir_relpath = ?2 " \
@@ -1271,9 +1277,9 @@
   "                     AND nodes.local_relpath = wc_lock.local_dir_relpath) " \
   ""
 
-#define STMT_APPLY_CHANGES_TO_BASE_NODE 124
-#define STMT_124_INFO {"STMT_APPLY_CHANGES_TO_BASE_NODE", NULL}
-#define STMT_124 \
+#define STMT_APPLY_CHANGES_TO_BASE_NODE 125
+#define STMT_125_INFO {"STMT_APPLY_CHANGES_TO_BASE_NODE", NULL}
+#define STMT_125 \
   "INSERT OR REPLACE INTO nodes ( " \
   "  wc_id, local_relpath, op_depth, parent_relpath, repos_id, repos_path, " \
   "  revision, presence, depth, kind, changed_revision, changed_date, " \
@@ -1287,18 +1293,18 @@
   "            AND op_depth = 0)) " \
   ""
 
-#define STMT_INSTALL_WORKING_NODE_FOR_DELETE 125
-#define STMT_125_INFO {"STMT_INSTALL_WORKING_NODE_FOR_DELETE", NULL}
-#define STMT_125 \
+#define STMT_INSTALL_WORKING_NODE_FOR_DELETE 126
+#define STMT_126_INFO {"STMT_INSTALL_WORKING_NODE_FOR_DELETE", NULL}
+#define STMT_126 \
   "INSERT INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, " \
   "    parent_relpath, presence, kind) " \
   "VALUES(?1, ?2, ?3, ?4, 'base-deleted', ?5) " \
   ""
 
-#define STMT_REPLACE_WITH_BASE_DELETED 126
-#define STMT_126_INFO {"STMT_REPLACE_WITH_BASE_DELETED", NULL}
-#define STMT_126 \
+#define STMT_REPLACE_WITH_BASE_DELETED 127
+#define STMT_127_INFO {"STMT_REPLACE_WITH_BASE_DELETED", NULL}
+#define STMT_127 \
   "INSERT OR REPLACE INTO nodes (wc_id, local_relpath, op_depth, parent_relpath, " \
   "                              kind, moved_to, presence) " \
   "SELECT wc_id, local_relpath, op_depth, parent_relpath, " \
@@ -1309,9 +1315,9 @@
   "   AND op_depth = ?3 " \
   ""
 
-#define STMT_INSERT_DELETE_FROM_NODE_RECURSIVE 127
-#define STMT_127_INFO {"STMT_INSERT_DELETE_FROM_NODE_RECURSIVE", NULL}
-#define STMT_127 \
+#define STMT_INSERT_DELETE_FROM_NODE_RECURSIVE 128
+#define STMT_128_INFO {"STMT_INSERT_DELETE_FROM_NODE_RECURSIVE", NULL}
+#define STMT_128 \
   "INSERT INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, presence, kind) " \
   "SELECT wc_id, local_relpath, ?4 , parent_relpath, 'base-deleted', " \
@@ -1330,9 +1336,9 @@
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_INSERT_WORKING_NODE_FROM_BASE_COPY 128
-#define STMT_128_INFO {"STMT_INSERT_WORKING_NODE_FROM_BASE_COPY", NULL}
-#define STMT_128 \
+#define STMT_INSERT_WORKING_NODE_FROM_BASE_COPY 129
+#define STMT_129_INFO {"STMT_INSERT_WORKING_NODE_FROM_BASE_COPY", NULL}
+#define STMT_129 \
   "INSERT OR REPLACE INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, repos_id, repos_path, " \
   "    revision, presence, depth, kind, changed_revision, changed_date, " \
@@ -1348,9 +1354,9 @@
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = 0 " \
   ""
 
-#define STMT_INSERT_DELETE_FROM_BASE 129
-#define STMT_129_INFO {"STMT_INSERT_DELETE_FROM_BASE", NULL}
-#define STMT_129 \
+#define STMT_INSERT_DELETE_FROM_BASE 130
+#define STMT_130_INFO {"STMT_INSERT_DELETE_FROM_BASE", NULL}
+#define STMT_130 \
   "INSERT INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, presence, kind) " \
   "SELECT wc_id, local_relpath, ?3 , parent_relpath, " \
@@ -1359,18 +1365,18 @@
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = 0 " \
   ""
 
-#define STMT_UPDATE_OP_DEPTH_INCREASE_RECURSIVE 130
-#define STMT_130_INFO {"STMT_UPDATE_OP_DEPTH_INCREASE_RECURSIVE", NULL}
-#define STMT_130 \
+#define STMT_UPDATE_OP_DEPTH_INCREASE_RECURSIVE 131
+#define STMT_131_INFO {"STMT_UPDATE_OP_DEPTH_INCREASE_RECURSIVE", NULL}
+#define STMT_131 \
   "UPDATE nodes SET op_depth = ?3 + 1 " \
   "WHERE wc_id = ?1 " \
   " AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   " AND op_depth = ?3 " \
   ""
 
-#define STMT_COPY_OP_DEPTH_RECURSIVE 131
-#define STMT_131_INFO {"STMT_COPY_OP_DEPTH_RECURSIVE", NULL}
-#define STMT_131 \
+#define STMT_COPY_OP_DEPTH_RECURSIVE 132
+#define STMT_132_INFO {"STMT_COPY_OP_DEPTH_RECURSIVE", NULL}
+#define STMT_132 \
   "INSERT INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, repos_id, repos_path, " \
   "    revision, presence, depth, kind, changed_revision, changed_date, " \
@@ -1395,16 +1401,16 @@
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_DOES_NODE_EXIST 132
-#define STMT_132_INFO {"STMT_DOES_NODE_EXIST", NULL}
-#define STMT_132 \
+#define STMT_DOES_NODE_EXIST 133
+#define STMT_133_INFO {"STMT_DOES_NODE_EXIST", NULL}
+#define STMT_133 \
   "SELECT 1 FROM nodes WHERE wc_id = ?1 AND local_relpath = ?2 " \
   "LIMIT 1 " \
   ""
 
-#define STMT_HAS_SERVER_EXCLUDED_DESCENDANTS 133
-#define STMT_133_INFO {"STMT_HAS_SERVER_EXCLUDED_DESCENDANTS", NULL}
-#define STMT_133 \
+#define STMT_HAS_SERVER_EXCLUDED_DESCENDANTS 134
+#define STMT_134_INFO {"STMT_HAS_SERVER_EXCLUDED_DESCENDANTS", NULL}
+#define STMT_134 \
   "SELECT local_relpath FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -1412,9 +1418,9 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_SELECT_ALL_EXCLUDED_DESCENDANTS 134
-#define STMT_134_INFO {"STMT_SELECT_ALL_EXCLUDED_DESCENDANTS", NULL}
-#define STMT_134 \
+#define STMT_SELECT_ALL_EXCLUDED_DESCENDANTS 135
+#define STMT_135_INFO {"STMT_SELECT_ALL_EXCLUDED_DESCENDANTS", NULL}
+#define STMT_135 \
   "SELECT local_relpath FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -1422,9 +1428,9 @@
   "  AND (presence = 'server-excluded' OR presence = 'excluded') " \
   ""
 
-#define STMT_INSERT_WORKING_NODE_COPY_FROM 135
-#define STMT_135_INFO {"STMT_INSERT_WORKING_NODE_COPY_FROM", NULL}
-#define STMT_135 \
+#define STMT_INSERT_WORKING_NODE_COPY_FROM 136
+#define STMT_136_INFO {"STMT_INSERT_WORKING_NODE_COPY_FROM", NULL}
+#define STMT_136 \
   "INSERT OR REPLACE INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, repos_id, " \
   "    repos_path, revision, presence, depth, moved_here, kind, changed_revision, " \
@@ -1443,9 +1449,9 @@
   "WHERE wc_id = ?1 AND local_relpath = ?2 " \
   ""
 
-#define STMT_INSERT_WORKING_NODE_COPY_FROM_DEPTH 136
-#define STMT_136_INFO {"STMT_INSERT_WORKING_NODE_COPY_FROM_DEPTH", NULL}
-#define STMT_136 \
+#define STMT_INSERT_WORKING_NODE_COPY_FROM_DEPTH 137
+#define STMT_137_INFO {"STMT_INSERT_WORKING_NODE_COPY_FROM_DEPTH", NULL}
+#define STMT_137 \
   "INSERT OR REPLACE INTO nodes ( " \
   "    wc_id, local_relpath, op_depth, parent_relpath, repos_id, " \
   "    repos_path, revision, presence, depth, moved_here, kind, changed_revision, " \
@@ -1464,49 +1470,49 @@
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = ?7 " \
   ""
 
-#define STMT_UPDATE_BASE_REVISION 137
-#define STMT_137_INFO {"STMT_UPDATE_BASE_REVISION", NULL}
-#define STMT_137 \
+#define STMT_UPDATE_BASE_REVISION 138
+#define STMT_138_INFO {"STMT_UPDATE_BASE_REVISION", NULL}
+#define STMT_138 \
   "UPDATE nodes SET revision = ?3 " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = 0 " \
   ""
 
-#define STMT_UPDATE_BASE_REPOS 138
-#define STMT_138_INFO {"STMT_UPDATE_BASE_REPOS", NULL}
-#define STMT_138 \
+#define STMT_UPDATE_BASE_REPOS 139
+#define STMT_139_INFO {"STMT_UPDATE_BASE_REPOS", NULL}
+#define STMT_139 \
   "UPDATE nodes SET repos_id = ?3, repos_path = ?4 " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = 0 " \
   ""
 
-#define STMT_ACTUAL_HAS_CHILDREN 139
-#define STMT_139_INFO {"STMT_ACTUAL_HAS_CHILDREN", NULL}
-#define STMT_139 \
+#define STMT_ACTUAL_HAS_CHILDREN 140
+#define STMT_140_INFO {"STMT_ACTUAL_HAS_CHILDREN", NULL}
+#define STMT_140 \
   "SELECT 1 FROM actual_node " \
   "WHERE wc_id = ?1 AND parent_relpath = ?2 " \
   "LIMIT 1 " \
   ""
 
-#define STMT_INSERT_EXTERNAL 140
-#define STMT_140_INFO {"STMT_INSERT_EXTERNAL", NULL}
-#define STMT_140 \
+#define STMT_INSERT_EXTERNAL 141
+#define STMT_141_INFO {"STMT_INSERT_EXTERNAL", NULL}
+#define STMT_141 \
   "INSERT OR REPLACE INTO externals ( " \
   "    wc_id, local_relpath, parent_relpath, presence, kind, def_local_relpath, " \
   "    repos_id, def_repos_relpath, def_operational_revision, def_revision) " \
   "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10) " \
   ""
 
-#define STMT_SELECT_EXTERNAL_INFO 141
-#define STMT_141_INFO {"STMT_SELECT_EXTERNAL_INFO", NULL}
-#define STMT_141 \
+#define STMT_SELECT_EXTERNAL_INFO 142
+#define STMT_142_INFO {"STMT_SELECT_EXTERNAL_INFO", NULL}
+#define STMT_142 \
   "SELECT presence, kind, def_local_relpath, repos_id, " \
   "    def_repos_relpath, def_operational_revision, def_revision " \
   "FROM externals WHERE wc_id = ?1 AND local_relpath = ?2 " \
   "LIMIT 1 " \
   ""
 
-#define STMT_DELETE_FILE_EXTERNALS 142
-#define STMT_142_INFO {"STMT_DELETE_FILE_EXTERNALS", NULL}
-#define STMT_142 \
+#define STMT_DELETE_FILE_EXTERNALS 143
+#define STMT_143_INFO {"STMT_DELETE_FILE_EXTERNALS", NULL}
+#define STMT_143 \
   "DELETE FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -1514,26 +1520,26 @@
   "  AND file_external IS NOT NULL " \
   ""
 
-#define STMT_DELETE_FILE_EXTERNAL_REGISTATIONS 143
-#define STMT_143_INFO {"STMT_DELETE_FILE_EXTERNAL_REGISTATIONS", NULL}
-#define STMT_143 \
+#define STMT_DELETE_FILE_EXTERNAL_REGISTATIONS 144
+#define STMT_144_INFO {"STMT_DELETE_FILE_EXTERNAL_REGISTATIONS", NULL}
+#define STMT_144 \
   "DELETE FROM externals " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   "  AND kind != 'dir' " \
   ""
 
-#define STMT_DELETE_EXTERNAL_REGISTATIONS 144
-#define STMT_144_INFO {"STMT_DELETE_EXTERNAL_REGISTATIONS", NULL}
-#define STMT_144 \
+#define STMT_DELETE_EXTERNAL_REGISTATIONS 145
+#define STMT_145_INFO {"STMT_DELETE_EXTERNAL_REGISTATIONS", NULL}
+#define STMT_145 \
   "DELETE FROM externals " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_SELECT_COMMITTABLE_EXTERNALS_BELOW 145
-#define STMT_145_INFO {"STMT_SELECT_COMMITTABLE_EXTERNALS_BELOW", NULL}
-#define STMT_145 \
+#define STMT_SELECT_COMMITTABLE_EXTERNALS_BELOW 146
+#define STMT_146_INFO {"STMT_SELECT_COMMITTABLE_EXTERNALS_BELOW", NULL}
+#define STMT_146 \
   "SELECT local_relpath, kind, def_repos_relpath, " \
   "  (SELECT root FROM repository AS r WHERE r.id = e.repos_id) " \
   "FROM externals e " \
@@ -1551,9 +1557,9 @@
   "                  AND nodes.local_relpath = e.parent_relpath)) " \
   ""
 
-#define STMT_SELECT_COMMITTABLE_EXTERNALS_IMMEDIATELY_BELOW 146
-#define STMT_146_INFO {"STMT_SELECT_COMMITTABLE_EXTERNALS_IMMEDIATELY_BELOW", NULL}
-#define STMT_146 \
+#define STMT_SELECT_COMMITTABLE_EXTERNALS_IMMEDIATELY_BELOW 147
+#define STMT_147_INFO {"STMT_SELECT_COMMITTABLE_EXTERNALS_IMMEDIATELY_BELOW", NULL}
+#define STMT_147 \
   "SELECT local_relpath, kind, def_repos_relpath, " \
   "  (SELECT root FROM repository AS r WHERE r.id = e.repos_id) " \
   "FROM externals e " \
@@ -1572,25 +1578,25 @@
   "                  AND nodes.local_relpath = e.parent_relpath)) " \
   ""
 
-#define STMT_SELECT_EXTERNALS_DEFINED 147
-#define STMT_147_INFO {"STMT_SELECT_EXTERNALS_DEFINED", NULL}
-#define STMT_147 \
+#define STMT_SELECT_EXTERNALS_DEFINED 148
+#define STMT_148_INFO {"STMT_SELECT_EXTERNALS_DEFINED", NULL}
+#define STMT_148 \
   "SELECT local_relpath, def_local_relpath " \
   "FROM externals " \
   "WHERE (wc_id = ?1 AND def_local_relpath = ?2) " \
   "   OR (wc_id = ?1 AND (((def_local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((def_local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END))) " \
   ""
 
-#define STMT_DELETE_EXTERNAL 148
-#define STMT_148_INFO {"STMT_DELETE_EXTERNAL", NULL}
-#define STMT_148 \
+#define STMT_DELETE_EXTERNAL 149
+#define STMT_149_INFO {"STMT_DELETE_EXTERNAL", NULL}
+#define STMT_149 \
   "DELETE FROM externals " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 " \
   ""
 
-#define STMT_SELECT_EXTERNAL_PROPERTIES 149
-#define STMT_149_INFO {"STMT_SELECT_EXTERNAL_PROPERTIES", NULL}
-#define STMT_149 \
+#define STMT_SELECT_EXTERNAL_PROPERTIES 150
+#define STMT_150_INFO {"STMT_SELECT_EXTERNAL_PROPERTIES", NULL}
+#define STMT_150 \
   "SELECT IFNULL((SELECT properties FROM actual_node a " \
   "               WHERE a.wc_id = ?1 AND A.local_relpath = n.local_relpath), " \
   "              properties), " \
@@ -1608,9 +1614,9 @@
   "  AND kind = 'dir' AND presence IN ('normal', 'incomplete') " \
   ""
 
-#define STMT_SELECT_CURRENT_PROPS_RECURSIVE 150
-#define STMT_150_INFO {"STMT_SELECT_CURRENT_PROPS_RECURSIVE", NULL}
-#define STMT_150 \
+#define STMT_SELECT_CURRENT_PROPS_RECURSIVE 151
+#define STMT_151_INFO {"STMT_SELECT_CURRENT_PROPS_RECURSIVE", NULL}
+#define STMT_151 \
   "SELECT IFNULL((SELECT properties FROM actual_node a " \
   "               WHERE a.wc_id = ?1 AND A.local_relpath = n.local_relpath), " \
   "              properties), " \
@@ -1620,51 +1626,51 @@
   "   OR (wc_id = ?1 AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END))) " \
   ""
 
-#define STMT_PRAGMA_LOCKING_MODE 151
-#define STMT_151_INFO {"STMT_PRAGMA_LOCKING_MODE", NULL}
-#define STMT_151 \
+#define STMT_PRAGMA_LOCKING_MODE 152
+#define STMT_152_INFO {"STMT_PRAGMA_LOCKING_MODE", NULL}
+#define STMT_152 \
   "PRAGMA locking_mode = exclusive; " \
   "PRAGMA journal_mode = DELETE " \
   ""
 
-#define STMT_FIND_REPOS_PATH_IN_WC 152
-#define STMT_152_INFO {"STMT_FIND_REPOS_PATH_IN_WC", NULL}
-#define STMT_152 \
+#define STMT_FIND_REPOS_PATH_IN_WC 153
+#define STMT_153_INFO {"STMT_FIND_REPOS_PATH_IN_WC", NULL}
+#define STMT_153 \
   "SELECT local_relpath FROM nodes_current " \
   "  WHERE wc_id = ?1 AND repos_path = ?2 " \
   ""
 
-#define STMT_INSERT_ACTUAL_NODE 153
-#define STMT_153_INFO {"STMT_INSERT_ACTUAL_NODE", NULL}
-#define STMT_153 \
+#define STMT_INSERT_ACTUAL_NODE 154
+#define STMT_154_INFO {"STMT_INSERT_ACTUAL_NODE", NULL}
+#define STMT_154 \
   "INSERT OR REPLACE INTO actual_node ( " \
   "  wc_id, local_relpath, parent_relpath, properties, changelist, conflict_data) " \
   "VALUES (?1, ?2, ?3, ?4, ?5, ?6) " \
   ""
 
-#define STMT_SELECT_ALL_FILES 154
-#define STMT_154_INFO {"STMT_SELECT_ALL_FILES", NULL}
-#define STMT_154 \
+#define STMT_SELECT_ALL_FILES 155
+#define STMT_155_INFO {"STMT_SELECT_ALL_FILES", NULL}
+#define STMT_155 \
   "SELECT local_relpath FROM nodes_current " \
   "WHERE wc_id = ?1 AND parent_relpath = ?2 AND kind = 'file' " \
   ""
 
-#define STMT_UPDATE_NODE_PROPS 155
-#define STMT_155_INFO {"STMT_UPDATE_NODE_PROPS", NULL}
-#define STMT_155 \
+#define STMT_UPDATE_NODE_PROPS 156
+#define STMT_156_INFO {"STMT_UPDATE_NODE_PROPS", NULL}
+#define STMT_156 \
   "UPDATE nodes SET properties = ?4 " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = ?3 " \
   ""
 
-#define STMT_PRAGMA_TABLE_INFO_NODES 156
-#define STMT_156_INFO {"STMT_PRAGMA_TABLE_INFO_NODES", NULL}
-#define STMT_156 \
+#define STMT_PRAGMA_TABLE_INFO_NODES 157
+#define STMT_157_INFO {"STMT_PRAGMA_TABLE_INFO_NODES", NULL}
+#define STMT_157 \
   "PRAGMA table_info(\"NODES\") " \
   ""
 
-#define STMT_CREATE_TARGET_PROP_CACHE 157
-#define STMT_157_INFO {"STMT_CREATE_TARGET_PROP_CACHE", NULL}
-#define STMT_157 \
+#define STMT_CREATE_TARGET_PROP_CACHE 158
+#define STMT_158_INFO {"STMT_CREATE_TARGET_PROP_CACHE", NULL}
+#define STMT_158 \
   "DROP TABLE IF EXISTS target_prop_cache; " \
   "CREATE TEMPORARY TABLE target_prop_cache ( " \
   "  local_relpath TEXT NOT NULL PRIMARY KEY, " \
@@ -1673,9 +1679,9 @@
   "); " \
   ""
 
-#define STMT_CACHE_TARGET_PROPS 158
-#define STMT_158_INFO {"STMT_CACHE_TARGET_PROPS", NULL}
-#define STMT_158 \
+#define STMT_CACHE_TARGET_PROPS 159
+#define STMT_159_INFO {"STMT_CACHE_TARGET_PROPS", NULL}
+#define STMT_159 \
   "INSERT INTO target_prop_cache(local_relpath, kind, properties) " \
   " SELECT n.local_relpath, n.kind, " \
   "        IFNULL((SELECT properties FROM actual_node AS a " \
@@ -1694,9 +1700,9 @@
   "  ORDER BY t.local_relpath " \
   ""
 
-#define STMT_CACHE_TARGET_PRISTINE_PROPS 159
-#define STMT_159_INFO {"STMT_CACHE_TARGET_PRISTINE_PROPS", NULL}
-#define STMT_159 \
+#define STMT_CACHE_TARGET_PRISTINE_PROPS 160
+#define STMT_160_INFO {"STMT_CACHE_TARGET_PRISTINE_PROPS", NULL}
+#define STMT_160 \
   "INSERT INTO target_prop_cache(local_relpath, kind, properties) " \
   " SELECT n.local_relpath, n.kind, " \
   "        CASE n.presence " \
@@ -1721,22 +1727,22 @@
   "  ORDER BY t.local_relpath " \
   ""
 
-#define STMT_SELECT_ALL_TARGET_PROP_CACHE 160
-#define STMT_160_INFO {"STMT_SELECT_ALL_TARGET_PROP_CACHE", NULL}
-#define STMT_160 \
+#define STMT_SELECT_ALL_TARGET_PROP_CACHE 161
+#define STMT_161_INFO {"STMT_SELECT_ALL_TARGET_PROP_CACHE", NULL}
+#define STMT_161 \
   "SELECT local_relpath, properties FROM target_prop_cache " \
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_DROP_TARGET_PROP_CACHE 161
-#define STMT_161_INFO {"STMT_DROP_TARGET_PROP_CACHE", NULL}
-#define STMT_161 \
+#define STMT_DROP_TARGET_PROP_CACHE 162
+#define STMT_162_INFO {"STMT_DROP_TARGET_PROP_CACHE", NULL}
+#define STMT_162 \
   "DROP TABLE target_prop_cache; " \
   ""
 
-#define STMT_CREATE_REVERT_LIST 162
-#define STMT_162_INFO {"STMT_CREATE_REVERT_LIST", NULL}
-#define STMT_162 \
+#define STMT_CREATE_REVERT_LIST 163
+#define STMT_163_INFO {"STMT_CREATE_REVERT_LIST", NULL}
+#define STMT_163 \
   "DROP TABLE IF EXISTS revert_list; " \
   "CREATE TEMPORARY TABLE revert_list ( " \
   "   local_relpath TEXT NOT NULL, " \
@@ -1794,26 +1800,26 @@
   "END " \
   ""
 
-#define STMT_DROP_REVERT_LIST_TRIGGERS 163
-#define STMT_163_INFO {"STMT_DROP_REVERT_LIST_TRIGGERS", NULL}
-#define STMT_163 \
+#define STMT_DROP_REVERT_LIST_TRIGGERS 164
+#define STMT_164_INFO {"STMT_DROP_REVERT_LIST_TRIGGERS", NULL}
+#define STMT_164 \
   "DROP TRIGGER trigger_revert_list_nodes; " \
   "DROP TRIGGER trigger_revert_list_actual_delete; " \
   "DROP TRIGGER trigger_revert_list_actual_update " \
   ""
 
-#define STMT_SELECT_REVERT_LIST 164
-#define STMT_164_INFO {"STMT_SELECT_REVERT_LIST", NULL}
-#define STMT_164 \
+#define STMT_SELECT_REVERT_LIST 165
+#define STMT_165_INFO {"STMT_SELECT_REVERT_LIST", NULL}
+#define STMT_165 \
   "SELECT actual, notify, kind, op_depth, repos_id, conflict_data " \
   "FROM revert_list " \
   "WHERE local_relpath = ?1 " \
   "ORDER BY actual DESC " \
   ""
 
-#define STMT_SELECT_REVERT_LIST_COPIED_CHILDREN 165
-#define STMT_165_INFO {"STMT_SELECT_REVERT_LIST_COPIED_CHILDREN", NULL}
-#define STMT_165 \
+#define STMT_SELECT_REVERT_LIST_COPIED_CHILDREN 166
+#define STMT_166_INFO {"STMT_SELECT_REVERT_LIST_COPIED_CHILDREN", NULL}
+#define STMT_166 \
   "SELECT local_relpath, kind " \
   "FROM revert_list " \
   "WHERE (((local_relpath) > (CASE (?1) WHEN '' THEN '' ELSE (?1) || '/' END)) AND ((local_relpath) < CASE (?1) WHEN '' THEN X'FFFF' ELSE (?1) || '0' END)) " \
@@ -1822,15 +1828,15 @@
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_DELETE_REVERT_LIST 166
-#define STMT_166_INFO {"STMT_DELETE_REVERT_LIST", NULL}
-#define STMT_166 \
+#define STMT_DELETE_REVERT_LIST 167
+#define STMT_167_INFO {"STMT_DELETE_REVERT_LIST", NULL}
+#define STMT_167 \
   "DELETE FROM revert_list WHERE local_relpath = ?1 " \
   ""
 
-#define STMT_SELECT_REVERT_LIST_RECURSIVE 167
-#define STMT_167_INFO {"STMT_SELECT_REVERT_LIST_RECURSIVE", NULL}
-#define STMT_167 \
+#define STMT_SELECT_REVERT_LIST_RECURSIVE 168
+#define STMT_168_INFO {"STMT_SELECT_REVERT_LIST_RECURSIVE", NULL}
+#define STMT_168 \
   "SELECT p.local_relpath, n.kind, a.notify, a.kind " \
   "FROM (SELECT DISTINCT local_relpath " \
   "      FROM revert_list " \
@@ -1841,32 +1847,32 @@
   "ORDER BY p.local_relpath " \
   ""
 
-#define STMT_DELETE_REVERT_LIST_RECURSIVE 168
-#define STMT_168_INFO {"STMT_DELETE_REVERT_LIST_RECURSIVE", NULL}
-#define STMT_168 \
+#define STMT_DELETE_REVERT_LIST_RECURSIVE 169
+#define STMT_169_INFO {"STMT_DELETE_REVERT_LIST_RECURSIVE", NULL}
+#define STMT_169 \
   "DELETE FROM revert_list " \
   "WHERE (local_relpath = ?1 " \
   "       OR (((local_relpath) > (CASE (?1) WHEN '' THEN '' ELSE (?1) || '/' END)) AND ((local_relpath) < CASE (?1) WHEN '' THEN X'FFFF' ELSE (?1) || '0' END))) " \
   ""
 
-#define STMT_DROP_REVERT_LIST 169
-#define STMT_169_INFO {"STMT_DROP_REVERT_LIST", NULL}
-#define STMT_169 \
+#define STMT_DROP_REVERT_LIST 170
+#define STMT_170_INFO {"STMT_DROP_REVERT_LIST", NULL}
+#define STMT_170 \
   "DROP TABLE IF EXISTS revert_list " \
   ""
 
-#define STMT_CREATE_DELETE_LIST 170
-#define STMT_170_INFO {"STMT_CREATE_DELETE_LIST", NULL}
-#define STMT_170 \
+#define STMT_CREATE_DELETE_LIST 171
+#define STMT_171_INFO {"STMT_CREATE_DELETE_LIST", NULL}
+#define STMT_171 \
   "DROP TABLE IF EXISTS delete_list; " \
   "CREATE TEMPORARY TABLE delete_list ( " \
   "   local_relpath TEXT PRIMARY KEY NOT NULL UNIQUE " \
   "   ) " \
   ""
 
-#define STMT_INSERT_DELETE_LIST 171
-#define STMT_171_INFO {"STMT_INSERT_DELETE_LIST", NULL}
-#define STMT_171 \
+#define STMT_INSERT_DELETE_LIST 172
+#define STMT_172_INFO {"STMT_INSERT_DELETE_LIST", NULL}
+#define STMT_172 \
   "INSERT INTO delete_list(local_relpath) " \
   "SELECT ?2 " \
   "UNION ALL " \
@@ -1882,22 +1888,22 @@
   "ORDER by local_relpath " \
   ""
 
-#define STMT_SELECT_DELETE_LIST 172
-#define STMT_172_INFO {"STMT_SELECT_DELETE_LIST", NULL}
-#define STMT_172 \
+#define STMT_SELECT_DELETE_LIST 173
+#define STMT_173_INFO {"STMT_SELECT_DELETE_LIST", NULL}
+#define STMT_173 \
   "SELECT local_relpath FROM delete_list " \
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_FINALIZE_DELETE 173
-#define STMT_173_INFO {"STMT_FINALIZE_DELETE", NULL}
-#define STMT_173 \
+#define STMT_FINALIZE_DELETE 174
+#define STMT_174_INFO {"STMT_FINALIZE_DELETE", NULL}
+#define STMT_174 \
   "DROP TABLE IF EXISTS delete_list " \
   ""
 
-#define STMT_CREATE_UPDATE_MOVE_LIST 174
-#define STMT_174_INFO {"STMT_CREATE_UPDATE_MOVE_LIST", NULL}
-#define STMT_174 \
+#define STMT_CREATE_UPDATE_MOVE_LIST 175
+#define STMT_175_INFO {"STMT_CREATE_UPDATE_MOVE_LIST", NULL}
+#define STMT_175 \
   "DROP TABLE IF EXISTS update_move_list; " \
   "CREATE TEMPORARY TABLE update_move_list ( " \
   "  local_relpath TEXT PRIMARY KEY NOT NULL UNIQUE, " \
@@ -1908,39 +1914,39 @@
   "  ) " \
   ""
 
-#define STMT_INSERT_UPDATE_MOVE_LIST 175
-#define STMT_175_INFO {"STMT_INSERT_UPDATE_MOVE_LIST", NULL}
-#define STMT_175 \
+#define STMT_INSERT_UPDATE_MOVE_LIST 176
+#define STMT_176_INFO {"STMT_INSERT_UPDATE_MOVE_LIST", NULL}
+#define STMT_176 \
   "INSERT INTO update_move_list(local_relpath, action, kind, content_state, " \
   "  prop_state) " \
   "VALUES (?1, ?2, ?3, ?4, ?5) " \
   ""
 
-#define STMT_SELECT_UPDATE_MOVE_LIST 176
-#define STMT_176_INFO {"STMT_SELECT_UPDATE_MOVE_LIST", NULL}
-#define STMT_176 \
+#define STMT_SELECT_UPDATE_MOVE_LIST 177
+#define STMT_177_INFO {"STMT_SELECT_UPDATE_MOVE_LIST", NULL}
+#define STMT_177 \
   "SELECT local_relpath, action, kind, content_state, prop_state " \
   "FROM update_move_list " \
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_FINALIZE_UPDATE_MOVE 177
-#define STMT_177_INFO {"STMT_FINALIZE_UPDATE_MOVE", NULL}
-#define STMT_177 \
+#define STMT_FINALIZE_UPDATE_MOVE 178
+#define STMT_178_INFO {"STMT_FINALIZE_UPDATE_MOVE", NULL}
+#define STMT_178 \
   "DROP TABLE IF EXISTS update_move_list " \
   ""
 
-#define STMT_MOVE_NOTIFY_TO_REVERT 178
-#define STMT_178_INFO {"STMT_MOVE_NOTIFY_TO_REVERT", NULL}
-#define STMT_178 \
+#define STMT_MOVE_NOTIFY_TO_REVERT 179
+#define STMT_179_INFO {"STMT_MOVE_NOTIFY_TO_REVERT", NULL}
+#define STMT_179 \
   "INSERT INTO revert_list (local_relpath, notify, kind, actual) " \
   "       SELECT local_relpath, 2, kind, 1 FROM update_move_list; " \
   "DROP TABLE update_move_list " \
   ""
 
-#define STMT_SELECT_MIN_MAX_REVISIONS 179
-#define STMT_179_INFO {"STMT_SELECT_MIN_MAX_REVISIONS", NULL}
-#define STMT_179 \
+#define STMT_SELECT_MIN_MAX_REVISIONS 180
+#define STMT_180_INFO {"STMT_SELECT_MIN_MAX_REVISIONS", NULL}
+#define STMT_180 \
   "SELECT MIN(revision), MAX(revision), " \
   "       MIN(changed_revision), MAX(changed_revision) FROM nodes " \
   "  WHERE wc_id = ?1 " \
@@ -1951,9 +1957,9 @@
   "    AND op_depth = 0 " \
   ""
 
-#define STMT_HAS_SPARSE_NODES 180
-#define STMT_180_INFO {"STMT_HAS_SPARSE_NODES", NULL}
-#define STMT_180 \
+#define STMT_HAS_SPARSE_NODES 181
+#define STMT_181_INFO {"STMT_HAS_SPARSE_NODES", NULL}
+#define STMT_181 \
   "SELECT 1 FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (local_relpath = ?2 " \
@@ -1965,9 +1971,9 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_SUBTREE_HAS_TREE_MODIFICATIONS 181
-#define STMT_181_INFO {"STMT_SUBTREE_HAS_TREE_MODIFICATIONS", NULL}
-#define STMT_181 \
+#define STMT_SUBTREE_HAS_TREE_MODIFICATIONS 182
+#define STMT_182_INFO {"STMT_SUBTREE_HAS_TREE_MODIFICATIONS", NULL}
+#define STMT_182 \
   "SELECT 1 FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (local_relpath = ?2 " \
@@ -1976,9 +1982,9 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_SUBTREE_HAS_PROP_MODIFICATIONS 182
-#define STMT_182_INFO {"STMT_SUBTREE_HAS_PROP_MODIFICATIONS", NULL}
-#define STMT_182 \
+#define STMT_SUBTREE_HAS_PROP_MODIFICATIONS 183
+#define STMT_183_INFO {"STMT_SUBTREE_HAS_PROP_MODIFICATIONS", NULL}
+#define STMT_183 \
   "SELECT 1 FROM actual_node " \
   "WHERE wc_id = ?1 " \
   "  AND (local_relpath = ?2 " \
@@ -1987,9 +1993,9 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_HAS_SWITCHED 183
-#define STMT_183_INFO {"STMT_HAS_SWITCHED", NULL}
-#define STMT_183 \
+#define STMT_HAS_SWITCHED 184
+#define STMT_184_INFO {"STMT_HAS_SWITCHED", NULL}
+#define STMT_184 \
   "SELECT 1 " \
   "FROM nodes " \
   "WHERE wc_id = ?1 " \
@@ -2001,47 +2007,47 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_SELECT_MOVED_FROM_RELPATH 184
-#define STMT_184_INFO {"STMT_SELECT_MOVED_FROM_RELPATH", NULL}
-#define STMT_184 \
+#define STMT_SELECT_MOVED_FROM_RELPATH 185
+#define STMT_185_INFO {"STMT_SELECT_MOVED_FROM_RELPATH", NULL}
+#define STMT_185 \
   "SELECT local_relpath, op_depth FROM nodes " \
   "WHERE wc_id = ?1 AND moved_to = ?2 AND op_depth > 0 " \
   ""
 
-#define STMT_UPDATE_MOVED_TO_RELPATH 185
-#define STMT_185_INFO {"STMT_UPDATE_MOVED_TO_RELPATH", NULL}
-#define STMT_185 \
+#define STMT_UPDATE_MOVED_TO_RELPATH 186
+#define STMT_186_INFO {"STMT_UPDATE_MOVED_TO_RELPATH", NULL}
+#define STMT_186 \
   "UPDATE nodes SET moved_to = ?4 " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = ?3 " \
   ""
 
-#define STMT_CLEAR_MOVED_TO_RELPATH 186
-#define STMT_186_INFO {"STMT_CLEAR_MOVED_TO_RELPATH", NULL}
-#define STMT_186 \
+#define STMT_CLEAR_MOVED_TO_RELPATH 187
+#define STMT_187_INFO {"STMT_CLEAR_MOVED_TO_RELPATH", NULL}
+#define STMT_187 \
   "UPDATE nodes SET moved_to = NULL " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth = ?3 " \
   ""
 
-#define STMT_CLEAR_MOVED_HERE_RECURSIVE 187
-#define STMT_187_INFO {"STMT_CLEAR_MOVED_HERE_RECURSIVE", NULL}
-#define STMT_187 \
+#define STMT_CLEAR_MOVED_HERE_RECURSIVE 188
+#define STMT_188_INFO {"STMT_CLEAR_MOVED_HERE_RECURSIVE", NULL}
+#define STMT_188 \
   "UPDATE nodes SET moved_here = NULL " \
   "WHERE wc_id = ?1 " \
   " AND (local_relpath = ?2 OR (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END))) " \
   " AND op_depth = ?3 " \
   ""
 
-#define STMT_SELECT_MOVED_HERE_CHILDREN 188
-#define STMT_188_INFO {"STMT_SELECT_MOVED_HERE_CHILDREN", NULL}
-#define STMT_188 \
+#define STMT_SELECT_MOVED_HERE_CHILDREN 189
+#define STMT_189_INFO {"STMT_SELECT_MOVED_HERE_CHILDREN", NULL}
+#define STMT_189 \
   "SELECT moved_to, local_relpath FROM nodes " \
   "WHERE wc_id = ?1 AND op_depth > 0 " \
   "  AND (((moved_to) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((moved_to) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_SELECT_MOVED_FOR_DELETE 189
-#define STMT_189_INFO {"STMT_SELECT_MOVED_FOR_DELETE", NULL}
-#define STMT_189 \
+#define STMT_SELECT_MOVED_FOR_DELETE 190
+#define STMT_190_INFO {"STMT_SELECT_MOVED_FOR_DELETE", NULL}
+#define STMT_190 \
   "SELECT local_relpath, moved_to, op_depth, " \
   "       (SELECT CASE WHEN r.moved_here THEN r.op_depth END FROM nodes r " \
   "        WHERE r.wc_id = ?1 " \
@@ -2055,9 +2061,9 @@
   "  AND op_depth >= ?3 " \
   ""
 
-#define STMT_SELECT_MOVED_FROM_FOR_DELETE 190
-#define STMT_190_INFO {"STMT_SELECT_MOVED_FROM_FOR_DELETE", NULL}
-#define STMT_190 \
+#define STMT_SELECT_MOVED_FROM_FOR_DELETE 191
+#define STMT_191_INFO {"STMT_SELECT_MOVED_FROM_FOR_DELETE", NULL}
+#define STMT_191 \
   "SELECT local_relpath, op_depth, " \
   "       (SELECT CASE WHEN r.moved_here THEN r.op_depth END FROM nodes r " \
   "        WHERE r.wc_id = ?1 " \
@@ -2068,25 +2074,25 @@
   "WHERE wc_id = ?1 AND moved_to = ?2 AND op_depth > 0 " \
   ""
 
-#define STMT_UPDATE_MOVED_TO_DESCENDANTS 191
-#define STMT_191_INFO {"STMT_UPDATE_MOVED_TO_DESCENDANTS", NULL}
-#define STMT_191 \
+#define STMT_UPDATE_MOVED_TO_DESCENDANTS 192
+#define STMT_192_INFO {"STMT_UPDATE_MOVED_TO_DESCENDANTS", NULL}
+#define STMT_192 \
   "UPDATE nodes SET moved_to = (CASE WHEN (?2) = '' THEN (CASE WHEN (?3) = '' THEN (moved_to) WHEN (moved_to) = '' THEN (?3) ELSE (?3) || '/' || (moved_to) END) WHEN (?3) = '' THEN (CASE WHEN (?2) = '' THEN (moved_to)  WHEN SUBSTR((moved_to), 1, LENGTH(?2)) = (?2)  THEN CASE WHEN LENGTH(?2) = LENGTH(moved_to) THEN '' WHEN SUBSTR((moved_to), LENGTH(?2)+1, 1) = '/' THEN SUBSTR((moved_to), LENGTH(?2)+2) END END) WHEN SUBSTR((moved_to), 1, LENGTH(?2)) = (?2) THEN CASE WHEN LENGTH(?2) = LENGTH(moved_to) THEN (?3) WHEN SUBSTR((moved_to), LENGTH(?2)+1, 1) = '/' THEN (?3) || SUBSTR((moved_to), LENGTH(?2)+1) END END) " \
   " WHERE wc_id = ?1 " \
   "   AND (((moved_to) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((moved_to) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_CLEAR_MOVED_TO_DESCENDANTS 192
-#define STMT_192_INFO {"STMT_CLEAR_MOVED_TO_DESCENDANTS", NULL}
-#define STMT_192 \
+#define STMT_CLEAR_MOVED_TO_DESCENDANTS 193
+#define STMT_193_INFO {"STMT_CLEAR_MOVED_TO_DESCENDANTS", NULL}
+#define STMT_193 \
   "UPDATE nodes SET moved_to = NULL " \
   " WHERE wc_id = ?1 " \
   "   AND (((moved_to) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((moved_to) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_SELECT_MOVED_PAIR3 193
-#define STMT_193_INFO {"STMT_SELECT_MOVED_PAIR3", NULL}
-#define STMT_193 \
+#define STMT_SELECT_MOVED_PAIR3 194
+#define STMT_194_INFO {"STMT_SELECT_MOVED_PAIR3", NULL}
+#define STMT_194 \
   "SELECT n.local_relpath, d.moved_to, d.op_depth, n.kind " \
   "FROM nodes n " \
   "JOIN nodes d ON d.wc_id = ?1 AND d.local_relpath = n.local_relpath " \
@@ -2112,9 +2118,9 @@
   "ORDER BY n.local_relpath " \
   ""
 
-#define STMT_SELECT_MOVED_OUTSIDE 194
-#define STMT_194_INFO {"STMT_SELECT_MOVED_OUTSIDE", NULL}
-#define STMT_194 \
+#define STMT_SELECT_MOVED_OUTSIDE 195
+#define STMT_195_INFO {"STMT_SELECT_MOVED_OUTSIDE", NULL}
+#define STMT_195 \
   "SELECT local_relpath, moved_to, op_depth FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (local_relpath = ?2 OR (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END))) " \
@@ -2123,9 +2129,9 @@
   "  AND NOT (((moved_to) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((moved_to) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
   ""
 
-#define STMT_SELECT_MOVED_DESCENDANTS_SRC 195
-#define STMT_195_INFO {"STMT_SELECT_MOVED_DESCENDANTS_SRC", NULL}
-#define STMT_195 \
+#define STMT_SELECT_MOVED_DESCENDANTS_SRC 196
+#define STMT_196_INFO {"STMT_SELECT_MOVED_DESCENDANTS_SRC", NULL}
+#define STMT_196 \
   "SELECT s.op_depth, n.local_relpath, n.kind, n.repos_path, s.moved_to " \
   "FROM nodes n " \
   "JOIN nodes s ON s.wc_id = n.wc_id AND s.local_relpath = n.local_relpath " \
@@ -2139,9 +2145,9 @@
   "  AND s.moved_to IS NOT NULL " \
   ""
 
-#define STMT_COMMIT_UPDATE_ORIGIN 196
-#define STMT_196_INFO {"STMT_COMMIT_UPDATE_ORIGIN", NULL}
-#define STMT_196 \
+#define STMT_COMMIT_UPDATE_ORIGIN 197
+#define STMT_197_INFO {"STMT_COMMIT_UPDATE_ORIGIN", NULL}
+#define STMT_197 \
   "UPDATE nodes SET repos_id = ?4, " \
   "                 repos_path = (CASE WHEN (?2) = '' THEN (CASE WHEN (?5) = '' THEN (local_relpath) WHEN (local_relpath) = '' THEN (?5) ELSE (?5) || '/' || (local_relpath) END) WHEN (?5) = '' THEN (CASE WHEN (?2) = '' THEN (local_relpath)  WHEN SUBSTR((local_relpath), 1, LENGTH(?2)) = (?2)  THEN CASE WHEN LENGTH(?2) = LENGTH(local_relpath) THEN '' WHEN SUBSTR((local_relpath), LENGTH(?2)+1, 1) = '/' THEN SUBSTR((local_relpath), LENGTH(?2)+2) END END) WHEN SUBSTR((local_relpath), 1, LENGTH(?2)) = (?2) THEN CASE WHEN LENGTH(?2) = LENGTH(local_relpath) THEN (?5) WHEN SUBSTR((local_relpath), LENGTH(?2)+1, 1) = '/' THEN (?5) || SUBSTR((local_relpath), LENGTH(?2)+1) END END), " \
   "                 revision = ?6 " \
@@ -2151,16 +2157,16 @@
   "  AND op_depth = ?3 " \
   ""
 
-#define STMT_HAS_LAYER_BETWEEN 197
-#define STMT_197_INFO {"STMT_HAS_LAYER_BETWEEN", NULL}
-#define STMT_197 \
+#define STMT_HAS_LAYER_BETWEEN 198
+#define STMT_198_INFO {"STMT_HAS_LAYER_BETWEEN", NULL}
+#define STMT_198 \
   "SELECT 1 FROM NODES " \
   "WHERE wc_id = ?1 AND local_relpath = ?2 AND op_depth > ?3 AND op_depth < ?4 " \
   ""
 
-#define STMT_SELECT_REPOS_PATH_REVISION 198
-#define STMT_198_INFO {"STMT_SELECT_REPOS_PATH_REVISION", NULL}
-#define STMT_198 \
+#define STMT_SELECT_REPOS_PATH_REVISION 199
+#define STMT_199_INFO {"STMT_SELECT_REPOS_PATH_REVISION", NULL}
+#define STMT_199 \
   "SELECT local_relpath, repos_path, revision FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -2168,17 +2174,17 @@
   "ORDER BY local_relpath " \
   ""
 
-#define STMT_SELECT_HAS_NON_FILE_CHILDREN 199
-#define STMT_199_INFO {"STMT_SELECT_HAS_NON_FILE_CHILDREN", NULL}
-#define STMT_199 \
+#define STMT_SELECT_HAS_NON_FILE_CHILDREN 200
+#define STMT_200_INFO {"STMT_SELECT_HAS_NON_FILE_CHILDREN", NULL}
+#define STMT_200 \
   "SELECT 1 FROM nodes " \
   "WHERE wc_id = ?1 AND parent_relpath = ?2 AND op_depth = ?3 AND kind != 'file' " \
   "LIMIT 1 " \
   ""
 
-#define STMT_SELECT_HAS_GRANDCHILDREN 200
-#define STMT_200_INFO {"STMT_SELECT_HAS_GRANDCHILDREN", NULL}
-#define STMT_200 \
+#define STMT_SELECT_HAS_GRANDCHILDREN 201
+#define STMT_201_INFO {"STMT_SELECT_HAS_GRANDCHILDREN", NULL}
+#define STMT_201 \
   "SELECT 1 FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((parent_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((parent_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -2187,24 +2193,24 @@
   "LIMIT 1 " \
   ""
 
-#define STMT_SELECT_ALL_NODES 201
-#define STMT_201_INFO {"STMT_SELECT_ALL_NODES", NULL}
-#define STMT_201 \
+#define STMT_SELECT_ALL_NODES 202
+#define STMT_202_INFO {"STMT_SELECT_ALL_NODES", NULL}
+#define STMT_202 \
   "SELECT op_depth, local_relpath, parent_relpath, file_external FROM nodes " \
   "WHERE wc_id = ?1 " \
   ""
 
-#define STMT_UPDATE_IPROP 202
-#define STMT_202_INFO {"STMT_UPDATE_IPROP", NULL}
-#define STMT_202 \
+#define STMT_UPDATE_IPROP 203
+#define STMT_203_INFO {"STMT_UPDATE_IPROP", NULL}
+#define STMT_203 \
   "UPDATE nodes " \
   "SET inherited_props = ?3 " \
   "WHERE (wc_id = ?1 AND local_relpath = ?2 AND op_depth = 0) " \
   ""
 
-#define STMT_SELECT_IPROPS_NODE 203
-#define STMT_203_INFO {"STMT_SELECT_IPROPS_NODE", NULL}
-#define STMT_203 \
+#define STMT_SELECT_IPROPS_NODE 204
+#define STMT_204_INFO {"STMT_SELECT_IPROPS_NODE", NULL}
+#define STMT_204 \
   "SELECT local_relpath, repos_path FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND local_relpath = ?2 " \
@@ -2212,9 +2218,9 @@
   "  AND (inherited_props not null) " \
   ""
 
-#define STMT_SELECT_IPROPS_RECURSIVE 204
-#define STMT_204_INFO {"STMT_SELECT_IPROPS_RECURSIVE", NULL}
-#define STMT_204 \
+#define STMT_SELECT_IPROPS_RECURSIVE 205
+#define STMT_205_INFO {"STMT_SELECT_IPROPS_RECURSIVE", NULL}
+#define STMT_205 \
   "SELECT local_relpath, repos_path FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND (((local_relpath) > (CASE (?2) WHEN '' THEN '' ELSE (?2) || '/' END)) AND ((local_relpath) < CASE (?2) WHEN '' THEN X'FFFF' ELSE (?2) || '0' END)) " \
@@ -2222,9 +2228,9 @@
   "  AND (inherited_props not null) " \
   ""
 
-#define STMT_SELECT_IPROPS_CHILDREN 205
-#define STMT_205_INFO {"STMT_SELECT_IPROPS_CHILDREN", NULL}
-#define STMT_205 \
+#define STMT_SELECT_IPROPS_CHILDREN 206
+#define STMT_206_INFO {"STMT_SELECT_IPROPS_CHILDREN", NULL}
+#define STMT_206 \
   "SELECT local_relpath, repos_path FROM nodes " \
   "WHERE wc_id = ?1 " \
   "  AND parent_relpath = ?2 " \
@@ -2232,16 +2238,16 @@
   "  AND (inherited_props not null) " \
   ""
 
-#define STMT_HAVE_STAT1_TABLE 206
-#define STMT_206_INFO {"STMT_HAVE_STAT1_TABLE", NULL}
-#define STMT_206 \
+#define STMT_HAVE_STAT1_TABLE 207
+#define STMT_207_INFO {"STMT_HAVE_STAT1_TABLE", NULL}
+#define STMT_207 \
   "SELECT 1 FROM sqlite_master WHERE name='sqlite_stat1' AND type='table' " \
   "LIMIT 1 " \
   ""
 
-#define STMT_CREATE_SCHEMA 207
-#define STMT_207_INFO {"STMT_CREATE_SCHEMA", NULL}
-#define STMT_207 \
+#define STMT_CREATE_SCHEMA 208
+#define STMT_208_INFO {"STMT_CREATE_SCHEMA", NULL}
+#define STMT_208 \
   "CREATE TABLE REPOSITORY ( " \
   "  id INTEGER PRIMARY KEY AUTOINCREMENT, " \
   "  root  TEXT UNIQUE NOT NULL, " \
@@ -2382,9 +2388,9 @@
   "; " \
   ""
 
-#define STMT_INSTALL_SCHEMA_STATISTICS 208
-#define STMT_208_INFO {"STMT_INSTALL_SCHEMA_STATISTICS", NULL}
-#define STMT_208 \
+#define STMT_INSTALL_SCHEMA_STATISTICS 209
+#define STMT_209_INFO {"STMT_INSTALL_SCHEMA_STATISTICS", NULL}
+#define STMT_209 \
   "ANALYZE sqlite_master; " \
   "DELETE FROM sqlite_stat1 " \
   "WHERE tbl in ('NODES', 'ACTUAL_NODE', 'LOCK', 'WC_LOCK', 'EXTERNALS'); " \
@@ -2409,9 +2415,9 @@
   "ANALYZE sqlite_master; " \
   ""
 
-#define STMT_UPGRADE_TO_30 209
-#define STMT_209_INFO {"STMT_UPGRADE_TO_30", NULL}
-#define STMT_209 \
+#define STMT_UPGRADE_TO_30 210
+#define STMT_210_INFO {"STMT_UPGRADE_TO_30", NULL}
+#define STMT_210 \
   "CREATE UNIQUE INDEX IF NOT EXISTS I_NODES_MOVED " \
   "ON NODES (wc_id, moved_to, op_depth); " \
   "CREATE INDEX IF NOT EXISTS I_PRISTINE_MD5 ON PRISTINE (md5_checksum); " \
@@ -2419,9 +2425,9 @@
   "UPDATE nodes SET file_external=1 WHERE file_external IS NOT NULL; " \
   ""
 
-#define STMT_UPGRADE_30_SELECT_CONFLICT_SEPARATE 210
-#define STMT_210_INFO {"STMT_UPGRADE_30_SELECT_CONFLICT_SEPARATE", NULL}
-#define STMT_210 \
+#define STMT_UPGRADE_30_SELECT_CONFLICT_SEPARATE 211
+#define STMT_211_INFO {"STMT_UPGRADE_30_SELECT_CONFLICT_SEPARATE", NULL}
+#define STMT_211 \
   "SELECT wc_id, local_relpath, " \
   "  conflict_old, conflict_working, conflict_new, prop_reject, tree_conflict_data " \
   "FROM actual_node " \
@@ -2433,18 +2439,18 @@
   "ORDER by wc_id, local_relpath " \
   ""
 
-#define STMT_UPGRADE_30_SET_CONFLICT 211
-#define STMT_211_INFO {"STMT_UPGRADE_30_SET_CONFLICT", NULL}
-#define STMT_211 \
+#define STMT_UPGRADE_30_SET_CONFLICT 212
+#define STMT_212_INFO {"STMT_UPGRADE_30_SET_CONFLICT", NULL}
+#define STMT_212 \
   "UPDATE actual_node SET conflict_data = ?3, conflict_old = NULL, " \
   "  conflict_working = NULL, conflict_new = NULL, prop_reject = NULL, " \
   "  tree_conflict_data = NULL " \
   "WHERE wc_id = ?1 and local_relpath = ?2 " \
   ""
 
-#define STMT_UPGRADE_TO_31 212
-#define STMT_212_INFO {"STMT_UPGRADE_TO_31", NULL}
-#define STMT_212 \
+#define STMT_UPGRADE_TO_31 213
+#define STMT_213_INFO {"STMT_UPGRADE_TO_31", NULL}
+#define STMT_213 \
   "ALTER TABLE NODES ADD COLUMN inherited_props BLOB; " \
   "DROP INDEX IF EXISTS I_ACTUAL_CHANGELIST; " \
   "DROP INDEX IF EXISTS I_EXTERNALS_PARENT; " \
@@ -2457,9 +2463,9 @@
   "PRAGMA user_version = 31; " \
   ""
 
-#define STMT_UPGRADE_31_SELECT_WCROOT_NODES 213
-#define STMT_213_INFO {"STMT_UPGRADE_31_SELECT_WCROOT_NODES", NULL}
-#define STMT_213 \
+#define STMT_UPGRADE_31_SELECT_WCROOT_NODES 214
+#define STMT_214_INFO {"STMT_UPGRADE_31_SELECT_WCROOT_NODES", NULL}
+#define STMT_214 \
   "SELECT l.wc_id, l.local_relpath FROM nodes as l " \
   "LEFT OUTER JOIN nodes as r " \
   "ON l.wc_id = r.wc_id " \
@@ -2511,9 +2517,9 @@
   "DROP TABLE ACTUAL_NODE_BACKUP; " \
   ""
 
-#define STMT_VERIFICATION_TRIGGERS 214
-#define STMT_214_INFO {"STMT_VERIFICATION_TRIGGERS", NULL}
-#define STMT_214 \
+#define STMT_VERIFICATION_TRIGGERS 215
+#define STMT_215_INFO {"STMT_VERIFICATION_TRIGGERS", NULL}
+#define STMT_215 \
   "CREATE TEMPORARY TRIGGER no_repository_updates BEFORE UPDATE ON repository " \
   "BEGIN " \
   "  SELECT RAISE(FAIL, 'Updates to REPOSITORY are not allowed.'); " \
@@ -2552,9 +2558,9 @@
   "END; " \
   ""
 
-#define STMT_STATIC_VERIFY 215
-#define STMT_215_INFO {"STMT_STATIC_VERIFY", NULL}
-#define STMT_215 \
+#define STMT_STATIC_VERIFY 216
+#define STMT_216_INFO {"STMT_STATIC_VERIFY", NULL}
+#define STMT_216 \
   "SELECT local_relpath, op_depth, 1, 'Invalid parent relpath set in NODES' " \
   "FROM nodes n WHERE local_relpath != '' " \
   " AND (parent_relpath IS NULL " \
@@ -2943,6 +2949,7 @@
     STMT_213, \
     STMT_214, \
     STMT_215, \
+    STMT_216, \
     NULL \
   }
 
@@ -3164,5 +3171,6 @@
     STMT_213_INFO, \
     STMT_214_INFO, \
     STMT_215_INFO, \
+    STMT_216_INFO, \
     {NULL, NULL} \
   }
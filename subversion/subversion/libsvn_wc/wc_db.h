@@ -268,6 +268,27 @@ svn_wc__db_open(svn_wc__db_t **db,
 svn_error_t *
 svn_wc__db_close(svn_wc__db_t *db);
 
+/* Upper limit for the [working-copy] status-threads and install-threads
+   options. */
+#define SVN_WC__DB_MAX_THREADS 64
+
+/* Return the number of threads to use for reading directories while
+   walking the status of DB's working copies, as configured.  0 or 1
+   means that all directories are read on the calling thread. */
+int
+svn_wc__db_get_status_threads(svn_wc__db_t *db);
+
+/* Return TRUE if status walks on DB should use the status journal of
+   the working copy; see status_journal.h. */
+svn_boolean_t
+svn_wc__db_get_status_journal(svn_wc__db_t *db);
+
+/* Return the number of threads to use for installing files while running
+   the work queue of DB's working copies, as configured.  0 or 1 means
+   that all work items run on the calling thread. */
+int
+svn_wc__db_get_install_threads(svn_wc__db_t *db);
+
 
 /* Initialize the SDB for LOCAL_ABSPATH, which should be a working copy path.
 
@@ -3028,6 +3049,29 @@ svn_wc__db_wq_record_and_fetch_next(apr_uint64_t *id,
                                     apr_pool_t *result_pool,
                                     apr_pool_t *scratch_pool);
 
+/* Batch variant of svn_wc__db_wq_record_and_fetch_next().  In a single
+   transaction, mark the work items with the ids in COMPLETED_IDS
+   (apr_uint64_t) as completed, record the timestamps and sizes in
+   RECORD_MAP unless it is NULL, and fetch the next MAX_ITEMS work items
+   in queue order.
+
+   Set *IDS to an array of their ids (apr_uint64_t) and *WORK_ITEMS to an
+   array of the items themselves (svn_skel_t *); both are empty when the
+   queue is.  MAX_ITEMS may be 0 to just complete and record.
+
+   RESULT_POOL will be used to allocate *IDS and *WORK_ITEMS, and
+   SCRATCH_POOL will be used for all temporary allocations.  */
+svn_error_t *
+svn_wc__db_wq_record_and_fetch_batch(apr_array_header_t **ids,
+                                     apr_array_header_t **work_items,
+                                     svn_wc__db_t *db,
+                                     const char *wri_abspath,
+                                     const apr_array_header_t *completed_ids,
+                                     apr_hash_t *record_map,
+                                     int max_items,
+                                     apr_pool_t *result_pool,
+                                     apr_pool_t *scratch_pool);
+
 
 /* @} */
 
@@ -52,6 +52,17 @@ struct svn_wc__db_t {
   /* Busy timeout in ms., 0 for the libsvn_subr default. */
   apr_int32_t timeout;
 
+  /* Number of threads reading directories during status walks, 0 or 1
+     to read them on the calling thread. */
+  int status_threads;
+
+  /* Should status walks use the status journal of the working copy? */
+  svn_boolean_t status_journal;
+
+  /* Number of threads installing files from the work queue, 0 or 1 to
+     install them on the calling thread. */
+  int install_threads;
+
   /* Map a given working copy directory to its relevant data.
      const char *local_abspath -> svn_wc__db_wcroot_t *wcroot  */
   apr_hash_t *dir_data;
@@ -241,6 +241,9 @@ svn_wc__db_open(svn_wc__db_t **db,
       svn_error_t *err;
       svn_boolean_t sqlite_exclusive = FALSE;
       apr_int64_t timeout;
+      apr_int64_t status_threads;
+      svn_boolean_t status_journal;
+      apr_int64_t install_threads;
 
       err = svn_config_get_bool(config, &sqlite_exclusive,
                                 SVN_CONFIG_SECTION_WORKING_COPY,
@@ -261,12 +264,64 @@ svn_wc__db_open(svn_wc__db_t **db,
         svn_error_clear(err);
       else
         (*db)->timeout = (apr_int32_t)timeout;
+
+      err = svn_config_get_int64(config, &status_threads,
+                                 SVN_CONFIG_SECTION_WORKING_COPY,
+                                 SVN_CONFIG_OPTION_STATUS_THREADS,
+                                 0);
+      if (err || status_threads < 0)
+        svn_error_clear(err);
+      else if (status_threads > SVN_WC__DB_MAX_THREADS)
+        (*db)->status_threads = SVN_WC__DB_MAX_THREADS;
+      else
+        (*db)->status_threads = (int)status_threads;
+
+      err = svn_config_get_bool(config, &status_journal,
+                                SVN_CONFIG_SECTION_WORKING_COPY,
+                                SVN_CONFIG_OPTION_STATUS_JOURNAL,
+                                FALSE);
+      if (err)
+        svn_error_clear(err);
+      else
+        (*db)->status_journal = status_journal;
+
+      err = svn_config_get_int64(config, &install_threads,
+                                 SVN_CONFIG_SECTION_WORKING_COPY,
+                                 SVN_CONFIG_OPTION_INSTALL_THREADS,
+                                 0);
+      if (err || install_threads < 0)
+        svn_error_clear(err);
+      else if (install_threads > SVN_WC__DB_MAX_THREADS)
+        (*db)->install_threads = SVN_WC__DB_MAX_THREADS;
+      else
+        (*db)->install_threads = (int)install_threads;
     }
 
   return SVN_NO_ERROR;
 }
 
 
+int
+svn_wc__db_get_status_threads(svn_wc__db_t *db)
+{
+  return db->status_threads;
+}
+
+
+svn_boolean_t
+svn_wc__db_get_status_journal(svn_wc__db_t *db)
+{
+  return db->status_journal;
+}
+
+
+int
+svn_wc__db_get_install_threads(svn_wc__db_t *db)
+{
+  return db->install_threads;
+}
+
+
 svn_error_t *
 svn_wc__db_close(svn_wc__db_t *db)
 {
@@ -22,6 +22,8 @@
  */
 
 #include <apr_pools.h>
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
 
 #include "svn_private_config.h"
 #include "svn_types.h"
@@ -77,13 +79,18 @@ struct work_item_dispatch {
                        apr_pool_t *scratch_pool);
 };
 
-/* Forward definition */
+/* Forward definitions */
 static svn_error_t *
 get_and_record_fileinfo(work_item_baton_t *wqb,
                         const char *local_abspath,
                         svn_boolean_t ignore_enoent,
                         apr_pool_t *scratch_pool);
 
+static void
+record_fileinfo(work_item_baton_t *wqb,
+                const char *local_abspath,
+                const svn_io_dirent2_t *dirent);
+
 /* ------------------------------------------------------------------------ */
 /* OP_REMOVE_BASE  */
 
@@ -445,60 +452,76 @@ svn_wc__wq_build_postupgrade(svn_skel_t **work_item,
 
 /* OP_FILE_INSTALL */
 
-/* Process the OP_FILE_INSTALL work item WORK_ITEM.
- * See svn_wc__wq_build_file_install() which generates this work item.
- * Implements (struct work_item_dispatch).func. */
-static svn_error_t *
-run_file_install(work_item_baton_t *wqb,
-                 svn_wc__db_t *db,
-                 const svn_skel_t *work_item,
-                 const char *wri_abspath,
-                 svn_cancel_func_t cancel_func,
-                 void *cancel_baton,
-                 apr_pool_t *scratch_pool)
+/* Everything needed to install a file for an OP_FILE_INSTALL work item,
+   gathered from the DB by prepare_file_install() so that
+   perform_file_install() does not need to access it. */
+typedef struct file_install_t
 {
-  const svn_skel_t *arg1 = work_item->children->next;
-  const svn_skel_t *arg4 = arg1->next->next->next;
-  const char *local_relpath;
   const char *local_abspath;
-  svn_boolean_t use_commit_times;
-  svn_boolean_t record_fileinfo;
-  svn_boolean_t special;
-  svn_stream_t *src_stream;
+  const char *source_abspath;
+
+  /* Translation settings.  */
   svn_subst_eol_style_t style;
   const char *eol;
   apr_hash_t *keywords;
+  svn_boolean_t special;
+
+  /* Where to create the temporary file.  */
   const char *temp_dir_abspath;
-  svn_stream_t *dst_stream;
+
+  /* How to tweak the installed file.  */
+  svn_boolean_t set_executable;
+  svn_boolean_t set_read_only;
+  apr_time_t affected_time; /* 0 to leave the timestamp alone */
+
+  svn_boolean_t record_fileinfo;
+} file_install_t;
+
+/* Read what is needed to run the OP_FILE_INSTALL work item WORK_ITEM from
+   DB and set *INSTALL to it, allocated in RESULT_POOL.  Use SCRATCH_POOL
+   for temporary allocations. */
+static svn_error_t *
+prepare_file_install(file_install_t **install,
+                     svn_wc__db_t *db,
+                     const svn_skel_t *work_item,
+                     const char *wri_abspath,
+                     apr_pool_t *result_pool,
+                     apr_pool_t *scratch_pool)
+{
+  const svn_skel_t *arg1 = work_item->children->next;
+  const svn_skel_t *arg4 = arg1->next->next->next;
+  file_install_t *fi = apr_pcalloc(result_pool, sizeof(*fi));
+  const char *local_relpath;
+  svn_boolean_t use_commit_times;
   apr_int64_t val;
   const char *wcroot_abspath;
-  const char *source_abspath;
   const svn_checksum_t *checksum;
   apr_hash_t *props;
   apr_time_t changed_date;
 
   local_relpath = apr_pstrmemdup(scratch_pool, arg1->data, arg1->len);
-  SVN_ERR(svn_wc__db_from_relpath(&local_abspath, db, wri_abspath,
-                                  local_relpath, scratch_pool, scratch_pool));
+  SVN_ERR(svn_wc__db_from_relpath(&fi->local_abspath, db, wri_abspath,
+                                  local_relpath, result_pool, scratch_pool));
 
   SVN_ERR(svn_skel__parse_int(&val, arg1->next, scratch_pool));
   use_commit_times = (val != 0);
   SVN_ERR(svn_skel__parse_int(&val, arg1->next->next, scratch_pool));
-  record_fileinfo = (val != 0);
+  fi->record_fileinfo = (val != 0);
 
   SVN_ERR(svn_wc__db_read_node_install_info(&wcroot_abspath,
                                             &checksum, &props,
                                             &changed_date,
-                                            db, local_abspath, wri_abspath,
-                                            scratch_pool, scratch_pool));
+                                            db, fi->local_abspath,
+                                            wri_abspath,
+                                            result_pool, scratch_pool));
 
   if (arg4 != NULL)
     {
       /* Use the provided path for the source.  */
       local_relpath = apr_pstrmemdup(scratch_pool, arg4->data, arg4->len);
-      SVN_ERR(svn_wc__db_from_relpath(&source_abspath, db, wri_abspath,
+      SVN_ERR(svn_wc__db_from_relpath(&fi->source_abspath, db, wri_abspath,
                                       local_relpath,
-                                      scratch_pool, scratch_pool));
+                                      result_pool, scratch_pool));
     }
   else if (! checksum)
     {
@@ -513,31 +536,90 @@ run_file_install(work_item_baton_t *wqb,
                                _("Can't install '%s' from pristine store, "
                                  "because no checksum is recorded for this "
                                  "file"),
-                               svn_dirent_local_style(local_abspath,
+                               svn_dirent_local_style(fi->local_abspath,
                                                       scratch_pool));
     }
   else
     {
-      SVN_ERR(svn_wc__db_pristine_get_future_path(&source_abspath,
+      SVN_ERR(svn_wc__db_pristine_get_future_path(&fi->source_abspath,
                                                   wcroot_abspath,
                                                   checksum,
-                                                  scratch_pool, scratch_pool));
+                                                  result_pool, scratch_pool));
     }
 
-  SVN_ERR(svn_stream_open_readonly(&src_stream, source_abspath,
-                                   scratch_pool, scratch_pool));
-
   /* Fetch all the translation bits.  */
-  SVN_ERR(svn_wc__get_translate_info(&style, &eol,
-                                     &keywords,
-                                     &special, db, local_abspath,
+  SVN_ERR(svn_wc__get_translate_info(&fi->style, &fi->eol,
+                                     &fi->keywords,
+                                     &fi->special, db, fi->local_abspath,
                                      props, FALSE,
-                                     scratch_pool, scratch_pool));
-  if (special)
+                                     result_pool, scratch_pool));
+  if (fi->special)
+    {
+      /* Special files are installed as they are.  */
+      *install = fi;
+      return SVN_NO_ERROR;
+    }
+
+  /* Where is the Right Place to put a temp file in this working copy?  */
+  SVN_ERR(svn_wc__db_temp_wcroot_tempdir(&fi->temp_dir_abspath,
+                                         db, wcroot_abspath,
+                                         result_pool, scratch_pool));
+
+#ifndef WIN32
+  fi->set_executable = (props && svn_hash_gets(props, SVN_PROP_EXECUTABLE));
+#endif
+
+  /* Note that this explicitly checks the pristine properties, to make sure
+     that when the lock is locally set (=modification) it is not read only */
+  if (props && svn_hash_gets(props, SVN_PROP_NEEDS_LOCK))
+    {
+      svn_wc__db_status_t status;
+      svn_wc__db_lock_t *lock;
+      SVN_ERR(svn_wc__db_read_info(&status, NULL, NULL, NULL, NULL, NULL, NULL,
+                                   NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                                   NULL, NULL, &lock, NULL, NULL, NULL, NULL,
+                                   NULL, NULL, NULL, NULL, NULL, NULL,
+                                   db, fi->local_abspath,
+                                   scratch_pool, scratch_pool));
+
+      fi->set_read_only = (!lock && status != svn_wc__db_status_added);
+    }
+
+  if (use_commit_times)
+    fi->affected_time = changed_date;
+
+  *install = fi;
+  return SVN_NO_ERROR;
+}
+
+/* Install the file described by INSTALL.  If INSTALL asks for its file
+   info to be recorded, set *DIRENT to the dirent of the installed file,
+   allocated in RESULT_POOL; otherwise set *DIRENT to NULL.
+
+   This does not access the DB, so it may run on any thread.  Use
+   SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+perform_file_install(const svn_io_dirent2_t **dirent,
+                     const file_install_t *install,
+                     svn_cancel_func_t cancel_func,
+                     void *cancel_baton,
+                     apr_pool_t *result_pool,
+                     apr_pool_t *scratch_pool)
+{
+  svn_stream_t *src_stream;
+  svn_stream_t *dst_stream;
+
+  *dirent = NULL;
+
+  SVN_ERR(svn_stream_open_readonly(&src_stream, install->source_abspath,
+                                   scratch_pool, scratch_pool));
+
+  if (install->special)
     {
       /* When this stream is closed, the resulting special file will
          atomically be created/moved into place at LOCAL_ABSPATH.  */
-      SVN_ERR(svn_subst_create_specialfile(&dst_stream, local_abspath,
+      SVN_ERR(svn_subst_create_specialfile(&dst_stream,
+                                           install->local_abspath,
                                            scratch_pool, scratch_pool));
 
       /* Copy the "repository normal" form of the special file into the
@@ -552,27 +634,24 @@ run_file_install(work_item_baton_t *wqb,
       return SVN_NO_ERROR;
     }
 
-  if (svn_subst_translation_required(style, eol, keywords,
+  if (svn_subst_translation_required(install->style, install->eol,
+                                     install->keywords,
                                      FALSE /* special */,
                                      TRUE /* force_eol_check */))
     {
       /* Wrap it in a translating (expanding) stream.  */
-      src_stream = svn_subst_stream_translated(src_stream, eol,
+      src_stream = svn_subst_stream_translated(src_stream, install->eol,
                                                TRUE /* repair */,
-                                               keywords,
+                                               install->keywords,
                                                TRUE /* expand */,
                                                scratch_pool);
     }
 
-  /* Where is the Right Place to put a temp file in this working copy?  */
-  SVN_ERR(svn_wc__db_temp_wcroot_tempdir(&temp_dir_abspath,
-                                         db, wcroot_abspath,
-                                         scratch_pool, scratch_pool));
-
   /* Translate to a temporary file. We don't want the user seeing a partial
      file, nor let them muck with it while we translate. We may also need to
      get its TRANSLATED_SIZE before the user can monkey it.  */
-  SVN_ERR(svn_stream__create_for_install(&dst_stream, temp_dir_abspath,
+  SVN_ERR(svn_stream__create_for_install(&dst_stream,
+                                         install->temp_dir_abspath,
                                          scratch_pool, scratch_pool));
 
   /* Copy from the source to the dest, translating as we go. This will also
@@ -585,48 +664,55 @@ run_file_install(work_item_baton_t *wqb,
   /* With a single db we might want to install files in a missing directory.
      Simply trying this scenario on error won't do any harm and at least
      one user reported this problem on IRC. */
-  SVN_ERR(svn_stream__install_stream(dst_stream, local_abspath,
+  SVN_ERR(svn_stream__install_stream(dst_stream, install->local_abspath,
                                      TRUE /* make_parents*/, scratch_pool));
 
   /* Tweak the on-disk file according to its properties.  */
-#ifndef WIN32
-  if (props && svn_hash_gets(props, SVN_PROP_EXECUTABLE))
-    SVN_ERR(svn_io_set_file_executable(local_abspath, TRUE, FALSE,
+  if (install->set_executable)
+    SVN_ERR(svn_io_set_file_executable(install->local_abspath, TRUE, FALSE,
                                        scratch_pool));
-#endif
-
-  /* Note that this explicitly checks the pristine properties, to make sure
-     that when the lock is locally set (=modification) it is not read only */
-  if (props && svn_hash_gets(props, SVN_PROP_NEEDS_LOCK))
-    {
-      svn_wc__db_status_t status;
-      svn_wc__db_lock_t *lock;
-      SVN_ERR(svn_wc__db_read_info(&status, NULL, NULL, NULL, NULL, NULL, NULL,
-                                   NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-                                   NULL, NULL, &lock, NULL, NULL, NULL, NULL,
-                                   NULL, NULL, NULL, NULL, NULL, NULL,
-                                   db, local_abspath,
-                                   scratch_pool, scratch_pool));
 
-      if (!lock && status != svn_wc__db_status_added)
-        SVN_ERR(svn_io_set_file_read_only(local_abspath, FALSE, scratch_pool));
-    }
+  if (install->set_read_only)
+    SVN_ERR(svn_io_set_file_read_only(install->local_abspath, FALSE,
+                                      scratch_pool));
 
-  if (use_commit_times)
-    {
-      if (changed_date)
-        SVN_ERR(svn_io_set_file_affected_time(changed_date,
-                                              local_abspath,
-                                              scratch_pool));
-    }
+  if (install->affected_time)
+    SVN_ERR(svn_io_set_file_affected_time(install->affected_time,
+                                          install->local_abspath,
+                                          scratch_pool));
 
   /* ### this should happen before we rename the file into place.  */
-  if (record_fileinfo)
-    {
-      SVN_ERR(get_and_record_fileinfo(wqb, local_abspath,
-                                      FALSE /* ignore_enoent */,
-                                      scratch_pool));
-    }
+  if (install->record_fileinfo)
+    SVN_ERR(svn_io_stat_dirent2(dirent, install->local_abspath,
+                                FALSE /* verify_truename */,
+                                FALSE /* ignore_enoent */,
+                                result_pool, scratch_pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Process the OP_FILE_INSTALL work item WORK_ITEM.
+ * See svn_wc__wq_build_file_install() which generates this work item.
+ * Implements (struct work_item_dispatch).func. */
+static svn_error_t *
+run_file_install(work_item_baton_t *wqb,
+                 svn_wc__db_t *db,
+                 const svn_skel_t *work_item,
+                 const char *wri_abspath,
+                 svn_cancel_func_t cancel_func,
+                 void *cancel_baton,
+                 apr_pool_t *scratch_pool)
+{
+  file_install_t *install;
+  const svn_io_dirent2_t *dirent;
+
+  SVN_ERR(prepare_file_install(&install, db, work_item, wri_abspath,
+                               scratch_pool, scratch_pool));
+  SVN_ERR(perform_file_install(&dirent, install, cancel_func, cancel_baton,
+                               scratch_pool, scratch_pool));
+
+  if (dirent)
+    record_fileinfo(wqb, install->local_abspath, dirent);
 
   return SVN_NO_ERROR;
 }
@@ -1474,6 +1560,352 @@ dispatch_work_item(work_item_baton_t *wqb,
 }
 
 
+#if APR_HAS_THREADS
+
+/* Maximum number of work items fetched at once when installing files on
+   several threads. */
+#define WQ_BATCH_SIZE 256
+
+/* One file installation run by install_files(). */
+typedef struct install_job_t
+{
+  /* Prepared by the thread owning the DB. */
+  const file_install_t *install;
+
+  /* Results. */
+  svn_error_t *err;
+  svn_boolean_t have_dirent;
+  svn_io_dirent2_t dirent;
+} install_job_t;
+
+/* State shared by the threads running install_files(). */
+typedef struct install_jobs_t
+{
+  /* install_job_t * */
+  apr_array_header_t *jobs;
+
+  /* Index of the next job to start, protected by MUTEX. */
+  int next;
+  apr_thread_mutex_t *mutex;
+} install_jobs_t;
+
+/* Run jobs from JOBS until there are none left.  */
+static void
+run_install_jobs(install_jobs_t *jobs)
+{
+  /* Each thread needs its own pool, as pools are not thread-safe. */
+  apr_pool_t *pool = svn_pool_create(NULL);
+
+  while (TRUE)
+    {
+      install_job_t *job;
+      const svn_io_dirent2_t *dirent;
+      int i;
+
+      apr_thread_mutex_lock(jobs->mutex);
+      i = jobs->next++;
+      apr_thread_mutex_unlock(jobs->mutex);
+
+      if (i >= jobs->jobs->nelts)
+        break;
+
+      svn_pool_clear(pool);
+      job = APR_ARRAY_IDX(jobs->jobs, i, install_job_t *);
+
+      /* The cancel callback is not necessarily thread-safe; the owning
+         thread checks it between batches instead. */
+      job->err = perform_file_install(&dirent, job->install, NULL, NULL,
+                                      pool, pool);
+      if (!job->err && dirent)
+        {
+          job->dirent = *dirent;
+          job->have_dirent = TRUE;
+        }
+    }
+
+  svn_pool_destroy(pool);
+}
+
+/* Thread function running run_install_jobs() on the install_jobs_t DATA. */
+static void * APR_THREAD_FUNC
+install_worker(apr_thread_t *thread,
+               void *data)
+{
+  run_install_jobs(data);
+
+  apr_thread_exit(thread, APR_SUCCESS);
+  return NULL;
+}
+
+/* Return TRUE if WORK_ITEM is a file installation that can run on
+   another thread.  */
+static svn_boolean_t
+is_parallel_install(const svn_skel_t *work_item)
+{
+  const svn_skel_t *arg1 = work_item->children->next;
+
+  /* Installing from a working file might depend on earlier items. */
+  return (svn_skel__matches_atom(work_item->children, OP_FILE_INSTALL)
+          && arg1 && arg1->next && arg1->next->next
+          && arg1->next->next->next == NULL);
+}
+
+/* Install the files for the run of independent OP_FILE_INSTALL items
+   in WORK_ITEMS (svn_skel_t *) starting at index FIRST, on up to THREADS
+   threads.
+
+   Set *COUNT to the number of items in the run, which is 0 if the first
+   item can't be handled this way.  If an item fails, set *COUNT to the
+   number of items before it and return its error.  If the threads can't
+   be set up, set *COUNT to 0 and return an error.  Record the file info
+   of the successfully installed items in WQB.
+
+   Use SCRATCH_POOL for temporary allocations. */
+static svn_error_t *
+install_files(int *count,
+              work_item_baton_t *wqb,
+              svn_wc__db_t *db,
+              const char *wri_abspath,
+              const apr_array_header_t *work_items,
+              int first,
+              int threads,
+              apr_pool_t *scratch_pool)
+{
+  install_jobs_t jobs = { 0 };
+  apr_hash_t *targets = apr_hash_make(scratch_pool);
+  apr_array_header_t *workers;
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  int i;
+
+  *count = 0;
+  jobs.jobs = apr_array_make(scratch_pool, work_items->nelts - first,
+                             sizeof(install_job_t *));
+
+  /* Do all the DB work on this thread. */
+  for (i = first; i < work_items->nelts; i++)
+    {
+      const svn_skel_t *work_item = APR_ARRAY_IDX(work_items, i,
+                                                  const svn_skel_t *);
+      install_job_t *job;
+      file_install_t *install;
+      svn_error_t *err;
+
+      svn_pool_clear(iterpool);
+
+      if (!is_parallel_install(work_item))
+        break;
+
+      err = prepare_file_install(&install, db, work_item, wri_abspath,
+                                 scratch_pool, iterpool);
+      if (err)
+        {
+          /* Leave it to the caller to run (and fail) this item. */
+          svn_error_clear(err);
+          break;
+        }
+
+      /* Installing the same file twice must happen in order. */
+      if (svn_hash_gets(targets, install->local_abspath))
+        break;
+      svn_hash_sets(targets, install->local_abspath, install);
+
+      job = apr_pcalloc(scratch_pool, sizeof(*job));
+      job->install = install;
+      APR_ARRAY_PUSH(jobs.jobs, install_job_t *) = job;
+    }
+  svn_pool_destroy(iterpool);
+
+  /* Nothing to gain; let the caller run it as usual. */
+  if (jobs.jobs->nelts < 2)
+    return SVN_NO_ERROR;
+
+  /* *COUNT stays 0 if this fails, so that the caller doesn't complete
+     items that were never run. */
+  SVN_ERR(svn_error_wrap_apr(apr_thread_mutex_create(&jobs.mutex,
+                                                     APR_THREAD_MUTEX_DEFAULT,
+                                                     scratch_pool),
+                             _("Can't create mutex")));
+  *count = jobs.jobs->nelts;
+
+  /* This thread works on the jobs as well. */
+  workers = apr_array_make(scratch_pool, threads, sizeof(apr_thread_t *));
+  for (i = 1; i < threads && i < *count; i++)
+    {
+      apr_thread_t *thread;
+
+      /* If we can't get as many threads as we would like, make do with
+         what we have. */
+      if (apr_thread_create(&thread, NULL, install_worker, &jobs,
+                            scratch_pool))
+        break;
+
+      APR_ARRAY_PUSH(workers, apr_thread_t *) = thread;
+    }
+
+  run_install_jobs(&jobs);
+
+  for (i = 0; i < workers->nelts; i++)
+    {
+      apr_status_t retval;
+
+      apr_thread_join(&retval, APR_ARRAY_IDX(workers, i, apr_thread_t *));
+    }
+
+  /* Report the results in queue order. */
+  for (i = 0; i < jobs.jobs->nelts; i++)
+    {
+      install_job_t *job = APR_ARRAY_IDX(jobs.jobs, i, install_job_t *);
+
+      if (job->err)
+        {
+          int j;
+
+          /* Items after the failing one stay in the queue, and will be
+             run again later. */
+          for (j = i + 1; j < jobs.jobs->nelts; j++)
+            svn_error_clear(APR_ARRAY_IDX(jobs.jobs, j,
+                                          install_job_t *)->err);
+
+          *count = i;
+          return svn_error_trace(job->err);
+        }
+
+      if (job->have_dirent)
+        record_fileinfo(wqb, job->install->local_abspath, &job->dirent);
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_wc__wq_run() by fetching work items in batches, and
+   installing runs of files in them on up to THREADS threads.  The DB is
+   only accessed from the calling thread; file info recorded by the
+   installations is written back to it together with completing the
+   work items. */
+static svn_error_t *
+wq_run_batched(svn_wc__db_t *db,
+               const char *wri_abspath,
+               int threads,
+               svn_cancel_func_t cancel_func,
+               void *cancel_baton,
+               apr_pool_t *scratch_pool)
+{
+  apr_pool_t *batch_pool = svn_pool_create(scratch_pool);
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  apr_array_header_t *completed = apr_array_make(scratch_pool, WQ_BATCH_SIZE,
+                                                 sizeof(apr_uint64_t));
+  work_item_baton_t wib = { 0 };
+  wib.result_pool = svn_pool_create(scratch_pool);
+
+  while (TRUE)
+    {
+      apr_array_header_t *ids;
+      apr_array_header_t *work_items;
+      int i;
+
+      /* Mark what we did as completed, and get the next batch. */
+      svn_pool_clear(batch_pool);
+      SVN_ERR(svn_wc__db_wq_record_and_fetch_batch(&ids, &work_items,
+                                                   db, wri_abspath,
+                                                   completed,
+                                                   wib.record_map,
+                                                   WQ_BATCH_SIZE,
+                                                   batch_pool, iterpool));
+      apr_array_clear(completed);
+      svn_pool_clear(wib.result_pool);
+      wib.record_map = NULL;
+      wib.used = FALSE;
+
+      /* Stop work queue processing, if requested. A future 'svn cleanup'
+         should be able to continue the processing. */
+      if (cancel_func)
+        SVN_ERR(cancel_func(cancel_baton));
+
+      if (work_items->nelts == 0)
+        break;
+
+      i = 0;
+      while (i < work_items->nelts)
+        {
+          svn_error_t *err;
+          int count;
+
+          svn_pool_clear(iterpool);
+
+          /* Later items may depend on the file info of earlier ones being
+             in the DB, so record it before running anything else. */
+          if (completed->nelts || wib.used)
+            {
+              apr_array_header_t *no_ids, *no_items;
+
+              SVN_ERR(svn_wc__db_wq_record_and_fetch_batch(&no_ids,
+                                                           &no_items,
+                                                           db, wri_abspath,
+                                                           completed,
+                                                           wib.record_map,
+                                                           0,
+                                                           iterpool,
+                                                           iterpool));
+              apr_array_clear(completed);
+              svn_pool_clear(wib.result_pool);
+              wib.record_map = NULL;
+              wib.used = FALSE;
+            }
+
+          err = install_files(&count, &wib, db, wri_abspath, work_items, i,
+                              threads, iterpool);
+          if (!err && count == 0)
+            {
+              err = dispatch_work_item(&wib, db, wri_abspath,
+                                       APR_ARRAY_IDX(work_items, i,
+                                                     svn_skel_t *),
+                                       cancel_func, cancel_baton, iterpool);
+              count = err ? 0 : 1;
+            }
+
+          /* Complete what succeeded. */
+          while (count-- > 0)
+            APR_ARRAY_PUSH(completed, apr_uint64_t)
+              = APR_ARRAY_IDX(ids, i++, apr_uint64_t);
+
+          if (err)
+            {
+              const svn_skel_t *work_item = APR_ARRAY_IDX(work_items, i,
+                                                          svn_skel_t *);
+              const char *skel = svn_skel__unparse(work_item,
+                                                   scratch_pool)->data;
+              apr_array_header_t *no_ids, *no_items;
+
+              err = svn_error_compose_create(
+                      err,
+                      svn_wc__db_wq_record_and_fetch_batch(&no_ids,
+                                                           &no_items,
+                                                           db, wri_abspath,
+                                                           completed,
+                                                           wib.record_map,
+                                                           0,
+                                                           scratch_pool,
+                                                           scratch_pool));
+
+              return svn_error_createf(SVN_ERR_WC_BAD_ADM_LOG, err,
+                                       _("Failed to run the WC DB work queue "
+                                         "associated with '%s', work item %d "
+                                         "%s"),
+                                       svn_dirent_local_style(wri_abspath,
+                                                              scratch_pool),
+                                       (int)APR_ARRAY_IDX(ids, i,
+                                                          apr_uint64_t),
+                                       skel);
+            }
+        }
+    }
+
+  svn_pool_destroy(iterpool);
+  return SVN_NO_ERROR;
+}
+
+#endif /* APR_HAS_THREADS */
+
 svn_error_t *
 svn_wc__wq_run(svn_wc__db_t *db,
                const char *wri_abspath,
@@ -1500,6 +1932,17 @@ svn_wc__wq_run(svn_wc__db_t *db,
   }
 #endif
 
+#if APR_HAS_THREADS
+  if (svn_wc__db_get_install_threads(db) > 1)
+    {
+      svn_pool_destroy(iterpool);
+      return svn_error_trace(wq_run_batched(db, wri_abspath,
+                                            svn_wc__db_get_install_threads(db),
+                                            cancel_func, cancel_baton,
+                                            scratch_pool));
+    }
+#endif
+
   while (TRUE)
     {
       apr_uint64_t id;
@@ -1624,10 +2067,22 @@ get_and_record_fileinfo(work_item_baton_t *wqb,
   const svn_io_dirent2_t *dirent;
 
   SVN_ERR(svn_io_stat_dirent2(&dirent, local_abspath, FALSE, ignore_enoent,
-                              wqb->result_pool, scratch_pool));
+                              scratch_pool, scratch_pool));
 
+  record_fileinfo(wqb, local_abspath, dirent);
+
+  return SVN_NO_ERROR;
+}
+
+/* Remember DIRENT as the file info of LOCAL_ABSPATH in WQB, so that it
+   gets recorded in the DB together with completing the work item. */
+static void
+record_fileinfo(work_item_baton_t *wqb,
+                const char *local_abspath,
+                const svn_io_dirent2_t *dirent)
+{
   if (dirent->kind != svn_node_file)
-    return SVN_NO_ERROR;
+    return;
 
   wqb->used = TRUE;
 
@@ -1635,7 +2090,5 @@ get_and_record_fileinfo(work_item_baton_t *wqb,
     wqb->record_map = apr_hash_make(wqb->result_pool);
 
   svn_hash_sets(wqb->record_map, apr_pstrdup(wqb->result_pool, local_abspath),
-                dirent);
-
-  return SVN_NO_ERROR;
+                svn_io_dirent2_dup(dirent, wqb->result_pool));
 }
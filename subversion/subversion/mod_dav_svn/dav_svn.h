@@ -344,6 +344,10 @@ dav_svn__get_nodeprop_cache_flag(request_rec *r);
  * request? */
 svn_boolean_t dav_svn__get_block_read_flag(request_rec *r);
 
+/* for the repository referred to by this request, may clients request
+ * blame results calculated on the server? */
+svn_boolean_t dav_svn__get_file_blame_flag(request_rec *r);
+
 /* for the repository referred to by this request, are subrequests bypassed?
  * A function pointer if yes, NULL if not.
  */
@@ -702,6 +706,8 @@ static const dav_report_elem dav_svn__reports_list[] = {
   { SVN_XML_NAMESPACE, SVN_DAV__MERGEINFO_REPORT },
   { SVN_XML_NAMESPACE, SVN_DAV__INHERITED_PROPS_REPORT },
   { SVN_XML_NAMESPACE, "list-report" },
+  { SVN_XML_NAMESPACE, "fetch-files-report" },
+  { SVN_XML_NAMESPACE, "file-blame-report" },
   { NULL, NULL },
 };
 
@@ -759,6 +765,16 @@ dav_svn__list_report(const dav_resource *resource,
                      const apr_xml_doc *doc,
                      dav_svn__output *output);
 
+dav_error *
+dav_svn__fetch_files_report(const dav_resource *resource,
+                            const apr_xml_doc *doc,
+                            dav_svn__output *output);
+
+dav_error *
+dav_svn__file_blame_report(const dav_resource *resource,
+                           const apr_xml_doc *doc,
+                           dav_svn__output *output);
+
 /*** posts/ ***/
 
 /* The various POST handlers, defined in posts/, and used by repos.c.  */
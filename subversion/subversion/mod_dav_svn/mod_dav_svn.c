@@ -26,6 +26,7 @@
 
 #include <apr_strings.h>
 #include <apr_hash.h>
+#include <apr_global_mutex.h>
 
 #include <httpd.h>
 #include <http_config.h>
@@ -34,6 +35,10 @@
 #include <ap_provider.h>
 #include <mod_dav.h>
 
+#ifdef AP_NEED_SET_MUTEX_PERMS
+#include <unixd.h>
+#endif
+
 #include "svn_hash.h"
 #include "svn_version.h"
 #include "svn_cache_config.h"
@@ -42,6 +47,7 @@
 #include "svn_dso.h"
 #include "mod_dav_svn.h"
 
+#include "private/svn_cache.h"
 #include "private/svn_fspath.h"
 #include "private/svn_subr_private.h"
 
@@ -57,6 +63,10 @@
  * subreq mechanism and make a call directly to mod_authz_svn. */
 #define PATHAUTHZ_BYPASS_ARG "short_circuit"
 
+/* Whether to share the in-memory cache among all httpd child processes.
+ * This is a process-wide setting just like the cache size. */
+static svn_boolean_t memory_cache_shared = FALSE;
+
 /* per-server configuration */
 typedef struct server_conf_t {
   const char *special_uri;
@@ -107,6 +117,7 @@ typedef struct dir_conf_t {
   enum conf_flag revprop_cache;      /* whether to enable revprop caching */
   enum conf_flag nodeprop_cache;     /* whether to enable nodeprop caching */
   enum conf_flag block_read;         /* whether to enable block read mode */
+  enum conf_flag file_blame;         /* whether to serve file-blame REPORTs */
   const char *hooks_env;             /* path to hook script env config file */
 } dir_conf_t;
 
@@ -150,9 +161,70 @@ init(apr_pool_t *p, apr_pool_t *plog, apr_pool_t *ptemp, server_rec *s)
   conf = ap_get_module_config(s->module_config, &dav_svn_module);
   svn_utf_initialize2(conf->use_utf8, p);
 
+  /* A shared cache must exist before httpd forks its children.  It lives
+     until the configuration gets reloaded. */
+  if (memory_cache_shared)
+    {
+      serr = svn_cache__create_global_membuffer_shared(p);
+      if (serr)
+        {
+          ap_log_perror(APLOG_MARK, APLOG_WARNING, serr->apr_err, p,
+                        "mod_dav_svn: can't create the shared in-memory "
+                        "cache, using per-process caches: '%s'",
+                        serr->message ? serr->message : "(no more info)");
+          svn_error_clear(serr);
+          memory_cache_shared = FALSE;
+        }
+      else
+        {
+#ifdef AP_NEED_SET_MUTEX_PERMS
+          /* The children run as a different user. */
+          apr_array_header_t *mutexes
+            = svn_cache__membuffer_get_mutexes(
+                svn_cache__get_global_membuffer_cache(), ptemp);
+          int i;
+
+          for (i = 0; i < mutexes->nelts; ++i)
+            {
+              apr_status_t status = ap_unixd_set_global_mutex_perms(
+                  APR_ARRAY_IDX(mutexes, i, apr_global_mutex_t *));
+              if (status)
+                {
+                  ap_log_perror(APLOG_MARK, APLOG_ERR, status, p,
+                                "mod_dav_svn: can't set permissions on the "
+                                "shared in-memory cache mutexes");
+                  return HTTP_INTERNAL_SERVER_ERROR;
+                }
+            }
+#endif
+        }
+    }
+
   return OK;
 }
 
+/* Implements the child_init hook.  Children forked by httpd must
+   re-initialize the locks of a shared in-memory cache before using it. */
+static void
+init_child(apr_pool_t *p, server_rec *s)
+{
+  svn_error_t *serr;
+
+  if (!memory_cache_shared)
+    return;
+
+  serr = svn_cache__membuffer_child_init(
+           svn_cache__get_global_membuffer_cache(), p);
+  if (serr)
+    {
+      ap_log_error(APLOG_MARK, APLOG_ERR, serr->apr_err, s,
+                   "mod_dav_svn: error initializing the shared in-memory "
+                   "cache: '%s'",
+                   serr->message ? serr->message : "(no more info)");
+      svn_error_clear(serr);
+    }
+}
+
 static svn_error_t *
 malfunction_handler(svn_boolean_t can_return,
                     const char *file, int line,
@@ -286,6 +358,7 @@ merge_dir_config(apr_pool_t *p, void *base, void *overrides)
   newconf->revprop_cache = INHERIT_VALUE(parent, child, revprop_cache);
   newconf->nodeprop_cache = INHERIT_VALUE(parent, child, nodeprop_cache);
   newconf->block_read = INHERIT_VALUE(parent, child, block_read);
+  newconf->file_blame = INHERIT_VALUE(parent, child, file_blame);
   newconf->root_dir = INHERIT_VALUE(parent, child, root_dir);
   newconf->hooks_env = INHERIT_VALUE(parent, child, hooks_env);
 
@@ -607,6 +680,19 @@ SVNBlockRead_cmd(cmd_parms *cmd, void *config, int arg)
   return NULL;
 }
 
+static const char *
+SVNAllowFileBlame_cmd(cmd_parms *cmd, void *config, int arg)
+{
+  dir_conf_t *conf = config;
+
+  if (arg)
+    conf->file_blame = CONF_FLAG_ON;
+  else
+    conf->file_blame = CONF_FLAG_OFF;
+
+  return NULL;
+}
+
 static const char *
 SVNInMemoryCacheSize_cmd(cmd_parms *cmd, void *config, const char *arg1)
 {
@@ -627,6 +713,14 @@ SVNInMemoryCacheSize_cmd(cmd_parms *cmd, void *config, const char *arg1)
   return NULL;
 }
 
+static const char *
+SVNInMemoryCacheShared_cmd(cmd_parms *cmd, void *config, int arg)
+{
+  memory_cache_shared = arg ? TRUE : FALSE;
+
+  return NULL;
+}
+
 static const char *
 SVNCompressionLevel_cmd(cmd_parms *cmd, void *config, const char *arg1)
 {
@@ -1030,6 +1124,18 @@ dav_svn__get_block_read_flag(request_rec *r)
   return get_conf_flag(conf->block_read, FALSE);
 }
 
+
+svn_boolean_t
+dav_svn__get_file_blame_flag(request_rec *r)
+{
+  dir_conf_t *conf;
+
+  conf = ap_get_module_config(r->per_dir_config, &dav_svn_module);
+
+  /* SVNAllowFileBlame is 'on' by default. */
+  return get_conf_flag(conf->file_blame, TRUE);
+}
+
 int
 dav_svn__get_compression_level(request_rec *r)
 {
@@ -1385,6 +1491,13 @@ static const command_rec cmds[] =
                "caches (see SVNInMemoryCacheSize) have been configured."
                "(default is Off)."),
 
+  /* per directory/location */
+  AP_INIT_FLAG("SVNAllowFileBlame", SVNAllowFileBlame_cmd, NULL,
+               ACCESS_CONF|RSRC_CONF,
+               "enables calculating 'svn blame' results on the server; "
+               "clients fall back to doing it themselves if this is Off "
+               "(default is On)."),
+
   /* per server */
   AP_INIT_TAKE1("SVNInMemoryCacheSize", SVNInMemoryCacheSize_cmd, NULL,
                 RSRC_CONF,
@@ -1392,6 +1505,11 @@ static const command_rec cmds[] =
                 "in-memory object cache (default value is 16384; 0 switches "
                 "to dynamically sized caches)."),
   /* per server */
+  AP_INIT_FLAG("SVNInMemoryCacheShared", SVNInMemoryCacheShared_cmd, NULL,
+               RSRC_CONF,
+               "share one in-memory object cache among all httpd child "
+               "processes instead of giving each its own (default is Off)."),
+  /* per server */
   AP_INIT_TAKE1("SVNCompressionLevel", SVNCompressionLevel_cmd, NULL,
                 RSRC_CONF,
                 "specifies the compression level used before sending file "
@@ -1432,6 +1550,7 @@ register_hooks(apr_pool_t *pconf)
 {
   ap_hook_pre_config(init_dso, NULL, NULL, APR_HOOK_REALLY_FIRST);
   ap_hook_post_config(init, NULL, NULL, APR_HOOK_MIDDLE);
+  ap_hook_child_init(init_child, NULL, NULL, APR_HOOK_MIDDLE);
 
   /* our provider */
   dav_register_provider(pconf, "svn", &provider);
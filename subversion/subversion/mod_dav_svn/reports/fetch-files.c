@@ -0,0 +1,377 @@
+/*
+ * fetch-files.c: mod_dav_svn REPORT handler for fetching the contents
+ *                of many files in a single response
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#include <apr_pools.h>
+#include <apr_strings.h>
+#include <apr_xml.h>
+
+#include <mod_dav.h>
+
+#include "svn_pools.h"
+#include "svn_repos.h"
+#include "svn_xml.h"
+#include "svn_path.h"
+#include "svn_dav.h"
+#include "svn_delta.h"
+
+#include "private/svn_fspath.h"
+
+#include "../dav_svn.h"
+
+/* Maximum number of files a client may request in a single report.
+   Clients send much smaller batches; this merely bounds the memory and
+   time a single request may take. */
+#define MAX_FETCH_FILES 1024
+
+/* One file requested by the client. */
+typedef struct fetch_item_t
+{
+  /* Repository path of the file in the requested revision. */
+  const char *path;
+
+  /* Optional delta base.  BASE_PATH is NULL if there is none. */
+  const char *base_path;
+  svn_revnum_t base_rev;
+} fetch_item_t;
+
+/* Baton used while sending the response. */
+typedef struct fetch_files_baton_t
+{
+  /* this buffers the output for a bit and is automatically flushed,
+     at appropriate times, by the Apache filter system. */
+  apr_bucket_brigade *bb;
+
+  /* where to deliver the output */
+  dav_svn__output *output;
+
+  /* The resource this report was requested on. */
+  const dav_resource *resource;
+
+  /* Root of the requested revision. */
+  svn_fs_root_t *root;
+
+  /* Youngest revision in the repository. */
+  svn_revnum_t youngest;
+
+  /* Roots of delta base revisions; maps svn_revnum_t * to
+     svn_fs_root_t *. */
+  apr_hash_t *base_roots;
+
+  /* Helper variables to force early bucket brigade flushes */
+  int result_count;
+  int next_forced_flush;
+} fetch_files_baton_t;
+
+
+/* Parse the S:file element ELEM in namespace NS into *ITEM. */
+static dav_error *
+parse_fetch_item(fetch_item_t **item,
+                 const apr_xml_elem *elem,
+                 int ns,
+                 const dav_resource *resource)
+{
+  apr_pool_t *pool = resource->pool;
+  apr_xml_elem *child;
+  dav_error *derr;
+
+  *item = apr_pcalloc(pool, sizeof(**item));
+  (*item)->base_rev = SVN_INVALID_REVNUM;
+
+  for (child = elem->first_child; child != NULL; child = child->next)
+    {
+      const char *cdata;
+
+      /* if this element isn't one of ours, then skip it */
+      if (child->ns != ns)
+        continue;
+
+      if (strcmp(child->name, "path") == 0)
+        {
+          cdata = dav_xml_get_cdata(child, pool, 0);
+          if ((derr = dav_svn__test_canonical(cdata, pool)))
+            return derr;
+          (*item)->path = svn_fspath__canonicalize(cdata, pool);
+        }
+      else if (strcmp(child->name, "base-path") == 0)
+        {
+          cdata = dav_xml_get_cdata(child, pool, 0);
+          if ((derr = dav_svn__test_canonical(cdata, pool)))
+            return derr;
+          (*item)->base_path = svn_fspath__canonicalize(cdata, pool);
+        }
+      else if (strcmp(child->name, "base-revision") == 0)
+        {
+          cdata = dav_xml_get_cdata(child, pool, 1);
+          (*item)->base_rev = SVN_STR_TO_REV(cdata);
+        }
+      /* else unknown element; skip it */
+    }
+
+  if (! (*item)->path)
+    return dav_svn__new_error_svn(pool, HTTP_BAD_REQUEST, 0, 0,
+                                  "Request was missing the path argument");
+
+  if ((*item)->base_path && ! SVN_IS_VALID_REVNUM((*item)->base_rev))
+    return dav_svn__new_error_svn(pool, HTTP_BAD_REQUEST, 0, 0,
+                                  "Request was missing the base-revision "
+                                  "argument");
+
+  return NULL;
+}
+
+/* Set *BASE_ROOT to the root of revision REV, using and updating the
+   cache in FFB. */
+static svn_error_t *
+get_base_root(svn_fs_root_t **base_root,
+              fetch_files_baton_t *ffb,
+              svn_revnum_t rev)
+{
+  apr_pool_t *pool = ffb->resource->pool;
+
+  *base_root = apr_hash_get(ffb->base_roots, &rev, sizeof(rev));
+  if (! *base_root)
+    {
+      svn_revnum_t *key = apr_pmemdup(pool, &rev, sizeof(rev));
+
+      SVN_ERR(svn_fs_revision_root(base_root,
+                                   ffb->resource->info->repos->fs,
+                                   rev, pool));
+      apr_hash_set(ffb->base_roots, key, sizeof(*key), *base_root);
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* Send the contents of ITEM as a base64-encoded svndiff against its
+   delta base, if any and readable, to the client. */
+static svn_error_t *
+send_file(fetch_files_baton_t *ffb,
+          const fetch_item_t *item,
+          apr_pool_t *scratch_pool)
+{
+  request_rec *r = ffb->resource->info->r;
+  const dav_svn_repos *repos = ffb->resource->info->repos;
+  svn_revnum_t rev = svn_fs_revision_root_revision(ffb->root);
+  svn_fs_root_t *base_root = NULL;
+  const char *base_path = NULL;
+  svn_txdelta_stream_t *txd_stream;
+  svn_txdelta_window_handler_t handler;
+  void *handler_baton;
+  svn_stream_t *base64_stream;
+
+  if (! dav_svn__allow_read(r, repos, item->path, rev, scratch_pool))
+    return svn_error_createf(SVN_ERR_AUTHZ_UNREADABLE, NULL,
+                             "Access to '%s' forbidden", item->path);
+
+  /* A missing or unreadable delta base simply means sending the
+     fulltext. */
+  if (item->base_path
+      && item->base_rev >= 0
+      && item->base_rev <= ffb->youngest
+      && dav_svn__allow_read(r, repos, item->base_path, item->base_rev,
+                             scratch_pool))
+    {
+      svn_node_kind_t kind;
+      svn_error_t *err;
+
+      SVN_ERR(get_base_root(&base_root, ffb, item->base_rev));
+      err = svn_fs_check_path(&kind, base_root, item->base_path,
+                              scratch_pool);
+      if (err && err->apr_err == SVN_ERR_FS_NOT_DIRECTORY)
+        {
+          svn_error_clear(err);
+          kind = svn_node_none;
+        }
+      else
+        SVN_ERR(err);
+
+      if (kind == svn_node_file)
+        base_path = item->base_path;
+      else
+        base_root = NULL;
+    }
+
+  SVN_ERR(svn_fs_get_file_delta_stream(&txd_stream, base_root, base_path,
+                                       ffb->root, item->path,
+                                       scratch_pool));
+
+  SVN_ERR(dav_svn__brigade_printf(ffb->bb, ffb->output,
+                                  "<S:file path=\"%s\"><S:txdelta>",
+                                  apr_xml_quote_string(scratch_pool,
+                                                       item->path, 1)));
+
+  base64_stream = dav_svn__make_base64_output_stream(ffb->bb, ffb->output,
+                                                     scratch_pool);
+  svn_txdelta_to_svndiff3(&handler, &handler_baton, base64_stream,
+                          ffb->resource->info->svndiff_version,
+                          dav_svn__get_compression_level(r),
+                          scratch_pool);
+  SVN_ERR(svn_txdelta_send_txstream(txd_stream, handler, handler_baton,
+                                    scratch_pool));
+
+  SVN_ERR(dav_svn__brigade_puts(ffb->bb, ffb->output,
+                                "</S:txdelta></S:file>" DEBUG_CR));
+
+  /* Like the list report, flush after a few files to let the client
+     start working on them early. */
+  ffb->result_count++;
+  if (ffb->result_count == ffb->next_forced_flush)
+    {
+      apr_bucket *bkt;
+
+      bkt = apr_bucket_flush_create(
+                dav_svn__output_get_bucket_alloc(ffb->output));
+      APR_BRIGADE_INSERT_TAIL(ffb->bb, bkt);
+      SVN_ERR(dav_svn__output_pass_brigade(ffb->output, ffb->bb));
+
+      if (ffb->result_count < 64)
+        ffb->next_forced_flush = ffb->next_forced_flush * 4;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+dav_error *
+dav_svn__fetch_files_report(const dav_resource *resource,
+                            const apr_xml_doc *doc,
+                            dav_svn__output *output)
+{
+  svn_error_t *serr;
+  dav_error *derr = NULL;
+  apr_xml_elem *child;
+  fetch_files_baton_t ffb = { 0 };
+  const dav_svn_repos *repos = resource->info->repos;
+  apr_array_header_t *items;
+  apr_pool_t *iterpool;
+  int ns;
+  int i;
+
+  /* These get determined from the request document. */
+  svn_revnum_t rev = SVN_INVALID_REVNUM;     /* defaults to HEAD */
+
+  ns = dav_svn__find_ns(doc->namespaces, SVN_XML_NAMESPACE);
+  if (ns == -1)
+    {
+      return dav_svn__new_error_svn(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                                    "The request does not contain the 'svn:' "
+                                    "namespace, so it is not going to have "
+                                    "certain required elements");
+    }
+
+  items = apr_array_make(resource->pool, 16, sizeof(fetch_item_t *));
+  for (child = doc->root->first_child; child != NULL; child = child->next)
+    {
+      /* if this element isn't one of ours, then skip it */
+      if (child->ns != ns)
+        continue;
+
+      if (strcmp(child->name, "revision") == 0)
+        rev = SVN_STR_TO_REV(dav_xml_get_cdata(child, resource->pool, 1));
+      else if (strcmp(child->name, "file") == 0)
+        {
+          fetch_item_t *item;
+
+          if (items->nelts >= MAX_FETCH_FILES)
+            return dav_svn__new_error_svn(resource->pool, HTTP_BAD_REQUEST,
+                                          0, 0,
+                                          apr_psprintf(resource->pool,
+                                                       "Request contains "
+                                                       "more than %d files",
+                                                       MAX_FETCH_FILES));
+
+          if ((derr = parse_fetch_item(&item, child, ns, resource)))
+            return derr;
+
+          APR_ARRAY_PUSH(items, fetch_item_t *) = item;
+        }
+      /* else unknown element; skip it */
+    }
+
+  serr = svn_fs_youngest_rev(&ffb.youngest, repos->fs, resource->pool);
+  if (serr)
+    return dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                "Could not determine youngest revision",
+                                resource->pool);
+
+  if (! SVN_IS_VALID_REVNUM(rev))
+    rev = ffb.youngest;
+
+  serr = svn_fs_revision_root(&ffb.root, repos->fs, rev, resource->pool);
+  if (serr)
+    return dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                "Could not open revision root",
+                                resource->pool);
+
+  ffb.bb = apr_brigade_create(resource->pool,
+                              dav_svn__output_get_bucket_alloc(output));
+  ffb.output = output;
+  ffb.resource = resource;
+  ffb.base_roots = apr_hash_make(resource->pool);
+  ffb.next_forced_flush = 1;
+
+  serr = dav_svn__brigade_puts(ffb.bb, ffb.output,
+                               DAV_XML_HEADER DEBUG_CR
+                               "<S:fetch-files-report xmlns:S=\""
+                               SVN_XML_NAMESPACE "\" "
+                               "xmlns:D=\"DAV:\">" DEBUG_CR);
+  if (serr)
+    {
+      derr = dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                  "Error beginning REPORT response.",
+                                  resource->pool);
+      goto cleanup;
+    }
+
+  iterpool = svn_pool_create(resource->pool);
+  for (i = 0; i < items->nelts; i++)
+    {
+      const fetch_item_t *item = APR_ARRAY_IDX(items, i, fetch_item_t *);
+
+      svn_pool_clear(iterpool);
+
+      serr = send_file(&ffb, item, iterpool);
+      if (serr)
+        {
+          derr = dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                      "Error sending file contents.",
+                                      resource->pool);
+          goto cleanup;
+        }
+    }
+  svn_pool_destroy(iterpool);
+
+  if ((serr = dav_svn__brigade_puts(ffb.bb, ffb.output,
+                                    "</S:fetch-files-report>" DEBUG_CR)))
+    {
+      derr = dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                  "Error ending REPORT response.",
+                                  resource->pool);
+      goto cleanup;
+    }
+
+ cleanup:
+
+  return dav_svn__final_flush_or_error(resource->info->r, ffb.bb, output,
+                                       derr, resource->pool);
+}
@@ -0,0 +1,297 @@
+/*
+ * file-blame.c: mod_dav_svn REPORT handler for transmitting blame
+ *               information calculated on the server
+ *
+ * ====================================================================
+ *    Licensed to the Apache Software Foundation (ASF) under one
+ *    or more contributor license agreements.  See the NOTICE file
+ *    distributed with this work for additional information
+ *    regarding copyright ownership.  The ASF licenses this file
+ *    to you under the Apache License, Version 2.0 (the
+ *    "License"); you may not use this file except in compliance
+ *    with the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an
+ *    "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *    KIND, either express or implied.  See the License for the
+ *    specific language governing permissions and limitations
+ *    under the License.
+ * ====================================================================
+ */
+
+#define APR_WANT_STRFUNC
+#include <apr_want.h> /* for strcmp() */
+
+#include "svn_types.h"
+#include "svn_xml.h"
+#include "svn_pools.h"
+#include "svn_base64.h"
+#include "svn_props.h"
+#include "svn_dav.h"
+#include "svn_repos.h"
+
+#include "private/svn_log.h"
+#include "private/svn_fspath.h"
+
+#include "../dav_svn.h"
+
+struct file_blame_baton {
+  /* this buffers the output for a bit and is automatically flushed,
+     at appropriate times, by the Apache filter system. */
+  apr_bucket_brigade *bb;
+
+  /* where to deliver the output */
+  dav_svn__output *output;
+
+  /* Whether we've written the <S:file-blame-report> header.  Allows for
+     lazy writes to support mod_dav-based error handling. */
+  svn_boolean_t needs_header;
+};
+
+
+/* If FBB->needs_header is true, send the "<S:file-blame-report>" start
+   tag and set FBB->needs_header to zero.  Else do nothing. */
+static svn_error_t *
+maybe_send_header(struct file_blame_baton *fbb)
+{
+  if (fbb->needs_header)
+    {
+      SVN_ERR(dav_svn__brigade_puts(fbb->bb, fbb->output,
+                                    DAV_XML_HEADER DEBUG_CR
+                                    "<S:file-blame-report xmlns:S=\""
+                                    SVN_XML_NAMESPACE "\" "
+                                    "xmlns:D=\"DAV:\">" DEBUG_CR));
+      fbb->needs_header = FALSE;
+    }
+  return SVN_NO_ERROR;
+}
+
+
+/* Send a revision property named NAME with value VAL.  Quote NAME and
+   base64-encode VAL if necessary. */
+static svn_error_t *
+send_rev_prop(struct file_blame_baton *fbb,
+              const char *name,
+              const svn_string_t *val,
+              apr_pool_t *pool)
+{
+  name = apr_xml_quote_string(pool, name, 1);
+
+  if (svn_xml_is_xml_safe(val->data, val->len))
+    {
+      svn_stringbuf_t *tmp = NULL;
+      svn_xml_escape_cdata_string(&tmp, val, pool);
+      SVN_ERR(dav_svn__brigade_printf(fbb->bb, fbb->output,
+                                      "<S:rev-prop name=\"%s\">%s"
+                                      "</S:rev-prop>" DEBUG_CR,
+                                      name, tmp->data));
+    }
+  else
+    {
+      val = svn_base64_encode_string2(val, TRUE, pool);
+      SVN_ERR(dav_svn__brigade_printf(fbb->bb, fbb->output,
+                                      "<S:rev-prop name=\"%s\" "
+                                      "encoding=\"base64\">%s"
+                                      "</S:rev-prop>" DEBUG_CR,
+                                      name, val->data));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+
+/* This implements the svn_file_blame_receiver_t interface. */
+static svn_error_t *
+file_blame_receiver(void *baton,
+                    apr_int64_t line_start,
+                    apr_int64_t line_count,
+                    svn_revnum_t revision,
+                    apr_hash_t *rev_props,
+                    apr_pool_t *pool)
+{
+  struct file_blame_baton *fbb = baton;
+  apr_pool_t *iterpool;
+  apr_hash_index_t *hi;
+
+  SVN_ERR(maybe_send_header(fbb));
+
+  if (SVN_IS_VALID_REVNUM(revision))
+    SVN_ERR(dav_svn__brigade_printf(fbb->bb, fbb->output,
+                                    "<S:range start=\"%" APR_INT64_T_FMT
+                                    "\" count=\"%" APR_INT64_T_FMT
+                                    "\" rev=\"%ld\">" DEBUG_CR,
+                                    line_start, line_count, revision));
+  else
+    SVN_ERR(dav_svn__brigade_printf(fbb->bb, fbb->output,
+                                    "<S:range start=\"%" APR_INT64_T_FMT
+                                    "\" count=\"%" APR_INT64_T_FMT
+                                    "\">" DEBUG_CR,
+                                    line_start, line_count));
+
+  /* The revision properties are only sent with the first range of each
+     revision. */
+  if (rev_props)
+    {
+      iterpool = svn_pool_create(pool);
+      for (hi = apr_hash_first(pool, rev_props); hi; hi = apr_hash_next(hi))
+        {
+          svn_pool_clear(iterpool);
+          SVN_ERR(send_rev_prop(fbb, apr_hash_this_key(hi),
+                                apr_hash_this_val(hi), iterpool));
+        }
+      svn_pool_destroy(iterpool);
+    }
+
+  return svn_error_trace(dav_svn__brigade_puts(fbb->bb, fbb->output,
+                                               "</S:range>" DEBUG_CR));
+}
+
+
+/* Implements svn_cancel_func_t.  BATON is the request.  Calculating the
+   blame may take a long time before the first byte is sent, so notice a
+   client that went away in the meantime. */
+static svn_error_t *
+file_blame_cancel(void *baton)
+{
+  request_rec *r = baton;
+
+  if (r->connection->aborted)
+    return svn_error_create(SVN_ERR_CANCELLED, NULL,
+                            "Client closed the connection");
+
+  return SVN_NO_ERROR;
+}
+
+
+/* Respond to a client request for a REPORT of type file-blame-report for
+   the RESOURCE.  Get request body from DOC and send result to OUTPUT. */
+dav_error *
+dav_svn__file_blame_report(const dav_resource *resource,
+                           const apr_xml_doc *doc,
+                           dav_svn__output *output)
+{
+  svn_error_t *serr;
+  dav_error *derr = NULL;
+  apr_xml_elem *child;
+  int ns;
+  struct file_blame_baton fbb;
+  dav_svn__authz_read_baton arb;
+  const char *abs_path = NULL;
+
+  /* These get determined from the request document. */
+  svn_revnum_t start = SVN_INVALID_REVNUM;
+  svn_revnum_t end = SVN_INVALID_REVNUM;
+  apr_array_header_t *diff_options
+    = apr_array_make(resource->pool, 0, sizeof(const char *));
+
+  /* Construct the authz read check baton. */
+  arb.r = resource->info->r;
+  arb.repos = resource->info->repos;
+
+  /* Sanity check. */
+  if (!resource->info->repos_path)
+    return dav_svn__new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                              "The request does not specify a repository path");
+  if (!dav_svn__get_file_blame_flag(resource->info->r))
+    return dav_svn__new_error_svn(resource->pool, HTTP_FORBIDDEN,
+                                  SVN_ERR_UNSUPPORTED_FEATURE, 0,
+                                  "Server-side blame has been disabled "
+                                  "for this repository");
+  ns = dav_svn__find_ns(doc->namespaces, SVN_XML_NAMESPACE);
+  if (ns == -1)
+    {
+      return dav_svn__new_error_svn(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                                    "The request does not contain the 'svn:' "
+                                    "namespace, so it is not going to have "
+                                    "certain required elements");
+    }
+
+  /* Get request information. */
+  for (child = doc->root->first_child; child != NULL; child = child->next)
+    {
+      /* if this element isn't one of ours, then skip it */
+      if (child->ns != ns)
+        continue;
+
+      if (strcmp(child->name, "start-revision") == 0)
+        start = SVN_STR_TO_REV(dav_xml_get_cdata(child, resource->pool, 1));
+      else if (strcmp(child->name, "end-revision") == 0)
+        end = SVN_STR_TO_REV(dav_xml_get_cdata(child, resource->pool, 1));
+      else if (strcmp(child->name, "diff-option") == 0)
+        APR_ARRAY_PUSH(diff_options, const char *)
+          = dav_xml_get_cdata(child, resource->pool, 1);
+      else if (strcmp(child->name, "path") == 0)
+        {
+          const char *rel_path = dav_xml_get_cdata(child, resource->pool, 0);
+          if ((derr = dav_svn__test_canonical(rel_path, resource->pool)))
+            return derr;
+
+          /* Force REL_PATH to be a relative path, not an fspath. */
+          rel_path = svn_relpath_canonicalize(rel_path, resource->pool);
+
+          /* Append the REL_PATH to the base FS path to get an
+             absolute repository path. */
+          abs_path = svn_fspath__join(resource->info->repos_path, rel_path,
+                                      resource->pool);
+        }
+      /* else unknown element; skip it */
+    }
+
+  /* Check that all parameters are present and valid. */
+  if (! abs_path || ! SVN_IS_VALID_REVNUM(start)
+      || ! SVN_IS_VALID_REVNUM(end))
+    return dav_svn__new_error_svn(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                                  "Not all parameters passed");
+
+  fbb.bb = apr_brigade_create(resource->pool,
+                              dav_svn__output_get_bucket_alloc(output));
+  fbb.output = output;
+  fbb.needs_header = TRUE;
+
+  /* file_blame_receiver will send header first time it is called. */
+
+  /* Calculate the blame and send it. */
+  serr = svn_repos_get_file_blame(resource->info->repos->repos,
+                                  abs_path, start, end, diff_options,
+                                  dav_svn__authz_read_func(&arb), &arb,
+                                  file_blame_receiver, &fbb,
+                                  file_blame_cancel, resource->info->r,
+                                  resource->pool);
+
+  if (serr)
+    {
+      /* Don't 'goto cleanup'; see file-revs.c for why. */
+      return (dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                   NULL, resource->pool));
+    }
+
+  if ((serr = maybe_send_header(&fbb)))
+    {
+      derr = dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                  "Error beginning REPORT response",
+                                  resource->pool);
+      goto cleanup;
+    }
+
+  if ((serr = dav_svn__brigade_puts(fbb.bb, fbb.output,
+                                    "</S:file-blame-report>" DEBUG_CR)))
+    {
+      derr = dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
+                                  "Error ending REPORT response",
+                                  resource->pool);
+      goto cleanup;
+    }
+
+ cleanup:
+
+  /* We've detected a 'high level' svn action to log. */
+  dav_svn__operational_log(resource->info,
+                           svn_log__get_file_blame(abs_path, start, end,
+                                                   resource->pool));
+
+  return dav_svn__final_flush_or_error(resource->info->r, fbb.bb, output,
+                                       derr, resource->pool);
+}
@@ -1268,7 +1268,7 @@ dav_svn__update_report(const dav_resource *resource,
   editor->close_file = upd_close_file;
   editor->absent_file = upd_absent_file;
   editor->close_edit = upd_close_edit;
-  if ((serr = svn_repos_begin_report3(&rbaton, revnum,
+  if ((serr = svn_repos_begin_report4(&rbaton, revnum,
                                       repos->repos,
                                       src_path, target,
                                       dst_path,
@@ -1280,6 +1280,7 @@ dav_svn__update_report(const dav_resource *resource,
                                       dav_svn__authz_read_func(&arb),
                                       &arb,
                                       0,  /* disable zero-copy for now */
+                                      1,  /* no prefetching */
                                       resource->pool)))
     {
       return dav_svn__convert_err(serr, HTTP_INTERNAL_SERVER_ERROR,
@@ -153,6 +153,7 @@ get_vsn_options(apr_pool_t *p, apr_text_header *phdr)
   apr_text_append(p, phdr, SVN_DAV_NS_DAV_SVN_INLINE_PROPS);
   apr_text_append(p, phdr, SVN_DAV_NS_DAV_SVN_REVERSE_FILE_REVS);
   apr_text_append(p, phdr, SVN_DAV_NS_DAV_SVN_LIST);
+  apr_text_append(p, phdr, SVN_DAV_NS_DAV_SVN_FETCH_FILES);
   /* Mergeinfo is a special case: here we merely say that the server
    * knows how to handle mergeinfo -- whether the repository does too
    * is a separate matter.
@@ -280,6 +281,11 @@ get_option(const dav_resource *resource,
                     has ? "yes" : "no");
     }
 
+  /* Server-side blame may be switched off per location (SVNAllowFileBlame),
+     so announce it here instead of in get_vsn_options(). */
+  if (dav_svn__get_file_blame_flag(r))
+    apr_table_addn(r->headers_out, "DAV", SVN_DAV_NS_DAV_SVN_FILE_BLAME);
+
   /* Welcome to the 2nd generation of the svn HTTP protocol, now
      DeltaV-free!  If we're configured to advise this support, do so.  */
   if (resource->info->repos->v2_protocol)
@@ -1180,6 +1186,14 @@ deliver_report(request_rec *r,
         {
           return dav_svn__list_report(resource, doc, output);
         }
+      else if (strcmp(doc->root->name, "fetch-files-report") == 0)
+        {
+          return dav_svn__fetch_files_report(resource, doc, output);
+        }
+      else if (strcmp(doc->root->name, "file-blame-report") == 0)
+        {
+          return dav_svn__file_blame_report(resource, doc, output);
+        }
       /* NOTE: if you add a report, don't forget to add it to the
        *       dav_svn__reports_list[] array.
        */
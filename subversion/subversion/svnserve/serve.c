@@ -63,6 +63,10 @@
 #include "server.h"
 #include "logger.h"
 
+/* get-file sends file contents of at least this size directly from the
+   repository files, if the backend stores them verbatim. */
+#define SENDFILE_THRESHOLD 0x10000
+
 typedef struct commit_callback_baton_t {
   apr_pool_t *pool;
   svn_revnum_t *new_rev;
@@ -979,7 +983,7 @@ static svn_error_t *accept_report(svn_boolean_t *only_empty_entry,
   /* Make an svn_repos report baton.  Tell it to drive the network editor
    * when the report is complete. */
   svn_ra_svn_get_editor(&editor, &edit_baton, conn, pool, NULL, NULL);
-  SVN_CMD_ERR(svn_repos_begin_report3(&report_baton, rev,
+  SVN_CMD_ERR(svn_repos_begin_report4(&report_baton, rev,
                                       b->repository->repos,
                                       b->repository->fs_path->data, target,
                                       tgt_path, text_deltas, depth,
@@ -987,7 +991,7 @@ static svn_error_t *accept_report(svn_boolean_t *only_empty_entry,
                                       editor, edit_baton,
                                       authz_check_access_cb_func(b),
                                       &ab, svn_ra_svn_zero_copy_limit(conn),
-                                      pool));
+                                      b->update_threads, pool));
 
   rb.sb = b;
   rb.repos_url = svn_path_uri_decode(b->repository->repos_url, pool);
@@ -1457,6 +1461,7 @@ commit(svn_ra_svn_conn_t *conn,
   commit_callback_baton_t ccb;
   svn_revnum_t new_rev;
   authz_baton_t ab;
+  svn_error_t *err;
 
   ab.server = b;
   ab.conn = conn;
@@ -1522,8 +1527,15 @@ commit(svn_ra_svn_conn_t *conn,
                commit_done, &ccb,
                authz_commit_cb, &ab, pool));
   SVN_ERR(svn_ra_svn__write_cmd_response(conn, pool, ""));
-  SVN_ERR(svn_ra_svn_drive_editor2(conn, pool, editor, edit_baton,
-                                   &aborted, FALSE));
+
+  /* Let the client stream the edit, if it can. */
+  if (svn_ra_svn_has_capability(conn, SVN_RA_SVN_CAP_EDIT_WINDOW))
+    svn_ra_svn__enable_edit_window(conn, TRUE);
+  err = svn_ra_svn_drive_editor2(conn, pool, editor, edit_baton,
+                                 &aborted, FALSE);
+  svn_ra_svn__enable_edit_window(conn, FALSE);
+  SVN_ERR(err);
+
   if (!aborted)
     {
       SVN_ERR(log_command(b, conn, pool, "%s",
@@ -1562,6 +1574,9 @@ get_file(svn_ra_svn_conn_t *conn,
   svn_revnum_t rev;
   svn_fs_root_t *root;
   svn_stream_t *contents;
+  apr_file_t *contents_file = NULL;
+  apr_off_t contents_offset;
+  svn_filesize_t contents_length;
   apr_hash_t *props = NULL;
   apr_array_header_t *inherited_props;
   svn_string_t write_str;
@@ -1614,7 +1629,23 @@ get_file(svn_ra_svn_conn_t *conn,
                           &ab, root, full_path,
                           pool));
   if (want_contents)
-    SVN_CMD_ERR(svn_fs_file_contents(&contents, root, full_path, pool));
+    {
+      /* Larger files that are stored verbatim can be sent straight from
+         the repository files.  Smaller ones are better served from the
+         FS caches. */
+      SVN_CMD_ERR(svn_fs_file_contents_location(&contents_file,
+                                                &contents_offset,
+                                                &contents_length,
+                                                root, full_path,
+                                                pool, pool));
+      if (contents_file && contents_length < SENDFILE_THRESHOLD)
+        {
+          SVN_CMD_ERR(svn_io_file_close(contents_file, pool));
+          contents_file = NULL;
+        }
+      if (!contents_file)
+        SVN_CMD_ERR(svn_fs_file_contents(&contents, root, full_path, pool));
+    }
 
   /* Send successful command response with revision and props. */
   SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "w((?c)r(!", "success",
@@ -1644,7 +1675,16 @@ get_file(svn_ra_svn_conn_t *conn,
   SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "!))"));
 
   /* Now send the file's contents. */
-  if (want_contents)
+  if (contents_file)
+    {
+      SVN_ERR(svn_ra_svn__write_file_strings(conn, pool, contents_file,
+                                             contents_offset,
+                                             contents_length));
+      SVN_ERR(svn_io_file_close(contents_file, pool));
+      SVN_ERR(svn_ra_svn__write_cstring(conn, pool, ""));
+      SVN_ERR(svn_ra_svn__write_cmd_response(conn, pool, ""));
+    }
+  else if (want_contents)
     {
       err = SVN_NO_ERROR;
       while (1)
@@ -2887,6 +2927,135 @@ get_file_revs(svn_ra_svn_conn_t *conn,
   return SVN_NO_ERROR;
 }
 
+/* Implements svn_file_blame_receiver_t, sending the range to the client.
+ * BATON is the connection. */
+static svn_error_t *
+file_blame_receiver(void *baton,
+                    apr_int64_t line_start,
+                    apr_int64_t line_count,
+                    svn_revnum_t revision,
+                    apr_hash_t *rev_props,
+                    apr_pool_t *pool)
+{
+  svn_ra_svn_conn_t *conn = baton;
+
+  SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "nn(?r)(!",
+                                  (apr_uint64_t)line_start,
+                                  (apr_uint64_t)line_count, revision));
+  if (rev_props)
+    {
+      SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "!(!"));
+      SVN_ERR(svn_ra_svn__write_proplist(conn, pool, rev_props));
+      SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "!)"));
+    }
+  SVN_ERR(svn_ra_svn__write_tuple(conn, pool, "!))"));
+
+  return SVN_NO_ERROR;
+}
+
+/* Check for a closed connection only on every this many calls to
+ * file_blame_cancel(). */
+#define FILE_BLAME_CANCEL_INTERVAL 64
+
+/* Baton for file_blame_cancel(). */
+typedef struct file_blame_cancel_baton_t
+{
+  svn_ra_svn_conn_t *conn;
+
+  /* Number of calls so far. */
+  apr_uint64_t calls;
+} file_blame_cancel_baton_t;
+
+/* Implements svn_cancel_func_t.  BATON is a file_blame_cancel_baton_t.
+ * Calculating the blame may take a long time without any network traffic,
+ * so give up once the client closed the connection. */
+static svn_error_t *
+file_blame_cancel(void *baton)
+{
+  file_blame_cancel_baton_t *cb = baton;
+  svn_boolean_t terminated;
+
+  /* This gets called for every revision and every diff hunk. */
+  if (++cb->calls % FILE_BLAME_CANCEL_INTERVAL)
+    return SVN_NO_ERROR;
+
+  /* Must not reset the I/O limits of the running command. */
+  SVN_ERR(svn_ra_svn__check_terminated(&terminated, cb->conn,
+                                       svn_ra_svn__get_pool(cb->conn)));
+  if (terminated)
+    return svn_error_create(SVN_ERR_CANCELLED, NULL,
+                            _("Client closed the connection"));
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+get_file_blame(svn_ra_svn_conn_t *conn,
+               apr_pool_t *pool,
+               svn_ra_svn__list_t *params,
+               void *baton)
+{
+  server_baton_t *b = baton;
+  svn_error_t *err, *write_err;
+  svn_revnum_t start_rev, end_rev;
+  const char *path;
+  const char *full_path;
+  svn_ra_svn__list_t *options_list;
+  apr_array_header_t *diff_options;
+  file_blame_cancel_baton_t cancel_baton = { 0 };
+  int i;
+  authz_baton_t ab;
+
+  ab.server = b;
+  ab.conn = conn;
+  cancel_baton.conn = conn;
+
+  /* Parse arguments. */
+  SVN_ERR(svn_ra_svn__parse_tuple(params, "crrl", &path, &start_rev,
+                                  &end_rev, &options_list));
+  path = svn_relpath_canonicalize(path, pool);
+  SVN_ERR(trivial_auth_request(conn, pool, b));
+  full_path = svn_fspath__join(b->repository->fs_path->data, path, pool);
+
+  if (!b->repository->file_blame)
+    SVN_CMD_ERR(svn_error_create(SVN_ERR_UNSUPPORTED_FEATURE, NULL,
+                                 _("Server-side blame has been disabled "
+                                   "for this repository")));
+
+  diff_options = apr_array_make(pool, options_list->nelts,
+                                sizeof(const char *));
+  for (i = 0; i < options_list->nelts; ++i)
+    {
+      svn_ra_svn__item_t *elt = &SVN_RA_SVN__LIST_ITEM(options_list, i);
+
+      if (elt->kind != SVN_RA_SVN_STRING)
+        return svn_error_create(SVN_ERR_RA_SVN_MALFORMED_DATA, NULL,
+                                "Diff option not a string");
+
+      APR_ARRAY_PUSH(diff_options, const char *) = elt->u.string.data;
+    }
+
+  SVN_ERR(log_command(b, conn, pool, "%s",
+                      svn_log__get_file_blame(full_path, start_rev, end_rev,
+                                              pool)));
+
+  err = svn_repos_get_file_blame(b->repository->repos, full_path, start_rev,
+                                 end_rev, diff_options,
+                                 authz_check_access_cb_func(b), &ab,
+                                 file_blame_receiver, conn,
+                                 file_blame_cancel, &cancel_baton, pool);
+  write_err = svn_ra_svn__write_word(conn, pool, "done");
+  if (write_err)
+    {
+      svn_error_clear(err);
+      return write_err;
+    }
+  SVN_CMD_ERR(err);
+  SVN_ERR(svn_ra_svn__write_cmd_response(conn, pool, ""));
+
+  return SVN_NO_ERROR;
+}
+
 static svn_error_t *
 lock(svn_ra_svn_conn_t *conn,
      apr_pool_t *pool,
@@ -3721,6 +3890,7 @@ static const svn_ra_svn__cmd_entry_t main_commands[] = {
   { "get-locations",   get_locations },
   { "get-location-segments",   get_location_segments },
   { "get-file-revs",   get_file_revs },
+  { "get-file-blame",  get_file_blame },
   { "lock",            lock },
   { "lock-many",       lock_many },
   { "unlock",          unlock },
@@ -3885,6 +4055,11 @@ find_repos(const char *url,
   SVN_ERR(load_authz_config(repository, repository->repos_root, cfg,
                             result_pool));
 
+  /* May clients have the server calculate blame results? */
+  SVN_ERR(svn_config_get_bool(cfg, &repository->file_blame,
+                              SVN_CONFIG_SECTION_GENERAL,
+                              SVN_CONFIG_OPTION_FILE_BLAME, TRUE));
+
   /* Should we use Cyrus SASL? */
   SVN_ERR(svn_config_get_bool(cfg, &sasl_requested,
                               SVN_CONFIG_SECTION_SASL,
@@ -4134,6 +4309,7 @@ construct_server_baton(server_baton_t **baton,
   b->read_only = params->read_only;
   b->pool = conn_pool;
   b->vhost = params->vhost;
+  b->update_threads = params->update_threads;
 
   b->logger = params->logger;
   b->client_info = get_client_info(conn, params, conn_pool);
@@ -4142,7 +4318,7 @@ construct_server_baton(server_baton_t **baton,
    * send an empty mechlist. */
   if (params->compression_level > 0)
     SVN_ERR(svn_ra_svn__write_cmd_response(conn, scratch_pool,
-                                           "nn()(wwwwwwwwwwwww)",
+                                           "nn()(wwwwwwwwwwwwww)",
                                            (apr_uint64_t) 2, (apr_uint64_t) 2,
                                            SVN_RA_SVN_CAP_EDIT_PIPELINE,
                                            SVN_RA_SVN_CAP_SVNDIFF1,
@@ -4156,11 +4332,12 @@ construct_server_baton(server_baton_t **baton,
                                            SVN_RA_SVN_CAP_INHERITED_PROPS,
                                            SVN_RA_SVN_CAP_EPHEMERAL_TXNPROPS,
                                            SVN_RA_SVN_CAP_GET_FILE_REVS_REVERSE,
-                                           SVN_RA_SVN_CAP_LIST
+                                           SVN_RA_SVN_CAP_LIST,
+                                           SVN_RA_SVN_CAP_EDIT_WINDOW
                                            ));
   else
     SVN_ERR(svn_ra_svn__write_cmd_response(conn, scratch_pool,
-                                           "nn()(wwwwwwwwwww)",
+                                           "nn()(wwwwwwwwwwww)",
                                            (apr_uint64_t) 2, (apr_uint64_t) 2,
                                            SVN_RA_SVN_CAP_EDIT_PIPELINE,
                                            SVN_RA_SVN_CAP_ABSENT_ENTRIES,
@@ -4172,7 +4349,8 @@ construct_server_baton(server_baton_t **baton,
                                            SVN_RA_SVN_CAP_INHERITED_PROPS,
                                            SVN_RA_SVN_CAP_EPHEMERAL_TXNPROPS,
                                            SVN_RA_SVN_CAP_GET_FILE_REVS_REVERSE,
-                                           SVN_RA_SVN_CAP_LIST
+                                           SVN_RA_SVN_CAP_LIST,
+                                           SVN_RA_SVN_CAP_EDIT_WINDOW
                                            ));
 
   /* Read client response, which we assume to be in version 2 format:
@@ -4282,6 +4460,9 @@ construct_server_baton(server_baton_t **baton,
     if (supports_mergeinfo)
       SVN_ERR(svn_ra_svn__write_word(conn, scratch_pool,
                                      SVN_RA_SVN_CAP_MERGEINFO));
+    if (b->repository->file_blame)
+      SVN_ERR(svn_ra_svn__write_word(conn, scratch_pool,
+                                     SVN_RA_SVN_CAP_FILE_BLAME));
     SVN_ERR(svn_ra_svn__write_tuple(conn, scratch_pool, "!))"));
     SVN_ERR(svn_ra_svn__flush(conn, scratch_pool));
   }
@@ -4360,6 +4541,15 @@ serve_interruptable(svn_boolean_t *terminate_p,
           /* It's not a fatal error if we cannot enable keep-alives. */
         }
 
+      /* We buffer all output and flush it when we wait for the client.
+       * Don't let Nagle's algorithm delay the last segment of each flush
+       * by another round trip. */
+      ar = apr_socket_opt_set(connection->usock, APR_TCP_NODELAY, 1);
+      if (ar)
+        {
+          /* Not fatal either. */
+        }
+
       /* create the connection, configure ports etc. */
       connection->conn
         = svn_ra_svn_create_conn5(connection->usock, NULL, NULL,
@@ -4422,6 +4612,16 @@ serve_interruptable(svn_boolean_t *terminate_p,
   return svn_error_trace(err);
 }
 
+svn_error_t *
+connection_has_input(svn_boolean_t *has_input,
+                     svn_boolean_t *terminate_p,
+                     connection_t *connection,
+                     apr_pool_t *pool)
+{
+  return svn_error_trace(svn_ra_svn__has_command(has_input, terminate_p,
+                                                 connection->conn, pool));
+}
+
 svn_error_t *serve(svn_ra_svn_conn_t *conn,
                    serve_params_t *params,
                    apr_pool_t *pool)
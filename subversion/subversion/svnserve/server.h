@@ -63,6 +63,7 @@ typedef struct repository_t {
                            /* Client capabilities (SVN_RA_CAPABILITY_*) */
   svn_stringbuf_t *fs_path;/* Decoded base in-repos path (w/ leading slash) */
   enum username_case_type username_case; /* Case-normalize the username? */
+  svn_boolean_t file_blame; /* Calculate blame results for clients? */
   svn_boolean_t use_sasl;  /* Use Cyrus SASL for authentication;
                               always false if SVN_HAVE_SASL not defined */
 #ifdef SVN_HAVE_SASL
@@ -90,6 +91,7 @@ typedef struct server_baton_t {
                               May be NULL even if log_file is not. */
   svn_boolean_t read_only; /* Disallow write access (global flag) */
   svn_boolean_t vhost;     /* Use virtual-host-based path to repo. */
+  int update_threads;      /* Text delta prefetchers per update report. */
   apr_pool_t *pool;
 } server_baton_t;
 
@@ -159,6 +161,10 @@ typedef struct serve_params_t {
 
   /* Use virtual-host-based path to repo. */
   svn_boolean_t vhost;
+
+  /* Number of worker threads each update-style report may use to
+     compute text deltas ahead of the editor drive.  1 disables that. */
+  int update_threads;
 } serve_params_t;
 
 /* This structure contains all data that describes a client / server
@@ -221,6 +227,17 @@ serve_interruptable(svn_boolean_t *terminate_p,
                     svn_boolean_t (* is_busy)(connection_t *),
                     apr_pool_t *pool);
 
+/* Check whether CONNECTION has unprocessed incoming data, without waiting
+   for new data to arrive.  Set *HAS_INPUT accordingly and set *TERMINATE_P
+   to TRUE if the client has closed the connection.  CONNECTION must have
+   been initialized by serve_interruptable() before.  Use POOL for
+   temporary allocations. */
+svn_error_t *
+connection_has_input(svn_boolean_t *has_input,
+                     svn_boolean_t *terminate_p,
+                     connection_t *connection,
+                     apr_pool_t *pool);
+
 /* Initialize the Cyrus SASL library. POOL is used for allocations. */
 svn_error_t *cyrus_init(apr_pool_t *pool);
 
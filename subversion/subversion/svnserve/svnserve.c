@@ -55,11 +55,13 @@
 #include "private/svn_dep_compat.h"
 #include "private/svn_cmdline_private.h"
 #include "private/svn_atomic.h"
+#include "private/svn_cache.h"
 #include "private/svn_mutex.h"
 #include "private/svn_subr_private.h"
 
 #if APR_HAS_THREADS
 #    include <apr_thread_pool.h>
+#    include <apr_poll.h>
 #endif
 
 #include "winservice.h"
@@ -145,6 +147,13 @@ enum run_mode {
  */
 #define THREADPOOL_THREAD_IDLE_LIMIT 1000000
 
+/* Number of idle connections that we expect to be waiting for their next
+ * command at any given time in threaded mode.  This is only a hint for
+ * efficient pollset implementations like epoll.  With others, connections
+ * exceeding that limit will be polled by the worker threads as before.
+ */
+#define IDLE_CONNECTIONS_HINT 1024
+
 /* Number of client to server connections that may concurrently in the
  * TCP 3-way handshake state, i.e. are in the process of being created.
  *
@@ -222,6 +231,9 @@ void winservice_notify_stop(void)
 #define SVNSERVE_OPT_MAX_REQUEST     274
 #define SVNSERVE_OPT_MAX_RESPONSE    275
 #define SVNSERVE_OPT_CACHE_NODEPROPS 276
+#define SVNSERVE_OPT_CACHE_SEGMENTS  277
+#define SVNSERVE_OPT_CACHE_SHARED    278
+#define SVNSERVE_OPT_UPDATE_THREADS  279
 
 /* Text macro because we can't use #ifdef sections inside a N_("...")
    macro expansion. */
@@ -325,6 +337,28 @@ static const apr_getopt_option_t svnserve__options[] =
         "Default is yes.\n"
         "                             "
         "[used for FSFS repositories only]")},
+    {"cache-segments", SVNSERVE_OPT_CACHE_SEGMENTS, 1,
+     N_("number of independently locked segments in the\n"
+        "                             "
+        "in-memory cache.  More segments reduce lock\n"
+        "                             "
+        "contention between threads but limit the size\n"
+        "                             "
+        "of cachable items.\n"
+        "                             "
+        "Default is 0 (derived from the cache size).\n"
+        "                             "
+        "[used for FSFS and FSX repositories only]")},
+    {"cache-shared", SVNSERVE_OPT_CACHE_SHARED, 1,
+     N_("share a single in-memory cache among all forked\n"
+        "                             "
+        "worker processes instead of giving each its own.\n"
+        "                             "
+        "Only effective in fork mode.\n"
+        "                             "
+        "Default is no.\n"
+        "                             "
+        "[used for FSFS and FSX repositories only]")},
     {"client-speed", SVNSERVE_OPT_CLIENT_SPEED, 1,
      N_("Optimize network handling based on the assumption\n"
         "                             "
@@ -362,6 +396,12 @@ static const apr_getopt_option_t svnserve__options[] =
         "                             "
         "Default is " APR_STRINGIFY(THREADPOOL_MAX_SIZE) "."
         ONLY_AVAILABLE_WITH_THEADS)},
+    {"update-threads",   SVNSERVE_OPT_UPDATE_THREADS, 1,
+     N_("Number of threads per update, switch or diff\n"
+        "                             "
+        "request computing file deltas ahead of sending\n"
+        "                             "
+        "them.  Default is 1 (no look-ahead).")},
 #endif
     {"max-request-size", SVNSERVE_OPT_MAX_REQUEST, 1,
      N_("Maximum acceptable size of a client request in MB.\n"
@@ -614,14 +654,164 @@ static svn_root_pools__t *connection_pools;
 /* The global thread pool serving all connections. */
 static apr_thread_pool_t *threads;
 
+/* Connections waiting for their next command in threaded mode.  Instead
+   of blocking a worker thread in read(), they get parked here until there
+   is some data to process.  NULL if the platform does not support that. */
+static apr_pollset_t *idle_connections;
+
+/* The thread waiting for IDLE_CONNECTIONS to become readable. */
+static apr_thread_t *reactor_thread;
+
+/* Set to tell REACTOR_THREAD to exit. */
+static volatile svn_atomic_t reactor_stop = FALSE;
+
 /* Very simple load determination callback for serve_interruptable:
    With less than half the threads in THREADS in use, we can afford to
-   wait in the socket read() function.  Otherwise, poll them round-robin. */
+   wait in the socket read() function.  Otherwise, poll them round-robin.
+   If we can park idle connections, never wait in read(). */
 static svn_boolean_t
 is_busy(connection_t *connection)
 {
-  return apr_thread_pool_threads_count(threads) * 2
-       > apr_thread_pool_thread_max_get(threads);
+  return idle_connections
+      || apr_thread_pool_threads_count(threads) * 2
+         > apr_thread_pool_thread_max_get(threads);
+}
+
+static void * APR_THREAD_FUNC serve_thread(apr_thread_t *tid, void *data);
+
+/* Hand CONNECTION back to the worker threads. */
+static void
+push_connection(connection_t *connection)
+{
+  apr_status_t status = apr_thread_pool_push(threads, serve_thread,
+                                             connection, 0, NULL);
+  if (status)
+    {
+      svn_error_t *err = svn_error_wrap_apr(status, _("Can't push task"));
+      logger__log_error(connection->params->logger, err, NULL, NULL);
+      svn_error_clear(err);
+      close_connection(connection);
+    }
+}
+
+/* CONNECTION has no more commands to serve at the moment.  Park it in
+   IDLE_CONNECTIONS if possible, unless there is more data to process.
+   Otherwise, put it back into THREADS.  Use SCRATCH_POOL for temporary
+   allocations. */
+static void
+reschedule_connection(connection_t *connection,
+                      apr_pool_t *scratch_pool)
+{
+  if (idle_connections)
+    {
+      svn_boolean_t has_input;
+      svn_boolean_t terminated;
+      svn_error_t *err = connection_has_input(&has_input, &terminated,
+                                              connection, scratch_pool);
+      if (err || terminated)
+        {
+          if (err)
+            logger__log_error(connection->params->logger, err, NULL,
+                              get_client_info(connection->conn,
+                                              connection->params,
+                                              scratch_pool));
+          svn_error_clear(err);
+          close_connection(connection);
+          return;
+        }
+
+      /* Anything that is already in our receive buffers would not make
+         the socket signal readability anymore.  Serve it right away. */
+      if (!has_input)
+        {
+          apr_pollfd_t pfd = { 0 };
+          pfd.p = connection->pool;
+          pfd.desc_type = APR_POLL_SOCKET;
+          pfd.desc.s = connection->usock;
+          pfd.reqevents = APR_POLLIN;
+          pfd.client_data = connection;
+
+          if (apr_pollset_add(idle_connections, &pfd) == APR_SUCCESS)
+            return;
+        }
+    }
+
+  push_connection(connection);
+}
+
+/* Thread function waiting for parked connections to become readable and
+   dispatching them to the worker threads.  DATA is the serve_params_t. */
+static void * APR_THREAD_FUNC
+reactor_thread_run(apr_thread_t *tid, void *data)
+{
+  serve_params_t *params = data;
+
+  while (!svn_atomic_read(&reactor_stop))
+    {
+      const apr_pollfd_t *descs;
+      apr_int32_t count;
+      apr_int32_t i;
+      apr_status_t status = apr_pollset_poll(idle_connections, -1,
+                                             &count, &descs);
+      if (APR_STATUS_IS_EINTR(status) || APR_STATUS_IS_TIMEUP(status))
+        continue;
+
+      if (status)
+        {
+          /* Don't spin on persistent errors. */
+          svn_error_t *err = svn_error_wrap_apr(status,
+                                   _("Can't poll idle connections"));
+          logger__log_error(params->logger, err, NULL, NULL);
+          svn_error_clear(err);
+          apr_sleep(apr_time_from_msec(100));
+          continue;
+        }
+
+      for (i = 0; i < count; ++i)
+        {
+          apr_pollset_remove(idle_connections, &descs[i]);
+          push_connection(descs[i].client_data);
+        }
+    }
+
+  apr_thread_exit(tid, APR_SUCCESS);
+  return NULL;
+}
+
+/* Try to set up IDLE_CONNECTIONS and REACTOR_THREAD for PARAMS.  Leave
+   IDLE_CONNECTIONS as NULL if that is not supported.  Allocate both
+   in POOL. */
+static void
+start_reactor(serve_params_t *params,
+              apr_pool_t *pool)
+{
+  apr_status_t status
+    = apr_pollset_create(&idle_connections, IDLE_CONNECTIONS_HINT, pool,
+                         APR_POLLSET_THREADSAFE | APR_POLLSET_WAKEABLE);
+  if (status)
+    {
+      idle_connections = NULL;
+      return;
+    }
+
+  status = apr_thread_create(&reactor_thread, NULL, reactor_thread_run,
+                             params, pool);
+  if (status)
+    idle_connections = NULL;
+}
+
+/* Make REACTOR_THREAD exit and wait for it. */
+static void
+stop_reactor(void)
+{
+  apr_status_t retval;
+
+  if (!idle_connections)
+    return;
+
+  svn_atomic_set(&reactor_stop, TRUE);
+  apr_pollset_wakeup(idle_connections);
+  apr_thread_join(&retval, reactor_thread);
 }
 
 /* Serve the connection given by DATA.  Under high load, serve only
@@ -645,13 +835,14 @@ static void * APR_THREAD_FUNC serve_thread(apr_thread_t *tid, void *data)
       svn_error_clear(err);
       done = TRUE;
     }
-  svn_root_pools__release_pool(pool, connection_pools);
 
   /* Close or re-schedule connection. */
   if (done)
     close_connection(connection);
   else
-    apr_thread_pool_push(threads, serve_thread, connection, 0, NULL);
+    reschedule_connection(connection, pool);
+
+  svn_root_pools__release_pool(pool, connection_pools);
 
   return NULL;
 }
@@ -724,6 +915,7 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
   svn_boolean_t cache_nodeprops = TRUE;
   svn_boolean_t cache_txdeltas = TRUE;
   svn_boolean_t cache_revprops = FALSE;
+  svn_boolean_t cache_shared = FALSE;
   svn_boolean_t use_block_read = FALSE;
   apr_uint16_t port = SVN_RA_SVN_PORT;
   const char *host = NULL;
@@ -774,6 +966,7 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
   params.error_check_interval = 4096;
   params.max_request_size = MAX_REQUEST_SIZE * 0x100000;
   params.max_response_size = 0;
+  params.update_threads = 1;
 
   while (1)
     {
@@ -925,6 +1118,20 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           cache_nodeprops = svn_tristate__from_word(arg) == svn_tristate_true;
           break;
 
+        case SVNSERVE_OPT_CACHE_SEGMENTS:
+          {
+            apr_uint64_t segment_count;
+            SVN_ERR(svn_cstring_atoui64(&segment_count, arg));
+
+            svn_cache__set_global_membuffer_segment_count(
+              (apr_size_t)segment_count);
+          }
+          break;
+
+        case SVNSERVE_OPT_CACHE_SHARED:
+          cache_shared = svn_tristate__from_word(arg) == svn_tristate_true;
+          break;
+
         case SVNSERVE_OPT_BLOCK_READ:
           use_block_read = svn_tristate__from_word(arg) == svn_tristate_true;
           break;
@@ -962,6 +1169,12 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           max_thread_count = (apr_size_t)apr_strtoi64(arg, NULL, 0);
           break;
 
+        case SVNSERVE_OPT_UPDATE_THREADS:
+          params.update_threads = (int)apr_strtoi64(arg, NULL, 0);
+          if (params.update_threads < 1)
+            params.update_threads = 1;
+          break;
+
 #ifdef WIN32
         case SVNSERVE_OPT_SERVICE:
           if (run_mode != run_mode_service)
@@ -1294,7 +1507,28 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
 #endif
       }
 
+#if APR_HAS_THREADS
+    /* Prefetching reports access the caches from several threads even
+     * if each connection is served by a separate process. */
+    if (params.update_threads > 1)
+      settings.single_threaded = FALSE;
+#endif
+
     svn_cache_config_set(&settings);
+
+    /* Forked workers inherit a shared cache only if it already exists.
+     * So, allocate it right here in the listening process.  Fall back to
+     * per-process caches if that fails. */
+    if (cache_shared && handling_mode == connection_mode_fork)
+      {
+        err = svn_cache__create_global_membuffer_shared(pool);
+        if (err)
+          {
+            logger__log_error(params.logger, err, NULL, NULL);
+            svn_error_clear(err);
+            cache_shared = FALSE;
+          }
+      }
   }
 
 #if APR_HAS_THREADS
@@ -1323,6 +1557,9 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
 
       /* don't queue requests unless we reached the worker thread limit */
       apr_thread_pool_threshold_set(threads, 0);
+
+      /* don't tie up worker threads with idle connections */
+      start_reactor(&params, pool);
     }
   else
     {
@@ -1352,6 +1589,21 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
               /* the child would't listen to the main server's socket */
               apr_socket_close(sock);
 
+              /* Some lock types need to be re-opened after fork(). */
+              if (cache_shared)
+                {
+                  err = svn_cache__membuffer_child_init(
+                          svn_cache__get_global_membuffer_cache(),
+                          connection->pool);
+                  if (err)
+                    {
+                      logger__log_error(params.logger, err, NULL, NULL);
+                      svn_error_clear(err);
+                      close_connection(connection);
+                      return SVN_NO_ERROR;
+                    }
+                }
+
               /* serve_socket() logs any error it returns, so ignore it. */
               svn_error_clear(serve_socket(connection, connection->pool));
               close_connection(connection);
@@ -1424,6 +1676,7 @@ main(int argc, const char *argv[])
   /* Explicitly wait for all threads to exit.  As we found out with similar
      code in our C test framework, the memory pool cleanup below cannot be
      trusted to do the right thing. */
+  stop_reactor();
   if (threads)
     apr_thread_pool_destroy(threads);
 #endif
@@ -1058,6 +1058,66 @@ def blame_reverse_no_change(sbox):
   svntest.actions.run_and_verify_svn(expected_output, [],
                                      'blame', '-r5:3', sbox.ospath('iota'))
 
+@SkipUnless(svntest.main.is_ra_type_svn)
+def blame_server_blame_disabled(sbox):
+  "blame with server-side blame disabled"
+
+  sbox.build()
+
+  sbox.simple_append('iota', 'new line\n')
+  sbox.simple_commit('') #r2
+
+  # Without the capability, the client must calculate the blame itself.
+  svntest.main.file_append(
+    svntest.main.get_svnserve_conf_file_path(sbox.repo_dir),
+    "[general]\nfile-blame = false\n")
+
+  expected_output = [
+    '     1    jrandom This is the file \'iota\'.\n',
+    '     2    jrandom new line\n',
+  ]
+  svntest.actions.run_and_verify_svn(expected_output, [],
+                                     'blame', sbox.repo_url + '/iota')
+
+@SkipUnless(svntest.main.is_ra_type_dav)
+def blame_multiple_ranges_over_dav(sbox):
+  "server-side blame with several ranges per rev"
+
+  sbox.build()
+
+  sbox.simple_append('iota', 'second\n')
+  sbox.simple_commit('') #r2
+
+  # Two separate ranges of r3.  The revision properties only come with
+  # the first one.
+  svntest.main.file_write(sbox.ospath('iota'),
+                          "first\n"
+                          "This is the file 'iota'.\n"
+                          "second\n"
+                          "third\n")
+  sbox.simple_commit('') #r3
+
+  expected_output = [
+    '     3    jrandom first\n',
+    '     1    jrandom This is the file \'iota\'.\n',
+    '     2    jrandom second\n',
+    '     3    jrandom third\n',
+  ]
+  svntest.actions.run_and_verify_svn(expected_output, [],
+                                     'blame', sbox.repo_url + '/iota')
+
+  # Lines older than the start revision come without any properties.
+  expected_output = [
+    '     3    jrandom first\n',
+    '     -          - This is the file \'iota\'.\n',
+    '     2    jrandom second\n',
+    '     3    jrandom third\n',
+  ]
+  svntest.actions.run_and_verify_svn(expected_output, [],
+                                     'blame', '-r2:HEAD',
+                                     sbox.repo_url + '/iota')
+
+
 
 ########################################################################
 # Run the tests
@@ -1084,6 +1144,8 @@ test_list = [ None,
               blame_eol_handling,
               blame_youngest_to_oldest,
               blame_reverse_no_change,
+              blame_server_blame_disabled,
+              blame_multiple_ranges_over_dav,
              ]
 
 if __name__ == '__main__':
@@ -3145,6 +3145,55 @@ def commit_issue4722_checksum(sbox):
       fp.write('abcdefghijklmnopqrstuvwxyz')
   sbox.simple_commit()
 
+@SkipUnless(svntest.main.is_ra_type_svn)
+def commit_larger_than_edit_window(sbox):
+  "commit more data than the ra_svn edit window"
+
+  sbox.build()
+  wc_dir = sbox.wc_dir
+
+  wc_backup = sbox.add_wc_path('backup')
+  svntest.actions.duplicate_dir(wc_dir, wc_backup)
+
+  # Random data does not compress, so the commit sends more than the
+  # 16 MB the client may have unacknowledged.
+  data = os.urandom(20 * 1024 * 1024)
+  svntest.main.file_write(sbox.ospath('A/big'), data, 'wb')
+  sbox.simple_add('A/big')
+  sbox.simple_commit()
+
+  svntest.main.run_svn(None, 'update', wc_backup)
+  if open(os.path.join(wc_backup, 'A', 'big'), 'rb').read() != data:
+    raise svntest.Failure("Committed contents of 'A/big' differ")
+
+@SkipUnless(svntest.main.is_ra_type_svn)
+def commit_edit_window_early_failure(sbox):
+  "ra_svn commit failing early in a large edit"
+
+  sbox.build()
+  wc_dir = sbox.wc_dir
+
+  wc_backup = sbox.add_wc_path('backup')
+  svntest.actions.duplicate_dir(wc_dir, wc_backup)
+
+  # Make A/mu out of date in the backup.
+  sbox.simple_append('A/mu', 'new line\n')
+  sbox.simple_commit()
+
+  # The server rejects the out-of-date A/mu while the tree is being
+  # edited, before the client sends the contents of A/big, which are
+  # larger than the edit window.  The error must surface rather than
+  # the client waiting for acknowledgements that never come.
+  svntest.main.file_append(os.path.join(wc_backup, 'A', 'mu'), 'hello')
+  svntest.main.file_write(os.path.join(wc_backup, 'A', 'big'),
+                          os.urandom(20 * 1024 * 1024), 'wb')
+  svntest.main.run_svn(None, 'add', os.path.join(wc_backup, 'A', 'big'))
+
+  expected_err = ".*(mu.*out of date|Out of date.*mu).*"
+  svntest.actions.run_and_verify_svn(None, expected_err,
+                                     'commit', '-m', 'log message',
+                                     wc_backup)
+
 
 ########################################################################
 # Run the tests
@@ -3224,6 +3273,8 @@ test_list = [ None,
               mkdir_conflict_proper_error,
               commit_xml,
               commit_issue4722_checksum,
+              commit_larger_than_edit_window,
+              commit_edit_window_early_failure,
              ]
 
 if __name__ == '__main__':
@@ -3944,6 +3944,26 @@ def dump_include_copied_directory(sbox):
   ])
   svntest.actions.run_and_verify_svn(expected_output, [],
                                      'log', '-v', '-q', sbox2.repo_url)
+def jobs_out_of_range(sbox):
+  "reject --jobs values FSFS would not accept"
+
+  sbox.build(create_wc=False, empty=True)
+
+  for subcommand in ['pack', 'verify']:
+    svntest.actions.run_and_verify_svnadmin(None,
+                                            '.*Invalid number of jobs.*',
+                                            subcommand, '--jobs', '300',
+                                            sbox.repo_dir)
+    svntest.actions.run_and_verify_svnadmin(None,
+                                            '.*Invalid number of jobs.*',
+                                            subcommand, '--jobs', '0',
+                                            sbox.repo_dir)
+
+  # The largest accepted value still opens the repository.
+  svntest.actions.run_and_verify_svnadmin(None, [],
+                                          'verify', '-q', '--jobs', '256',
+                                          sbox.repo_dir)
+
 
 ########################################################################
 # Run the tests
@@ -4022,6 +4042,7 @@ test_list = [ None,
               recover_prunes_rep_cache_when_enabled,
               recover_prunes_rep_cache_when_disabled,
               dump_include_copied_directory,
+              jobs_out_of_range,
              ]
 
 if __name__ == '__main__':
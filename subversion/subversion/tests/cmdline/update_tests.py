@@ -6897,6 +6897,75 @@ def update_keeps_unversioned_items_in_deleted_dir(sbox):
                                         expected_status,
                                         [], True)
 
+@SkipUnless(svntest.main.is_ra_type_dav)
+def update_fetch_files_in_batches(sbox):
+  "update many files with batched file fetches"
+
+  sbox.build()
+  wc_dir = sbox.wc_dir
+
+  # Skelta mode makes the client fetch the file contents itself, in
+  # batches if the server supports that.
+  skelta = ['--config-option', 'servers:global:http-bulk-updates=no']
+  names = ['A/many/file%d' % i for i in range(100)]
+
+  # r2: Add more files than fit into a single batch.
+  sbox.simple_mkdir('A/many')
+  for name in names:
+    sbox.simple_append(name, 'This is %s.\n' % name)
+  sbox.simple_add(*names)
+  sbox.simple_commit()
+
+  # r3: Change all of them, so they get sent as deltas, and add a copy
+  # whose delta base is its copy source.
+  for name in names:
+    sbox.simple_append(name, 'Changed.\n')
+  sbox.simple_copy('A/mu', 'A/many/mu')
+  sbox.simple_append('A/many/mu', 'Changed.\n')
+  sbox.simple_commit()
+
+  sbox.simple_update(revision='1')
+
+  # Update to r2: all files get added.
+  expected_output = svntest.wc.State(wc_dir, {
+    'A/many' : Item(status='A '),
+    })
+  expected_disk = svntest.main.greek_state.copy()
+  expected_disk.add({'A/many' : Item()})
+  expected_status = svntest.actions.get_virginal_state(wc_dir, 2)
+  expected_status.add({'A/many' : Item(status='  ', wc_rev=2)})
+  for name in names:
+    expected_output.add({name : Item(status='A ')})
+    expected_disk.add({name : Item('This is %s.\n' % name)})
+    expected_status.add({name : Item(status='  ', wc_rev=2)})
+
+  svntest.actions.run_and_verify_update(wc_dir,
+                                        expected_output,
+                                        expected_disk,
+                                        expected_status,
+                                        [], False,
+                                        '-r', '2', wc_dir, *skelta)
+
+  # Update to r3: all files get changed and the copy gets added.
+  expected_output = svntest.wc.State(wc_dir, {
+    'A/many/mu' : Item(status='A '),
+    })
+  expected_disk.add({
+    'A/many/mu' : Item("This is the file 'mu'.\nChanged.\n"),
+    })
+  expected_status.tweak(wc_rev=3)
+  expected_status.add({'A/many/mu' : Item(status='  ', wc_rev=3)})
+  for name in names:
+    expected_output.add({name : Item(status='U ')})
+    expected_disk.tweak(name, contents='This is %s.\nChanged.\n' % name)
+
+  svntest.actions.run_and_verify_update(wc_dir,
+                                        expected_output,
+                                        expected_disk,
+                                        expected_status,
+                                        [], False,
+                                        wc_dir, *skelta)
+
 #######################################################################
 # Run the tests
 
@@ -6989,6 +7058,7 @@ test_list = [ None,
               update_delete_switched,
               update_add_missing_local_add,
               update_keeps_unversioned_items_in_deleted_dir,
+              update_fetch_files_in_batches,
              ]
 
 if __name__ == '__main__':
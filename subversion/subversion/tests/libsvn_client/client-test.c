@@ -38,6 +38,8 @@
 #include "private/svn_wc_private.h"
 #include "svn_props.h"
 #include "svn_hash.h"
+#include "svn_config.h"
+#include "svn_ra.h"
 
 #include "../svn_test.h"
 #include "../svn_test_fs.h"
@@ -1408,6 +1410,383 @@ test_copy_pin_externals_select_subtree(const svn_test_opts_t *opts, apr_pool_t *
   return SVN_NO_ERROR;
 }
 
+/* Baton for blame_history_receiver(). */
+struct blame_history_baton
+{
+  const svn_revnum_t *expected;   /* expected revision of each line, or
+                                     NULL to not check them */
+  int nlines;                     /* number of elements in EXPECTED */
+  int seen;                       /* number of lines reported so far */
+  svn_stringbuf_t *result;        /* "REV:LINE\n" for each line */
+};
+
+/* Implements svn_client_blame_receiver3_t. */
+static svn_error_t *
+blame_history_receiver(void *baton,
+                       svn_revnum_t start_revnum,
+                       svn_revnum_t end_revnum,
+                       apr_int64_t line_no,
+                       svn_revnum_t revision,
+                       apr_hash_t *rev_props,
+                       svn_revnum_t merged_revision,
+                       apr_hash_t *merged_rev_props,
+                       const char *merged_path,
+                       const char *line,
+                       svn_boolean_t local_change,
+                       apr_pool_t *pool)
+{
+  struct blame_history_baton *b = baton;
+
+  SVN_TEST_ASSERT(line_no == b->seen);
+  if (b->expected)
+    {
+      SVN_TEST_ASSERT(line_no < b->nlines);
+      SVN_TEST_INT_ASSERT(revision, b->expected[line_no]);
+    }
+  svn_stringbuf_appendcstr(b->result,
+                           apr_psprintf(pool, "%ld:%s\n", revision, line));
+  b->seen++;
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_wc_notify_func2_t, counting the blame revision
+   notifications in the int BATON. */
+static void
+count_blame_notifications(void *baton,
+                          const svn_wc_notify_t *notify,
+                          apr_pool_t *pool)
+{
+  int *count = baton;
+
+  if (notify->action == svn_wc_notify_blame_revision)
+    (*count)++;
+}
+
+/* Create a repository NAME and commit a file "blamed" to it through
+   REVISIONS revisions of scattered insertions and deletions.  Every line
+   is unique, so the diffs are unambiguous.  If WHITESPACE is TRUE, also
+   change the amount of white space in some of the lines that are kept.
+
+   Set *REPOS_URL to the URL of the repository, *NLINES_P to the number of
+   lines in the last revision of the file and *REVS_P to the revision that
+   added each of them, ignoring changes in white space.  Use CTX for the
+   commits. */
+static svn_error_t *
+create_blame_history(const char **repos_url,
+                     svn_revnum_t **revs_p,
+                     int *nlines_p,
+                     const char *name,
+                     int revisions,
+                     svn_boolean_t whitespace,
+                     svn_client_ctx_t *ctx,
+                     const svn_test_opts_t *opts,
+                     apr_pool_t *pool)
+{
+  enum { MAX_LINES = 2000 };
+  svn_revnum_t *revs = apr_palloc(pool, MAX_LINES * sizeof(*revs));
+  int *ids = apr_palloc(pool, MAX_LINES * sizeof(*ids));
+  int *spaces = apr_palloc(pool, MAX_LINES * sizeof(*spaces));
+  svn_revnum_t *new_revs = apr_palloc(pool, MAX_LINES * sizeof(*revs));
+  int *new_ids = apr_palloc(pool, MAX_LINES * sizeof(*ids));
+  int *new_spaces = apr_palloc(pool, MAX_LINES * sizeof(*spaces));
+  int nlines = 0;
+  int next_id = 0;
+  apr_uint32_t seed = 0x1234;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_revnum_t rev;
+
+  SVN_ERR(svn_test__create_repos2(NULL, repos_url, NULL, name, opts,
+                                  pool, pool));
+
+  /* r1 adds the file, every later revision edits it. */
+  for (rev = 1; rev <= revisions; rev++)
+    {
+      svn_client__mtcc_t *mtcc;
+      svn_stringbuf_t *contents;
+      int new_nlines = 0;
+      int i = 0;
+      int j;
+
+      svn_pool_clear(iterpool);
+
+      do
+        {
+          int keep = svn_test_rand(&seed) % 40;
+          int drop = svn_test_rand(&seed) % 4;
+          int add = (rev == 1) ? 500 : svn_test_rand(&seed) % 5;
+
+          for (j = 0; j < keep && i < nlines; j++, i++)
+            {
+              new_revs[new_nlines] = revs[i];
+              new_ids[new_nlines] = ids[i];
+              new_spaces[new_nlines++]
+                = (whitespace && svn_test_rand(&seed) % 10 == 0)
+                  ? 3 - spaces[i] : spaces[i];
+            }
+          for (j = 0; j < drop && i < nlines; j++)
+            i++;
+          for (j = 0; j < add && new_nlines < MAX_LINES; j++)
+            {
+              new_revs[new_nlines] = rev;
+              new_ids[new_nlines] = next_id++;
+              new_spaces[new_nlines++] = 1;
+            }
+        }
+      while (i < nlines);
+
+      memcpy(revs, new_revs, new_nlines * sizeof(*revs));
+      memcpy(ids, new_ids, new_nlines * sizeof(*ids));
+      memcpy(spaces, new_spaces, new_nlines * sizeof(*spaces));
+      nlines = new_nlines;
+
+      contents = svn_stringbuf_create_empty(iterpool);
+      for (j = 0; j < nlines; j++)
+        svn_stringbuf_appendcstr(contents,
+                                 apr_psprintf(iterpool, "line%s%d\n",
+                                              spaces[j] == 1 ? " " : "  ",
+                                              ids[j]));
+
+      SVN_ERR(svn_client__mtcc_create(&mtcc, *repos_url, rev - 1, ctx,
+                                      iterpool, iterpool));
+      if (rev == 1)
+        SVN_ERR(svn_client__mtcc_add_add_file(
+                          "blamed",
+                          svn_stream_from_stringbuf(contents, iterpool),
+                          NULL, mtcc, iterpool));
+      else
+        SVN_ERR(svn_client__mtcc_add_update_file(
+                          "blamed",
+                          svn_stream_from_stringbuf(contents, iterpool),
+                          NULL, NULL, NULL, mtcc, iterpool));
+      SVN_ERR(svn_client__mtcc_commit(NULL, NULL, NULL, mtcc, iterpool));
+    }
+  svn_pool_destroy(iterpool);
+
+  *revs_p = revs;
+  *nlines_p = nlines;
+
+  return SVN_NO_ERROR;
+}
+
+/* Blame the HEAD revision of the file "blamed" in REPOS_URL from r1 with
+   DIFF_OPTIONS, using CTX.  Let the server calculate the blame if it can
+   and SERVER_BLAME is TRUE.  Check the revision of each line against
+   the NLINES revisions in EXPECTED, unless that is NULL.
+
+   Set *RESULT to the blamed lines, and *NOTIFICATIONS to the number of
+   blame revision notifications sent. */
+static svn_error_t *
+run_blame(svn_stringbuf_t **result,
+          int *notifications,
+          const char *repos_url,
+          const svn_diff_file_options_t *diff_options,
+          svn_boolean_t server_blame,
+          const svn_revnum_t *expected,
+          int nlines,
+          svn_client_ctx_t *ctx,
+          apr_pool_t *pool)
+{
+  svn_opt_revision_t peg_rev, start_rev, end_rev;
+  struct blame_history_baton baton;
+  svn_config_t *cfg;
+
+  SVN_ERR(svn_config_create2(&cfg, FALSE, FALSE, pool));
+  svn_config_set_bool(cfg, SVN_CONFIG_SECTION_MISCELLANY,
+                      SVN_CONFIG_OPTION_SERVER_BLAME, server_blame);
+  ctx->config = apr_hash_make(pool);
+  svn_hash_sets(ctx->config, SVN_CONFIG_CATEGORY_CONFIG, cfg);
+
+  *notifications = 0;
+  ctx->notify_func2 = count_blame_notifications;
+  ctx->notify_baton2 = notifications;
+
+  peg_rev.kind = svn_opt_revision_head;
+  start_rev.kind = svn_opt_revision_number;
+  start_rev.value.number = 1;
+  end_rev.kind = svn_opt_revision_head;
+
+  baton.expected = expected;
+  baton.nlines = nlines;
+  baton.seen = 0;
+  baton.result = svn_stringbuf_create_empty(pool);
+  SVN_ERR(svn_client_blame5(svn_path_url_add_component2(repos_url,
+                                                        "blamed", pool),
+                            &peg_rev, &start_rev, &end_rev, diff_options,
+                            FALSE, FALSE,
+                            blame_history_receiver, &baton, ctx, pool));
+  if (expected)
+    SVN_TEST_INT_ASSERT(baton.seen, nlines);
+
+  ctx->notify_func2 = NULL;
+  ctx->notify_baton2 = NULL;
+  *result = baton.result;
+
+  return SVN_NO_ERROR;
+}
+
+/* Check that blame attributes every line of a long synthetic history to
+   the revision that added it, whether the client or the server
+   calculates it. */
+static svn_error_t *
+test_blame_synthetic_history(const svn_test_opts_t *opts,
+                             apr_pool_t *pool)
+{
+  const char *repos_url;
+  svn_client_ctx_t *ctx;
+  svn_diff_file_options_t *diff_options = svn_diff_file_options_create(pool);
+  svn_revnum_t *revs;
+  int nlines;
+  svn_stringbuf_t *client_result, *server_result;
+  int notifications;
+
+  SVN_ERR(svn_client_create_context2(&ctx, NULL, pool));
+  SVN_ERR(svn_test__init_auth_baton(&ctx->auth_baton, pool));
+  SVN_ERR(create_blame_history(&repos_url, &revs, &nlines,
+                               "test-blame-synthetic-history", 60, FALSE,
+                               ctx, opts, pool));
+
+  /* The client calculates the blame, applying each diff to its chunks. */
+  SVN_ERR(run_blame(&client_result, &notifications, repos_url,
+                    diff_options, FALSE, revs, nlines, ctx, pool));
+  SVN_TEST_INT_ASSERT(notifications, 60);
+
+  SVN_ERR(run_blame(&server_result, &notifications, repos_url,
+                    diff_options, TRUE, revs, nlines, ctx, pool));
+  SVN_TEST_STRING_ASSERT(server_result->data, client_result->data);
+
+  return SVN_NO_ERROR;
+}
+
+/* Blame a file whose history splits it into many small chunks: every
+   revision replaces a scattered set of lines, so each diff applies
+   thousands of hunks to a blame that ends up with a chunk for almost
+   every line.  Applying them walked the whole chunk list per hunk before
+   the chunks were indexed by position.  Report the time taken if
+   verbose. */
+static svn_error_t *
+test_blame_many_chunks(const svn_test_opts_t *opts,
+                       apr_pool_t *pool)
+{
+  enum { NLINES = 20000, REVISIONS = 16 };
+  const char *repos_url;
+  svn_client_ctx_t *ctx;
+  svn_diff_file_options_t *diff_options = svn_diff_file_options_create(pool);
+  svn_revnum_t *revs = apr_palloc(pool, NLINES * sizeof(*revs));
+  int *ids = apr_palloc(pool, NLINES * sizeof(*ids));
+  int next_id = 0;
+  svn_stringbuf_t *result;
+  int notifications;
+  apr_time_t start;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_revnum_t rev;
+  int i;
+
+  SVN_ERR(svn_client_create_context2(&ctx, NULL, pool));
+  SVN_ERR(svn_test__init_auth_baton(&ctx->auth_baton, pool));
+  SVN_ERR(svn_test__create_repos2(NULL, &repos_url, NULL,
+                                  "test-blame-many-chunks", opts,
+                                  pool, pool));
+
+  for (rev = 1; rev <= REVISIONS; rev++)
+    {
+      svn_client__mtcc_t *mtcc;
+      svn_stringbuf_t *contents;
+
+      svn_pool_clear(iterpool);
+
+      /* r1 adds all lines, later revisions replace every 11th line or
+         so, at offsets that vary from revision to revision. */
+      contents = svn_stringbuf_create_ensure(NLINES * 12, iterpool);
+      for (i = 0; i < NLINES; i++)
+        {
+          if (rev == 1 || (i * 7 + rev * 13) % 11 == 0)
+            {
+              revs[i] = rev;
+              ids[i] = next_id++;
+            }
+          svn_stringbuf_appendcstr(contents,
+                                   apr_psprintf(iterpool, "line %d\n",
+                                                ids[i]));
+        }
+
+      SVN_ERR(svn_client__mtcc_create(&mtcc, repos_url, rev - 1, ctx,
+                                      iterpool, iterpool));
+      if (rev == 1)
+        SVN_ERR(svn_client__mtcc_add_add_file(
+                          "blamed",
+                          svn_stream_from_stringbuf(contents, iterpool),
+                          NULL, mtcc, iterpool));
+      else
+        SVN_ERR(svn_client__mtcc_add_update_file(
+                          "blamed",
+                          svn_stream_from_stringbuf(contents, iterpool),
+                          NULL, NULL, NULL, mtcc, iterpool));
+      SVN_ERR(svn_client__mtcc_commit(NULL, NULL, NULL, mtcc, iterpool));
+    }
+  svn_pool_destroy(iterpool);
+
+  start = apr_time_now();
+  SVN_ERR(run_blame(&result, &notifications, repos_url, diff_options,
+                    FALSE, revs, NLINES, ctx, pool));
+  SVN_TEST_INT_ASSERT(notifications, REVISIONS);
+
+  if (opts->verbose)
+    printf("blamed %d lines in %d revisions in %" APR_TIME_T_FMT " usec\n",
+           NLINES, REVISIONS, apr_time_now() - start);
+
+  return SVN_NO_ERROR;
+}
+
+/* Compare the blame calculated by the server with the one calculated by
+   the client, with and without ignoring changes in white space.  Over
+   file:// both are calculated by the client; run this with a svn:// or
+   http:// server URL to test the server side. */
+static svn_error_t *
+test_blame_server_client(const svn_test_opts_t *opts,
+                         apr_pool_t *pool)
+{
+  const char *repos_url;
+  svn_client_ctx_t *ctx;
+  svn_ra_session_t *ra_session;
+  svn_boolean_t has_server_blame;
+  svn_diff_file_options_t *diff_options = svn_diff_file_options_create(pool);
+  svn_revnum_t *revs;
+  int nlines;
+  svn_stringbuf_t *client_result, *server_result;
+  int client_notifications, server_notifications;
+
+  SVN_ERR(svn_client_create_context2(&ctx, NULL, pool));
+  SVN_ERR(svn_test__init_auth_baton(&ctx->auth_baton, pool));
+  SVN_ERR(create_blame_history(&repos_url, &revs, &nlines,
+                               "test-blame-server-client", 30, TRUE,
+                               ctx, opts, pool));
+
+  SVN_ERR(svn_client_open_ra_session2(&ra_session, repos_url, NULL, ctx,
+                                      pool, pool));
+  SVN_ERR(svn_ra_has_capability(ra_session, &has_server_blame,
+                                SVN_RA_CAPABILITY_FILE_BLAME, pool));
+
+  /* Changes in white space count. */
+  SVN_ERR(run_blame(&client_result, &client_notifications, repos_url,
+                    diff_options, FALSE, NULL, 0, ctx, pool));
+  SVN_ERR(run_blame(&server_result, &server_notifications, repos_url,
+                    diff_options, TRUE, NULL, 0, ctx, pool));
+  SVN_TEST_STRING_ASSERT(server_result->data, client_result->data);
+  SVN_TEST_INT_ASSERT(client_notifications, 30);
+  SVN_TEST_INT_ASSERT(server_notifications, has_server_blame ? 0 : 30);
+
+  /* The diff options reach the server. */
+  diff_options->ignore_space = svn_diff_file_ignore_space_change;
+  SVN_ERR(run_blame(&client_result, &client_notifications, repos_url,
+                    diff_options, FALSE, revs, nlines, ctx, pool));
+  SVN_ERR(run_blame(&server_result, &server_notifications, repos_url,
+                    diff_options, TRUE, revs, nlines, ctx, pool));
+  SVN_TEST_STRING_ASSERT(server_result->data, client_result->data);
+
+  return SVN_NO_ERROR;
+}
+
 /* ========================================================================== */
 
 
@@ -1436,6 +1815,12 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "test svn_client_copy7 with externals_to_pin"),
     SVN_TEST_OPTS_PASS(test_copy_pin_externals_select_subtree,
                        "pin externals on selected subtrees only"),
+    SVN_TEST_OPTS_PASS(test_blame_synthetic_history,
+                       "blame a long synthetic history"),
+    SVN_TEST_OPTS_PASS(test_blame_server_client,
+                       "compare server and client blame"),
+    SVN_TEST_OPTS_PASS(test_blame_many_chunks,
+                       "blame a file split into many chunks"),
     SVN_TEST_NULL
   };
 
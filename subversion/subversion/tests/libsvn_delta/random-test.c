@@ -36,6 +36,10 @@
 #include "svn_delta.h"
 #include "svn_pools.h"
 #include "svn_error.h"
+#include "svn_sorts.h"
+
+#include "private/svn_delta_private.h"
+#include "private/svn_string_private.h"
 
 #include "../../libsvn_delta/delta.h"
 #include "delta-window-test.h"
@@ -605,6 +609,231 @@ random_txdelta_to_svndiff_stream_test(apr_pool_t *pool)
   return err;
 }
 
+/* Return a string of LEN pseudo-random bytes drawn from SEED. */
+static svn_stringbuf_t *
+random_stringbuf(apr_size_t len, apr_uint32_t *seed, apr_pool_t *pool)
+{
+  svn_stringbuf_t *result = svn_stringbuf_create_ensure(len, pool);
+  apr_size_t i;
+
+  for (i = 0; i < len; ++i)
+    result->data[i] = (char)svn_test_rand(seed);
+
+  result->data[len] = '\0';
+  result->len = len;
+
+  return result;
+}
+
+/* Change every STEP-th byte in STR, starting at offset FIRST. */
+static void
+mutate_stringbuf(svn_stringbuf_t *str, apr_size_t first, apr_size_t step)
+{
+  apr_size_t i;
+
+  for (i = first; i < str->len; i += step)
+    str->data[i] ^= 0x5a;
+}
+
+/* Set *DIFF to the svndiff data that turns SOURCE into TARGET. */
+static svn_error_t *
+make_svndiff(svn_stringbuf_t **diff,
+             svn_stringbuf_t *source,
+             svn_stringbuf_t *target,
+             apr_pool_t *pool)
+{
+  svn_txdelta_stream_t *txstream;
+  svn_txdelta_window_handler_t handler;
+  void *handler_baton;
+
+  *diff = svn_stringbuf_create_empty(pool);
+  svn_txdelta2(&txstream,
+               svn_stream_from_stringbuf(source, pool),
+               svn_stream_from_stringbuf(target, pool),
+               FALSE, pool);
+  svn_txdelta_to_svndiff3(&handler, &handler_baton,
+                          svn_stream_from_stringbuf(*diff, pool), 0,
+                          SVN_DELTA_COMPRESSION_LEVEL_NONE, pool);
+
+  return svn_error_trace(svn_txdelta_send_txstream(txstream, handler,
+                                                   handler_baton, pool));
+}
+
+/* Verify that svn_cstring__match_length and
+   svn_cstring__reverse_match_length find the first mismatch between
+   buffers of up to 200 bytes regardless of where it is, how long the
+   buffers are and how they are aligned. */
+static svn_error_t *
+check_match_lengths(apr_uint32_t *seed, apr_pool_t *pool)
+{
+  enum { LEN = 200 };
+  svn_stringbuf_t *a = random_stringbuf(LEN + 1, seed, pool);
+  char b_buffer[LEN + 3];
+  char *b = b_buffer + 3;
+  apr_size_t mismatch, max_len;
+
+  /* B is misaligned relative to A. */
+  memcpy(b, a->data + 1, LEN);
+  for (mismatch = 0; mismatch <= LEN; ++mismatch)
+    {
+      if (mismatch < LEN)
+        b[mismatch] ^= 0x5a;
+
+      for (max_len = 0; max_len <= LEN; ++max_len)
+        {
+          apr_size_t expected = MIN(mismatch, max_len);
+
+          SVN_TEST_ASSERT(svn_cstring__match_length(a->data + 1, b, max_len)
+                          == expected);
+        }
+
+      if (mismatch < LEN)
+        b[mismatch] ^= 0x5a;
+    }
+
+  for (mismatch = 0; mismatch <= LEN; ++mismatch)
+    {
+      if (mismatch < LEN)
+        b[LEN - 1 - mismatch] ^= 0x5a;
+
+      for (max_len = 0; max_len <= LEN; ++max_len)
+        {
+          apr_size_t expected = MIN(mismatch, max_len);
+
+          SVN_TEST_ASSERT(svn_cstring__reverse_match_length(a->data + 1 + LEN,
+                                                            b + LEN, max_len)
+                          == expected);
+        }
+
+      if (mismatch < LEN)
+        b[LEN - 1 - mismatch] ^= 0x5a;
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* (Note: *LAST_SEED is an output parameter.) */
+static svn_error_t *
+do_simd_consistency_test(apr_pool_t *pool,
+                         apr_uint32_t *last_seed)
+{
+  apr_uint32_t seed;
+  apr_uint32_t maxlen;
+  apr_size_t bytes_range;
+  int iterations;
+  int dump_files;
+  int print_windows;
+  const char *random_bytes;
+  apr_pool_t *iterpool;
+  int i;
+
+  init_params(&seed, &maxlen, &iterations, &dump_files, &print_windows,
+              &random_bytes, &bytes_range, pool);
+  *last_seed = seed;
+
+  /* The match length helpers must be exact with either implementation. */
+  svn_txdelta__set_simd_enabled(TRUE);
+  SVN_ERR(check_match_lengths(&seed, pool));
+  svn_txdelta__set_simd_enabled(FALSE);
+  SVN_ERR(check_match_lengths(&seed, pool));
+
+  /* Any difference in the checksums or match lengths would give us a
+     different delta.  So, compare the svndiff output for a number of
+     inputs that exercise the 16 byte SIMD chunks and 64 byte checksum
+     blocks in various ways. */
+  iterpool = svn_pool_create(pool);
+  for (i = 0; i < 6; ++i)
+    {
+      apr_size_t len = 1 + svn_test_rand(&seed) % maxlen;
+      svn_stringbuf_t *source;
+      svn_stringbuf_t *target;
+      svn_stringbuf_t *simd_diff;
+      svn_stringbuf_t *scalar_diff;
+      apr_size_t k;
+
+      svn_pool_clear(iterpool);
+      switch (i)
+        {
+          case 0:
+            /* Random data with scattered single byte changes. */
+            source = random_stringbuf(len, &seed, iterpool);
+            target = svn_stringbuf_dup(source, iterpool);
+            for (k = 0; k < len; k += 1 + svn_test_rand(&seed) % 300)
+              target->data[k] ^= 0x5a;
+            break;
+
+          case 1:
+            /* Unrelated random data.  Nothing matches. */
+            source = random_stringbuf(len, &seed, iterpool);
+            target = random_stringbuf(len, &seed, iterpool);
+            break;
+
+          case 2:
+            /* Short repeated pattern, shifted and slightly changed. */
+            source = svn_stringbuf_create_ensure(len, iterpool);
+            for (k = 0; k < len; ++k)
+              svn_stringbuf_appendbyte(source, "0123456789abc"[k % 13]);
+            target = svn_stringbuf_create(source->data + 5, iterpool);
+            mutate_stringbuf(target, 1000, 4093);
+            break;
+
+          case 3:
+            /* All bits set.  Largest possible checksum sums. */
+            source = svn_stringbuf_create_ensure(len, iterpool);
+            memset(source->data, 0xff, len);
+            source->data[len] = '\0';
+            source->len = len;
+            target = svn_stringbuf_dup(source, iterpool);
+            mutate_stringbuf(target, 63, 64 * 17);
+            mutate_stringbuf(target, 64 * 7, 64 * 23);
+            break;
+
+          case 4:
+            /* Changes right before and after 64 byte block boundaries. */
+            source = random_stringbuf(len, &seed, iterpool);
+            target = svn_stringbuf_dup(source, iterpool);
+            mutate_stringbuf(target, 127, 64 * 5);
+            mutate_stringbuf(target, 128, 64 * 7);
+            break;
+
+          default:
+            /* Changes at 16 byte chunk boundaries, with inserted data. */
+            source = random_stringbuf(len, &seed, iterpool);
+            target = svn_stringbuf_dup(source, iterpool);
+            mutate_stringbuf(target, 15, 16 * 11);
+            mutate_stringbuf(target, 16, 16 * 13);
+            svn_stringbuf_insert(target, len / 2, "inserted", 8);
+            break;
+        }
+
+      svn_txdelta__set_simd_enabled(TRUE);
+      SVN_ERR(make_svndiff(&simd_diff, source, target, iterpool));
+      svn_txdelta__set_simd_enabled(FALSE);
+      SVN_ERR(make_svndiff(&scalar_diff, source, target, iterpool));
+
+      if (!svn_stringbuf_compare(simd_diff, scalar_diff))
+        return svn_error_createf(SVN_ERR_TEST_FAILED, NULL,
+                                 "SIMD and scalar delta differ for input %d",
+                                 i);
+    }
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_test_driver_t. */
+static svn_error_t *
+simd_consistency_test(apr_pool_t *pool)
+{
+  apr_uint32_t seed;
+  svn_error_t *err = do_simd_consistency_test(pool, &seed);
+
+  svn_txdelta__set_simd_enabled(TRUE);
+  if (err)
+    fprintf(stderr, "SEED: %lu\n", (unsigned long)seed);
+  return err;
+}
+
 /* Change to 1 to enable the unit test for the delta combiner's range index: */
 #if 0
 #include "range-index-test.h"
@@ -625,6 +854,8 @@ static struct svn_test_descriptor_t test_funcs[] =
                    "random combine delta test"),
     SVN_TEST_PASS2(random_txdelta_to_svndiff_stream_test,
                    "random txdelta to svndiff stream test"),
+    SVN_TEST_PASS2(simd_consistency_test,
+                   "SIMD and scalar deltas are identical"),
 #ifdef SVN_RANGE_INDEX_TEST_H
     SVN_TEST_PASS2(random_range_index_test,
                    "random range index test"),
@@ -3065,6 +3065,154 @@ three_way_double_add(apr_pool_t *pool)
   return SVN_NO_ERROR;
 }
 
+/* Fill *LINES with NUM_LINES random line numbers, and *CONTENTS with the
+   corresponding text.  Most lines are one of VAR_LINES frequent lines, the
+   rest are unique lines numbered from UNIQUE_BASE.  If ORIGINAL is not
+   NULL, take about half of the lines from the same position in it. */
+static void
+make_random_lines(int **lines,
+                  svn_string_t **contents,
+                  int num_lines,
+                  int var_lines,
+                  int unique_base,
+                  const int *original,
+                  int original_lines,
+                  apr_pool_t *pool)
+{
+  svn_stringbuf_t *buf = svn_stringbuf_create_empty(pool);
+  int i;
+
+  *lines = apr_palloc(pool, (num_lines + 1) * sizeof(**lines));
+  for (i = 0; i < num_lines; i++)
+    {
+      if (original && i < original_lines && range_rand(0, 1))
+        (*lines)[i] = original[i];
+      else if (range_rand(0, 3))
+        (*lines)[i] = range_rand(1, var_lines);
+      else
+        (*lines)[i] = unique_base + i;
+
+      svn_stringbuf_appendcstr(buf, apr_psprintf(pool, "line %d\n",
+                                                 (*lines)[i]));
+    }
+
+  *contents = svn_string_create_from_buf(buf, pool);
+}
+
+/* The lines of the sources of a diff, and the number of common lines
+   found in them. */
+struct common_lines_baton
+{
+  int *original;
+  int *modified;
+  apr_off_t count;
+};
+
+/* Implements svn_diff_output_fns_t.output_common, checking that the
+   common lines really are the same. */
+static svn_error_t *
+count_common_lines(void *baton,
+                   apr_off_t original_start,
+                   apr_off_t original_length,
+                   apr_off_t modified_start,
+                   apr_off_t modified_length,
+                   apr_off_t latest_start,
+                   apr_off_t latest_length)
+{
+  struct common_lines_baton *b = baton;
+  apr_off_t i;
+
+  SVN_TEST_ASSERT(original_length == modified_length);
+  for (i = 0; i < original_length; i++)
+    SVN_TEST_ASSERT(b->original[original_start + i]
+                    == b->modified[modified_start + i]);
+
+  b->count += original_length;
+
+  return SVN_NO_ERROR;
+}
+
+/* Check that the alternative diff algorithms find correct diffs: the
+   linear space one as small as the default algorithm, histogram diff one
+   that is no smaller. */
+static svn_error_t *
+test_diff_algorithms(apr_pool_t *pool)
+{
+  static const svn_diff_file_algorithm_t algorithms[] =
+    {
+      svn_diff_file_algorithm_myers,
+      svn_diff_file_algorithm_myers_linear,
+      svn_diff_file_algorithm_histogram
+    };
+  svn_diff_file_options_t *diff_opts = svn_diff_file_options_create(pool);
+  svn_diff_output_fns_t vtable = { 0 };
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  apr_array_header_t *args = apr_array_make(pool, 1, sizeof(const char *));
+  int i, j;
+
+  APR_ARRAY_PUSH(args, const char *) = "--diff-algorithm=histogram";
+  SVN_ERR(svn_diff_file_options_parse(diff_opts, args, pool));
+  SVN_TEST_ASSERT(diff_opts->algorithm == svn_diff_file_algorithm_histogram);
+
+  vtable.output_common = count_common_lines;
+  seed_val();
+
+  for (i = 0; i < 50; i++)
+    {
+      int num_original = range_rand(0, 2000);
+      int num_modified = range_rand(0, 2000);
+      int var_lines = range_rand(1, 30);
+      struct common_lines_baton b;
+      svn_string_t *original, *modified;
+      apr_off_t counts[3];
+
+      svn_pool_clear(iterpool);
+
+      make_random_lines(&b.original, &original, num_original, var_lines,
+                        100000, NULL, 0, iterpool);
+      make_random_lines(&b.modified, &modified, num_modified, var_lines,
+                        200000, b.original, num_original, iterpool);
+
+      for (j = 0; j < 3; j++)
+        {
+          svn_diff_t *diff;
+
+          diff_opts->algorithm = algorithms[j];
+          SVN_ERR(svn_diff_mem_string_diff(&diff, original, modified,
+                                           diff_opts, iterpool));
+          b.count = 0;
+          SVN_ERR(svn_diff_output2(diff, &b, &vtable, NULL, NULL));
+          counts[j] = b.count;
+        }
+
+      if (counts[1] != counts[0] || counts[2] > counts[0])
+        return svn_error_createf(SVN_ERR_TEST_FAILED, NULL,
+                                 "Diff algorithms found %" APR_OFF_T_FMT
+                                 ", %" APR_OFF_T_FMT " and %" APR_OFF_T_FMT
+                                 " common lines (seed %lu)",
+                                 counts[0], counts[1], counts[2],
+                                 (unsigned long)seed_val());
+    }
+  svn_pool_destroy(iterpool);
+
+  /* Non-overlapping changes merge with every algorithm. */
+  for (j = 0; j < 3; j++)
+    {
+      diff_opts->algorithm = algorithms[j];
+      SVN_ERR(three_way_merge("algorithm1", "algorithm2", "algorithm3",
+                              "a\n" "b\n" "c\n" "d\n" "e\n" "f\n" "g\n",
+                              "a\n" "B\n" "c\n" "d\n" "e\n" "f\n" "g\n",
+                              "a\n" "b\n" "c\n" "d\n" "x\n" "e\n" "F\n",
+                              "a\n" "B\n" "c\n" "d\n" "x\n" "e\n" "F\n",
+                              diff_opts,
+                              svn_diff_conflict_display_modified_latest,
+                              pool));
+    }
+
+  return SVN_NO_ERROR;
+}
+
+
 /* ========================================================================== */
 
 
@@ -3109,6 +3257,8 @@ static struct svn_test_descriptor_t test_funcs[] =
                    "2-way issue #3362 test v2"),
     SVN_TEST_XFAIL2(three_way_double_add,
                    "3-way merge, double add"),
+    SVN_TEST_PASS2(test_diff_algorithms,
+                   "compare the diff algorithms"),
     SVN_TEST_NULL
   };
 
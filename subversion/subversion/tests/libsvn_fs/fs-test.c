@@ -7441,6 +7441,118 @@ test_closest_copy_file_replaced_with_dir(const svn_test_opts_t *opts,
   return SVN_NO_ERROR;
 }
 
+static svn_error_t *
+test_file_contents_location(const svn_test_opts_t *opts,
+                            apr_pool_t *pool)
+{
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  svn_fs_root_t *rev_root;
+  svn_revnum_t youngest_rev;
+  apr_file_t *file;
+  apr_off_t offset;
+  svn_filesize_t length;
+  svn_stringbuf_t *contents;
+  svn_stringbuf_t *expected;
+  apr_size_t len;
+  const char *fs_path = "test-file-contents-location";
+  const char *conf = "[deltification]\n"
+                     "plain-fulltext-size = 16\n";
+  int i;
+
+  /* Only FSFS can store file contents verbatim. */
+  if (strcmp(opts->fs_type, SVN_FS_TYPE_FSFS) != 0)
+    return svn_error_create(SVN_ERR_TEST_SKIPPED, NULL,
+                            "this will test FSFS repositories only");
+
+  /* Store fulltexts of 16kB and more as PLAIN. */
+  SVN_ERR(svn_test__create_fs(&fs, fs_path, opts, pool));
+  SVN_ERR(svn_io_file_open(&file,
+                           svn_dirent_join(fs_path, "fsfs.conf", pool),
+                           APR_WRITE | APR_APPEND, APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_io_file_write_full(file, conf, strlen(conf), NULL, pool));
+  SVN_ERR(svn_io_file_close(file, pool));
+  SVN_ERR(svn_fs_open2(&fs, fs_path, NULL, pool, pool));
+
+  /* Some reasonably large, poorly compressible contents. */
+  expected = svn_stringbuf_create_empty(pool);
+  for (i = 0; i < 10000; i++)
+    svn_stringbuf_appendcstr(expected, apr_psprintf(pool, "%d\n", i * i));
+
+  SVN_ERR(svn_fs_begin_txn2(&txn, fs, 0, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_fs_make_file(txn_root, "/foo", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "/foo", expected->data,
+                                      pool));
+  SVN_ERR(svn_fs_make_file(txn_root, "/small", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "/small", "small\n", pool));
+
+  /* Transaction contents are never reported. */
+  SVN_ERR(svn_fs_file_contents_location(&file, &offset, &length, txn_root,
+                                        "/foo", pool, pool));
+  SVN_TEST_ASSERT(file == NULL);
+
+  SVN_ERR(test_commit_txn(&youngest_rev, txn, NULL, pool));
+  SVN_TEST_INT_ASSERT(youngest_rev, 1);
+
+  /* The large file has been stored PLAIN.  The bytes found there must
+     match the file contents exactly. */
+  SVN_ERR(svn_fs_revision_root(&rev_root, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_file_contents_location(&file, &offset, &length, rev_root,
+                                        "/foo", pool, pool));
+  SVN_TEST_ASSERT(file != NULL);
+  SVN_TEST_ASSERT(length == expected->len);
+
+  len = (apr_size_t)length;
+  contents = svn_stringbuf_create_ensure(len, pool);
+  SVN_ERR(svn_io_file_seek(file, APR_SET, &offset, pool));
+  SVN_ERR(svn_io_file_read_full2(file, contents->data, len, &len,
+                                 NULL, pool));
+  contents->len = len;
+  contents->data[len] = '\0';
+  SVN_ERR(svn_io_file_close(file, pool));
+  SVN_TEST_STRING_ASSERT(contents->data, expected->data);
+
+  /* Reading it the usual way still works. */
+  SVN_ERR(svn_test__get_file_contents(rev_root, "/foo", &contents, pool));
+  SVN_TEST_STRING_ASSERT(contents->data, expected->data);
+
+  /* Small files are still stored as self-deltas. */
+  SVN_ERR(svn_fs_file_contents_location(&file, &offset, &length, rev_root,
+                                        "/small", pool, pool));
+  SVN_TEST_ASSERT(file == NULL);
+  SVN_ERR(svn_test__get_file_contents(rev_root, "/small", &contents, pool));
+  SVN_TEST_STRING_ASSERT(contents->data, "small\n");
+
+  /* Changes get deltified against the PLAIN rep. */
+  svn_stringbuf_appendcstr(expected, "more\n");
+  SVN_ERR(svn_fs_begin_txn2(&txn, fs, youngest_rev, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "/foo", expected->data,
+                                      pool));
+  SVN_ERR(test_commit_txn(&youngest_rev, txn, NULL, pool));
+
+  SVN_ERR(svn_fs_revision_root(&rev_root, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_file_contents_location(&file, &offset, &length, rev_root,
+                                        "/foo", pool, pool));
+  SVN_TEST_ASSERT(file == NULL);
+  SVN_ERR(svn_test__get_file_contents(rev_root, "/foo", &contents, pool));
+  SVN_TEST_STRING_ASSERT(contents->data, expected->data);
+
+  /* Unreasonable thresholds get rejected. */
+  conf = "plain-fulltext-size = 1000000000\n";
+  SVN_ERR(svn_io_file_open(&file,
+                           svn_dirent_join(fs_path, "fsfs.conf", pool),
+                           APR_WRITE | APR_APPEND, APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_io_file_write_full(file, conf, strlen(conf), NULL, pool));
+  SVN_ERR(svn_io_file_close(file, pool));
+  SVN_TEST_ASSERT_ERROR(svn_fs_open2(&fs, fs_path, NULL, pool, pool),
+                        SVN_ERR_BAD_CONFIG_VALUE);
+
+  return SVN_NO_ERROR;
+}
+
 /* ------------------------------------------------------------------------ */
 
 /* The test table.  */
@@ -7587,6 +7699,8 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "test issue SVN-4677 regression"),
     SVN_TEST_OPTS_PASS(test_closest_copy_file_replaced_with_dir,
                        "svn_fs_closest_copy after replacing file with dir"),
+    SVN_TEST_OPTS_PASS(test_file_contents_location,
+                       "test svn_fs_file_contents_location"),
     SVN_TEST_NULL
   };
 
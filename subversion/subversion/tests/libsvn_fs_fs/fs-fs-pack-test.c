@@ -36,6 +36,7 @@
 #include "svn_pools.h"
 #include "svn_props.h"
 #include "svn_fs.h"
+#include "private/svn_io_private.h"
 #include "private/svn_string_private.h"
 
 #include "../svn_test_fs.h"
@@ -190,7 +191,7 @@ create_packed_filesystem(const char *dir,
   /* Now pack the FS */
   pnb.expected_shard = 0;
   pnb.expected_action = svn_fs_pack_notify_start;
-  return svn_fs_pack(dir, pack_notify, &pnb, NULL, NULL, pool);
+  return svn_fs_pack2(dir, NULL, pack_notify, &pnb, NULL, NULL, pool);
 }
 
 /* Create a packed FSFS filesystem for revprop tests at REPO_NAME with
@@ -225,7 +226,7 @@ prepare_revprop_repo(svn_fs_t **fs,
   svn_pool_destroy(subpool);
 
   /* Pack the repository. */
-  SVN_ERR(svn_fs_pack(repo_name, NULL, NULL, NULL, NULL, pool));
+  SVN_ERR(svn_fs_pack2(repo_name, NULL, NULL, NULL, NULL, NULL, pool));
 
   return SVN_NO_ERROR;
 }
@@ -662,7 +663,7 @@ recover_fully_packed(const svn_test_opts_t *opts,
   SVN_ERR(svn_fs_commit_txn(&conflict, &after_rev, txn, subpool));
   SVN_TEST_ASSERT(SVN_IS_VALID_REVNUM(after_rev));
   svn_pool_destroy(subpool);
-  SVN_ERR(svn_fs_pack(REPO_NAME, NULL, NULL, NULL, NULL, pool));
+  SVN_ERR(svn_fs_pack2(REPO_NAME, NULL, NULL, NULL, NULL, NULL, pool));
   SVN_ERR(svn_fs_recover(REPO_NAME, NULL, NULL, pool));
 
   /* Now, delete the youngest revprop file, and recover again.  This
@@ -1001,7 +1002,7 @@ upgrade_txns_to_log_addressing(const svn_test_opts_t *opts,
   /* Pack repo to verify that old and new shard get packed according to
      their respective addressing mode */
 
-  SVN_ERR(svn_fs_pack(repo_name, NULL, NULL, NULL, NULL, pool));
+  SVN_ERR(svn_fs_pack2(repo_name, NULL, NULL, NULL, NULL, NULL, pool));
 
   /* verify that our changes got in */
 
@@ -1811,6 +1812,68 @@ pack_with_limited_memory(const svn_test_opts_t *opts,
 #undef MAX_REV
 #undef SHARD_SIZE
 
+/* ------------------------------------------------------------------------ */
+/* Pack a filesystem with several worker threads and make sure that
+   notifications still arrive in shard order and the result is sound. */
+#define REPO_NAME "test-repo-pack-concurrently"
+#define SHARD_SIZE 7
+#define MAX_REV 53
+static svn_error_t *
+pack_concurrently(const svn_test_opts_t *opts,
+                  apr_pool_t *pool)
+{
+  struct pack_notify_baton pnb;
+  apr_hash_t *fs_config;
+  svn_fs_t *fs;
+  svn_revnum_t i;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+
+  SVN_ERR(create_non_packed_filesystem(REPO_NAME, opts, MAX_REV, SHARD_SIZE,
+                                       pool));
+
+  /* Pack it using more workers than there are CPUs in most test setups. */
+  fs_config = apr_hash_make(pool);
+  svn_hash_sets(fs_config, SVN_FS_CONFIG_FSFS_JOBS, "4");
+
+  pnb.expected_shard = 0;
+  pnb.expected_action = svn_fs_pack_notify_start;
+  SVN_ERR(svn_fs_pack2(REPO_NAME, fs_config, pack_notify, &pnb, NULL, NULL,
+                       pool));
+  SVN_TEST_ASSERT(pnb.expected_shard == (MAX_REV + 1) / SHARD_SIZE);
+  SVN_TEST_ASSERT(pnb.expected_action == svn_fs_pack_notify_start);
+
+  /* All revisions must still read back correctly. */
+  SVN_ERR(svn_fs_open2(&fs, REPO_NAME, NULL, pool, pool));
+  for (i = 1; i <= MAX_REV; i++)
+    {
+      svn_fs_root_t *rev_root;
+      svn_stream_t *rstream;
+      svn_stringbuf_t *rstring;
+      const char *expected;
+
+      svn_pool_clear(iterpool);
+
+      SVN_ERR(svn_fs_revision_root(&rev_root, fs, i, iterpool));
+      SVN_ERR(svn_fs_file_contents(&rstream, rev_root, "iota", iterpool));
+      SVN_ERR(svn_test__stream_to_string(&rstring, rstream, iterpool));
+
+      expected = (i == 1) ? "This is the file 'iota'.\n"
+                          : get_rev_contents(i, iterpool);
+      if (strcmp(rstring->data, expected))
+        return svn_error_createf(SVN_ERR_FS_GENERAL, NULL,
+                                 "Bad data in revision %ld.", i);
+    }
+
+  SVN_ERR(svn_fs_verify(REPO_NAME, NULL, 0, MAX_REV, NULL, NULL, NULL, NULL,
+                        pool));
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+#undef REPO_NAME
+#undef MAX_REV
+#undef SHARD_SIZE
+
 /* ------------------------------------------------------------------------ */
 
 #define REPO_NAME "test-repo-large_delta_against_plain"
@@ -1887,6 +1950,190 @@ large_delta_against_plain(const svn_test_opts_t *opts,
 
 #undef REPO_NAME
 
+/* ------------------------------------------------------------------------ */
+
+#define REPO_NAME "test-repo-read_delta_chains_prefetched"
+#define MAX_REV 40
+#define LINE_COUNT 200
+
+/* Return the contents of "foo" in revision REV as committed by
+ * read_delta_chains_prefetched.  Line N gets modified in revision N. */
+static const char *
+get_chain_contents(svn_revnum_t rev,
+                   apr_pool_t *pool)
+{
+  svn_stringbuf_t *result = svn_stringbuf_create_empty(pool);
+  int i;
+
+  for (i = 0; i < LINE_COUNT; ++i)
+    svn_stringbuf_appendcstr(result,
+                             apr_psprintf(pool, "line %d, changed in r%ld\n",
+                                          i, (i >= 2 && i <= rev) ? i : 1));
+
+  return result->data;
+}
+
+/* Reading long delta chains from disk must give the same results with and
+ * without prefetching. */
+static svn_error_t *
+read_delta_chains_prefetched(const svn_test_opts_t *opts,
+                             apr_pool_t *pool)
+{
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *root;
+  svn_revnum_t rev;
+  int prefetch_threads;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+
+  if (strcmp(opts->fs_type, "fsfs") != 0)
+    return svn_error_create(SVN_ERR_TEST_SKIPPED, NULL, NULL);
+
+  SVN_ERR(svn_test__create_fs(&fs, REPO_NAME, opts, pool));
+
+  /* Every revision modifies the same file, building up delta chains. */
+  for (rev = 0; rev < MAX_REV; )
+    {
+      svn_pool_clear(iterpool);
+
+      SVN_ERR(svn_fs_begin_txn(&txn, fs, rev, iterpool));
+      SVN_ERR(svn_fs_txn_root(&root, txn, iterpool));
+      if (rev == 0)
+        SVN_ERR(svn_fs_make_file(root, "foo", iterpool));
+      SVN_ERR(svn_test__set_file_contents(root, "foo",
+                                          get_chain_contents(rev + 1,
+                                                             iterpool),
+                                          iterpool));
+      SVN_ERR(svn_fs_commit_txn(NULL, &rev, txn, iterpool));
+    }
+
+  /* Read all of them with cold caches, once without and once with
+   * prefetching. */
+  for (prefetch_threads = 0; prefetch_threads <= 4; prefetch_threads += 4)
+    {
+      apr_hash_t *fs_config = apr_hash_make(pool);
+      svn_hash_sets(fs_config, SVN_FS_CONFIG_FSFS_CACHE_NS,
+                    svn_uuid_generate(pool));
+      SVN_ERR(svn_fs_open2(&fs, REPO_NAME, fs_config, pool, pool));
+      ((fs_fs_data_t *)fs->fsap_data)->prefetch_threads = prefetch_threads;
+
+      for (rev = MAX_REV; rev > 0; --rev)
+        {
+          svn_stringbuf_t *contents;
+
+          svn_pool_clear(iterpool);
+          SVN_ERR(svn_fs_revision_root(&root, fs, rev, iterpool));
+          SVN_ERR(svn_test__get_file_contents(root, "foo", &contents,
+                                              iterpool));
+          SVN_TEST_STRING_ASSERT(contents->data,
+                                 get_chain_contents(rev, iterpool));
+        }
+    }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+#undef REPO_NAME
+#undef MAX_REV
+#undef LINE_COUNT
+
+/* ------------------------------------------------------------------------ */
+/* Commit, pack and hotcopy with fsyncs enabled.  All of them collect the
+   files to flush in a batch, some of which have been made read-only at
+   that point.  Run this as a non-root user to catch attempts to open
+   them for writing. */
+#define REPO_NAME "test-repo-batch-fsync"
+#define SHARD_SIZE 4
+#define MAX_REV 10
+static svn_error_t *
+batch_fsync_read_only(const svn_test_opts_t *opts,
+                      apr_pool_t *pool)
+{
+  const char *copy_name = REPO_NAME "-copy";
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  const char *conflict;
+  svn_revnum_t rev;
+  svn_string_t *value;
+  const char *path;
+  apr_file_t *file;
+  apr_finfo_t finfo;
+  svn_boolean_t read_only;
+
+  /* The repository gets created without SVN_FS_CONFIG_NO_FLUSH_TO_DISK,
+     so every commit uses the batch. */
+  SVN_ERR(create_non_packed_filesystem(REPO_NAME, opts, MAX_REV, SHARD_SIZE,
+                                       pool));
+  SVN_ERR(svn_fs_open2(&fs, REPO_NAME, NULL, pool, pool));
+
+  /* The rev file has been scheduled for fsync after being made read-only
+     (except on Windows, where we don't copy permissions). */
+  SVN_ERR(svn_io_stat(&finfo, svn_fs_fs__path_rev_absolute(fs, MAX_REV,
+                                                           pool),
+                      APR_FINFO_PROT | APR_FINFO_OWNER, pool));
+  SVN_ERR(svn_io__is_finfo_read_only(&read_only, &finfo, pool));
+#ifndef WIN32
+  SVN_TEST_ASSERT(read_only);
+#endif
+
+  /* A failed commit may leave a read-only revprops file behind.  The next
+     commit must replace it. */
+  path = svn_fs_fs__path_revprops(fs, MAX_REV + 1, pool);
+  SVN_ERR(svn_io_file_open(&file, path, APR_WRITE | APR_CREATE,
+                           APR_OS_DEFAULT, pool));
+  SVN_ERR(svn_io_file_write_full(file, "junk", 4, NULL, pool));
+  SVN_ERR(svn_io_file_close(file, pool));
+  SVN_ERR(svn_io_set_file_read_only(path, FALSE, pool));
+
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, MAX_REV, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "iota",
+                                      get_rev_contents(MAX_REV + 1, pool),
+                                      pool));
+  SVN_ERR(svn_fs_change_txn_prop(txn, SVN_PROP_REVISION_LOG,
+                                 svn_string_create(R1_LOG_MSG, pool),
+                                 pool));
+  SVN_ERR(svn_fs_commit_txn(&conflict, &rev, txn, pool));
+  SVN_TEST_INT_ASSERT(rev, MAX_REV + 1);
+
+  SVN_ERR(svn_fs_revision_prop2(&value, fs, rev, SVN_PROP_REVISION_LOG,
+                                FALSE, pool, pool));
+  SVN_TEST_STRING_ASSERT(value->data, R1_LOG_MSG);
+
+  /* Pack the full shards, flushing the pack files in a batch. */
+  SVN_ERR(svn_fs_pack2(REPO_NAME, NULL, NULL, NULL, NULL, NULL, pool));
+
+  /* Hotcopy, then commit and copy the new revision incrementally.  Both
+     schedule the read-only copies of the rev files. */
+  SVN_ERR(svn_io_remove_dir2(copy_name, TRUE, NULL, NULL, pool));
+  SVN_ERR(svn_fs_hotcopy3(REPO_NAME, copy_name, FALSE, FALSE,
+                          NULL, NULL, NULL, NULL, pool));
+
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "iota",
+                                      get_rev_contents(rev + 1, pool),
+                                      pool));
+  SVN_ERR(svn_fs_commit_txn(&conflict, &rev, txn, pool));
+  SVN_TEST_ASSERT(SVN_IS_VALID_REVNUM(rev));
+
+  SVN_ERR(svn_fs_hotcopy3(REPO_NAME, copy_name, FALSE, TRUE,
+                          NULL, NULL, NULL, NULL, pool));
+
+  SVN_ERR(svn_fs_verify(REPO_NAME, NULL, 0, rev, NULL, NULL, NULL, NULL,
+                        pool));
+  SVN_ERR(svn_fs_verify(copy_name, NULL, 0, rev, NULL, NULL, NULL, NULL,
+                        pool));
+
+  return SVN_NO_ERROR;
+}
+#undef REPO_NAME
+#undef SHARD_SIZE
+#undef MAX_REV
+
 
 
 /* The test table.  */
@@ -1940,8 +2187,14 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "compare empty PLAIN and non-existent reps"),
     SVN_TEST_OPTS_PASS(pack_with_limited_memory,
                        "pack with limited memory for metadata"),
+    SVN_TEST_OPTS_PASS(pack_concurrently,
+                       "pack shards using multiple threads"),
     SVN_TEST_OPTS_PASS(large_delta_against_plain,
                        "large deltas against PLAIN, issue #4658"),
+    SVN_TEST_OPTS_PASS(read_delta_chains_prefetched,
+                       "read delta chains with prefetching"),
+    SVN_TEST_OPTS_PASS(batch_fsync_read_only,
+                       "commit, pack and hotcopy with batched fsyncs"),
     SVN_TEST_NULL
   };
 
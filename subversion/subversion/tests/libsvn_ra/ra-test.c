@@ -1876,6 +1876,109 @@ test_get_deleted_rev_errors(const svn_test_opts_t *opts,
   return SVN_NO_ERROR;
 }
 
+/* Commit CONTENTS as the new text of the file PATH, adding it if ADD is
+   set. */
+static svn_error_t *
+commit_file_text(svn_ra_session_t *session,
+                 const char *path,
+                 const char *contents,
+                 svn_boolean_t add,
+                 apr_pool_t *pool)
+{
+  const svn_delta_editor_t *editor;
+  void *edit_baton;
+  void *root_baton, *file_baton;
+  svn_txdelta_window_handler_t handler;
+  void *handler_baton;
+
+  SVN_ERR(svn_ra_get_commit_editor3(session, &editor, &edit_baton,
+                                    apr_hash_make(pool), NULL, NULL,
+                                    NULL, TRUE, pool));
+  SVN_ERR(editor->open_root(edit_baton, SVN_INVALID_REVNUM,
+                            pool, &root_baton));
+  if (add)
+    SVN_ERR(editor->add_file(path, root_baton, NULL, SVN_INVALID_REVNUM,
+                             pool, &file_baton));
+  else
+    SVN_ERR(editor->open_file(path, root_baton, SVN_INVALID_REVNUM, pool,
+                              &file_baton));
+  SVN_ERR(editor->apply_textdelta(file_baton, NULL, pool, &handler,
+                                  &handler_baton));
+  SVN_ERR(svn_txdelta_send_string(svn_string_create(contents, pool),
+                                  handler, handler_baton, pool));
+  SVN_ERR(editor->close_file(file_baton, NULL, pool));
+  SVN_ERR(editor->close_directory(root_baton, pool));
+  SVN_ERR(editor->close_edit(edit_baton, pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_file_blame_receiver_t.  Append the revision of each
+   line to the svn_stringbuf_t BATON, e.g. "1 2 2 ". */
+static svn_error_t *
+blame_lines_receiver(void *baton,
+                     apr_int64_t line_start,
+                     apr_int64_t line_count,
+                     svn_revnum_t revision,
+                     apr_hash_t *rev_props,
+                     apr_pool_t *pool)
+{
+  svn_stringbuf_t *lines = baton;
+  apr_int64_t i;
+
+  for (i = 0; i < line_count; i++)
+    {
+      if (SVN_IS_VALID_REVNUM(revision))
+        svn_stringbuf_appendcstr(lines, apr_psprintf(pool, "%ld ",
+                                                     revision));
+      else
+        svn_stringbuf_appendcstr(lines, "- ");
+    }
+
+  return SVN_NO_ERROR;
+}
+
+/* svn_ra_get_file_blame() over ra_local, which does not advertise
+   SVN_RA_CAPABILITY_FILE_BLAME. */
+static svn_error_t *
+get_file_blame_local(const svn_test_opts_t *opts,
+                     apr_pool_t *pool)
+{
+  svn_ra_session_t *session;
+  svn_boolean_t has_blame;
+  svn_stringbuf_t *lines;
+
+  if (opts->repos_url && strncmp(opts->repos_url, "file://", 7) != 0)
+    return svn_error_create(SVN_ERR_TEST_SKIPPED, NULL,
+                            "this test tests ra_local only");
+
+  SVN_ERR(make_and_open_repos(&session, "get_file_blame_local", opts, pool));
+
+  SVN_ERR(commit_file_text(session, "f", "one\ntwo\nthree\n", TRUE,
+                           pool)); /* r1 */
+  SVN_ERR(commit_file_text(session, "f", "one\nTWO\nthree\nfour\n",
+                           FALSE, pool)); /* r2 */
+  SVN_ERR(commit_file_text(session, "f", "zero\none\nTWO\nthree\nfour\n",
+                           FALSE, pool)); /* r3 */
+
+  SVN_ERR(svn_ra_has_capability(session, &has_blame,
+                                SVN_RA_CAPABILITY_FILE_BLAME, pool));
+  SVN_TEST_ASSERT(!has_blame);
+
+  lines = svn_stringbuf_create_empty(pool);
+  SVN_ERR(svn_ra_get_file_blame(session, "f", 1, 3, NULL,
+                                blame_lines_receiver, lines, pool));
+  SVN_TEST_STRING_ASSERT(lines->data, "3 1 2 1 2 ");
+
+  /* Lines from before the start revision are not attributed. */
+  lines = svn_stringbuf_create_empty(pool);
+  SVN_ERR(svn_ra_get_file_blame(session, "f", 3, 3, NULL,
+                                blame_lines_receiver, lines, pool));
+  SVN_TEST_STRING_ASSERT(lines->data, "3 - - - - ");
+
+  return SVN_NO_ERROR;
+}
+
 
 /* The test table.  */
 
@@ -1916,6 +2019,8 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "test get-deleted-rev no delete"),
     SVN_TEST_OPTS_PASS(test_get_deleted_rev_errors,
                        "test get-deleted-rev errors"),
+    SVN_TEST_OPTS_PASS(get_file_blame_local,
+                       "test svn_ra_get_file_blame over ra_local"),
     SVN_TEST_NULL
   };
 
@@ -38,7 +38,7 @@
 /* Test dumping in the presence of the property PROP_NAME:PROP_VAL.
  * Return the dumped data in *DUMP_DATA_P (if DUMP_DATA_P is not null).
  * REPOS is an empty repository.
- * See svn_repos_dump_fs3() for START_REV, END_REV, NOTIFY_FUNC, NOTIFY_BATON.
+ * See svn_repos_dump_fs5() for START_REV, END_REV, NOTIFY_FUNC, NOTIFY_BATON.
  */
 static svn_error_t *
 test_dump_bad_props(svn_stringbuf_t **dump_data_p,
@@ -76,8 +76,8 @@ test_dump_bad_props(svn_stringbuf_t **dump_data_p,
   SVN_TEST_ASSERT(SVN_IS_VALID_REVNUM(youngest_rev));
 
   /* Test that a dump completes without error. */
-  SVN_ERR(svn_repos_dump_fs4(repos, stream, start_rev, end_rev,
-                             FALSE, FALSE, TRUE, TRUE,
+  SVN_ERR(svn_repos_dump_fs5(repos, stream, start_rev, end_rev,
+                             FALSE, FALSE, TRUE, TRUE, 1,
                              notify_func, notify_baton,
                              NULL, NULL, NULL, NULL,
                              pool));
@@ -120,7 +120,7 @@ test_load_bad_props(svn_stringbuf_t *dump_data,
   svn_revnum_t youngest_rev;
   svn_string_t *loaded_prop_val;
 
-  SVN_ERR(svn_repos_load_fs6(repos, stream,
+  SVN_ERR(svn_repos_load_fs7(repos, stream,
                              SVN_INVALID_REVNUM, SVN_INVALID_REVNUM,
                              svn_repos_load_uuid_default,
                              parent_fspath,
@@ -128,6 +128,7 @@ test_load_bad_props(svn_stringbuf_t *dump_data,
                              validate_props,
                              FALSE /*ignore_dates*/,
                              FALSE /*normalize_props*/,
+                             1 /*jobs*/,
                              notify_func, notify_baton,
                              NULL, NULL, /*cancellation*/
                              pool));
@@ -273,6 +274,206 @@ test_load_r0_mergeinfo(const svn_test_opts_t *opts,
   return SVN_NO_ERROR;
 }
 
+/* Dump revisions START_REV to END_REV of REPOS with the given options,
+ * once sequentially and once using JOBS threads, and check that both
+ * dumps are identical.
+ */
+static svn_error_t *
+check_dump_jobs(svn_repos_t *repos,
+                svn_revnum_t start_rev,
+                svn_revnum_t end_rev,
+                svn_boolean_t incremental,
+                svn_boolean_t use_deltas,
+                int jobs,
+                apr_pool_t *pool)
+{
+  svn_stringbuf_t *expected = svn_stringbuf_create_empty(pool);
+  svn_stringbuf_t *actual = svn_stringbuf_create_empty(pool);
+
+  SVN_ERR(svn_repos_dump_fs5(repos, svn_stream_from_stringbuf(expected, pool),
+                             start_rev, end_rev, incremental, use_deltas,
+                             TRUE, TRUE, 1, NULL, NULL, NULL, NULL,
+                             NULL, NULL, pool));
+  SVN_ERR(svn_repos_dump_fs5(repos, svn_stream_from_stringbuf(actual, pool),
+                             start_rev, end_rev, incremental, use_deltas,
+                             TRUE, TRUE, jobs, NULL, NULL, NULL, NULL,
+                             NULL, NULL, pool));
+
+  SVN_TEST_ASSERT(expected->len > 0);
+  SVN_TEST_ASSERT(svn_stringbuf_compare(expected, actual));
+
+  return SVN_NO_ERROR;
+}
+
+/* Create a repository named NAME with 20 revisions of history and
+ * return it in *REPOS_P.
+ */
+static svn_error_t *
+create_history_repos(svn_repos_t **repos_p,
+                     const char *name,
+                     const svn_test_opts_t *opts,
+                     apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  svn_fs_root_t *rev_root;
+  svn_revnum_t youngest_rev = 0;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  int i;
+
+  SVN_ERR(svn_test__create_repos(&repos, name, opts, pool));
+  fs = svn_repos_fs(repos);
+
+  /* r1: the greek tree; r2 .. r20: modify some of its files and
+     properties, copy a directory from an older revision in r10 and
+     delete one in r15. */
+  SVN_ERR(svn_fs_begin_txn2(&txn, fs, youngest_rev, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__create_greek_tree(txn_root, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  for (i = 2; i <= 20; i++)
+    {
+      svn_pool_clear(iterpool);
+
+      SVN_ERR(svn_fs_begin_txn2(&txn, fs, youngest_rev, 0, iterpool));
+      SVN_ERR(svn_fs_txn_root(&txn_root, txn, iterpool));
+      SVN_ERR(svn_test__set_file_contents(txn_root,
+                                          i % 2 ? "iota" : "A/mu",
+                                          apr_psprintf(iterpool, "r%d\n", i),
+                                          iterpool));
+      if (i % 4 == 0)
+        SVN_ERR(svn_fs_change_node_prop(txn_root, "A/D", "prop",
+                                        svn_string_createf(iterpool,
+                                                           "r%d", i),
+                                        iterpool));
+      if (i == 10)
+        {
+          SVN_ERR(svn_fs_revision_root(&rev_root, fs, 2, iterpool));
+          SVN_ERR(svn_fs_copy(rev_root, "A/B", txn_root, "A/B2", iterpool));
+        }
+      if (i == 15)
+        SVN_ERR(svn_fs_delete(txn_root, "A/C", iterpool));
+      SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn,
+                                      iterpool));
+    }
+  svn_pool_destroy(iterpool);
+  SVN_TEST_ASSERT(youngest_rev == 20);
+
+  *repos_p = repos;
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_dump_jobs(const svn_test_opts_t *opts,
+               apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_revnum_t youngest_rev = 20;
+
+  SVN_ERR(create_history_repos(&repos, "test-repo-dump-jobs", opts, pool));
+
+  /* Full dumps, with and without deltas. */
+  SVN_ERR(check_dump_jobs(repos, 0, youngest_rev, FALSE, FALSE, 4, pool));
+  SVN_ERR(check_dump_jobs(repos, 0, youngest_rev, FALSE, TRUE, 4, pool));
+
+  /* Partial ranges, starting with a full tree or incrementally. */
+  SVN_ERR(check_dump_jobs(repos, 5, 13, FALSE, TRUE, 3, pool));
+  SVN_ERR(check_dump_jobs(repos, 5, 13, TRUE, FALSE, 3, pool));
+
+  /* More workers than revisions. */
+  SVN_ERR(check_dump_jobs(repos, 18, 20, TRUE, TRUE, 8, pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Load DUMP_DATA into a new repository named NAME using JOBS and check
+ * that dumping that repository yields DUMP_DATA again.
+ */
+static svn_error_t *
+check_load_jobs(const char *name,
+                svn_stringbuf_t *dump_data,
+                svn_boolean_t use_deltas,
+                int jobs,
+                const svn_test_opts_t *opts,
+                apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_stringbuf_t *reloaded = svn_stringbuf_create_empty(pool);
+
+  SVN_ERR(svn_test__create_repos(&repos, name, opts, pool));
+  SVN_ERR(svn_repos_load_fs7(repos, svn_stream_from_stringbuf(dump_data, pool),
+                             SVN_INVALID_REVNUM, SVN_INVALID_REVNUM,
+                             svn_repos_load_uuid_force, NULL,
+                             FALSE, FALSE, TRUE, FALSE, FALSE, jobs,
+                             NULL, NULL, NULL, NULL, pool));
+
+  SVN_ERR(svn_repos_dump_fs5(repos, svn_stream_from_stringbuf(reloaded, pool),
+                             SVN_INVALID_REVNUM, SVN_INVALID_REVNUM,
+                             FALSE, use_deltas, TRUE, TRUE, 1,
+                             NULL, NULL, NULL, NULL, NULL, NULL, pool));
+  SVN_TEST_ASSERT(svn_stringbuf_compare(dump_data, reloaded));
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_load_jobs(const svn_test_opts_t *opts,
+               apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_revnum_t youngest_rev;
+  svn_stringbuf_t *fulltexts = svn_stringbuf_create_empty(pool);
+  svn_stringbuf_t *deltas = svn_stringbuf_create_empty(pool);
+  const char *r6;
+  const char *node;
+
+  SVN_ERR(create_history_repos(&repos, "test-repo-load-jobs", opts, pool));
+
+  SVN_ERR(svn_repos_dump_fs5(repos, svn_stream_from_stringbuf(fulltexts,
+                                                              pool),
+                             SVN_INVALID_REVNUM, SVN_INVALID_REVNUM,
+                             FALSE, FALSE, TRUE, TRUE, 1,
+                             NULL, NULL, NULL, NULL, NULL, NULL, pool));
+  SVN_ERR(svn_repos_dump_fs5(repos, svn_stream_from_stringbuf(deltas, pool),
+                             SVN_INVALID_REVNUM, SVN_INVALID_REVNUM,
+                             FALSE, TRUE, TRUE, TRUE, 1,
+                             NULL, NULL, NULL, NULL, NULL, NULL, pool));
+
+  /* Loading with a read-ahead reproduces the original repository. */
+  SVN_ERR(check_load_jobs("test-repo-load-jobs-full", fulltexts, FALSE, 4,
+                          opts, pool));
+  SVN_ERR(check_load_jobs("test-repo-load-jobs-deltas", deltas, TRUE, 2,
+                          opts, pool));
+
+  /* Cut the stream in the first node record of r6.  All revisions
+     before that get loaded and the error is the same as without a
+     read-ahead. */
+  r6 = strstr(deltas->data, "Revision-number: 6\n");
+  SVN_TEST_ASSERT(r6);
+  node = strstr(r6, "Node-path: ");
+  SVN_TEST_ASSERT(node);
+  svn_stringbuf_remove(deltas, node - deltas->data + 5, deltas->len);
+
+  SVN_ERR(svn_test__create_repos(&repos, "test-repo-load-jobs-cut", opts,
+                                 pool));
+  SVN_TEST_ASSERT_ERROR(svn_repos_load_fs7(repos,
+                                           svn_stream_from_stringbuf(deltas,
+                                                                     pool),
+                                           SVN_INVALID_REVNUM,
+                                           SVN_INVALID_REVNUM,
+                                           svn_repos_load_uuid_force, NULL,
+                                           FALSE, FALSE, TRUE, FALSE, FALSE,
+                                           4, NULL, NULL, NULL, NULL, pool),
+                        SVN_ERR_INCOMPLETE_DATA);
+  SVN_ERR(svn_fs_youngest_rev(&youngest_rev, svn_repos_fs(repos), pool));
+  SVN_TEST_ASSERT(youngest_rev == 5);
+
+  return SVN_NO_ERROR;
+}
+
 /* The test table.  */
 
 static int max_threads = 4;
@@ -284,6 +485,10 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "test dumping with r0 mergeinfo"),
     SVN_TEST_OPTS_PASS(test_load_r0_mergeinfo,
                        "test loading with r0 mergeinfo"),
+    SVN_TEST_OPTS_PASS(test_dump_jobs,
+                       "test dumping with several threads"),
+    SVN_TEST_OPTS_PASS(test_load_jobs,
+                       "test loading with a separate parser thread"),
     SVN_TEST_NULL
   };
 
@@ -20,6 +20,7 @@
  * ====================================================================
  */
 
+#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -44,6 +45,7 @@
 
 /* be able to look into svn_config_t */
 #include "../../libsvn_subr/config_impl.h"
+#include "../../libsvn_repos/repos.h"
 
 #include "../svn_test_fs.h"
 
@@ -1093,9 +1095,9 @@ rmlocks(const svn_test_opts_t *opts,
     SVN_ERR(create_rmlocks_editor(&editor, &edit_baton, &removed, subpool));
 
     /* Report what we have. */
-    SVN_ERR(svn_repos_begin_report3(&report_baton, 1, repos, "/", "", NULL,
+    SVN_ERR(svn_repos_begin_report4(&report_baton, 1, repos, "/", "", NULL,
                                     FALSE, svn_depth_infinity, FALSE, FALSE,
-                                    editor, edit_baton, NULL, NULL, 1024,
+                                    editor, edit_baton, NULL, NULL, 1024, 1,
                                     subpool));
     SVN_ERR(svn_repos_set_path3(report_baton, "", 1,
                                 svn_depth_infinity,
@@ -1575,6 +1577,92 @@ test_authz_wildcard_performance(apr_pool_t *pool)
   return SVN_NO_ERROR;
 }
 
+/* Test that cached authz decisions match uncached ones, regardless of the
+ * order of the lookups. */
+static svn_error_t *
+test_authz_decision_cache(apr_pool_t *pool)
+{
+  svn_authz_t *authz_cfg;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  int i, k, r, u;
+
+  const char *contents =
+    "[groups]"                                                               NL
+    "team = userA, userB"                                                    NL
+    ""                                                                       NL
+    "[/]"                                                                    NL
+    "* = r"                                                                  NL
+    ""                                                                       NL
+    "[:glob:greek:/A/*/G]"                                                   NL
+    "* ="                                                                    NL
+    "userA = rw"                                                             NL
+    ""                                                                       NL
+    "[:glob:greek:/A/**/*a*]"                                                NL
+    "@team = rw"                                                             NL
+    ""                                                                       NL
+    "[:glob:greek:/**/lambda]"                                               NL
+    "* ="                                                                    NL
+    ""                                                                       NL
+    "[greek:/A/D]"                                                           NL
+    "userB ="                                                                NL
+    ""                                                                       NL
+    "[greek:/A/D/H/psi]"                                                     NL
+    "userB = r"                                                              NL;
+
+  const char *paths[] =
+    { "/", "/iota", "/A", "/A/mu", "/A/B", "/A/B/lambda", "/A/B/E",
+      "/A/B/E/alpha", "/A/B/E/beta", "/A/B/F", "/A/C", "/A/D",
+      "/A/D/gamma", "/A/D/G", "/A/D/G/pi", "/A/D/G/rho", "/A/D/G/tau",
+      "/A/D/H", "/A/D/H/chi", "/A/D/H/psi/", "/A/D/H/omega",
+      "//A/D/G/pi" };
+  const svn_repos_authz_access_t requests[] =
+    { svn_authz_read, svn_authz_write,
+      svn_authz_read | svn_authz_recursive,
+      svn_authz_write | svn_authz_recursive };
+  const char *users[] = { NULL, "userA", "userB", "userC" };
+  const int path_count = sizeof(paths) / sizeof(paths[0]);
+
+  SVN_ERR(authz_get_handle(&authz_cfg, contents, FALSE, pool));
+
+  /* Walk the paths forward, then backward, so that later lookups will
+   * be answered from decisions cached for both parents and children. */
+  for (u = 0; u < sizeof(users) / sizeof(users[0]); ++u)
+    for (k = 0; k < 2 * path_count; ++k)
+      for (r = 0; r < sizeof(requests) / sizeof(requests[0]); ++r)
+        {
+          svn_authz_t *uncached_cfg;
+          svn_boolean_t cached, uncached;
+          const char *path;
+
+          svn_pool_clear(iterpool);
+
+          i = k < path_count ? k : 2 * path_count - 1 - k;
+          path = paths[i];
+
+          SVN_ERR(svn_repos_authz_check_access(authz_cfg, "greek", path,
+                                               users[u], requests[r],
+                                               &cached, iterpool));
+
+          SVN_ERR(authz_get_handle(&uncached_cfg, contents, FALSE,
+                                   iterpool));
+          SVN_ERR(svn_repos_authz_check_access(uncached_cfg, "greek", path,
+                                               users[u], requests[r],
+                                               &uncached, iterpool));
+
+          if (cached != uncached)
+            return svn_error_createf(SVN_ERR_TEST_FAILED, NULL,
+                                     "Cached authz %s access type %d to "
+                                     "%s for user %s",
+                                     cached ? "grants" : "denies",
+                                     requests[r], path,
+                                     users[u] ? users[u] : "-");
+        }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
 /* Test that the latest definition wins, regardless of whether the ":glob:"
  * prefix has been given. */
 static svn_error_t *
@@ -3166,9 +3254,9 @@ reporter_depth_exclude(const svn_test_opts_t *opts,
   SVN_ERR(dir_delta_get_editor(&editor, &edit_baton, fs,
                                txn_root, "", subpool));
 
-  SVN_ERR(svn_repos_begin_report3(&report_baton, 2, repos, "/", "", NULL,
+  SVN_ERR(svn_repos_begin_report4(&report_baton, 2, repos, "/", "", NULL,
                                   TRUE, svn_depth_infinity, FALSE, FALSE,
-                                  editor, edit_baton, NULL, NULL, 0,
+                                  editor, edit_baton, NULL, NULL, 0, 1,
                                   subpool));
   SVN_ERR(svn_repos_set_path3(report_baton, "", 1,
                               svn_depth_infinity,
@@ -3224,9 +3312,9 @@ reporter_depth_exclude(const svn_test_opts_t *opts,
   SVN_ERR(dir_delta_get_editor(&editor, &edit_baton, fs,
                                txn_root, "", subpool));
 
-  SVN_ERR(svn_repos_begin_report3(&report_baton, 2, repos, "/", "", NULL,
+  SVN_ERR(svn_repos_begin_report4(&report_baton, 2, repos, "/", "", NULL,
                                   TRUE, svn_depth_infinity, FALSE, FALSE,
-                                  editor, edit_baton, NULL, NULL, 0,
+                                  editor, edit_baton, NULL, NULL, 0, 1,
                                   subpool));
   SVN_ERR(svn_repos_set_path3(report_baton, "", 1,
                               svn_depth_infinity,
@@ -4466,6 +4554,854 @@ test_list(const svn_test_opts_t *opts,
   return SVN_NO_ERROR;
 }
 
+/* Baton for verify_notify(). */
+struct verify_notify_baton_t
+{
+  /* The next revision expected to be reported as verified. */
+  svn_revnum_t expected_rev;
+
+  /* Whether svn_repos_notify_verify_end has been received. */
+  svn_boolean_t done;
+};
+
+/* Implement svn_repos_notify_func_t checking that revisions get reported
+   in order. */
+static void
+verify_notify(void *baton,
+              const svn_repos_notify_t *notify,
+              apr_pool_t *scratch_pool)
+{
+  struct verify_notify_baton_t *vnb = baton;
+
+  if (notify->action == svn_repos_notify_verify_rev_end)
+    {
+      /* Remember out-of-order revisions by making EXPECTED_REV invalid. */
+      if (notify->revision == vnb->expected_rev)
+        vnb->expected_rev++;
+      else
+        vnb->expected_rev = SVN_INVALID_REVNUM;
+    }
+  else if (notify->action == svn_repos_notify_verify_end)
+    {
+      vnb->done = TRUE;
+    }
+}
+
+static svn_error_t *
+test_verify_jobs(const svn_test_opts_t *opts,
+                 apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  svn_revnum_t youngest_rev = 0;
+  struct verify_notify_baton_t vnb;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  int i;
+
+  SVN_ERR(svn_test__create_repos(&repos, "test-repo-verify-jobs", opts,
+                                 pool));
+  fs = svn_repos_fs(repos);
+
+  /* r1: the greek tree; r2 .. r20: modify some of its files. */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__create_greek_tree(txn_root, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  for (i = 2; i <= 20; i++)
+    {
+      svn_pool_clear(iterpool);
+
+      SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, iterpool));
+      SVN_ERR(svn_fs_txn_root(&txn_root, txn, iterpool));
+      SVN_ERR(svn_test__set_file_contents(txn_root,
+                                          i % 2 ? "iota" : "A/mu",
+                                          apr_psprintf(iterpool, "r%d\n", i),
+                                          iterpool));
+      SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn,
+                                      iterpool));
+    }
+  svn_pool_destroy(iterpool);
+  SVN_TEST_ASSERT(youngest_rev == 20);
+
+  /* Verify with more workers than CPUs and check that notifications are
+     still in revision order. */
+  vnb.expected_rev = 0;
+  vnb.done = FALSE;
+  SVN_ERR(svn_repos_verify_fs4(repos, 0, youngest_rev, FALSE, FALSE, 4,
+                               verify_notify, &vnb, NULL, NULL, NULL, NULL,
+                               pool));
+  SVN_TEST_ASSERT(vnb.expected_rev == youngest_rev + 1);
+  SVN_TEST_ASSERT(vnb.done);
+
+  /* Partial ranges work as well. */
+  vnb.expected_rev = 5;
+  vnb.done = FALSE;
+  SVN_ERR(svn_repos_verify_fs4(repos, 5, 13, FALSE, FALSE, 3,
+                               verify_notify, &vnb, NULL, NULL, NULL, NULL,
+                               pool));
+  SVN_TEST_ASSERT(vnb.expected_rev == 14);
+  SVN_TEST_ASSERT(vnb.done);
+
+  return SVN_NO_ERROR;
+}
+
+/* Log entry receiver appending the revision to the svn_stringbuf_t in
+   BATON. */
+static svn_error_t *
+log_index_receiver(void *baton,
+                   svn_repos_log_entry_t *log_entry,
+                   apr_pool_t *scratch_pool)
+{
+  svn_stringbuf_t *revs = baton;
+
+  svn_stringbuf_appendcstr(revs, apr_psprintf(scratch_pool, " r%ld",
+                                              log_entry->revision));
+  return SVN_NO_ERROR;
+}
+
+/* Run a number of log queries against REPOS and return their results,
+   one line per query, in *RESULT. */
+static svn_error_t *
+run_log_index_queries(svn_stringbuf_t **result,
+                      svn_repos_t *repos,
+                      apr_pool_t *result_pool,
+                      apr_pool_t *scratch_pool)
+{
+  const char *paths[] = { "/A/B/E/alpha", "/A2/B/E/alpha", "/alpha2",
+                          "/A", "/A2", "/A/C", "A/C/x", "/A2/new",
+                          "A/D/G", "/iota", "/" };
+  const struct { svn_revnum_t start, end; int limit; } ranges[] = {
+    { SVN_INVALID_REVNUM, 0, 0 },
+    { 0, SVN_INVALID_REVNUM, 0 },
+    { 6, 2, 0 },
+    { SVN_INVALID_REVNUM, 1, 2 },
+  };
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  svn_revnum_t youngest;
+  int i, k;
+
+  SVN_ERR(svn_fs_youngest_rev(&youngest, svn_repos_fs(repos), scratch_pool));
+  *result = svn_stringbuf_create_empty(result_pool);
+
+  for (i = 0; i <= (int)(sizeof(paths) / sizeof(paths[0])); i++)
+    for (k = 0; k < (int)(sizeof(ranges) / sizeof(ranges[0])) * 2; k++)
+      {
+        apr_array_header_t *targets;
+        svn_boolean_t strict = k % 2;
+        svn_error_t *err;
+
+        svn_pool_clear(iterpool);
+
+        /* The last round queries two paths at once. */
+        targets = apr_array_make(iterpool, 2, sizeof(const char *));
+        if (i < (int)(sizeof(paths) / sizeof(paths[0])))
+          {
+            APR_ARRAY_PUSH(targets, const char *) = paths[i];
+          }
+        else
+          {
+            APR_ARRAY_PUSH(targets, const char *) = "/alpha2";
+            APR_ARRAY_PUSH(targets, const char *) = "/A/mu";
+          }
+
+        svn_stringbuf_appendcstr(*result,
+                                 apr_psprintf(iterpool, "\n%s %d:",
+                                              APR_ARRAY_IDX(targets, 0,
+                                                            const char *),
+                                              k));
+        err = svn_repos_get_logs5(repos, targets, ranges[k / 2].start,
+                                  ranges[k / 2].end, ranges[k / 2].limit,
+                                  strict, FALSE, NULL, NULL, NULL,
+                                  NULL, NULL, log_index_receiver, *result,
+                                  iterpool);
+
+        /* Not all paths exist in all ranges. */
+        if (err)
+          svn_stringbuf_appendcstr(*result,
+                                   apr_psprintf(iterpool, " E%d",
+                                                err->apr_err));
+        svn_error_clear(err);
+      }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_log_index(const svn_test_opts_t *opts,
+               apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root, *rev_root;
+  svn_revnum_t youngest_rev = 0, indexed_rev;
+  svn_stringbuf_t *expected, *actual;
+  svn_repos__log_index_t *log_index;
+  apr_pool_t *subpool = svn_pool_create(pool);
+
+  SVN_ERR(svn_test__create_repos(&repos, "test-repo-log-index", opts,
+                                 pool));
+  fs = svn_repos_fs(repos);
+
+  /* r1: the greek tree */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__create_greek_tree(txn_root, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r2: modify A/mu and A/B/E/alpha */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/mu", "r2\n", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/B/E/alpha", "r2\n",
+                                      pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r3: copy A to A2 */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_fs_revision_root(&rev_root, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_copy(rev_root, "A", txn_root, "A2", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r4: modify A2/B/E/alpha and add A2/new */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A2/B/E/alpha", "r4\n",
+                                      pool));
+  SVN_ERR(svn_fs_make_file(txn_root, "A2/new", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r5: copy A2/B/E/alpha to alpha2 and modify A/mu */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_fs_revision_root(&rev_root, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_copy(rev_root, "A2/B/E/alpha", txn_root, "alpha2", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/mu", "r5\n", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r6: modify alpha2 and delete A/D/H */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "alpha2", "r6\n", pool));
+  SVN_ERR(svn_fs_delete(txn_root, "A/D/H", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r7: replace A/C with a new directory containing A/C/x */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_fs_delete(txn_root, "A/C", pool));
+  SVN_ERR(svn_fs_make_dir(txn_root, "A/C", pool));
+  SVN_ERR(svn_fs_make_file(txn_root, "A/C/x", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* Build the index and make sure further commits keep it current. */
+  SVN_ERR(svn_repos__log_index_build(&indexed_rev, repos, NULL, NULL, pool));
+  SVN_TEST_ASSERT(indexed_rev == youngest_rev);
+
+  /* r8: modify A/B/lambda and alpha2 */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/B/lambda", "r8\n",
+                                      pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "alpha2", "r8\n", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  SVN_ERR(svn_repos__log_index_open(&log_index, &indexed_rev, repos,
+                                    subpool, subpool));
+  SVN_TEST_ASSERT(log_index != NULL);
+  SVN_TEST_ASSERT(indexed_rev == youngest_rev);
+  svn_pool_destroy(subpool);
+
+  /* Logs must be the same with and without the index. */
+  SVN_ERR(run_log_index_queries(&actual, repos, pool, pool));
+  SVN_ERR(svn_io_remove_file2(svn_dirent_join(svn_repos_db_env(repos, pool),
+                                              SVN_REPOS__LOG_INDEX_DB, pool),
+                              FALSE, pool));
+  SVN_ERR(run_log_index_queries(&expected, repos, pool, pool));
+
+  SVN_TEST_STRING_ASSERT(actual->data, expected->data);
+
+  return SVN_NO_ERROR;
+}
+
+/* Log entry receiver appending the revision and whether it has
+   children to the svn_stringbuf_t in BATON. */
+static svn_error_t *
+log_index_merged_receiver(void *baton,
+                          svn_repos_log_entry_t *log_entry,
+                          apr_pool_t *scratch_pool)
+{
+  svn_stringbuf_t *revs = baton;
+
+  svn_stringbuf_appendcstr(revs, apr_psprintf(scratch_pool, " r%ld%s%s",
+                                              log_entry->revision,
+                                              log_entry->has_children
+                                                ? "+" : "",
+                                              log_entry->subtractive_merge
+                                                ? "-" : ""));
+  return SVN_NO_ERROR;
+}
+
+/* File revision handler appending the path, revision and merge flag
+   to the svn_stringbuf_t in BATON. */
+static svn_error_t *
+log_index_file_rev_handler(void *baton,
+                           const char *path,
+                           svn_revnum_t rev,
+                           apr_hash_t *rev_props,
+                           svn_boolean_t result_of_merge,
+                           svn_txdelta_window_handler_t *delta_handler,
+                           void **delta_baton,
+                           apr_array_header_t *prop_diffs,
+                           apr_pool_t *pool)
+{
+  svn_stringbuf_t *revs = baton;
+
+  svn_stringbuf_appendcstr(revs, apr_psprintf(pool, " %s@%ld%s", path, rev,
+                                              result_of_merge ? "M" : ""));
+  return SVN_NO_ERROR;
+}
+
+/* Run a number of merge-aware log and file revision queries against
+   REPOS and return their results, one line per query, in *RESULT. */
+static svn_error_t *
+run_log_index_merge_queries(svn_stringbuf_t **result,
+                            svn_repos_t *repos,
+                            apr_pool_t *result_pool,
+                            apr_pool_t *scratch_pool)
+{
+  const char *paths[] = { "/trunk", "/branches/1.0.x", "/trunk/A/mu",
+                          "/branches/1.0.x/A/mu" };
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
+  int i;
+
+  *result = svn_stringbuf_create_empty(result_pool);
+
+  for (i = 0; i < (int)(sizeof(paths) / sizeof(paths[0])); i++)
+    {
+      apr_array_header_t *targets;
+
+      svn_pool_clear(iterpool);
+
+      targets = apr_array_make(iterpool, 1, sizeof(const char *));
+      APR_ARRAY_PUSH(targets, const char *) = paths[i];
+
+      svn_stringbuf_appendcstr(*result,
+                               apr_psprintf(iterpool, "\nlog %s:", paths[i]));
+      SVN_ERR(svn_repos_get_logs5(repos, targets, SVN_INVALID_REVNUM, 0, 0,
+                                  FALSE, TRUE, NULL, NULL, NULL, NULL, NULL,
+                                  log_index_merged_receiver, *result,
+                                  iterpool));
+
+      /* Only the last two paths are files. */
+      if (i >= 2)
+        {
+          svn_stringbuf_appendcstr(*result,
+                                   apr_psprintf(iterpool, "\nblame %s:",
+                                                paths[i]));
+          SVN_ERR(svn_repos_get_file_revs2(repos, paths[i], 0,
+                                           SVN_INVALID_REVNUM, TRUE,
+                                           NULL, NULL,
+                                           log_index_file_rev_handler,
+                                           *result, iterpool));
+        }
+    }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_log_index_mergeinfo(const svn_test_opts_t *opts,
+                         apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_revnum_t youngest_rev, indexed_rev;
+  svn_stringbuf_t *expected, *actual;
+
+  SVN_ERR(svn_test__create_blame_repository(&repos,
+                                            "test-repo-log-index-mergeinfo",
+                                            opts, pool));
+  SVN_ERR(svn_fs_youngest_rev(&youngest_rev, svn_repos_fs(repos), pool));
+
+  SVN_ERR(svn_repos__log_index_build(&indexed_rev, repos, NULL, NULL, pool));
+  SVN_TEST_ASSERT(indexed_rev == youngest_rev);
+
+  /* Merge-aware logs and blames must be the same with and without the
+     index. */
+  SVN_ERR(run_log_index_merge_queries(&actual, repos, pool, pool));
+  SVN_ERR(svn_io_remove_file2(svn_dirent_join(svn_repos_db_env(repos, pool),
+                                              SVN_REPOS__LOG_INDEX_DB, pool),
+                              FALSE, pool));
+  SVN_ERR(run_log_index_merge_queries(&expected, repos, pool, pool));
+
+  SVN_TEST_STRING_ASSERT(actual->data, expected->data);
+
+  return SVN_NO_ERROR;
+}
+
+/* Implements svn_file_blame_receiver_t.  Append a description of the
+   range to the svn_stringbuf_t * BATON. */
+static svn_error_t *
+file_blame_receiver(void *baton,
+                    apr_int64_t line_start,
+                    apr_int64_t line_count,
+                    svn_revnum_t revision,
+                    apr_hash_t *rev_props,
+                    apr_pool_t *pool)
+{
+  svn_stringbuf_t *result = baton;
+
+  svn_stringbuf_appendcstr(result,
+                           apr_psprintf(pool, "%d+%d:r%ld%s ",
+                                        (int)line_start, (int)line_count,
+                                        revision, rev_props ? "p" : ""));
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_get_file_blame(const svn_test_opts_t *opts,
+                    apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  svn_revnum_t youngest_rev;
+  svn_stringbuf_t *result = svn_stringbuf_create_empty(pool);
+  apr_array_header_t *diff_options;
+
+  SVN_ERR(svn_test__create_repos(&repos, "test-repo-get-file-blame", opts,
+                                 pool));
+  fs = svn_repos_fs(repos);
+
+  /* r1: the greek tree. */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__create_greek_tree(txn_root, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  /* r2 and r3: edit iota. */
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "iota", "a\nb\nc\n", pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+
+  SVN_ERR(svn_fs_begin_txn(&txn, fs, youngest_rev, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "iota", "a\nb \nc\nd\n",
+                                      pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+  SVN_TEST_ASSERT(youngest_rev == 3);
+
+  /* The whole history; revision properties come with the first range
+     of each revision only. */
+  SVN_ERR(svn_repos_get_file_blame(repos, "/iota", 0, 3, NULL, NULL, NULL,
+                                   file_blame_receiver, result,
+                                   NULL, NULL, pool));
+  SVN_TEST_STRING_ASSERT(result->data, "0+1:r2p 1+1:r3p 2+1:r2 3+1:r3 ");
+
+  /* Lines older than the start revision are not attributed. */
+  svn_stringbuf_setempty(result);
+  SVN_ERR(svn_repos_get_file_blame(repos, "/iota", 3, 3, NULL, NULL, NULL,
+                                   file_blame_receiver, result,
+                                   NULL, NULL, pool));
+  SVN_TEST_STRING_ASSERT(result->data, "0+1:r-1 1+1:r3p 2+1:r-1 3+1:r3 ");
+
+  /* Whitespace changes can be ignored. */
+  diff_options = apr_array_make(pool, 1, sizeof(const char *));
+  APR_ARRAY_PUSH(diff_options, const char *) = "-w";
+  svn_stringbuf_setempty(result);
+  SVN_ERR(svn_repos_get_file_blame(repos, "/iota", 0, 3, diff_options,
+                                   NULL, NULL, file_blame_receiver, result,
+                                   NULL, NULL, pool));
+  SVN_TEST_STRING_ASSERT(result->data, "0+3:r2p 3+1:r3p ");
+
+  /* Reversed ranges are rejected. */
+  SVN_TEST_ASSERT_ERROR(svn_repos_get_file_blame(repos, "/iota", 3, 1, NULL,
+                                                 NULL, NULL,
+                                                 file_blame_receiver, result,
+                                                 NULL, NULL, pool),
+                        SVN_ERR_INCORRECT_PARAMS);
+
+  return SVN_NO_ERROR;
+}
+
+/* Baton for the editor created by get_recording_editor(), used as edit,
+   directory and file baton alike. */
+typedef struct recording_baton_t
+{
+  /* Where to append the description of each editor call (const char *). */
+  apr_array_header_t *log;
+
+  /* The node this baton belongs to. */
+  const char *path;
+} recording_baton_t;
+
+/* Append the description given by FMT to the log of BATON. */
+static void
+record(recording_baton_t *baton,
+       const char *fmt,
+       ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  APR_ARRAY_PUSH(baton->log, const char *)
+    = apr_pvsprintf(baton->log->pool, fmt, ap);
+  va_end(ap);
+}
+
+/* Return a new baton for PATH sharing the log of PARENT. */
+static recording_baton_t *
+make_recording_baton(recording_baton_t *parent,
+                     const char *path)
+{
+  recording_baton_t *baton = apr_pcalloc(parent->log->pool, sizeof(*baton));
+
+  baton->log = parent->log;
+  baton->path = apr_pstrdup(parent->log->pool, path);
+
+  return baton;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_open_root(void *edit_baton,
+                    svn_revnum_t base_revision,
+                    apr_pool_t *dir_pool,
+                    void **root_baton)
+{
+  record(edit_baton, "open_root %ld", base_revision);
+  *root_baton = make_recording_baton(edit_baton, "");
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_delete_entry(const char *path,
+                       svn_revnum_t revision,
+                       void *parent_baton,
+                       apr_pool_t *pool)
+{
+  record(parent_baton, "delete_entry %s %ld", path, revision);
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_add_directory(const char *path,
+                        void *parent_baton,
+                        const char *copyfrom_path,
+                        svn_revnum_t copyfrom_revision,
+                        apr_pool_t *dir_pool,
+                        void **child_baton)
+{
+  record(parent_baton, "add_directory %s %s %ld", path,
+         copyfrom_path ? copyfrom_path : "-", copyfrom_revision);
+  *child_baton = make_recording_baton(parent_baton, path);
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_open_directory(const char *path,
+                         void *parent_baton,
+                         svn_revnum_t base_revision,
+                         apr_pool_t *dir_pool,
+                         void **child_baton)
+{
+  record(parent_baton, "open_directory %s %ld", path, base_revision);
+  *child_baton = make_recording_baton(parent_baton, path);
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_change_prop(void *baton,
+                      const char *name,
+                      const svn_string_t *value,
+                      apr_pool_t *pool)
+{
+  recording_baton_t *rb = baton;
+
+  /* Only the presence of entry props matters here. */
+  if (svn_property_kind2(name) == svn_prop_entry_kind)
+    record(rb, "change_prop %s %s", rb->path, name);
+  else
+    record(rb, "change_prop %s %s %s", rb->path, name,
+           value ? value->data : "(deleted)");
+
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_close_node(void *baton,
+                     apr_pool_t *pool)
+{
+  recording_baton_t *rb = baton;
+
+  record(rb, "close %s", rb->path);
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_add_file(const char *path,
+                   void *parent_baton,
+                   const char *copyfrom_path,
+                   svn_revnum_t copyfrom_revision,
+                   apr_pool_t *file_pool,
+                   void **file_baton)
+{
+  record(parent_baton, "add_file %s %s %ld", path,
+         copyfrom_path ? copyfrom_path : "-", copyfrom_revision);
+  *file_baton = make_recording_baton(parent_baton, path);
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_open_file(const char *path,
+                    void *parent_baton,
+                    svn_revnum_t base_revision,
+                    apr_pool_t *file_pool,
+                    void **file_baton)
+{
+  record(parent_baton, "open_file %s %ld", path, base_revision);
+  *file_baton = make_recording_baton(parent_baton, path);
+  return SVN_NO_ERROR;
+}
+
+/* Implement svn_txdelta_window_handler_t by recording WINDOW in the
+   recording_baton_t BATON. */
+static svn_error_t *
+recording_window_handler(svn_txdelta_window_t *window,
+                         void *baton)
+{
+  recording_baton_t *rb = baton;
+  svn_stringbuf_t *ops;
+  svn_checksum_t *checksum;
+  int i;
+
+  if (!window)
+    {
+      record(rb, "window %s end", rb->path);
+      return SVN_NO_ERROR;
+    }
+
+  ops = svn_stringbuf_create_empty(rb->log->pool);
+  for (i = 0; i < window->num_ops; ++i)
+    svn_stringbuf_appendcstr(ops,
+                             apr_psprintf(rb->log->pool,
+                                          " %d:%" APR_SIZE_T_FMT
+                                          ":%" APR_SIZE_T_FMT,
+                                          window->ops[i].action_code,
+                                          window->ops[i].offset,
+                                          window->ops[i].length));
+
+  SVN_ERR(svn_checksum(&checksum, svn_checksum_md5,
+                       window->new_data ? window->new_data->data : "",
+                       window->new_data ? window->new_data->len : 0,
+                       rb->log->pool));
+
+  record(rb, "window %s %" SVN_FILESIZE_T_FMT " %" APR_SIZE_T_FMT
+         " %" APR_SIZE_T_FMT " %s%s",
+         rb->path, window->sview_offset, window->sview_len,
+         window->tview_len, svn_checksum_to_cstring(checksum, rb->log->pool),
+         ops->data);
+
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_apply_textdelta(void *file_baton,
+                          const char *base_checksum,
+                          apr_pool_t *pool,
+                          svn_txdelta_window_handler_t *handler,
+                          void **handler_baton)
+{
+  recording_baton_t *rb = file_baton;
+
+  record(rb, "apply_textdelta %s %s", rb->path,
+         base_checksum ? base_checksum : "-");
+  *handler = recording_window_handler;
+  *handler_baton = rb;
+
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_close_file(void *file_baton,
+                     const char *text_checksum,
+                     apr_pool_t *pool)
+{
+  recording_baton_t *rb = file_baton;
+
+  record(rb, "close_file %s %s", rb->path,
+         text_checksum ? text_checksum : "-");
+  return SVN_NO_ERROR;
+}
+
+/* An svn_delta_editor_t function. */
+static svn_error_t *
+recording_close_edit(void *edit_baton,
+                     apr_pool_t *pool)
+{
+  record(edit_baton, "close_edit");
+  return SVN_NO_ERROR;
+}
+
+/* Set *EDITOR and *EDIT_BATON to an editor appending a description of
+   every call to LOG (const char *), allocated in LOG's pool. */
+static void
+get_recording_editor(const svn_delta_editor_t **editor,
+                     void **edit_baton,
+                     apr_array_header_t *log)
+{
+  svn_delta_editor_t *e = svn_delta_default_editor(log->pool);
+  recording_baton_t *baton = apr_pcalloc(log->pool, sizeof(*baton));
+
+  e->open_root = recording_open_root;
+  e->delete_entry = recording_delete_entry;
+  e->add_directory = recording_add_directory;
+  e->open_directory = recording_open_directory;
+  e->change_dir_prop = recording_change_prop;
+  e->close_directory = recording_close_node;
+  e->add_file = recording_add_file;
+  e->open_file = recording_open_file;
+  e->apply_textdelta = recording_apply_textdelta;
+  e->change_file_prop = recording_change_prop;
+  e->close_file = recording_close_file;
+  e->close_edit = recording_close_edit;
+
+  baton->log = log;
+  baton->path = "";
+
+  *editor = e;
+  *edit_baton = baton;
+}
+
+/* Report an update of REPOS from revision 1 to revision 2 using
+   PREFETCH_JOBS and return the editor drive in *LOG, allocated in POOL. */
+static svn_error_t *
+record_update_report(apr_array_header_t **log,
+                     svn_repos_t *repos,
+                     int prefetch_jobs,
+                     apr_pool_t *pool)
+{
+  const svn_delta_editor_t *editor;
+  void *edit_baton;
+  void *report_baton;
+
+  *log = apr_array_make(pool, 0, sizeof(const char *));
+  get_recording_editor(&editor, &edit_baton, *log);
+
+  SVN_ERR(svn_repos_begin_report4(&report_baton, 2, repos, "/", "", NULL,
+                                  TRUE, svn_depth_infinity, FALSE, FALSE,
+                                  editor, edit_baton, NULL, NULL, 0,
+                                  prefetch_jobs, pool));
+  SVN_ERR(svn_repos_set_path3(report_baton, "", 1, svn_depth_infinity,
+                              FALSE, NULL, pool));
+  SVN_ERR(svn_repos_finish_report(report_baton, pool));
+
+  return SVN_NO_ERROR;
+}
+
+/* Test that prefetching text deltas does not change the editor drive. */
+static svn_error_t *
+test_report_prefetch(const svn_test_opts_t *opts,
+                     apr_pool_t *pool)
+{
+  svn_repos_t *repos;
+  svn_fs_t *fs;
+  svn_fs_txn_t *txn;
+  svn_fs_root_t *txn_root;
+  svn_revnum_t youngest_rev;
+  svn_stringbuf_t *big = svn_stringbuf_create_empty(pool);
+  apr_array_header_t *serial, *prefetched;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  int i;
+
+  SVN_ERR(svn_test__create_repos(&repos, "test-repo-report-prefetch",
+                                 opts, pool));
+  fs = svn_repos_fs(repos);
+
+  /* Many more files than there may be prefetched at once, and one file
+     whose delta spans many windows. */
+  for (i = 0; i < 100000; ++i)
+    svn_stringbuf_appendcstr(big, apr_psprintf(iterpool, "line %d\n", i));
+
+  SVN_ERR(svn_fs_begin_txn2(&txn, fs, 0, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  SVN_ERR(svn_test__create_greek_tree(txn_root, pool));
+  SVN_ERR(svn_fs_make_dir(txn_root, "A/many", pool));
+  for (i = 0; i < 50; ++i)
+    {
+      const char *path = apr_psprintf(iterpool, "A/many/f%02d", i);
+
+      SVN_ERR(svn_fs_make_file(txn_root, path, iterpool));
+      SVN_ERR(svn_test__set_file_contents(txn_root, path,
+                                          apr_psprintf(iterpool,
+                                                       "file %d\n", i),
+                                          iterpool));
+    }
+  SVN_ERR(svn_fs_make_file(txn_root, "A/big", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/big", big->data, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+  SVN_TEST_ASSERT(youngest_rev == 1);
+
+  SVN_ERR(svn_fs_begin_txn2(&txn, fs, 1, 0, pool));
+  SVN_ERR(svn_fs_txn_root(&txn_root, txn, pool));
+  for (i = 0; i < 50; ++i)
+    {
+      svn_pool_clear(iterpool);
+      SVN_ERR(svn_test__set_file_contents(txn_root,
+                                          apr_psprintf(iterpool,
+                                                       "A/many/f%02d", i),
+                                          apr_psprintf(iterpool,
+                                                       "file %d\nchanged\n",
+                                                       i),
+                                          iterpool));
+    }
+  SVN_ERR(svn_test__set_file_contents(txn_root, "iota", "new iota\n", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/D/G/rho", "new rho\n",
+                                      pool));
+  SVN_ERR(svn_fs_delete(txn_root, "A/B/lambda", pool));
+  SVN_ERR(svn_fs_make_file(txn_root, "A/B/new", pool));
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/B/new", "new file\n",
+                                      pool));
+  SVN_ERR(svn_fs_change_node_prop(txn_root, "A/D/gamma", "prop",
+                                  svn_string_create("value", pool), pool));
+  svn_stringbuf_insert(big, 0, "changed\n", 8);
+  svn_stringbuf_appendcstr(big, "changed\n");
+  SVN_ERR(svn_test__set_file_contents(txn_root, "A/big", big->data, pool));
+  SVN_ERR(svn_repos_fs_commit_txn(NULL, repos, &youngest_rev, txn, pool));
+  SVN_TEST_ASSERT(youngest_rev == 2);
+  svn_pool_destroy(iterpool);
+
+  SVN_ERR(record_update_report(&serial, repos, 1, pool));
+  SVN_ERR(record_update_report(&prefetched, repos, 4, pool));
+
+  for (i = 0; i < serial->nelts && i < prefetched->nelts; ++i)
+    SVN_TEST_STRING_ASSERT(APR_ARRAY_IDX(prefetched, i, const char *),
+                           APR_ARRAY_IDX(serial, i, const char *));
+  SVN_TEST_INT_ASSERT(prefetched->nelts, serial->nelts);
+
+  return SVN_NO_ERROR;
+}
+
 /* The test table.  */
 
 static int max_threads = 4;
@@ -4537,6 +5473,18 @@ static struct svn_test_descriptor_t test_funcs[] =
                    "optional authz wildcard performance test"),
     SVN_TEST_OPTS_PASS(test_list,
                        "test svn_repos_list"),
+    SVN_TEST_OPTS_PASS(test_verify_jobs,
+                       "test svn_repos_verify_fs4 with multiple jobs"),
+    SVN_TEST_OPTS_PASS(test_log_index,
+                       "test log with the changed-paths log index"),
+    SVN_TEST_OPTS_PASS(test_log_index_mergeinfo,
+                       "test merge-aware log and blame with the log index"),
+    SVN_TEST_OPTS_PASS(test_get_file_blame,
+                       "test svn_repos_get_file_blame"),
+    SVN_TEST_PASS2(test_authz_decision_cache,
+                   "test authz decision cache"),
+    SVN_TEST_OPTS_PASS(test_report_prefetch,
+                       "test reporter with text delta prefetching"),
     SVN_TEST_NULL
   };
 
@@ -22,12 +22,15 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <apr_general.h>
 #include <apr_lib.h>
 #include <apr_time.h>
+#include <apr_thread_proc.h>
 
 #include "svn_pools.h"
+#include "svn_dirent_uri.h"
 
 #include "private/svn_cache.h"
 #include "svn_private_config.h"
@@ -590,6 +593,328 @@ test_membuffer_unaligned_fixed_keys(apr_pool_t *pool)
   return SVN_NO_ERROR;
 }
 
+/* Baton for cache_thread_func(). */
+typedef struct cache_thread_baton_t
+{
+  /* The cache shared between all threads. */
+  svn_cache__t *cache;
+
+  /* Seed for the pseudo-random key sequence. */
+  apr_uint32_t seed;
+
+  /* Result of the thread's work. */
+  svn_error_t *err;
+} cache_thread_baton_t;
+
+/* Read and write random items in BATON->CACHE.  The value for any given
+ * key is always the same, so any reader that sees a different value got
+ * a corrupted copy.  Use POOL for temporary allocations.
+ */
+static svn_error_t *
+exercise_cache(cache_thread_baton_t *baton,
+               apr_pool_t *pool)
+{
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  apr_uint32_t seed = baton->seed;
+  int i;
+
+  for (i = 0; i < 20000; ++i)
+    {
+      int key_no, k;
+      const char *key;
+      svn_stringbuf_t *expected;
+      svn_stringbuf_t *value;
+      svn_boolean_t found;
+
+      svn_pool_clear(iterpool);
+
+      seed = seed * 1103515245 + 12345;
+      key_no = (int)((seed >> 8) % 1000);
+      key = apr_psprintf(iterpool, "key %d", key_no);
+
+      expected = svn_stringbuf_create_empty(iterpool);
+      for (k = 0; k <= key_no % 64; ++k)
+        svn_stringbuf_appendcstr(expected, key);
+
+      if (i % 4 == 0)
+        {
+          SVN_ERR(svn_cache__set(baton->cache, key, expected, iterpool));
+        }
+      else
+        {
+          SVN_ERR(svn_cache__get((void **)&value, &found, baton->cache, key,
+                                 iterpool));
+          if (found && !svn_stringbuf_compare(value, expected))
+            return svn_error_createf(SVN_ERR_TEST_FAILED, NULL,
+                                     "wrong value for '%s'", key);
+        }
+    }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
+#if APR_HAS_THREADS
+static void *
+APR_THREAD_FUNC cache_thread_func(apr_thread_t *tid, void *data)
+{
+  cache_thread_baton_t *baton = data;
+  apr_pool_t *pool = svn_pool_create(NULL);
+
+  baton->err = exercise_cache(baton, pool);
+
+  svn_pool_destroy(pool);
+  apr_thread_exit(tid, APR_SUCCESS);
+
+  return NULL;
+}
+#endif
+
+#define APR_ERR(expr)                           \
+  do {                                          \
+    apr_status_t status = (expr);               \
+    if (status)                                 \
+      return svn_error_wrap_apr(status, NULL);  \
+  } while (0)
+
+static svn_error_t *
+test_membuffer_concurrency(apr_pool_t *pool)
+{
+#if APR_HAS_THREADS
+  /* Many threads reading and writing small, heavily contended segments.
+     Readers will mostly take the lock-free path and race with writers. */
+  enum { THREAD_COUNT = 8 };
+  svn_cache__t *cache;
+  svn_membuffer_t *membuffer;
+  apr_thread_t *threads[THREAD_COUNT];
+  cache_thread_baton_t batons[THREAD_COUNT];
+  svn_error_t *err = SVN_NO_ERROR;
+  int i;
+
+  SVN_ERR(svn_cache__membuffer_cache_create(&membuffer, 1024 * 1024,
+                                            256 * 1024, 16,
+                                            TRUE, TRUE, pool));
+  SVN_ERR(svn_cache__create_membuffer_cache(&cache,
+                                            membuffer,
+                                            NULL,
+                                            NULL,
+                                            APR_HASH_KEY_STRING,
+                                            "cache:",
+                                            SVN_CACHE__MEMBUFFER_DEFAULT_PRIORITY,
+                                            TRUE,
+                                            FALSE,
+                                            pool, pool));
+
+  for (i = 0; i < THREAD_COUNT; ++i)
+    {
+      batons[i].cache = cache;
+      batons[i].seed = (apr_uint32_t)i * 7919;
+      batons[i].err = SVN_NO_ERROR;
+
+      APR_ERR(apr_thread_create(&threads[i], NULL, cache_thread_func,
+                                &batons[i], pool));
+    }
+
+  /* wait for the threads to finish */
+  for (i = 0; i < THREAD_COUNT; ++i)
+    {
+      apr_status_t retval;
+      APR_ERR(apr_thread_join(&retval, threads[i]));
+      err = svn_error_compose_create(err, batons[i].err);
+    }
+
+  SVN_ERR(err);
+#endif
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_membuffer_shared(apr_pool_t *pool)
+{
+  svn_cache__t *cache;
+  svn_membuffer_t *membuffer;
+  svn_boolean_t found;
+  svn_revnum_t *answer;
+  apr_array_header_t *mutexes;
+
+  SVN_ERR(svn_cache__membuffer_cache_create_shared(&membuffer, 10*1024, 1,
+                                                   0, TRUE, pool));
+
+  /* Segments share a small set of locks. */
+  mutexes = svn_cache__membuffer_get_mutexes(membuffer, pool);
+  SVN_TEST_ASSERT(mutexes->nelts > 0 && mutexes->nelts <= 8);
+
+  SVN_ERR(svn_cache__create_membuffer_cache(&cache,
+                                            membuffer,
+                                            serialize_revnum,
+                                            deserialize_revnum,
+                                            APR_HASH_KEY_STRING,
+                                            "cache:",
+                                            SVN_CACHE__MEMBUFFER_DEFAULT_PRIORITY,
+                                            FALSE,
+                                            FALSE,
+                                            pool, pool));
+
+  SVN_ERR(basic_cache_test(cache, FALSE, pool));
+
+#if APR_HAS_FORK
+  {
+    /* Data written by a child process must be visible to its parent. */
+    apr_proc_t proc;
+    int exitcode;
+    apr_exit_why_e why;
+    apr_status_t status = apr_proc_fork(&proc, pool);
+
+    if (status == APR_INCHILD)
+      {
+        svn_revnum_t forty = 40;
+        svn_error_t *err = svn_cache__membuffer_child_init(membuffer, pool);
+        if (!err)
+          err = svn_cache__set(cache, "forty", &forty, pool);
+
+        exit(err ? EXIT_FAILURE : EXIT_SUCCESS);
+      }
+
+    if (status != APR_INPARENT)
+      return svn_error_wrap_apr(status, "fork failed");
+
+    status = apr_proc_wait(&proc, &exitcode, &why, APR_WAIT);
+    if (status != APR_CHILD_DONE)
+      return svn_error_wrap_apr(status, "wait failed");
+    SVN_TEST_ASSERT(APR_PROC_CHECK_EXIT(why) && exitcode == EXIT_SUCCESS);
+
+    SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "forty", pool));
+    SVN_TEST_ASSERT(found);
+    SVN_TEST_ASSERT(*answer == 40);
+  }
+#endif
+
+  /* Entries written by this process must still be there. */
+  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "thirty", pool));
+  SVN_TEST_ASSERT(found);
+  SVN_TEST_ASSERT(*answer == 30);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_disk_cache(apr_pool_t *pool)
+{
+  svn_cache__disk_t *disk;
+  svn_cache__t *l1, *cache, *other_cache;
+  const char *dir;
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_stringbuf_t *value;
+  svn_boolean_t found;
+  int i, k, hits;
+
+#if !APR_HAS_MMAP
+  return svn_error_create(SVN_ERR_TEST_SKIPPED, NULL,
+                          "disk caches require memory-mapped files");
+#endif
+
+  SVN_ERR(svn_test_make_sandbox_dir(&dir, "cache-test-disk", pool));
+  SVN_ERR(svn_cache__get_disk_cache(&disk,
+                                    svn_dirent_join(dir, "cache", pool),
+                                    0x100000, pool));
+
+  /* L1 can hold only a single entry, i.e. we will mostly hit the disk. */
+  SVN_ERR(svn_cache__create_inprocess(&l1, serialize_revnum,
+                                      deserialize_revnum,
+                                      APR_HASH_KEY_STRING, 1, 1, TRUE, "",
+                                      pool));
+  SVN_ERR(svn_cache__create_disk_backed(&cache, l1, disk,
+                                        serialize_revnum, deserialize_revnum,
+                                        APR_HASH_KEY_STRING, "revnums",
+                                        pool));
+  SVN_ERR(basic_cache_test(cache, FALSE, pool));
+
+  /* A new first level, as after a restart, still finds the data. */
+  SVN_ERR(svn_cache__create_inprocess(&l1, serialize_revnum,
+                                      deserialize_revnum,
+                                      APR_HASH_KEY_STRING, 1, 1, TRUE, "",
+                                      pool));
+  SVN_ERR(svn_cache__create_disk_backed(&cache, l1, disk,
+                                        serialize_revnum, deserialize_revnum,
+                                        APR_HASH_KEY_STRING, "revnums",
+                                        pool));
+  SVN_ERR(svn_cache__has_key(&found, cache, "twenty", pool));
+  SVN_TEST_ASSERT(found);
+
+  /* Different prefixes don't see each other's data. */
+  SVN_ERR(svn_cache__create_inprocess(&l1, serialize_revnum,
+                                      deserialize_revnum,
+                                      APR_HASH_KEY_STRING, 1, 1, TRUE, "",
+                                      pool));
+  SVN_ERR(svn_cache__create_disk_backed(&other_cache, l1, disk,
+                                        serialize_revnum, deserialize_revnum,
+                                        APR_HASH_KEY_STRING, "other",
+                                        pool));
+  SVN_ERR(svn_cache__has_key(&found, other_cache, "twenty", pool));
+  SVN_TEST_ASSERT(!found);
+
+  /* Write much more than fits into the file, with no L1 at all.
+   * Whatever we still find must be correct and the latest entry must be
+   * there. */
+  SVN_ERR(svn_cache__create_null(&l1, "l1", pool));
+  SVN_ERR(svn_cache__create_disk_backed(&cache, l1, disk, NULL, NULL,
+                                        APR_HASH_KEY_STRING, "strings",
+                                        pool));
+  for (i = 0; i < 1000; ++i)
+    {
+      svn_pool_clear(iterpool);
+      value = svn_stringbuf_create_empty(iterpool);
+      for (k = 0; k < 1000; ++k)
+        svn_stringbuf_appendcstr(value, apr_psprintf(iterpool, "%d,", i));
+
+      SVN_ERR(svn_cache__set(cache, apr_psprintf(iterpool, "%d", i), value,
+                             iterpool));
+    }
+
+  for (i = 0, hits = 0; i < 1000; ++i)
+    {
+      svn_stringbuf_t *expected;
+
+      svn_pool_clear(iterpool);
+      expected = svn_stringbuf_create_empty(iterpool);
+      for (k = 0; k < 1000; ++k)
+        svn_stringbuf_appendcstr(expected,
+                                 apr_psprintf(iterpool, "%d,", i));
+
+      SVN_ERR(svn_cache__get((void **)&value, &found, cache,
+                             apr_psprintf(iterpool, "%d", i), iterpool));
+      if (found)
+        {
+          SVN_TEST_ASSERT(svn_stringbuf_compare(value, expected));
+          ++hits;
+        }
+      else
+        {
+          SVN_TEST_ASSERT(i < 999);
+        }
+    }
+
+  SVN_TEST_ASSERT(hits > 0 && hits < 1000);
+
+  /* Overly long keys don't make it to disk. */
+  value = svn_stringbuf_create("long", pool);
+  {
+    char *long_key = apr_palloc(pool, 2000 + 1);
+    memset(long_key, 'x', 2000);
+    long_key[2000] = '\0';
+
+    SVN_ERR(svn_cache__set(cache, long_key, value, pool));
+    SVN_ERR(svn_cache__has_key(&found, cache, long_key, pool));
+    SVN_TEST_ASSERT(!found);
+  }
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
 
 /* The test table.  */
 
@@ -616,6 +941,14 @@ static struct svn_test_descriptor_t test_funcs[] =
                    "test membuffer cache with unaligned string keys"),
     SVN_TEST_PASS2(test_membuffer_unaligned_fixed_keys,
                    "test membuffer cache with unaligned fixed keys"),
+    SVN_TEST_SKIP2(test_membuffer_concurrency,
+                   ! APR_HAS_THREADS,
+                   "concurrent membuffer cache access"),
+    SVN_TEST_PASS2(test_disk_cache,
+                   "persistent disk cache as second level"),
+    SVN_TEST_SKIP2(test_membuffer_shared,
+                   ! APR_HAS_SHARED_MEMORY,
+                   "membuffer cache in shared memory"),
     SVN_TEST_NULL
   };
 
@@ -22,11 +22,16 @@
  */
 
 #include <apr_pools.h>
+#include <apr_sha1.h>
 
 #include <zlib.h>
 
 #include "svn_error.h"
 #include "svn_io.h"
+#include "svn_pools.h"
+#include "svn_sorts.h"
+
+#include "private/svn_subr_private.h"
 
 #include "../svn_test.h"
 
@@ -68,6 +73,9 @@ test_checksum_parse(apr_pool_t *pool)
   SVN_ERR(checksum_parse_kind("cafeaffe",
                               svn_checksum_fnv1a_32x4,
                               "modified fnv-1a", pool));
+  SVN_ERR(checksum_parse_kind("0123456789abcdef",
+                              svn_checksum_fnv1a_64x4,
+                              "64 bit modified fnv-1a", pool));
 
   return SVN_NO_ERROR;
 }
@@ -76,7 +84,7 @@ static svn_error_t *
 test_checksum_empty(apr_pool_t *pool)
 {
   svn_checksum_kind_t kind;
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     {
       svn_checksum_t *checksum;
       char data = '\0';
@@ -119,7 +127,7 @@ static svn_error_t *
 zero_match(apr_pool_t *pool)
 {
   svn_checksum_kind_t kind;
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     SVN_ERR(zero_match_kind(kind, pool));
 
   return SVN_NO_ERROR;
@@ -132,7 +140,7 @@ zero_cross_match(apr_pool_t *pool)
   svn_checksum_kind_t k_kind;
 
   for (i_kind = svn_checksum_md5;
-       i_kind <= svn_checksum_fnv1a_32x4;
+       i_kind <= svn_checksum_fnv1a_64x4;
        ++i_kind)
     {
       svn_checksum_t *i_zero;
@@ -143,7 +151,7 @@ zero_cross_match(apr_pool_t *pool)
       SVN_ERR(svn_checksum(&i_A, i_kind, "A", 1, pool));
 
       for (k_kind = svn_checksum_md5;
-           k_kind <= svn_checksum_fnv1a_32x4;
+           k_kind <= svn_checksum_fnv1a_64x4;
            ++k_kind)
         {
           svn_checksum_t *k_zero;
@@ -258,7 +266,7 @@ static svn_error_t *
 test_serialization(apr_pool_t *pool)
 {
   svn_checksum_kind_t kind;
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     {
       const svn_checksum_t *parsed_checksum;
       svn_checksum_t *checksum = svn_checksum_empty_checksum(kind, pool);
@@ -278,7 +286,7 @@ static svn_error_t *
 test_checksum_parse_all_zero(apr_pool_t *pool)
 {
   svn_checksum_kind_t kind;
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     {
       svn_checksum_t *checksum;
       const char *hex;
@@ -302,7 +310,7 @@ test_checksummed_stream_read(apr_pool_t *pool)
   const svn_string_t *str = svn_string_create("abcde", pool);
   svn_checksum_kind_t kind;
 
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     {
       svn_stream_t *stream;
       svn_checksum_t *expected_checksum;
@@ -333,7 +341,7 @@ test_checksummed_stream_reset(apr_pool_t *pool)
   const svn_string_t *str = svn_string_create("abcde", pool);
   svn_checksum_kind_t kind;
 
-  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_32x4; ++kind)
+  for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
     {
       svn_stream_t *stream;
       svn_checksum_t *expected_checksum;
@@ -368,6 +376,87 @@ test_checksummed_stream_reset(apr_pool_t *pool)
 
 static int max_threads = 1;
 
+static svn_error_t *
+test_checksum_incremental(apr_pool_t *pool)
+{
+  apr_size_t len;
+  apr_size_t size = 100000;
+  unsigned char *data = apr_palloc(pool, size);
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  svn_checksum_t *checksum, *expected;
+  svn_checksum_ctx_t *md5_ctx, *sha1_ctx;
+
+  for (len = 0; len < size; ++len)
+    data[len] = (unsigned char)(len * 7 + (len >> 8));
+
+  /* Well-known SHA-1 test vector. */
+  SVN_ERR(svn_checksum(&checksum, svn_checksum_sha1, "abc", 3, pool));
+  SVN_TEST_STRING_ASSERT(svn_checksum_to_cstring_display(checksum, pool),
+                         "a9993e364706816aba3e25717850c26c9cd0d89d");
+
+  /* Cover all padding cases plus a few multi-block inputs. */
+  for (len = 0; len < size; len = len < 300 ? len + 1 : len * 3)
+    {
+      svn_checksum_kind_t kind;
+      apr_sha1_ctx_t apr_ctx;
+      unsigned char apr_digest[APR_SHA1_DIGESTSIZE];
+
+      svn_pool_clear(iterpool);
+
+      /* Our SHA-1 may use CPU extensions; compare it with APR's. */
+      apr_sha1_init(&apr_ctx);
+      apr_sha1_update_binary(&apr_ctx, data, (unsigned int)len);
+      apr_sha1_final(apr_digest, &apr_ctx);
+
+      SVN_ERR(svn_checksum(&checksum, svn_checksum_sha1, data, len,
+                           iterpool));
+      SVN_TEST_ASSERT(memcmp(checksum->digest, apr_digest,
+                             APR_SHA1_DIGESTSIZE) == 0);
+
+      /* Feeding the data in odd-sized pieces and through two contexts at
+         once must give the same results as a single call. */
+      for (kind = svn_checksum_md5; kind <= svn_checksum_fnv1a_64x4; ++kind)
+        {
+          svn_checksum_ctx_t *ctx1 = svn_checksum_ctx_create(kind, iterpool);
+          svn_checksum_ctx_t *ctx2 = svn_checksum_ctx_create(kind, iterpool);
+          svn_checksum_t *actual1, *actual2;
+          apr_size_t pos, chunk;
+
+          SVN_ERR(svn_checksum(&expected, kind, data, len, iterpool));
+
+          for (pos = 0, chunk = 1; pos < len; pos += chunk, chunk += 13)
+            SVN_ERR(svn_checksum_update(ctx1, data + pos,
+                                        MIN(chunk, len - pos)));
+
+          SVN_ERR(svn_checksum__update_pair(ctx2, NULL, data, len / 2));
+          SVN_ERR(svn_checksum__update_pair(ctx2, NULL, data + len / 2,
+                                            len - len / 2));
+
+          SVN_ERR(svn_checksum_final(&actual1, ctx1, iterpool));
+          SVN_ERR(svn_checksum_final(&actual2, ctx2, iterpool));
+          SVN_TEST_ASSERT(svn_checksum_match(expected, actual1));
+          SVN_TEST_ASSERT(svn_checksum_match(expected, actual2));
+        }
+    }
+
+  /* MD5 and SHA-1 in a single pass. */
+  md5_ctx = svn_checksum_ctx_create(svn_checksum_md5, pool);
+  sha1_ctx = svn_checksum_ctx_create(svn_checksum_sha1, pool);
+  SVN_ERR(svn_checksum__update_pair(md5_ctx, sha1_ctx, data, size));
+
+  SVN_ERR(svn_checksum_final(&checksum, md5_ctx, pool));
+  SVN_ERR(svn_checksum(&expected, svn_checksum_md5, data, size, pool));
+  SVN_TEST_ASSERT(svn_checksum_match(expected, checksum));
+
+  SVN_ERR(svn_checksum_final(&checksum, sha1_ctx, pool));
+  SVN_ERR(svn_checksum(&expected, svn_checksum_sha1, data, size, pool));
+  SVN_TEST_ASSERT(svn_checksum_match(expected, checksum));
+
+  svn_pool_destroy(iterpool);
+
+  return SVN_NO_ERROR;
+}
+
 static struct svn_test_descriptor_t test_funcs[] =
   {
     SVN_TEST_NULL,
@@ -389,6 +478,8 @@ static struct svn_test_descriptor_t test_funcs[] =
                    "read from checksummed stream"),
     SVN_TEST_PASS2(test_checksummed_stream_reset,
                    "reset checksummed stream"),
+    SVN_TEST_PASS2(test_checksum_incremental,
+                   "incremental and paired checksum updates"),
     SVN_TEST_NULL
   };
 
@@ -849,6 +849,24 @@ test_string_matching(apr_pool_t *pool)
       {"x_234567890abcdef", "x1234567890abcdef", 1, 15},
       {"1234567890abcdefx", "1234567890abcdex", 15, 1},
 
+      /* longer matches, exercising the chunky code paths */
+      {"1234567890abcdefghijklmnopqrstuvwxyzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 40, 40},
+      {"1234567890abcdef_hijklmnopqrstuvwxyzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 16, 23},
+      {"1234567890abcdefg_ijklmnopqrstuvwxyzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 17, 22},
+      {"1234567890abcdefghijklmnopqrstuvw_yzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 33, 6},
+      {"123456_890abcdefghijklmnopqrstuvwxyzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 6, 33},
+      {"1234567890abcdefghijklm_opqrstuvwxyzABCD",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCD", 23, 16},
+      {"x1234567890abcdefghijklmnopqrstuvwxyzABCD",
+       "y1234567890abcdefghijklmnopqrstuvwxyzABCD", 0, 40},
+      {"1234567890abcdefghijklmnopqrstuvwxyzABCDx",
+       "1234567890abcdefghijklmnopqrstuvwxyzABCDy", 40, 0},
+
       /* list terminator */
       {NULL}
     };
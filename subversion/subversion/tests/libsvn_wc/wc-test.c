@@ -21,9 +21,12 @@
  * ====================================================================
  */
 
+#include <string.h>
+
 #include <apr_pools.h>
 #include <apr_general.h>
 #include <apr_md5.h>
+#include <apr_strings.h>
 
 #define SVN_DEPRECATED
 
@@ -35,6 +38,7 @@
 #include "svn_wc.h"
 #include "svn_client.h"
 #include "svn_hash.h"
+#include "svn_props.h"
 
 #include "utils.h"
 
@@ -493,6 +497,303 @@ test_internal_file_modified(const svn_test_opts_t *opts, apr_pool_t *pool)
   return SVN_NO_ERROR;
 }
 
+/* Status callback appending a description of STATUS to the array
+   BATON. */
+static svn_error_t *
+collect_status(void *baton,
+               const char *local_abspath,
+               const svn_wc_status3_t *status,
+               apr_pool_t *scratch_pool)
+{
+  apr_array_header_t *statuses = baton;
+
+  APR_ARRAY_PUSH(statuses, const char *)
+    = apr_psprintf(statuses->pool, "%s %d %d", local_abspath,
+                   status->node_status, status->text_status);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_walk_status_threads(const svn_test_opts_t *opts, apr_pool_t *pool)
+{
+  svn_test__sandbox_t b;
+  apr_array_header_t *serial = apr_array_make(pool, 0, sizeof(const char *));
+  apr_array_header_t *parallel = apr_array_make(pool, 0,
+                                                sizeof(const char *));
+  int i;
+
+  SVN_ERR(svn_test__sandbox_create(&b, "walk_status_threads", opts, pool));
+  SVN_ERR(sbox_add_and_commit_greek_tree(&b));
+
+  /* Give the walk some variety: modified, missing, unversioned and
+     added nodes at several levels. */
+  SVN_ERR(sbox_file_write(&b, "A/B/lambda", "modified lambda"));
+  SVN_ERR(sbox_file_write(&b, "A/D/G/unversioned", "unversioned"));
+  SVN_ERR(svn_io_remove_dir2(sbox_wc_path(&b, "A/D/H"), FALSE,
+                             NULL, NULL, pool));
+  SVN_ERR(sbox_wc_mkdir(&b, "A/C/new"));
+  SVN_ERR(sbox_wc_mkdir(&b, "A/C/new/deeper"));
+  SVN_ERR(sbox_file_write(&b, "A/C/new/deeper/file", "file"));
+
+  b.wc_ctx->db->status_threads = 0;
+  SVN_ERR(svn_wc_walk_status(b.wc_ctx, b.wc_abspath, svn_depth_infinity,
+                             TRUE, TRUE, FALSE, NULL,
+                             collect_status, serial, NULL, NULL, pool));
+
+  b.wc_ctx->db->status_threads = 4;
+  SVN_ERR(svn_wc_walk_status(b.wc_ctx, b.wc_abspath, svn_depth_infinity,
+                             TRUE, TRUE, FALSE, NULL,
+                             collect_status, parallel, NULL, NULL, pool));
+
+  SVN_TEST_INT_ASSERT(parallel->nelts, serial->nelts);
+  for (i = 0; i < serial->nelts; i++)
+    SVN_TEST_STRING_ASSERT(APR_ARRAY_IDX(parallel, i, const char *),
+                           APR_ARRAY_IDX(serial, i, const char *));
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_walk_status_threads_skipped(const svn_test_opts_t *opts,
+                                 apr_pool_t *pool)
+{
+  svn_test__sandbox_t b;
+  apr_array_header_t *serial = apr_array_make(pool, 0, sizeof(const char *));
+  apr_array_header_t *parallel = apr_array_make(pool, 0,
+                                                sizeof(const char *));
+  apr_array_header_t *ignores = apr_array_make(pool, 1, sizeof(const char *));
+  apr_pool_t *iterpool = svn_pool_create(pool);
+  int i;
+
+  SVN_ERR(svn_test__sandbox_create(&b, "walk_status_threads_skipped", opts,
+                                   pool));
+  SVN_ERR(sbox_add_and_commit_greek_tree(&b));
+
+  /* Many more subdirectories than the workers may read ahead, none of
+     which has anything to read: versioned ones missing from disk, and
+     ignored unversioned ones. */
+  for (i = 0; i < 200; i++)
+    {
+      const char *name;
+
+      svn_pool_clear(iterpool);
+
+      name = apr_psprintf(iterpool, "A/C/missing%03d", i);
+      SVN_ERR(sbox_wc_mkdir(&b, name));
+      SVN_ERR(svn_io_remove_dir2(sbox_wc_path(&b, name), FALSE,
+                                 NULL, NULL, iterpool));
+
+      name = apr_psprintf(iterpool, "A/C/ignored%03d", i);
+      SVN_ERR(svn_io_make_dir_recursively(sbox_wc_path(&b, name), iterpool));
+    }
+  svn_pool_destroy(iterpool);
+
+  /* Modifications after them must still be found. */
+  SVN_ERR(sbox_file_write(&b, "A/D/G/rho", "modified rho"));
+  SVN_ERR(sbox_file_write(&b, "iota", "modified iota"));
+  APR_ARRAY_PUSH(ignores, const char *) = "ignored*";
+
+  b.wc_ctx->db->status_threads = 0;
+  SVN_ERR(svn_wc_walk_status(b.wc_ctx, b.wc_abspath, svn_depth_infinity,
+                             TRUE, FALSE, FALSE, ignores,
+                             collect_status, serial, NULL, NULL, pool));
+
+  b.wc_ctx->db->status_threads = 2;
+  SVN_ERR(svn_wc_walk_status(b.wc_ctx, b.wc_abspath, svn_depth_infinity,
+                             TRUE, FALSE, FALSE, ignores,
+                             collect_status, parallel, NULL, NULL, pool));
+
+  SVN_TEST_INT_ASSERT(parallel->nelts, serial->nelts);
+  for (i = 0; i < serial->nelts; i++)
+    SVN_TEST_STRING_ASSERT(APR_ARRAY_IDX(parallel, i, const char *),
+                           APR_ARRAY_IDX(serial, i, const char *));
+
+  return SVN_NO_ERROR;
+}
+
+/* Baton for find_text_status(). */
+struct find_status_baton_t
+{
+  const char *local_abspath;
+  enum svn_wc_status_kind text_status;
+};
+
+/* Status callback setting the text status in BATON, a struct
+   find_status_baton_t, if LOCAL_ABSPATH is the path it looks for. */
+static svn_error_t *
+find_text_status(void *baton,
+                 const char *local_abspath,
+                 const svn_wc_status3_t *status,
+                 apr_pool_t *scratch_pool)
+{
+  struct find_status_baton_t *fsb = baton;
+
+  if (strcmp(local_abspath, fsb->local_abspath) == 0)
+    fsb->text_status = status->text_status;
+
+  return SVN_NO_ERROR;
+}
+
+/* Walk the status of the working copy in B and set *TEXT_STATUS to the
+   text status of RELPATH. */
+static svn_error_t *
+walk_text_status(enum svn_wc_status_kind *text_status,
+                 svn_test__sandbox_t *b,
+                 const char *relpath,
+                 apr_pool_t *pool)
+{
+  struct find_status_baton_t fsb;
+
+  fsb.local_abspath = sbox_wc_path(b, relpath);
+  fsb.text_status = svn_wc_status_none;
+
+  SVN_ERR(svn_wc_walk_status(b->wc_ctx, b->wc_abspath, svn_depth_infinity,
+                             TRUE, TRUE, FALSE, NULL,
+                             find_text_status, &fsb, NULL, NULL, pool));
+
+  *text_status = fsb.text_status;
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_walk_status_journal(const svn_test_opts_t *opts, apr_pool_t *pool)
+{
+  svn_test__sandbox_t b;
+  enum svn_wc_status_kind text_status;
+
+  SVN_ERR(svn_test__sandbox_create(&b, "walk_status_journal", opts, pool));
+  SVN_ERR(sbox_add_and_commit_greek_tree(&b));
+  b.wc_ctx->db->status_journal = TRUE;
+
+  /* The first walk reads everything and fills the cache. */
+  SVN_ERR(sbox_file_write(&b, ".svn/status-journal", "gen1\n"));
+  SVN_ERR(walk_text_status(&text_status, &b, "A/B/lambda", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_normal);
+
+  /* A change the watcher did not report goes unnoticed... */
+  SVN_ERR(sbox_file_write(&b, "A/B/lambda", "modified lambda\n"));
+  SVN_ERR(walk_text_status(&text_status, &b, "A/B/lambda", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_normal);
+
+  /* ... until it is in the journal. */
+  SVN_ERR(sbox_file_write(&b, ".svn/status-journal", "gen1\nA/B/lambda\n"));
+  SVN_ERR(walk_text_status(&text_status, &b, "A/B/lambda", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_modified);
+
+  /* The modification is now in the cache, so it is still found when
+     the journal has nothing new to report. */
+  SVN_ERR(walk_text_status(&text_status, &b, "A/B/lambda", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_modified);
+
+  /* A new generation makes the walk read everything again. */
+  SVN_ERR(sbox_file_write(&b, "A/D/gamma", "modified gamma\n"));
+  SVN_ERR(sbox_file_write(&b, ".svn/status-journal", "gen2\n"));
+  SVN_ERR(walk_text_status(&text_status, &b, "A/D/gamma", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_modified);
+
+  /* A watcher may only see the root of a subtree that is moved in, so a
+     modification deep below it must still be found. */
+  SVN_ERR(svn_io_file_rename2(sbox_wc_path(&b, "A/D"),
+                              sbox_wc_path(&b, "D-moved"), FALSE, pool));
+  SVN_ERR(sbox_file_write(&b, "D-moved/G/rho", "modified rho\n"));
+  SVN_ERR(svn_io_file_rename2(sbox_wc_path(&b, "D-moved"),
+                              sbox_wc_path(&b, "A/D"), FALSE, pool));
+  SVN_ERR(sbox_file_write(&b, ".svn/status-journal", "gen2\nA/D\n"));
+  SVN_ERR(walk_text_status(&text_status, &b, "A/D/G/rho", pool));
+  SVN_TEST_ASSERT(text_status == svn_wc_status_modified);
+
+  return SVN_NO_ERROR;
+}
+
+/* Status callback counting the nodes in the int BATON that are not
+   normal. */
+static svn_error_t *
+count_changed_status(void *baton,
+                     const char *local_abspath,
+                     const svn_wc_status3_t *status,
+                     apr_pool_t *scratch_pool)
+{
+  int *changed = baton;
+
+  if (status->node_status != svn_wc_status_normal
+      || status->text_status != svn_wc_status_normal)
+    (*changed)++;
+
+  return SVN_NO_ERROR;
+}
+
+/* Check that the size and timestamp recorded for RELPATH in B match the
+   file on disk. */
+static svn_error_t *
+check_recorded_fileinfo(svn_test__sandbox_t *b,
+                        const char *relpath,
+                        apr_pool_t *pool)
+{
+  const char *local_abspath = sbox_wc_path(b, relpath);
+  const svn_io_dirent2_t *dirent;
+  svn_filesize_t recorded_size;
+  apr_time_t recorded_time;
+
+  SVN_ERR(svn_wc__db_read_info(NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                               NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                               NULL, NULL, NULL, &recorded_size,
+                               &recorded_time, NULL, NULL, NULL, NULL,
+                               NULL, NULL, NULL, NULL,
+                               b->wc_ctx->db, local_abspath, pool, pool));
+  SVN_ERR(svn_io_stat_dirent2(&dirent, local_abspath, TRUE, FALSE,
+                              pool, pool));
+
+  SVN_TEST_INT_ASSERT(recorded_size, dirent->filesize);
+  SVN_TEST_ASSERT(recorded_time == dirent->mtime);
+
+  return SVN_NO_ERROR;
+}
+
+static svn_error_t *
+test_parallel_install(const svn_test_opts_t *opts, apr_pool_t *pool)
+{
+  svn_test__sandbox_t b;
+  svn_stringbuf_t *contents;
+  int changed = 0;
+
+  SVN_ERR(svn_test__sandbox_create(&b, "parallel_install", opts, pool));
+  SVN_ERR(sbox_add_and_commit_greek_tree(&b));
+
+  /* Make one of the files need translation. */
+  SVN_ERR(sbox_wc_propset(&b, SVN_PROP_KEYWORDS, "Revision", "iota"));
+  SVN_ERR(sbox_file_write(&b, "iota", "$Revision$\n"));
+  SVN_ERR(sbox_wc_commit(&b, ""));
+
+  b.wc_ctx->db->install_threads = 4;
+
+  /* Remove all files and get them back through the work queue. */
+  SVN_ERR(sbox_wc_update(&b, "", 0));
+  SVN_ERR(sbox_wc_update(&b, "", 2));
+
+  SVN_ERR(svn_stringbuf_from_file2(&contents, sbox_wc_path(&b, "iota"),
+                                   pool));
+  SVN_TEST_STRING_ASSERT(contents->data, "$Revision: 2 $\n");
+  SVN_ERR(svn_stringbuf_from_file2(&contents,
+                                   sbox_wc_path(&b, "A/D/G/pi"), pool));
+  SVN_TEST_STRING_ASSERT(contents->data, "This is the file 'pi'.\n");
+
+  /* The recorded file info must match the installed files.  Status would
+     fall back to comparing the contents, so check it directly as well. */
+  SVN_ERR(check_recorded_fileinfo(&b, "iota", pool));
+  SVN_ERR(check_recorded_fileinfo(&b, "A/mu", pool));
+  SVN_ERR(check_recorded_fileinfo(&b, "A/B/lambda", pool));
+  SVN_ERR(check_recorded_fileinfo(&b, "A/D/G/pi", pool));
+  SVN_ERR(check_recorded_fileinfo(&b, "A/D/H/omega", pool));
+  SVN_ERR(svn_wc_walk_status(b.wc_ctx, b.wc_abspath, svn_depth_infinity,
+                             TRUE, TRUE, FALSE, NULL,
+                             count_changed_status, &changed,
+                             NULL, NULL, pool));
+  SVN_TEST_INT_ASSERT(changed, 0);
+
+  return SVN_NO_ERROR;
+}
+
 /* ---------------------------------------------------------------------- */
 /* The list of test functions */
 
@@ -515,6 +816,14 @@ static struct svn_test_descriptor_t test_funcs[] =
                        "test legacy commit2"),
     SVN_TEST_OPTS_PASS(test_internal_file_modified,
                        "test internal_file_modified"),
+    SVN_TEST_OPTS_PASS(test_walk_status_threads,
+                       "status walk with parallel directory reads"),
+    SVN_TEST_OPTS_PASS(test_walk_status_threads_skipped,
+                       "parallel status walk over many empty subdirs"),
+    SVN_TEST_OPTS_PASS(test_walk_status_journal,
+                       "status walk using the status journal"),
+    SVN_TEST_OPTS_PASS(test_parallel_install,
+                       "install files on several threads"),
     SVN_TEST_NULL
   };
 